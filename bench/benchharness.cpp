@@ -0,0 +1,255 @@
+#include "benchharness.hpp"
+
+#include <ptx/core/platform/time.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace ptx {
+namespace bench {
+
+namespace {
+
+constexpr uint64_t kMaxIterations = 1000000000ull;
+
+uint64_t TimeBody(const Harness::Body& body, uint64_t iterations) {
+    const uint64_t start = ptx::Time::Nanos();
+    body(iterations);
+    return ptx::Time::Nanos() - start;
+}
+
+std::string Escape(const std::string& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+// Reads "key":"value" from one flat JSON object.
+bool FindString(const std::string& object, const char* key, std::string& value) {
+    const std::string pattern = std::string("\"") + key + "\":\"";
+    size_t start = object.find(pattern);
+    if (start == std::string::npos) return false;
+    start += pattern.size();
+
+    value.clear();
+    for (size_t i = start; i < object.size(); ++i) {
+        if (object[i] == '\\' && i + 1 < object.size()) {
+            value += object[++i];
+        } else if (object[i] == '"') {
+            return true;
+        } else {
+            value += object[i];
+        }
+    }
+    return false;
+}
+
+// Reads "key":number from one flat JSON object.
+bool FindNumber(const std::string& object, const char* key, double& value) {
+    const std::string pattern = std::string("\"") + key + "\":";
+    const size_t start = object.find(pattern);
+    if (start == std::string::npos) return false;
+
+    const char* begin = object.c_str() + start + pattern.size();
+    char* end = nullptr;
+    value = std::strtod(begin, &end);
+    return end != begin;
+}
+
+}  // namespace
+
+// === Registration ===
+
+void Harness::Add(const char* group, const char* name, Body body) {
+    entries.push_back(Entry{group, name, std::move(body)});
+}
+
+void Harness::SetFilter(const std::string& text) {
+    filter = text;
+}
+
+void Harness::SetSampleCount(uint32_t count) {
+    sampleCount = std::max<uint32_t>(count, 1);
+}
+
+void Harness::SetMinSampleNanos(uint64_t nanos) {
+    minSampleNanos = nanos;
+}
+
+bool Harness::Matches(const Entry& entry) const {
+    return filter.empty() || (entry.group + "/" + entry.name).find(filter) != std::string::npos;
+}
+
+void Harness::List(FILE* out) const {
+    for (const Entry& entry : entries) {
+        if (Matches(entry)) std::fprintf(out, "%s/%s\n", entry.group.c_str(), entry.name.c_str());
+    }
+}
+
+// === Running ===
+
+std::vector<Result> Harness::Run(FILE* log) const {
+    std::vector<Result> results;
+
+    for (const Entry& entry : entries) {
+        if (!Matches(entry)) continue;
+
+        // Calibrate: grow the operation count until one sample is long enough to time.
+        // The calibration runs double as warm-up for caches and lazily built tables.
+        uint64_t iterations = 1;
+        for (;;) {
+            const uint64_t elapsed = TimeBody(entry.body, iterations);
+            if (elapsed >= minSampleNanos || iterations >= kMaxIterations) break;
+
+            const double scale = elapsed > 0 ? 1.2 * static_cast<double>(minSampleNanos) / elapsed : 10.0;
+            const uint64_t grown = static_cast<uint64_t>(iterations * std::min(std::max(scale, 2.0), 100.0));
+            iterations = std::min(grown, kMaxIterations);
+        }
+
+        std::vector<double> perOp(sampleCount);
+        for (uint32_t s = 0; s < sampleCount; ++s) {
+            perOp[s] = static_cast<double>(TimeBody(entry.body, iterations)) / iterations;
+        }
+
+        double mean = 0.0;
+        for (double value : perOp) mean += value;
+        mean /= sampleCount;
+
+        double variance = 0.0;
+        for (double value : perOp) variance += (value - mean) * (value - mean);
+
+        std::vector<double> sorted = perOp;
+        std::sort(sorted.begin(), sorted.end());
+
+        Result result;
+        result.group = entry.group;
+        result.name = entry.name;
+        result.nsPerOp = sorted[sampleCount / 2];
+        result.minNsPerOp = sorted.front();
+        result.maxNsPerOp = sorted.back();
+        result.stddevNs = std::sqrt(variance / sampleCount);
+        result.iterations = iterations;
+        result.samples = sampleCount;
+        results.push_back(result);
+
+        if (log) {
+            std::fprintf(log, "%-44s %14.1f ns/op  (min %.1f, +/- %.1f, %llu ops x %u)\n",
+                         result.Key().c_str(), result.nsPerOp, result.minNsPerOp, result.stddevNs,
+                         static_cast<unsigned long long>(iterations), sampleCount);
+            std::fflush(log);
+        }
+    }
+
+    return results;
+}
+
+// === JSON ===
+
+std::string Harness::ToJson(const std::vector<Result>& results) {
+    std::string json = "{\"version\":1,\"results\":[";
+
+    char number[256];
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        json += i == 0 ? "\n" : ",\n";
+        json += "{\"group\":\"" + Escape(r.group) + "\",\"name\":\"" + Escape(r.name) + "\",";
+        std::snprintf(number, sizeof(number),
+                      "\"ns_per_op\":%.3f,\"min_ns\":%.3f,\"max_ns\":%.3f,\"stddev_ns\":%.3f,"
+                      "\"iterations\":%llu,\"samples\":%u}",
+                      r.nsPerOp, r.minNsPerOp, r.maxNsPerOp, r.stddevNs,
+                      static_cast<unsigned long long>(r.iterations), static_cast<unsigned>(r.samples));
+        json += number;
+    }
+
+    json += "\n]}\n";
+    return json;
+}
+
+bool Harness::LoadJson(const std::string& path, std::vector<Result>& results) {
+    std::ifstream file(path);
+    if (!file) return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    const size_t array = text.find("\"results\"");
+    if (array == std::string::npos) return false;
+
+    // Result entries are flat objects, so each one ends at the next closing brace.
+    results.clear();
+    size_t position = text.find('{', array);
+    while (position != std::string::npos) {
+        const size_t end = text.find('}', position);
+        if (end == std::string::npos) break;
+
+        const std::string object = text.substr(position, end - position + 1);
+        Result result;
+        double value = 0.0;
+        if (FindString(object, "group", result.group) && FindString(object, "name", result.name) &&
+            FindNumber(object, "ns_per_op", result.nsPerOp)) {
+            if (FindNumber(object, "min_ns", value)) result.minNsPerOp = value;
+            if (FindNumber(object, "max_ns", value)) result.maxNsPerOp = value;
+            if (FindNumber(object, "stddev_ns", value)) result.stddevNs = value;
+            if (FindNumber(object, "iterations", value)) result.iterations = static_cast<uint64_t>(value);
+            if (FindNumber(object, "samples", value)) result.samples = static_cast<uint32_t>(value);
+            results.push_back(result);
+        }
+
+        position = text.find('{', end);
+    }
+
+    return !results.empty();
+}
+
+// === Comparison ===
+
+int Harness::Compare(const std::vector<Result>& baseline, const std::vector<Result>& current,
+                     double threshold, FILE* out) {
+    std::map<std::string, const Result*> stored;
+    for (const Result& result : baseline) stored[result.Key()] = &result;
+
+    int regressions = 0;
+    std::fprintf(out, "%-44s %14s %14s %9s\n", "benchmark", "baseline ns", "current ns", "change");
+
+    for (const Result& result : current) {
+        auto it = stored.find(result.Key());
+        if (it == stored.end()) {
+            std::fprintf(out, "%-44s %14s %14.1f %9s  new\n", result.Key().c_str(), "-", result.nsPerOp, "-");
+            continue;
+        }
+
+        const double before = it->second->nsPerOp;
+        const double change = before > 0.0 ? result.nsPerOp / before - 1.0 : 0.0;
+        const char* verdict = "";
+        if (change > threshold) {
+            verdict = "  REGRESSION";
+            ++regressions;
+        } else if (change < -threshold) {
+            verdict = "  improved";
+        }
+
+        std::fprintf(out, "%-44s %14.1f %14.1f %+8.1f%%%s\n", result.Key().c_str(), before, result.nsPerOp,
+                     change * 100.0, verdict);
+        stored.erase(it);
+    }
+
+    for (const auto& missing : stored) {
+        std::fprintf(out, "%-44s %14.1f %14s %9s  missing\n", missing.first.c_str(), missing.second->nsPerOp, "-", "-");
+    }
+
+    std::fprintf(out, "%d regression(s) beyond %.1f%%\n", regressions, threshold * 100.0);
+    return regressions;
+}
+
+}  // namespace bench
+}  // namespace ptx
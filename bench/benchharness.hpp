@@ -0,0 +1,154 @@
+/**
+ * @file benchharness.hpp
+ * @brief Small self-contained timing harness for the ptx_bench microbenchmarks.
+ *
+ * Each benchmark is a callback that performs a requested number of operations. The
+ * harness calibrates the operation count until one sample takes long enough to time
+ * reliably, collects several samples and reports the median time per operation. Results
+ * can be written as JSON and compared against a stored baseline to flag regressions.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ptx {
+namespace bench {
+
+/**
+ * @brief Keeps a computed value alive so the optimizer cannot discard the work producing it.
+ * @param value Value to treat as observed.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* bytes = reinterpret_cast<const volatile char*>(&value);
+    (void)bytes[0];
+#endif
+}
+
+/**
+ * @brief Timing summary for one benchmark.
+ */
+struct Result {
+    std::string group;       ///< Suite the benchmark belongs to, e.g. "raster".
+    std::string name;        ///< Benchmark name, unique within the group.
+    double nsPerOp = 0.0;    ///< Median nanoseconds per operation across samples.
+    double minNsPerOp = 0.0; ///< Fastest sample.
+    double maxNsPerOp = 0.0; ///< Slowest sample.
+    double stddevNs = 0.0;   ///< Standard deviation across samples.
+    uint64_t iterations = 0; ///< Operations per sample after calibration.
+    uint32_t samples = 0;    ///< Number of timed samples.
+
+    /** @brief Gets "group/name", the key used to match baselines. */
+    std::string Key() const { return group + "/" + name; }
+};
+
+/**
+ * @class Harness
+ * @brief Registers, runs and reports microbenchmarks.
+ */
+class Harness {
+public:
+    /**
+     * @brief Benchmark body.
+     *
+     * Runs @p iterations operations; setup belongs outside the body so it is not timed.
+     */
+    using Body = std::function<void(uint64_t iterations)>;
+
+    /**
+     * @brief Registers a benchmark.
+     * @param group Suite name.
+     * @param name Benchmark name.
+     * @param body Callback performing the requested number of operations.
+     */
+    void Add(const char* group, const char* name, Body body);
+
+    /**
+     * @brief Restricts Run() to benchmarks whose "group/name" contains @p text.
+     * @param text Substring to match, empty for all.
+     */
+    void SetFilter(const std::string& text);
+
+    /**
+     * @brief Sets how many timed samples each benchmark takes.
+     * @param count Sample count, at least 1.
+     */
+    void SetSampleCount(uint32_t count);
+
+    /**
+     * @brief Sets the minimum duration of one sample; calibration grows the operation count to reach it.
+     * @param nanos Minimum sample time in nanoseconds.
+     */
+    void SetMinSampleNanos(uint64_t nanos);
+
+    /**
+     * @brief Prints the registered benchmarks that pass the filter.
+     * @param out Output stream.
+     */
+    void List(FILE* out) const;
+
+    /**
+     * @brief Runs every benchmark that passes the filter.
+     * @param log Stream for progress lines, or nullptr for silence.
+     * @return One result per benchmark, in registration order.
+     */
+    std::vector<Result> Run(FILE* log) const;
+
+    /**
+     * @brief Serializes results as JSON.
+     * @param results Results to write.
+     * @return JSON object text with a "results" array.
+     */
+    static std::string ToJson(const std::vector<Result>& results);
+
+    /**
+     * @brief Reads results written by ToJson().
+     * @param path File to read.
+     * @param results Receives the parsed results.
+     * @return False if the file cannot be read or holds no results.
+     */
+    static bool LoadJson(const std::string& path, std::vector<Result>& results);
+
+    /**
+     * @brief Compares results against a baseline and prints a table.
+     *
+     * A benchmark regresses when its median is slower than the baseline by more than
+     * @p threshold (0.1 = 10%). Benchmarks missing from either side are listed but never fail.
+     *
+     * @param baseline Stored baseline results.
+     * @param current Fresh results.
+     * @param threshold Allowed relative slowdown.
+     * @param out Output stream for the table.
+     * @return Number of regressions.
+     */
+    static int Compare(const std::vector<Result>& baseline, const std::vector<Result>& current,
+                       double threshold, FILE* out);
+
+private:
+    struct Entry {
+        std::string group;
+        std::string name;
+        Body body;
+    };
+
+    std::vector<Entry> entries;
+    std::string filter;
+    uint32_t sampleCount = 9;
+    uint64_t minSampleNanos = 20000000ull;
+
+    bool Matches(const Entry& entry) const;
+};
+
+}  // namespace bench
+}  // namespace ptx
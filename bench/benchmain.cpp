@@ -0,0 +1,109 @@
+/**
+ * @file benchmain.cpp
+ * @brief Command line entry point for ptx_bench.
+ *
+ * Usage: ptx_bench [--list] [--filter text] [--samples n] [--min-time-ms ms]
+ *                  [--json out.json] [--compare baseline.json] [--threshold pct]
+ *
+ * With --compare the process exits with status 1 when any benchmark is slower than the
+ * baseline by more than the threshold (default 10%), so it can gate CI or a local script.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#include "benchsuites.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace {
+
+void PrintUsage(const char* program) {
+    std::fprintf(stderr,
+                 "usage: %s [--list] [--filter text] [--samples n] [--min-time-ms ms]\n"
+                 "          [--json out.json] [--compare baseline.json] [--threshold pct]\n",
+                 program);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ptx::bench::Harness harness;
+    ptx::bench::RegisterRenderBenchmarks(harness);
+    ptx::bench::RegisterSignalBenchmarks(harness);
+    ptx::bench::RegisterMathBenchmarks(harness);
+    ptx::bench::RegisterSceneBenchmarks(harness);
+    ptx::bench::RegisterPhysicsBenchmarks(harness);
+
+    bool list = false;
+    std::string filter;
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 0.10;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--list") == 0) {
+            list = true;
+        } else if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+            harness.SetFilter(filter);
+        } else if (std::strcmp(arg, "--samples") == 0 && hasValue) {
+            harness.SetSampleCount(static_cast<uint32_t>(std::atoi(argv[++i])));
+        } else if (std::strcmp(arg, "--min-time-ms") == 0 && hasValue) {
+            harness.SetMinSampleNanos(static_cast<uint64_t>(std::atof(argv[++i]) * 1000000.0));
+        } else if (std::strcmp(arg, "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        } else if (std::strcmp(arg, "--compare") == 0 && hasValue) {
+            baselinePath = argv[++i];
+        } else if (std::strcmp(arg, "--threshold") == 0 && hasValue) {
+            threshold = std::atof(argv[++i]) / 100.0;
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (list) {
+        harness.List(stdout);
+        return 0;
+    }
+
+    // Load the baseline first so a bad path fails before minutes of benchmarking.
+    std::vector<ptx::bench::Result> baseline;
+    if (!baselinePath.empty() && !ptx::bench::Harness::LoadJson(baselinePath, baseline)) {
+        std::fprintf(stderr, "could not read baseline '%s'\n", baselinePath.c_str());
+        return 2;
+    }
+
+    // Benchmarks skipped by the filter are not "missing", so drop them from the baseline too.
+    if (!filter.empty()) {
+        baseline.erase(std::remove_if(baseline.begin(), baseline.end(),
+                                      [&](const ptx::bench::Result& r) { return r.Key().find(filter) == std::string::npos; }),
+                       baseline.end());
+    }
+
+    const std::vector<ptx::bench::Result> results = harness.Run(stdout);
+
+    if (!jsonPath.empty()) {
+        std::ofstream file(jsonPath);
+        if (!file) {
+            std::fprintf(stderr, "could not write '%s'\n", jsonPath.c_str());
+            return 2;
+        }
+        file << ptx::bench::Harness::ToJson(results);
+    }
+
+    if (!baseline.empty()) {
+        std::printf("\n");
+        return ptx::bench::Harness::Compare(baseline, results, threshold, stdout) > 0 ? 1 : 0;
+    }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "benchsuites.hpp"
+
+#include <ptx/core/math/quaternion.hpp>
+#include <ptx/core/math/vector3d.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace ptx {
+namespace bench {
+
+namespace {
+
+constexpr size_t kBatch = 1024;
+
+/**
+ * @brief Arrays of vectors and unit quaternions shared by the math kernels.
+ */
+struct MathFixture {
+    std::vector<Vector3D> a;
+    std::vector<Vector3D> b;
+    std::vector<Vector3D> out;
+    std::vector<Quaternion> rotations;
+    std::vector<Quaternion> composed;
+
+    MathFixture() : out(kBatch), composed(kBatch) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            const float t = static_cast<float>(i);
+            a.emplace_back(std::sin(t * 0.1f) * 10.0f, std::cos(t * 0.3f) * 5.0f, t * 0.01f + 1.0f);
+            b.emplace_back(std::cos(t * 0.7f), std::sin(t * 0.2f) * 3.0f, 2.0f - t * 0.001f);
+            rotations.push_back(Quaternion(std::cos(t * 0.05f), std::sin(t * 0.05f), 0.3f, 0.1f).UnitQuaternion());
+        }
+    }
+};
+
+}  // namespace
+
+void RegisterMathBenchmarks(Harness& harness) {
+    std::shared_ptr<MathFixture> fixture = std::make_shared<MathFixture>();
+
+    // Each operation processes the full batch, matching how the renderer walks vertex arrays.
+    harness.Add("math", "quaternion_rotate_vector_x1024", [fixture](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (size_t v = 0; v < kBatch; ++v) fixture->out[v] = fixture->rotations[v].RotateVector(fixture->a[v]);
+        }
+        DoNotOptimize(fixture->out[kBatch - 1]);
+    });
+
+    harness.Add("math", "quaternion_multiply_x1024", [fixture](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (size_t v = 0; v < kBatch; ++v) {
+                fixture->composed[v] = fixture->rotations[v].Multiply(fixture->rotations[kBatch - 1 - v]);
+            }
+        }
+        DoNotOptimize(fixture->composed[kBatch - 1]);
+    });
+
+    harness.Add("math", "vector3d_cross_x1024", [fixture](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (size_t v = 0; v < kBatch; ++v) fixture->out[v] = fixture->a[v].CrossProduct(fixture->b[v]);
+        }
+        DoNotOptimize(fixture->out[kBatch - 1]);
+    });
+
+    harness.Add("math", "vector3d_normalize_x1024", [fixture](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (size_t v = 0; v < kBatch; ++v) fixture->out[v] = fixture->a[v].UnitSphere();
+        }
+        DoNotOptimize(fixture->out[kBatch - 1]);
+    });
+}
+
+}  // namespace bench
+}  // namespace ptx
@@ -0,0 +1,88 @@
+#include "benchsuites.hpp"
+
+#include <ptx/systems/physics/broadphasetree.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace ptx {
+namespace bench {
+
+namespace {
+
+constexpr int kBodies = 512;
+
+/**
+ * @brief Spheres drifting through a volume, tracked by a broadphase tree.
+ */
+struct BroadPhaseFixture {
+    BroadPhaseTree tree{0.5f};
+    std::vector<Vector3D> centers;
+    std::vector<int32_t> proxies;
+    float time = 0.0f;
+
+    BroadPhaseFixture() {
+        for (int i = 0; i < kBodies; ++i) {
+            const float t = static_cast<float>(i);
+            centers.emplace_back(std::fmod(t * 7.3f, 100.0f), std::fmod(t * 3.1f, 100.0f), std::fmod(t * 5.7f, 100.0f));
+            proxies.push_back(tree.CreateProxy(AABB::FromSphere(centers.back(), 1.5f), nullptr));
+        }
+    }
+
+    // Moves every body a little; most stay inside their fat bounds.
+    void Move() {
+        time += 0.1f;
+        for (int i = 0; i < kBodies; ++i) {
+            const Vector3D offset(std::sin(time + i) * 0.8f, std::cos(time * 1.3f + i) * 0.8f, 0.0f);
+            tree.MoveProxy(proxies[i], AABB::FromSphere(centers[i] + offset, 1.5f));
+        }
+    }
+
+    // Counts overlapping pairs the way a collision step would, each pair once.
+    uint32_t CountPairs() const {
+        uint32_t pairs = 0;
+        for (int i = 0; i < kBodies; ++i) {
+            const int32_t self = proxies[i];
+            tree.Query(tree.GetFatBounds(self), [&](int32_t other) {
+                if (other > self) ++pairs;
+                return true;
+            });
+        }
+        return pairs;
+    }
+};
+
+}  // namespace
+
+void RegisterPhysicsBenchmarks(Harness& harness) {
+    std::shared_ptr<BroadPhaseFixture> fixture = std::make_shared<BroadPhaseFixture>();
+
+    harness.Add("broadphase", "move_and_pairs_512", [fixture](uint64_t iterations) {
+        uint32_t pairs = 0;
+        for (uint64_t i = 0; i < iterations; ++i) {
+            fixture->Move();
+            pairs += fixture->CountPairs();
+        }
+        DoNotOptimize(pairs);
+    });
+
+    // One operation casts 64 rays across the volume.
+    harness.Add("broadphase", "raycast_x64_512", [fixture](uint64_t iterations) {
+        uint32_t hits = 0;
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (int r = 0; r < 64; ++r) {
+                const Vector3D origin(-10.0f, r * 1.5f, 50.0f);
+                const Vector3D direction = Vector3D(1.0f, 0.05f * (r % 5), 0.02f * (r % 3)).UnitSphere();
+                fixture->tree.Raycast(origin, direction, 200.0f, [&](int32_t, float currentMax) {
+                    ++hits;
+                    return currentMax;
+                });
+            }
+        }
+        DoNotOptimize(hits);
+    });
+}
+
+}  // namespace bench
+}  // namespace ptx
@@ -0,0 +1,270 @@
+#include "benchsuites.hpp"
+
+#include <ptx/assets/image/image.hpp>
+#include <ptx/assets/image/imagesequence.hpp>
+#include <ptx/assets/model/statictrianglegroup.hpp>
+#include <ptx/assets/model/trianglegroup.hpp>
+#include <ptx/core/geometry/2d/circle.hpp>
+#include <ptx/systems/render/core/camera.hpp>
+#include <ptx/systems/render/core/pixelgroup.hpp>
+#include <ptx/systems/render/raster/rasterizer.hpp>
+#include <ptx/systems/render/material/implementations/audioreactivematerial.hpp>
+#include <ptx/systems/render/material/implementations/combinematerial.hpp>
+#include <ptx/systems/render/material/implementations/depthmaterial.hpp>
+#include <ptx/systems/render/material/implementations/gradientmaterial.hpp>
+#include <ptx/systems/render/material/implementations/horizontalrainbowmaterial.hpp>
+#include <ptx/systems/render/material/implementations/imagematerial.hpp>
+#include <ptx/systems/render/material/implementations/imagesequencematerial.hpp>
+#include <ptx/systems/render/material/implementations/materialmask.hpp>
+#include <ptx/systems/render/material/implementations/normalmaterial.hpp>
+#include <ptx/systems/render/material/implementations/oscilloscopematerial.hpp>
+#include <ptx/systems/render/material/implementations/phonglightmaterial.hpp>
+#include <ptx/systems/render/material/implementations/proceduralnoisematerial.hpp>
+#include <ptx/systems/render/material/implementations/spectrumanalyzermaterial.hpp>
+#include <ptx/systems/render/material/implementations/tvstaticmaterial.hpp>
+#include <ptx/systems/render/material/implementations/uniformcolormaterial.hpp>
+#include <ptx/systems/render/material/implementations/uvmapmaterial.hpp>
+#include <ptx/systems/render/material/implementations/vectorfield2dmaterial.hpp>
+#include <ptx/systems/render/post/effects/fisheye.hpp>
+#include <ptx/systems/render/post/effects/glitchx.hpp>
+#include <ptx/systems/render/post/effects/horizontalblur.hpp>
+#include <ptx/systems/render/post/effects/magnet.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace ptx {
+namespace bench {
+
+namespace {
+
+constexpr uint16_t kPanelSide = 64;
+constexpr uint16_t kPanelPixels = kPanelSide * kPanelSide;
+constexpr int kShadePoints = 1024;
+
+/**
+ * @brief A rippled N x N quad grid in front of a 64 x 64 camera, optionally with copies off screen.
+ */
+struct RasterFixture {
+    std::vector<Vector3D> vertices;
+    std::vector<IndexGroup> indices;
+    std::unique_ptr<StaticTriangleGroup> source;
+    std::vector<std::unique_ptr<TriangleGroup>> groups;
+    std::vector<std::unique_ptr<Mesh>> meshes;
+    UniformColorMaterial material{RGBColor(255, 128, 0)};
+    std::unique_ptr<Scene> scene;
+
+    Transform transform;
+    CameraLayout layout{CameraLayout::ZForward, CameraLayout::YUp};
+    PixelGroup pixels{kPanelPixels, Vector2D(kPanelSide, kPanelSide), Vector2D(0, 0), kPanelSide};
+    Camera camera{&transform, &layout, &pixels};
+    Rasterizer::Scratch scratch;
+
+    RasterFixture(int quads, int hiddenCopies) {
+        const float step = static_cast<float>(kPanelSide) / quads;
+        for (int y = 0; y <= quads; ++y) {
+            for (int x = 0; x <= quads; ++x) {
+                const float z = 20.0f + 2.0f * std::sin(x * 0.5f) * std::cos(y * 0.5f);
+                vertices.emplace_back(x * step, y * step, z);
+            }
+        }
+        for (int y = 0; y < quads; ++y) {
+            for (int x = 0; x < quads; ++x) {
+                const int a = y * (quads + 1) + x;
+                indices.emplace_back(a, a + 1, a + quads + 2);
+                indices.emplace_back(a, a + quads + 2, a + quads + 1);
+            }
+        }
+
+        source.reset(new StaticTriangleGroup(vertices.data(), indices.data(), static_cast<int>(vertices.size()),
+                                             static_cast<int>(indices.size())));
+        scene.reset(new Scene(1 + hiddenCopies));
+
+        // Hidden copies sit far to the side, like disabled overlay panels left in the scene.
+        for (int i = 0; i <= hiddenCopies; ++i) {
+            groups.emplace_back(new TriangleGroup(source.get()));
+            meshes.emplace_back(new Mesh(source.get(), groups.back().get(), &material));
+            meshes.back()->GetTransform()->SetPosition(Vector3D(i == 0 ? 0.0f : 1000.0f * i, 0, 0));
+            meshes.back()->ResetVertices();
+            meshes.back()->UpdateTransform();
+            scene->AddMesh(meshes.back().get());
+        }
+
+        Rasterizer::PrepareCamera(&camera);
+    }
+
+    void Render() {
+        Rasterizer::Rasterize(scene.get(), &camera, nullptr, &scratch);
+    }
+};
+
+void AddRaster(Harness& harness, const char* name, int quads, int hiddenCopies) {
+    std::shared_ptr<RasterFixture> fixture = std::make_shared<RasterFixture>(quads, hiddenCopies);
+    harness.Add("raster", name, [fixture](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) fixture->Render();
+        DoNotOptimize(fixture->pixels.GetColors()[0]);
+    });
+}
+
+/**
+ * @brief Surface samples spread over a 64 x 64 area with varying normals.
+ */
+struct ShadePoints {
+    std::vector<Vector3D> positions;
+    std::vector<Vector3D> normals;
+    std::vector<Vector3D> uvws;
+
+    ShadePoints() {
+        for (int i = 0; i < kShadePoints; ++i) {
+            const float x = static_cast<float>(i % 32) * 2.0f;
+            const float y = static_cast<float>(i / 32) * 2.0f;
+            positions.emplace_back(x, y, 10.0f + 0.1f * (i % 7));
+            normals.push_back(Vector3D(std::sin(x * 0.1f), std::cos(y * 0.1f), 1.0f).UnitSphere());
+            uvws.emplace_back(x / 64.0f, y / 64.0f, 0.0f);
+        }
+    }
+};
+
+/**
+ * @brief Owns every built-in material plus the inputs they read.
+ */
+struct MaterialFixture {
+    uint8_t imageData[kPanelPixels];
+    uint8_t palette[4 * 3] = {255, 0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 255};
+    const uint8_t* frames[2] = {imageData, imageData};
+    Image image{imageData, palette, kPanelSide, kPanelSide, 4};
+    ImageSequence sequence{&image, frames, 2, 30.0f};
+    const RGBColor paletteColors[6] = {RGBColor(255, 0, 0), RGBColor(255, 255, 0), RGBColor(0, 255, 0),
+                                RGBColor(0, 255, 255), RGBColor(0, 0, 255), RGBColor(255, 0, 255)};
+    float samples[128];
+    Circle2D maskShape{Vector2D(32, 32), 20.0f};
+
+    UniformColorMaterial red{RGBColor(255, 0, 0)};
+    UniformColorMaterial blue{RGBColor(0, 0, 255)};
+
+    std::vector<std::pair<const char*, std::unique_ptr<IMaterial>>> materials;
+
+    MaterialFixture() {
+        for (uint16_t i = 0; i < kPanelPixels; ++i) imageData[i] = static_cast<uint8_t>((i / 7) % 4);
+        for (int i = 0; i < 128; ++i) samples[i] = 0.5f + 0.5f * std::sin(i * 0.2f);
+
+        auto* audio = new AudioReactiveMaterial();
+        audio->BindSamples(samples);
+        audio->SetSizeFull(Vector2D(64, 64));
+
+        auto* combine = new CombineMaterial();
+        combine->AddMaterial(CombineParams::Method::Base, &red, 1.0f);
+        combine->AddMaterial(CombineParams::Method::Add, &blue, 0.5f);
+
+        auto* oscilloscope = new OscilloscopeMaterial();
+        oscilloscope->BindSamples(samples);
+        oscilloscope->SetSizeFull(Vector2D(64, 64));
+
+        auto* phong = new PhongLightMaterial(2);
+        phong->LightAt(0).Set(Vector3D(0, 0, -50), Vector3D(255, 255, 255), 1000.0f, 0.5f, 0.5f);
+        phong->LightAt(1).Set(Vector3D(64, 64, -50), Vector3D(0, 128, 255), 1000.0f, 0.5f, 0.5f);
+
+        auto* spectrum = new SpectrumAnalyzerMaterial();
+        spectrum->BindSamples(samples);
+        spectrum->SetSizeFull(Vector2D(64, 64));
+        spectrum->Update(0.016f);
+
+        materials.emplace_back("AudioReactive", audio);
+        materials.emplace_back("Combine", combine);
+        materials.emplace_back("Depth", new DepthMaterial(DepthAxis::Z, 20.0f, 0.0f));
+        materials.emplace_back("Gradient", new GradientMaterial(6, paletteColors, 32.0f));
+        materials.emplace_back("HorizontalRainbow", new HorizontalRainbowMaterial());
+        materials.emplace_back("Image", new ImageMaterial(&image));
+        materials.emplace_back("ImageSequence", new ImageSequenceMaterial(&sequence));
+        // Exact pointer types, otherwise MaterialT's forwarding constructor wins overload resolution.
+        const IMaterial* inner = &red;
+        const IMaterial* outer = &blue;
+        Shape* shape = &maskShape;
+        materials.emplace_back("MaterialMask", new MaterialMask(inner, outer, shape));
+        materials.emplace_back("Normal", new NormalMaterial());
+        materials.emplace_back("Oscilloscope", oscilloscope);
+        materials.emplace_back("PhongLight", phong);
+        materials.emplace_back("ProceduralNoise", new ProceduralNoiseMaterial());
+        materials.emplace_back("SpectrumAnalyzer", spectrum);
+        materials.emplace_back("TVStatic", new TVStaticMaterial());
+        materials.emplace_back("UniformColor", new UniformColorMaterial(RGBColor(10, 20, 30)));
+        materials.emplace_back("UVMap", new UVMapMaterial(&image));
+        materials.emplace_back("VectorField2D", new VectorField2DMaterial(16, 16));
+    }
+};
+
+void AddShading(Harness& harness) {
+    std::shared_ptr<MaterialFixture> fixture = std::make_shared<MaterialFixture>();
+    std::shared_ptr<ShadePoints> points = std::make_shared<ShadePoints>();
+
+    for (auto& entry : fixture->materials) {
+        IMaterial* material = entry.second.get();
+        // One operation shades every sample point once.
+        harness.Add("shade", entry.first, [fixture, points, material](uint64_t iterations) {
+            const IShader* shader = material->GetShader();
+            uint32_t checksum = 0;
+            for (uint64_t i = 0; i < iterations; ++i) {
+                for (int p = 0; p < kShadePoints; ++p) {
+                    const SurfaceProperties surface(points->positions[p], points->normals[p], points->uvws[p]);
+                    const RGBColor color = shader->Shade(surface, *material);
+                    checksum += color.R + color.G + color.B;
+                }
+            }
+            DoNotOptimize(checksum);
+        });
+    }
+}
+
+/**
+ * @brief A 64 x 64 panel filled with a pattern; effects run on it in place.
+ */
+struct EffectFixture {
+    PixelGroup pixels{kPanelPixels, Vector2D(kPanelSide, kPanelSide), Vector2D(0, 0), kPanelSide};
+    std::vector<RGBColor> pattern;
+    Fisheye fisheye{0.5f};
+    GlitchX glitch{8};
+    HorizontalBlur blur{6};
+    Magnet magnet{0.5f};
+
+    EffectFixture() {
+        for (uint16_t i = 0; i < kPanelPixels; ++i) {
+            pattern.emplace_back(static_cast<uint8_t>(i * 3), static_cast<uint8_t>(i >> 4), static_cast<uint8_t>(i * 7));
+        }
+        for (Effect* effect : std::initializer_list<Effect*>{&fisheye, &glitch, &blur, &magnet}) effect->SetRatio(0.35f);
+    }
+
+    void Reset() {
+        for (uint16_t i = 0; i < kPanelPixels; ++i) *pixels.GetColor(i) = pattern[i];
+    }
+};
+
+void AddEffect(Harness& harness, const std::shared_ptr<EffectFixture>& fixture, const char* name, Effect* effect) {
+    // The reset is part of each operation so every pass sees the same input.
+    harness.Add("post", name, [fixture, effect](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            fixture->Reset();
+            effect->Apply(&fixture->pixels);
+        }
+        DoNotOptimize(fixture->pixels.GetColors()[0]);
+    });
+}
+
+}  // namespace
+
+void RegisterRenderBenchmarks(Harness& harness) {
+    AddRaster(harness, "grid16_64x64", 16, 0);
+    AddRaster(harness, "grid48_64x64", 48, 0);
+    AddRaster(harness, "grid16_with_31_hidden", 16, 31);
+
+    AddShading(harness);
+
+    std::shared_ptr<EffectFixture> effects = std::make_shared<EffectFixture>();
+    AddEffect(harness, effects, "Fisheye", &effects->fisheye);
+    AddEffect(harness, effects, "GlitchX", &effects->glitch);
+    AddEffect(harness, effects, "HorizontalBlur", &effects->blur);
+    AddEffect(harness, effects, "Magnet", &effects->magnet);
+}
+
+}  // namespace bench
+}  // namespace ptx
@@ -0,0 +1,83 @@
+#include "benchsuites.hpp"
+
+#include <ptx/assets/model/statictrianglegroup.hpp>
+#include <ptx/assets/model/trianglegroup.hpp>
+#include <ptx/systems/render/material/implementations/uniformcolormaterial.hpp>
+#include <ptx/systems/scene/mesh.hpp>
+#include <ptx/systems/scene/scene.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace ptx {
+namespace bench {
+
+namespace {
+
+constexpr int kObjects = 64;
+constexpr int kGridQuads = 16;
+
+/**
+ * @brief A scene of independent grid meshes that all move every frame.
+ */
+struct SceneFixture {
+    std::vector<Vector3D> vertices;
+    std::vector<IndexGroup> indices;
+    std::unique_ptr<StaticTriangleGroup> source;
+    std::vector<std::unique_ptr<TriangleGroup>> groups;
+    std::vector<std::unique_ptr<Mesh>> meshes;
+    UniformColorMaterial material{RGBColor(255, 255, 255)};
+    Scene scene{kObjects};
+    float angle = 0.0f;
+
+    SceneFixture() {
+        for (int y = 0; y <= kGridQuads; ++y) {
+            for (int x = 0; x <= kGridQuads; ++x) vertices.emplace_back(x, y, 0.0f);
+        }
+        for (int y = 0; y < kGridQuads; ++y) {
+            for (int x = 0; x < kGridQuads; ++x) {
+                const int a = y * (kGridQuads + 1) + x;
+                indices.emplace_back(a, a + 1, a + kGridQuads + 2);
+                indices.emplace_back(a, a + kGridQuads + 2, a + kGridQuads + 1);
+            }
+        }
+
+        source.reset(new StaticTriangleGroup(vertices.data(), indices.data(), static_cast<int>(vertices.size()),
+                                             static_cast<int>(indices.size())));
+        for (int i = 0; i < kObjects; ++i) {
+            groups.emplace_back(new TriangleGroup(source.get()));
+            meshes.emplace_back(new Mesh(source.get(), groups.back().get(), &material));
+            scene.AddMesh(meshes.back().get());
+        }
+    }
+
+    // One frame of per-object work: move every enabled mesh and rebuild its world-space vertices.
+    void Step() {
+        angle += 1.0f;
+        Mesh** list = scene.GetMeshes();
+        const uint8_t count = scene.GetMeshCount();
+        for (uint8_t i = 0; i < count; ++i) {
+            Mesh* mesh = list[i];
+            if (!mesh->IsEnabled()) continue;
+
+            mesh->GetTransform()->SetRotation(Vector3D(angle, angle * 0.5f, 0.0f));
+            mesh->GetTransform()->SetPosition(Vector3D(i * 20.0f, 0.0f, 50.0f));
+            mesh->ResetVertices();
+            mesh->UpdateTransform();
+        }
+    }
+};
+
+}  // namespace
+
+void RegisterSceneBenchmarks(Harness& harness) {
+    std::shared_ptr<SceneFixture> fixture = std::make_shared<SceneFixture>();
+
+    harness.Add("scene", "update_transforms_64x289", [fixture](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) fixture->Step();
+        DoNotOptimize(fixture->angle);
+    });
+}
+
+}  // namespace bench
+}  // namespace ptx
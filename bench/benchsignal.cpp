@@ -0,0 +1,143 @@
+#include "benchsuites.hpp"
+
+#include <ptx/core/signal/audioanalyzer.hpp>
+#include <ptx/core/signal/fft.hpp>
+#include <ptx/core/signal/filter/maxfilter.hpp>
+#include <ptx/core/signal/filter/minfilter.hpp>
+#include <ptx/core/signal/filter/peakdetection.hpp>
+#include <ptx/core/signal/stft.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace ptx {
+namespace bench {
+
+namespace {
+
+/**
+ * @brief Interleaved complex input for one FFT size plus working buffers.
+ */
+struct FFTFixture {
+    int size;
+    std::vector<float> input;
+    std::vector<float> work;
+    std::vector<float> magnitude;
+
+    std::vector<float> real;
+    std::vector<float> spectrum;
+
+    explicit FFTFixture(int size)
+        : size(size), input(size * 2), work(size * 2), magnitude(size), real(size), spectrum(size + 2) {
+        for (int i = 0; i < size; ++i) {
+            real[i] = std::sin(i * 0.37f) + 0.5f * std::sin(i * 1.91f);
+            input[i * 2] = real[i];
+            input[i * 2 + 1] = 0.0f;
+        }
+    }
+};
+
+}  // namespace
+
+void RegisterSignalBenchmarks(Harness& harness) {
+    static const char* const names[] = {"forward_magnitude_64", "forward_magnitude_128", "forward_magnitude_256",
+                                        "forward_magnitude_512", "forward_magnitude_1024", "forward_magnitude_2048",
+                                        "forward_magnitude_4096"};
+    static const char* const realNames[] = {"real_magnitude_64", "real_magnitude_128", "real_magnitude_256",
+                                            "real_magnitude_512", "real_magnitude_1024", "real_magnitude_2048",
+                                            "real_magnitude_4096"};
+
+    int index = 0;
+    for (int size = 64; size <= 4096; size *= 2, ++index) {
+        std::shared_ptr<FFTFixture> fixture = std::make_shared<FFTFixture>(size);
+
+        // Build the twiddle tables now so the first sample does not pay for them.
+        FFT& fft = FFT::Instance(size);
+
+        harness.Add("fft", names[index], [fixture, &fft](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                fixture->work = fixture->input;
+                fft.Forward(fixture->work.data());
+                fft.ComplexMagnitude(fixture->work.data(), fixture->magnitude.data());
+            }
+            DoNotOptimize(fixture->magnitude[1]);
+        });
+
+        harness.Add("fft", realNames[index], [fixture, &fft](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                fft.ForwardReal(fixture->real.data(), fixture->spectrum.data());
+                fft.RealMagnitude(fixture->spectrum.data(), fixture->magnitude.data());
+            }
+            DoNotOptimize(fixture->magnitude[1]);
+        });
+    }
+
+    // One operation streams 4096 samples through a 1024-point, 75%-overlap STFT and back.
+    std::shared_ptr<STFT> stft = std::make_shared<STFT>(1024, 256);
+    std::shared_ptr<FFTFixture> stream = std::make_shared<FFTFixture>(4096);
+    harness.Add("fft", "stft_1024_hop256_x4096", [stft, stream](uint64_t iterations) {
+        float sum = 0.0f;
+        for (uint64_t i = 0; i < iterations; ++i) {
+            size_t position = 0;
+            while (position < stream->real.size()) {
+                position += stft->Push(stream->real.data() + position, stream->real.size() - position);
+                if (stft->HasFrame()) {
+                    stft->Synthesize(stft->GetSpectrum());
+                    sum += stft->GetOutput()[0];
+                }
+            }
+        }
+        DoNotOptimize(sum);
+    });
+
+    // One operation analyzes 4096 samples (16 frames) into 128 smoothed bands with peak flags.
+    std::shared_ptr<AudioAnalyzer> analyzer = std::make_shared<AudioAnalyzer>(48000.0f, 1024, 256, 128);
+    harness.Add("fft", "analyzer_1024_hop256_bands128_x4096", [analyzer, stream](uint64_t iterations) {
+        uint64_t frames = 0;
+        for (uint64_t i = 0; i < iterations; ++i) {
+            analyzer->PushSamples(stream->real.data(), stream->real.size());
+            frames += analyzer->ProcessPending();
+        }
+        DoNotOptimize(frames);
+    });
+
+    // Envelope followers: one operation filters a 1024-sample block with a 480-sample window.
+    std::shared_ptr<MinFilter> minFilter = std::make_shared<MinFilter>(480);
+    std::shared_ptr<MaxFilter> maxFilter = std::make_shared<MaxFilter>(480);
+    std::shared_ptr<std::vector<float>> block = std::make_shared<std::vector<float>>(1024);
+    for (size_t i = 0; i < block->size(); ++i) (*block)[i] = std::sin(i * 0.01f) * std::sin(i * 0.37f);
+
+    harness.Add("filter", "min_window480_x1024", [minFilter, block](uint64_t iterations) {
+        std::vector<float> out(block->size());
+        for (uint64_t i = 0; i < iterations; ++i) minFilter->FilterBlock(block->data(), out.data(), out.size());
+        DoNotOptimize(out.back());
+    });
+
+    harness.Add("filter", "max_window480_x1024", [maxFilter, block](uint64_t iterations) {
+        std::vector<float> out(block->size());
+        for (uint64_t i = 0; i < iterations; ++i) maxFilter->FilterBlock(block->data(), out.data(), out.size());
+        DoNotOptimize(out.back());
+    });
+
+    // Z-score peaks: a 512-sample scan, and one frame of 513 spectrum bins as channels.
+    std::shared_ptr<PeakDetection> scanPeaks = std::make_shared<PeakDetection>(512, 32, 2.0f, 0.5f);
+    std::shared_ptr<PeakDetection> binPeaks = std::make_shared<PeakDetection>(513, 32, 2.0f, 0.5f);
+
+    harness.Add("filter", "peaks_scan512_lag32", [scanPeaks, block](uint64_t iterations) {
+        std::vector<bool> peaks;
+        for (uint64_t i = 0; i < iterations; ++i) scanPeaks->Calculate(block->data(), peaks);
+        DoNotOptimize(peaks.size());
+    });
+
+    harness.Add("filter", "peaks_channels513_lag32", [binPeaks, block](uint64_t iterations) {
+        std::vector<uint8_t> peaks;
+        for (uint64_t i = 0; i < iterations; ++i) {
+            binPeaks->CalculateChannels(block->data() + (i & 255), peaks);
+        }
+        DoNotOptimize(peaks.size());
+    });
+}
+
+}  // namespace bench
+}  // namespace ptx
@@ -0,0 +1,35 @@
+/**
+ * @file benchsuites.hpp
+ * @brief Registration entry points for the ptx_bench suites.
+ *
+ * Each suite registers its benchmarks with a Harness; state is built once at registration
+ * and captured by the benchmark bodies so only the measured work is timed.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "benchharness.hpp"
+
+namespace ptx {
+namespace bench {
+
+/** @brief Rasterizing reference meshes, per-material Shade() and post effects. */
+void RegisterRenderBenchmarks(Harness& harness);
+
+/** @brief FFT forward transforms and magnitudes across sizes. */
+void RegisterSignalBenchmarks(Harness& harness);
+
+/** @brief Quaternion and Vector3D kernels. */
+void RegisterMathBenchmarks(Harness& harness);
+
+/** @brief Per-object scene iteration: mesh transform updates over a populated scene. */
+void RegisterSceneBenchmarks(Harness& harness);
+
+/** @brief Broadphase tree updates, pair queries and raycasts. */
+void RegisterPhysicsBenchmarks(Harness& harness);
+
+}  // namespace bench
+}  // namespace ptx
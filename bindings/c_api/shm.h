@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * C ABI for reading PTX shared-memory frames (consumer side).
+ *
+ * A client attaches to the camera registry (default "/ptx_reg") and lazily
+ * attaches to each camera's framebuffer and geometry channels. Frames can be
+ * read zero-copy (acquire, read, then release to confirm the data was not torn)
+ * or copied with automatic torn-read retry.
+ *
+ * Return codes: 1 = success, 0 = not available / timeout / torn, -1 = bad argument.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ptx_shm_client ptx_shm_client;
+
+typedef struct ptx_shm_camera_info {
+    char     name[32];     /* user-visible camera id */
+    uint32_t index;        /* channel index (/ptx_fb{index}, /ptx_geom{index}) */
+    uint32_t pixel_count;  /* pixels per frame */
+    uint32_t width;        /* logical width */
+    uint32_t height;       /* logical height */
+} ptx_shm_camera_info;
+
+typedef struct ptx_shm_frame {
+    const uint8_t* data;   /* RGB888 payload (shared memory for acquire, caller buffer for copy) */
+    size_t   bytes;        /* payload size */
+    uint32_t width;        /* framebuffer width (pixel_count for 1xN cameras) */
+    uint32_t height;       /* framebuffer height */
+    uint32_t stride;       /* bytes per row */
+    uint32_t buffer_index; /* ring slot */
+    uint64_t seq;          /* slot sequence at acquire time */
+    uint64_t frame;        /* producer frame number (0 if not stamped) */
+    uint64_t publish_ns;   /* CLOCK_MONOTONIC publish time (0 if not stamped) */
+} ptx_shm_frame;
+
+ptx_shm_client* ptx_shm_client_open(const char* registry_name);
+void ptx_shm_client_close(ptx_shm_client* client);
+
+uint32_t ptx_shm_camera_count(ptx_shm_client* client);
+int ptx_shm_camera_info_at(ptx_shm_client* client, uint32_t camera, ptx_shm_camera_info* out);
+
+int ptx_shm_frame_acquire(ptx_shm_client* client, uint32_t camera, ptx_shm_frame* out);
+int ptx_shm_frame_release(ptx_shm_client* client, uint32_t camera, const ptx_shm_frame* frame);
+int ptx_shm_frame_copy(ptx_shm_client* client, uint32_t camera, uint8_t* dst, size_t capacity, ptx_shm_frame* out);
+int ptx_shm_frame_wait(ptx_shm_client* client, uint32_t camera, uint64_t last_frame, int timeout_ms);
+uint64_t ptx_shm_frame_latest(ptx_shm_client* client, uint32_t camera);
+
+uint64_t ptx_shm_geometry_generation(ptx_shm_client* client, uint32_t camera);
+int ptx_shm_geometry_copy(ptx_shm_client* client, uint32_t camera, float* dst_xy, uint32_t count, uint64_t* generation);
+
+uint64_t ptx_shm_now_ns(void);
+
+#ifdef __cplusplus
+}
+#endif
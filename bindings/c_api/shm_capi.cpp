@@ -0,0 +1,168 @@
+#include "shm.h"
+
+#include <cstring>
+#include <vector>
+
+#include <ptx/platform/ipc/ptx_shm_reader.hpp>
+
+namespace {
+
+struct CameraChannels {
+    PTXFbReader fb;
+    PTXGeomReader geom;
+    bool fb_attached = false;
+    bool geom_attached = false;
+};
+
+} // namespace
+
+struct ptx_shm_client {
+    PTXRegistryReader registry;
+    std::vector<CameraChannels> cameras;
+
+    ~ptx_shm_client() {
+        for (CameraChannels& channels : cameras) {
+            if (channels.fb_attached) ptx_fb_detach(channels.fb);
+            if (channels.geom_attached) ptx_geom_detach(channels.geom);
+        }
+        ptx_registry_detach(registry);
+    }
+
+    // Attach a camera's channels on first use; producers may create them after the registry.
+    CameraChannels* Channels(uint32_t camera, bool need_fb, bool need_geom) {
+        const PTXRegCamera* record = ptx_registry_camera(registry, camera);
+        if (!record) return nullptr;
+        if (cameras.size() <= camera) cameras.resize(camera + 1);
+
+        CameraChannels& channels = cameras[camera];
+        char fb_name[48];
+        char geom_name[48];
+        ptx_registry_channel_names(*record, fb_name, sizeof(fb_name), geom_name, sizeof(geom_name),
+                                   ptx_registry_stream_prefix(registry));
+
+        if (need_fb && !channels.fb_attached) channels.fb_attached = ptx_fb_attach(channels.fb, fb_name);
+        if (need_geom && !channels.geom_attached) channels.geom_attached = ptx_geom_attach(channels.geom, geom_name);
+
+        if (need_fb && !channels.fb_attached) return nullptr;
+        if (need_geom && !channels.geom_attached) return nullptr;
+        return &channels;
+    }
+};
+
+namespace {
+
+void to_c(const PTXFrameView& view, ptx_shm_frame* out) {
+    out->data = view.data;
+    out->bytes = view.bytes;
+    out->width = view.width;
+    out->height = view.height;
+    out->stride = view.stride;
+    out->buffer_index = view.index;
+    out->seq = view.seq;
+    out->frame = view.frame;
+    out->publish_ns = view.publish_ns;
+}
+
+} // namespace
+
+extern "C" {
+
+ptx_shm_client* ptx_shm_client_open(const char* registry_name) {
+    ptx_shm_client* client = new ptx_shm_client();
+    if (!ptx_registry_attach(client->registry, registry_name ? registry_name : "/ptx_reg")) {
+        delete client;
+        return nullptr;
+    }
+    return client;
+}
+
+void ptx_shm_client_close(ptx_shm_client* client) {
+    delete client;
+}
+
+uint32_t ptx_shm_camera_count(ptx_shm_client* client) {
+    return client ? ptx_registry_count(client->registry) : 0;
+}
+
+int ptx_shm_camera_info_at(ptx_shm_client* client, uint32_t camera, ptx_shm_camera_info* out) {
+    if (!client || !out) return -1;
+    const PTXRegCamera* record = ptx_registry_camera(client->registry, camera);
+    if (!record) return 0;
+
+    std::memcpy(out->name, record->name, sizeof(out->name));
+    out->name[sizeof(out->name) - 1] = '\0';
+    out->index = record->index;
+    out->pixel_count = record->pixel_count;
+    out->width = record->width;
+    out->height = record->height;
+    return 1;
+}
+
+int ptx_shm_frame_acquire(ptx_shm_client* client, uint32_t camera, ptx_shm_frame* out) {
+    if (!client || !out) return -1;
+    CameraChannels* channels = client->Channels(camera, true, false);
+    if (!channels) return 0;
+
+    PTXFrameView view;
+    if (!ptx_fb_latest(channels->fb, view)) return 0;
+    to_c(view, out);
+    return 1;
+}
+
+int ptx_shm_frame_release(ptx_shm_client* client, uint32_t camera, const ptx_shm_frame* frame) {
+    if (!client || !frame) return -1;
+    CameraChannels* channels = client->Channels(camera, true, false);
+    if (!channels) return 0;
+
+    PTXFrameView view;
+    view.data = frame->data;
+    view.index = frame->buffer_index;
+    view.seq = frame->seq;
+    return ptx_fb_still_valid(channels->fb, view) ? 1 : 0;
+}
+
+int ptx_shm_frame_copy(ptx_shm_client* client, uint32_t camera, uint8_t* dst, size_t capacity, ptx_shm_frame* out) {
+    if (!client || !dst) return -1;
+    CameraChannels* channels = client->Channels(camera, true, false);
+    if (!channels) return 0;
+
+    PTXFrameView view;
+    if (!ptx_fb_copy_latest(channels->fb, dst, capacity, &view)) return 0;
+    if (out) {
+        to_c(view, out);
+        out->data = dst;
+    }
+    return 1;
+}
+
+int ptx_shm_frame_wait(ptx_shm_client* client, uint32_t camera, uint64_t last_frame, int timeout_ms) {
+    if (!client) return -1;
+    CameraChannels* channels = client->Channels(camera, true, false);
+    if (!channels) return 0;
+    return ptx_fb_wait(channels->fb, last_frame, timeout_ms) ? 1 : 0;
+}
+
+uint64_t ptx_shm_frame_latest(ptx_shm_client* client, uint32_t camera) {
+    if (!client) return 0;
+    CameraChannels* channels = client->Channels(camera, true, false);
+    return channels ? ptx_fb_latest_frame(channels->fb) : 0;
+}
+
+uint64_t ptx_shm_geometry_generation(ptx_shm_client* client, uint32_t camera) {
+    if (!client) return 0;
+    CameraChannels* channels = client->Channels(camera, false, true);
+    return channels ? ptx_geom_reader_generation(channels->geom) : 0;
+}
+
+int ptx_shm_geometry_copy(ptx_shm_client* client, uint32_t camera, float* dst_xy, uint32_t count, uint64_t* generation) {
+    if (!client || !dst_xy) return -1;
+    CameraChannels* channels = client->Channels(camera, false, true);
+    if (!channels) return 0;
+    return ptx_geom_read(channels->geom, dst_xy, count, generation) ? 1 : 0;
+}
+
+uint64_t ptx_shm_now_ns(void) {
+    return ptx_monotonic_ns();
+}
+
+} // extern "C"
@@ -8,8 +8,10 @@
  *   instance:get(field_name)
  *   instance:set(field_name, value)
  *   instance:call(method_name, ...)
+ *   ptx.shm_open([registry]) -> userdata (shared-memory frame reader)
  *
- * This file links against the PTX reflection C API (reflect.h).
+ * This file links against the PTX reflection C API (reflect.h) and the
+ * shared-memory reader C API (shm.h).
  */
 
 #include <lua.h>
@@ -25,6 +27,7 @@ static int instance_method_trampoline(lua_State *Linner);
 #include <string.h>
 
 #include "../../c_api/reflect.h"
+#include "../../c_api/shm.h"
 
 typedef struct {
     void *class_desc;    /* ptx::ClassDesc* as void* */
@@ -895,7 +898,156 @@ static int l_ptx_call_static(lua_State *L) {
     ptx_method_destroy_return(method, ret); lua_pushnil(L); return 1;
 }
 
+/* ---------------------------------------------------------------------------
+ * Shared-memory frame reader (ptx.shm_open)
+ * Camera arguments are 1-based positions in the registry, like Lua arrays.
+ * ------------------------------------------------------------------------- */
+
+typedef struct {
+    ptx_shm_client *client;
+} shm_ud;
+
+static ptx_shm_client *check_shm(lua_State *L) {
+    shm_ud *ud = (shm_ud*)luaL_checkudata(L, 1, "ptx.shm");
+    if (!ud->client) luaL_error(L, "ptx.shm: reader is closed");
+    return ud->client;
+}
+
+static uint32_t check_camera(lua_State *L, int index) {
+    lua_Integer cam = luaL_checkinteger(L, index);
+    luaL_argcheck(L, cam >= 1, index, "camera positions start at 1");
+    return (uint32_t)(cam - 1);
+}
+
+static int l_ptx_shm_open(lua_State *L) {
+    const char *registry = luaL_optstring(L, 1, "/ptx_reg");
+    ptx_shm_client *client = ptx_shm_client_open(registry);
+    if (!client) { lua_pushnil(L); lua_pushfstring(L, "registry %s is not published", registry); return 2; }
+
+    shm_ud *ud = (shm_ud*)lua_newuserdata(L, sizeof(shm_ud));
+    ud->client = client;
+    luaL_setmetatable(L, "ptx.shm");
+    return 1;
+}
+
+static int shm_close(lua_State *L) {
+    shm_ud *ud = (shm_ud*)luaL_checkudata(L, 1, "ptx.shm");
+    if (ud->client) { ptx_shm_client_close(ud->client); ud->client = NULL; }
+    return 0;
+}
+
+/* reader:cameras() -> { {name=, index=, pixel_count=, width=, height=}, ... } */
+static int shm_cameras(lua_State *L) {
+    ptx_shm_client *client = check_shm(L);
+    uint32_t count = ptx_shm_camera_count(client);
+    lua_createtable(L, (int)count, 0);
+    for (uint32_t i = 0; i < count; ++i) {
+        ptx_shm_camera_info info;
+        if (ptx_shm_camera_info_at(client, i, &info) != 1) continue;
+        lua_createtable(L, 0, 5);
+        lua_pushstring(L, info.name); lua_setfield(L, -2, "name");
+        lua_pushinteger(L, info.index); lua_setfield(L, -2, "index");
+        lua_pushinteger(L, info.pixel_count); lua_setfield(L, -2, "pixel_count");
+        lua_pushinteger(L, info.width); lua_setfield(L, -2, "width");
+        lua_pushinteger(L, info.height); lua_setfield(L, -2, "height");
+        lua_rawseti(L, -2, (lua_Integer)i + 1);
+    }
+    return 1;
+}
+
+/* reader:wait(cam [, last_frame [, timeout_ms]]) -> bool */
+static int shm_wait(lua_State *L) {
+    ptx_shm_client *client = check_shm(L);
+    uint32_t cam = check_camera(L, 2);
+    uint64_t last = (uint64_t)luaL_optinteger(L, 3, 0);
+    int timeout = (int)luaL_optinteger(L, 4, -1);
+    lua_pushboolean(L, ptx_shm_frame_wait(client, cam, last, timeout) == 1);
+    return 1;
+}
+
+/* reader:frame(cam) -> rgb_string, frame_number, publish_ns  (nil if unavailable) */
+static int shm_frame(lua_State *L) {
+    ptx_shm_client *client = check_shm(L);
+    uint32_t cam = check_camera(L, 2);
+
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        ptx_shm_frame frame;
+        if (ptx_shm_frame_acquire(client, cam, &frame) != 1) break;
+
+        /* One copy straight from the ring into the Lua string, then confirm it was not torn. */
+        lua_pushlstring(L, (const char*)frame.data, frame.bytes);
+        if (ptx_shm_frame_release(client, cam, &frame) == 1) {
+            lua_pushinteger(L, (lua_Integer)frame.frame);
+            lua_pushinteger(L, (lua_Integer)frame.publish_ns);
+            return 3;
+        }
+        lua_pop(L, 1);
+    }
+    lua_pushnil(L);
+    return 1;
+}
+
+/* reader:latest(cam) -> latest published frame number */
+static int shm_latest(lua_State *L) {
+    ptx_shm_client *client = check_shm(L);
+    lua_pushinteger(L, (lua_Integer)ptx_shm_frame_latest(client, check_camera(L, 2)));
+    return 1;
+}
+
+/* reader:geometry(cam) -> { x1, y1, x2, y2, ... }, generation  (nil if unavailable) */
+static int shm_geometry(lua_State *L) {
+    ptx_shm_client *client = check_shm(L);
+    uint32_t cam = check_camera(L, 2);
+
+    ptx_shm_camera_info info;
+    if (ptx_shm_camera_info_at(client, cam, &info) != 1) { lua_pushnil(L); return 1; }
+
+    float *xy = (float*)malloc((size_t)info.pixel_count * 2u * sizeof(float));
+    if (!xy) return luaL_error(L, "ptx.shm: out of memory");
+
+    uint64_t generation = 0;
+    if (ptx_shm_geometry_copy(client, cam, xy, info.pixel_count, &generation) != 1) {
+        free(xy);
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_createtable(L, (int)(info.pixel_count * 2u), 0);
+    for (uint32_t i = 0; i < info.pixel_count * 2u; ++i) {
+        lua_pushnumber(L, xy[i]);
+        lua_rawseti(L, -2, (lua_Integer)i + 1);
+    }
+    free(xy);
+    lua_pushinteger(L, (lua_Integer)generation);
+    return 2;
+}
+
+/* reader:geometry_generation(cam) -> integer */
+static int shm_geometry_generation(lua_State *L) {
+    ptx_shm_client *client = check_shm(L);
+    lua_pushinteger(L, (lua_Integer)ptx_shm_geometry_generation(client, check_camera(L, 2)));
+    return 1;
+}
+
+static const luaL_Reg shm_methods[] = {
+    {"cameras", shm_cameras},
+    {"wait", shm_wait},
+    {"frame", shm_frame},
+    {"latest", shm_latest},
+    {"geometry", shm_geometry},
+    {"geometry_generation", shm_geometry_generation},
+    {"close", shm_close},
+    {NULL, NULL}
+};
+
 int luaopen_ptx(lua_State *L) {
+    /* create shared-memory reader metatable */
+    luaL_newmetatable(L, "ptx.shm");
+    lua_pushvalue(L, -1); lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, shm_close); lua_setfield(L, -2, "__gc");
+    luaL_setfuncs(L, shm_methods, 0);
+    lua_pop(L, 1);
+
     /* create instance metatable */
     luaL_newmetatable(L, "ptx.instance");
     lua_pushcfunction(L, instance_index); lua_setfield(L, -2, "__index");
@@ -913,5 +1065,6 @@ int luaopen_ptx(lua_State *L) {
     lua_pushcfunction(L, l_ptx_new_sig); lua_setfield(L, -2, "new_sig");
     lua_pushcfunction(L, l_ptx_call_static); lua_setfield(L, -2, "call_static");
     lua_pushcfunction(L, l_ptx_call_static_sig); lua_setfield(L, -2, "call_static_sig");
+    lua_pushcfunction(L, l_ptx_shm_open); lua_setfield(L, -2, "shm_open");
     return 1;
 }
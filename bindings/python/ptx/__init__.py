@@ -13,8 +13,13 @@ Example
 >>> color = ctor(*[0, 128, 255])
 >>> [f.name for f in rgb.fields]
 ['R', 'G', 'B']
+
+The :mod:`ptx.shm` module reads frames published over shared memory by
+``VirtualController`` (see ``bindings/c_api/shm.h``).
 """
 
+from . import shm
+
 from .reflection import (
     load_reflection,
     PTXReflection,
@@ -33,4 +38,5 @@ __all__ = [
     "PTXMethod",
     "PTXConstructor",
     "PTXObject",
+    "shm",
 ]
@@ -0,0 +1,239 @@
+"""ctypes-based reader for PTX shared-memory frames.
+
+This module talks to the consumer C ABI declared in ``bindings/c_api/shm.h``
+(exported from the same shared library as the reflection API). It attaches to
+the camera registry published by ``VirtualController``, enumerates cameras and
+reads frames either zero-copy or as copies with torn-read retry.
+
+Example
+-------
+>>> from ptx import shm
+>>> client = shm.open_client()
+>>> cam = client.cameras()[0]
+>>> last = 0
+>>> while client.wait(0, last, timeout_ms=1000):
+...     with client.frame(0) as f:
+...         pixels = bytes(f.data)     # zero-copy view until the block exits
+...     if f.valid:
+...         last = f.frame
+"""
+
+from __future__ import annotations
+
+import ctypes
+import os
+from dataclasses import dataclass
+from typing import List, Optional, Tuple, Union
+
+from .reflection import _resolve_library_path
+
+__all__ = [
+    "open_client",
+    "PTXShmClient",
+    "PTXCameraInfo",
+    "PTXFrame",
+]
+
+
+class _CameraInfo(ctypes.Structure):
+    _fields_ = [
+        ("name", ctypes.c_char * 32),
+        ("index", ctypes.c_uint32),
+        ("pixel_count", ctypes.c_uint32),
+        ("width", ctypes.c_uint32),
+        ("height", ctypes.c_uint32),
+    ]
+
+
+class _Frame(ctypes.Structure):
+    _fields_ = [
+        ("data", ctypes.c_void_p),
+        ("bytes", ctypes.c_size_t),
+        ("width", ctypes.c_uint32),
+        ("height", ctypes.c_uint32),
+        ("stride", ctypes.c_uint32),
+        ("buffer_index", ctypes.c_uint32),
+        ("seq", ctypes.c_uint64),
+        ("frame", ctypes.c_uint64),
+        ("publish_ns", ctypes.c_uint64),
+    ]
+
+
+@dataclass(frozen=True)
+class PTXCameraInfo:
+    """Registry record for one published camera."""
+
+    name: str
+    index: int
+    pixel_count: int
+    width: int
+    height: int
+
+
+class PTXFrame:
+    """Zero-copy frame view; use as a context manager.
+
+    ``data`` is a memoryview into shared memory that is only meaningful inside
+    the ``with`` block. On exit the view is checked against the producer's
+    sequence; ``valid`` is ``False`` if the buffer was rewritten meanwhile and
+    anything read from ``data`` should be discarded.
+    """
+
+    def __init__(self, client: "PTXShmClient", camera: int, raw: _Frame):
+        self._client = client
+        self._camera = camera
+        self._raw = raw
+        self.valid = True
+        buffer = (ctypes.c_uint8 * raw.bytes).from_address(raw.data)
+        self.data: Optional[memoryview] = memoryview(buffer).cast("B")
+
+    width = property(lambda self: self._raw.width)
+    height = property(lambda self: self._raw.height)
+    stride = property(lambda self: self._raw.stride)
+    frame = property(lambda self: self._raw.frame)
+    publish_ns = property(lambda self: self._raw.publish_ns)
+
+    def release(self) -> bool:
+        """Confirm the data was not torn and drop the shared-memory view."""
+        if self.data is not None:
+            self.valid = self._client._lib.ptx_shm_frame_release(
+                self._client._handle, self._camera, ctypes.byref(self._raw)) == 1
+            self.data.release()
+            self.data = None
+        return self.valid
+
+    def __enter__(self) -> "PTXFrame":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.release()
+
+
+class PTXShmClient:
+    """Consumer handle bound to one camera registry."""
+
+    def __init__(self, registry: str = "/ptx_reg",
+                 library: Optional[Union[str, os.PathLike[str]]] = None):
+        self._lib = ctypes.CDLL(str(_resolve_library_path(library)))
+        self._configure()
+        self._handle = self._lib.ptx_shm_client_open(registry.encode("utf-8"))
+        if not self._handle:
+            raise FileNotFoundError(f"PTX registry {registry!r} is not published")
+
+    def _configure(self) -> None:
+        lib = self._lib
+        client = ctypes.c_void_p
+
+        lib.ptx_shm_client_open.argtypes = [ctypes.c_char_p]
+        lib.ptx_shm_client_open.restype = client
+        lib.ptx_shm_client_close.argtypes = [client]
+        lib.ptx_shm_client_close.restype = None
+
+        lib.ptx_shm_camera_count.argtypes = [client]
+        lib.ptx_shm_camera_count.restype = ctypes.c_uint32
+        lib.ptx_shm_camera_info_at.argtypes = [client, ctypes.c_uint32, ctypes.POINTER(_CameraInfo)]
+        lib.ptx_shm_camera_info_at.restype = ctypes.c_int
+
+        lib.ptx_shm_frame_acquire.argtypes = [client, ctypes.c_uint32, ctypes.POINTER(_Frame)]
+        lib.ptx_shm_frame_acquire.restype = ctypes.c_int
+        lib.ptx_shm_frame_release.argtypes = [client, ctypes.c_uint32, ctypes.POINTER(_Frame)]
+        lib.ptx_shm_frame_release.restype = ctypes.c_int
+        lib.ptx_shm_frame_copy.argtypes = [client, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_size_t,
+                                           ctypes.POINTER(_Frame)]
+        lib.ptx_shm_frame_copy.restype = ctypes.c_int
+        lib.ptx_shm_frame_wait.argtypes = [client, ctypes.c_uint32, ctypes.c_uint64, ctypes.c_int]
+        lib.ptx_shm_frame_wait.restype = ctypes.c_int
+        lib.ptx_shm_frame_latest.argtypes = [client, ctypes.c_uint32]
+        lib.ptx_shm_frame_latest.restype = ctypes.c_uint64
+
+        lib.ptx_shm_geometry_generation.argtypes = [client, ctypes.c_uint32]
+        lib.ptx_shm_geometry_generation.restype = ctypes.c_uint64
+        lib.ptx_shm_geometry_copy.argtypes = [client, ctypes.c_uint32, ctypes.POINTER(ctypes.c_float),
+                                              ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64)]
+        lib.ptx_shm_geometry_copy.restype = ctypes.c_int
+
+        lib.ptx_shm_now_ns.argtypes = []
+        lib.ptx_shm_now_ns.restype = ctypes.c_uint64
+
+    # ------------------------------ lifecycle ------------------------------
+
+    def close(self) -> None:
+        if self._handle:
+            self._lib.ptx_shm_client_close(self._handle)
+            self._handle = None
+
+    def __enter__(self) -> "PTXShmClient":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+    def __del__(self) -> None:
+        self.close()
+
+    # ------------------------------ registry -------------------------------
+
+    def cameras(self) -> List[PTXCameraInfo]:
+        result = []
+        for i in range(self._lib.ptx_shm_camera_count(self._handle)):
+            info = _CameraInfo()
+            if self._lib.ptx_shm_camera_info_at(self._handle, i, ctypes.byref(info)) == 1:
+                result.append(PTXCameraInfo(info.name.decode("utf-8", "replace"), info.index,
+                                            info.pixel_count, info.width, info.height))
+        return result
+
+    # ------------------------------- frames --------------------------------
+
+    def wait(self, camera: int, last_frame: int = 0, timeout_ms: int = -1) -> bool:
+        """Block until a frame newer than ``last_frame`` is published."""
+        return self._lib.ptx_shm_frame_wait(self._handle, camera, last_frame, timeout_ms) == 1
+
+    def latest_frame_number(self, camera: int) -> int:
+        return self._lib.ptx_shm_frame_latest(self._handle, camera)
+
+    def frame(self, camera: int) -> Optional[PTXFrame]:
+        """Zero-copy view of the newest complete frame, or ``None``."""
+        raw = _Frame()
+        if self._lib.ptx_shm_frame_acquire(self._handle, camera, ctypes.byref(raw)) != 1:
+            return None
+        return PTXFrame(self, camera, raw)
+
+    def copy_frame(self, camera: int) -> Optional[Tuple[bytes, int, int]]:
+        """Copy the newest frame; returns ``(rgb_bytes, frame_number, publish_ns)`` or ``None``."""
+        cams = self.cameras()
+        if camera >= len(cams):
+            return None
+        size = cams[camera].pixel_count * 3
+        buffer = (ctypes.c_uint8 * size)()
+        raw = _Frame()
+        if self._lib.ptx_shm_frame_copy(self._handle, camera, buffer, size, ctypes.byref(raw)) != 1:
+            return None
+        return bytes(buffer[:raw.bytes]), raw.frame, raw.publish_ns
+
+    # ------------------------------ geometry -------------------------------
+
+    def geometry_generation(self, camera: int) -> int:
+        return self._lib.ptx_shm_geometry_generation(self._handle, camera)
+
+    def geometry(self, camera: int) -> Optional[Tuple[List[Tuple[float, float]], int]]:
+        """Copy the camera's pixel positions; returns ``([(x, y), ...], generation)`` or ``None``."""
+        cams = self.cameras()
+        if camera >= len(cams):
+            return None
+        count = cams[camera].pixel_count
+        xy = (ctypes.c_float * (count * 2))()
+        generation = ctypes.c_uint64()
+        if self._lib.ptx_shm_geometry_copy(self._handle, camera, xy, count, ctypes.byref(generation)) != 1:
+            return None
+        return [(xy[2 * i], xy[2 * i + 1]) for i in range(count)], generation.value
+
+    def now_ns(self) -> int:
+        """CLOCK_MONOTONIC nanoseconds, comparable with ``publish_ns``."""
+        return self._lib.ptx_shm_now_ns()
+
+
+def open_client(registry: str = "/ptx_reg",
+                library: Optional[Union[str, os.PathLike[str]]] = None) -> PTXShmClient:
+    """Attach to a published camera registry."""
+
+    return PTXShmClient(registry, library)
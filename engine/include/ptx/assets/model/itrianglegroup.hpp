@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "../../core/geometry/3d/triangle.hpp"
 #include "indexgroup.hpp"
 #include "istatictrianglegroup.hpp"
@@ -53,4 +55,21 @@ public:
      */
     virtual Triangle3D* GetTriangles() = 0;
 
+    /**
+     * @brief Records that the vertices were rewritten through GetVertices().
+     *
+     * Anything that caches data derived from the vertices, such as Mesh bounds, compares
+     * GetVertexVersion() against the value it saw, so every in-place writer must call this.
+     */
+    void MarkVerticesChanged() { ++vertexVersion; }
+
+    /**
+     * @brief Retrieves the counter advanced by MarkVerticesChanged().
+     * @return The current vertex version.
+     */
+    uint32_t GetVertexVersion() const { return vertexVersion; }
+
+private:
+    uint32_t vertexVersion = 0; ///< Advanced on every in-place vertex write.
+
 };
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <vector>
 #include "../../core/geometry/3d/triangle.hpp"
 #include "indexgroup.hpp"
 #include "istatictrianglegroup.hpp"
@@ -28,7 +29,7 @@
  */
 class StaticTriangleGroup : public IStaticTriangleGroup {
 private:
-    Triangle3D* triangles; ///< Array of 3D triangles in the group.
+    std::vector<Triangle3D> triangles; ///< 3D triangles built from the vertices and indices.
     Vector3D* vertices; ///< Array of vertex positions.
     const IndexGroup* indexGroup; ///< Index group defining triangle vertex indices.
     const IndexGroup* uvIndexGroup; ///< Index group for UV coordinates (if available).
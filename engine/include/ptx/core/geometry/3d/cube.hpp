@@ -23,6 +23,8 @@
 class Cube {
 private:
     Quaternion previousRotation; ///< Previous rotation of the object.
+
+protected:
     Vector3D centerPosition; ///< Center position of the bounding cube.
     Vector3D maximum; ///< Maximum coordinates of the bounding cube.
     Vector3D minimum; ///< Minimum coordinates of the bounding cube.
@@ -0,0 +1,116 @@
+/**
+ * @file randomstream.hpp
+ * @brief Small deterministic random number generator with independent streams.
+ *
+ * ptx::Random wraps the platform's global generator, which is shared state and
+ * cannot be used from several threads or reproduced per task. RandomStream is a
+ * PCG32 generator held by value: the same (seed, stream) pair always yields the
+ * same sequence, and different stream ids yield independent sequences, so
+ * parallel work can draw numbers without locks and still be reproducible.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class RandomStream
+ * @brief PCG32 (XSH RR) generator selected by seed and stream id.
+ */
+class RandomStream {
+public:
+    /**
+     * @brief Constructor.
+     * @param seed Starting state.
+     * @param stream Stream id; streams with the same seed do not overlap.
+     */
+    explicit RandomStream(uint64_t seed = 0x853c49e6748fea9bULL, uint64_t stream = 0) {
+        Seed(seed, stream);
+    }
+
+    /**
+     * @brief Restarts the generator.
+     * @param seed Starting state.
+     * @param stream Stream id.
+     */
+    void Seed(uint64_t seed, uint64_t stream) {
+        state = 0;
+        increment = (stream << 1u) | 1u;
+        Next();
+        state += seed;
+        Next();
+    }
+
+    /**
+     * @brief Gets the next 32-bit value.
+     */
+    uint32_t Next() {
+        const uint64_t previous = state;
+        state = previous * 6364136223846793005ULL + increment;
+        const uint32_t shifted = static_cast<uint32_t>(((previous >> 18u) ^ previous) >> 27u);
+        const uint32_t rotation = static_cast<uint32_t>(previous >> 59u);
+        return (shifted >> rotation) | (shifted << ((32u - rotation) & 31u));
+    }
+
+    /**
+     * @brief Gets a float in [0, 1).
+     */
+    float NextFloat() {
+        return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * @brief Gets a float in [min, max).
+     */
+    float Float(float min, float max) {
+        return min + (max - min) * NextFloat();
+    }
+
+    /**
+     * @brief Gets an integer in [min, max].
+     */
+    int Int(int min, int max) {
+        if (max <= min) return min;
+        const uint32_t span = static_cast<uint32_t>(max - min) + 1u;
+        return min + static_cast<int>(Next() % span);
+    }
+
+    /**
+     * @brief Combines two values into a well-mixed 64-bit seed (SplitMix64 finalizer).
+     */
+    static uint64_t Mix(uint64_t a, uint64_t b) {
+        uint64_t z = a + 0x9e3779b97f4a7c15ULL * (b + 1u);
+        z = (z ^ (z >> 30u)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27u)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31u);
+    }
+
+private:
+    uint64_t state;
+    uint64_t increment;
+
+    PTX_BEGIN_FIELDS(RandomStream)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(RandomStream)
+        PTX_METHOD_AUTO(RandomStream, Seed, "Seed"),
+        PTX_METHOD_AUTO(RandomStream, Next, "Next"),
+        PTX_METHOD_AUTO(RandomStream, NextFloat, "Next float"),
+        PTX_METHOD_AUTO(RandomStream, Float, "Float"),
+        PTX_METHOD_AUTO(RandomStream, Int, "Int")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(RandomStream)
+        PTX_CTOR0(RandomStream),
+        PTX_CTOR(RandomStream, uint64_t, uint64_t)
+    PTX_END_DESCRIBE(RandomStream)
+};
+
+} // namespace ptx
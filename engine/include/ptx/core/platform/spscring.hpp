@@ -0,0 +1,119 @@
+/**
+ * @file spscring.hpp
+ * @brief Lock-free single-producer/single-consumer ring buffer.
+ *
+ * One thread writes and one thread reads; neither ever blocks or allocates, which makes
+ * the ring safe to feed from an audio capture callback. The producer and consumer
+ * positions live on separate cache lines so the two sides do not false-share.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace ptx {
+
+/**
+ * @class SPSCRing
+ * @brief Fixed-capacity FIFO of trivially copyable items shared by exactly two threads.
+ *
+ * Write() may only be called from the producer thread and Read()/Discard() only from the
+ * consumer thread. Size() and FreeSpace() are safe from either side but are snapshots.
+ *
+ * @tparam T Item type, e.g. float samples.
+ */
+template <typename T>
+class SPSCRing {
+public:
+    /**
+     * @brief Constructor.
+     * @param capacity Minimum number of items held; rounded up to a power of two.
+     */
+    explicit SPSCRing(size_t capacity)
+        : buffer(RoundUp(capacity)),
+          mask(buffer.size() - 1) {}
+
+    SPSCRing(const SPSCRing&) = delete;
+    SPSCRing& operator=(const SPSCRing&) = delete;
+
+    /** @brief Number of items the ring can hold. */
+    size_t GetCapacity() const { return buffer.size(); }
+
+    /** @brief Items currently queued. */
+    size_t Size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    /** @brief Items that can be written without overwriting unread data. */
+    size_t FreeSpace() const { return buffer.size() - Size(); }
+
+    /**
+     * @brief Appends items (producer only).
+     * @param items Items to copy in.
+     * @param count Number of items offered.
+     * @return Number written; less than @p count when the ring is full.
+     */
+    size_t Write(const T* items, size_t count) {
+        if (!items || count == 0) return 0;
+
+        const size_t writePos = head.load(std::memory_order_relaxed);
+        const size_t readPos = tail.load(std::memory_order_acquire);
+        const size_t n = std::min(count, buffer.size() - (writePos - readPos));
+
+        const size_t start = writePos & mask;
+        const size_t first = std::min(n, buffer.size() - start);
+        std::copy(items, items + first, buffer.begin() + static_cast<std::ptrdiff_t>(start));
+        std::copy(items + first, items + n, buffer.begin());
+
+        head.store(writePos + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief Removes the oldest items (consumer only).
+     * @param items Destination for up to @p count items.
+     * @param count Maximum number of items to take.
+     * @return Number read.
+     */
+    size_t Read(T* items, size_t count) {
+        if (!items || count == 0) return 0;
+
+        const size_t readPos = tail.load(std::memory_order_relaxed);
+        const size_t writePos = head.load(std::memory_order_acquire);
+        const size_t n = std::min(count, writePos - readPos);
+
+        const size_t start = readPos & mask;
+        const size_t first = std::min(n, buffer.size() - start);
+        std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(start),
+                  buffer.begin() + static_cast<std::ptrdiff_t>(start + first), items);
+        std::copy(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(n - first), items + first);
+
+        tail.store(readPos + n, std::memory_order_release);
+        return n;
+    }
+
+    /** @brief Drops every queued item (consumer only). */
+    void Discard() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    static size_t RoundUp(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        return size;
+    }
+
+    std::vector<T> buffer;
+    size_t mask;
+    alignas(64) std::atomic<size_t> head{0}; ///< Total items written; advanced by the producer.
+    alignas(64) std::atomic<size_t> tail{0}; ///< Total items read; advanced by the consumer.
+};
+
+} // namespace ptx
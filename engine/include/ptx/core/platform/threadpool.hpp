@@ -0,0 +1,122 @@
+/**
+ * @file threadpool.hpp
+ * @brief Shared worker pool for data-parallel engine work.
+ *
+ * The pool runs batches of independent work (queries, solver islands, render
+ * jobs) on a fixed set of worker threads. On targets without threading support
+ * (Arduino) every call runs inline on the calling thread, so callers can use the
+ * same code path on every platform.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#if !defined(ARDUINO)
+    #include <condition_variable>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+#endif
+
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size worker pool with a blocking parallel-for helper.
+ *
+ * ParallelFor() splits an index range into chunks that are claimed by the
+ * workers and by the calling thread, so it is safe to call from inside a task
+ * that is itself running on the pool.
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;                               ///< Fire-and-forget work item.
+    using RangeFunction = std::function<void(size_t begin, size_t end)>; ///< Body invoked for a [begin, end) chunk.
+
+    /**
+     * @brief Creates a pool.
+     * @param workerCount Number of worker threads. Zero selects hardware concurrency minus one.
+     */
+    explicit ThreadPool(size_t workerCount = 0);
+
+    /**
+     * @brief Stops the workers after draining queued tasks.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Gets the process-wide shared pool.
+     */
+    static ThreadPool& Shared();
+
+    /**
+     * @brief Number of worker threads (zero on single-threaded targets).
+     */
+    size_t GetWorkerCount() const;
+
+    /**
+     * @brief Total threads that take part in ParallelFor (workers plus caller).
+     */
+    size_t GetConcurrency() const { return GetWorkerCount() + 1; }
+
+    /**
+     * @brief Queues a task for asynchronous execution.
+     * @param task Work item; runs inline when the pool has no workers.
+     */
+    void Submit(Task task);
+
+    /**
+     * @brief Runs @p body over [0, count) in chunks of @p grainSize and blocks until done.
+     * @param count Number of indices.
+     * @param grainSize Indices per chunk (clamped to at least one).
+     * @param body Function invoked once per chunk; may run on any thread.
+     *
+     * The first exception thrown by @p body is rethrown on the calling thread.
+     */
+    void ParallelFor(size_t count, size_t grainSize, const RangeFunction& body);
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     */
+    void WaitIdle();
+
+private:
+#if !defined(ARDUINO)
+    std::vector<std::thread> workers;
+    std::deque<Task> tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable idle;
+    size_t activeTasks = 0;
+    bool stopping = false;
+
+    void WorkerLoop();
+#endif
+
+    PTX_BEGIN_FIELDS(ThreadPool)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(ThreadPool)
+        PTX_METHOD_AUTO(ThreadPool, GetWorkerCount, "Get worker count"),
+        PTX_METHOD_AUTO(ThreadPool, GetConcurrency, "Get concurrency"),
+        PTX_METHOD_AUTO(ThreadPool, WaitIdle, "Wait idle")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(ThreadPool)
+        PTX_CTOR(ThreadPool, size_t)
+    PTX_END_DESCRIBE(ThreadPool)
+};
+
+} // namespace ptx
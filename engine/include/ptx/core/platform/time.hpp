@@ -33,6 +33,29 @@ inline uint32_t Micros() {
     );
 #endif
 }
+
+/**
+ * @brief Monotonic nanosecond clock for frame pacing.
+ *
+ * Arduino only has micros(); the 32-bit counter is extended across wraps, so the
+ * result stays monotonic as long as it is read at least once every ~71 minutes.
+ */
+inline uint64_t Nanos() {
+#if defined(ARDUINO)
+    static uint32_t lastMicros = 0;
+    static uint64_t wrapMicros = 0;
+    const uint32_t now = micros();
+    if (now < lastMicros) wrapMicros += (uint64_t(1) << 32);
+    lastMicros = now;
+    return (wrapMicros + now) * 1000ull;
+#else
+    using namespace std::chrono;
+    return static_cast<std::uint64_t>(
+        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count()
+    );
+#endif
+}
+
     struct Reflection {
         static uint32_t Millis() { return ::ptx::Time::Millis(); }
         static uint32_t Micros() { return ::ptx::Time::Micros(); }
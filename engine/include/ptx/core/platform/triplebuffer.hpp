@@ -0,0 +1,78 @@
+/**
+ * @file triplebuffer.hpp
+ * @brief Lock-free latest-value handoff from one writer thread to one reader thread.
+ *
+ * The writer fills a private back buffer and publishes it by swapping it with the shared
+ * middle slot; the reader swaps the middle slot for its front buffer when a newer one is
+ * waiting. Neither side waits for the other, and the reader always sees a complete value.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace ptx {
+
+/**
+ * @class TripleBuffer
+ * @brief Three copies of @p T rotated between a writer, a shared slot and a reader.
+ *
+ * GetWriteBuffer()/Publish() belong to the writer thread, Acquire()/GetReadBuffer() to the
+ * reader thread. A value the reader holds stays untouched until its next Acquire().
+ *
+ * @tparam T Snapshot type; buffers are reused, so vectors keep their capacity.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    /** @brief Constructs three default values. */
+    TripleBuffer() = default;
+
+    /**
+     * @brief Constructs three copies of @p initial, e.g. to pre-size containers.
+     * @param initial Starting value of every buffer.
+     */
+    explicit TripleBuffer(const T& initial)
+        : buffers{initial, initial, initial} {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /** @brief Buffer the writer fills next (writer only). */
+    T& GetWriteBuffer() { return buffers[back]; }
+
+    /** @brief Hands the write buffer to the reader and takes back the stale one (writer only). */
+    void Publish() {
+        back = static_cast<uint8_t>(middle.exchange(static_cast<uint8_t>(back | kFresh), std::memory_order_acq_rel) & kIndex);
+    }
+
+    /**
+     * @brief Takes the newest published value if there is one (reader only).
+     * @return True if GetReadBuffer() changed.
+     */
+    bool Acquire() {
+        if ((middle.load(std::memory_order_relaxed) & kFresh) == 0) {
+            return false;
+        }
+        front = static_cast<uint8_t>(middle.exchange(front, std::memory_order_acq_rel) & kIndex);
+        return true;
+    }
+
+    /** @brief Value obtained by the last Acquire() (reader only). */
+    const T& GetReadBuffer() const { return buffers[front]; }
+
+private:
+    static constexpr uint8_t kIndex = 0x3; ///< Buffer index bits of the shared slot.
+    static constexpr uint8_t kFresh = 0x4; ///< Set while the shared slot holds an unread value.
+
+    T buffers[3];
+    uint8_t back = 0;                 ///< Writer's buffer.
+    uint8_t front = 1;                ///< Reader's buffer.
+    std::atomic<uint8_t> middle{2};   ///< Shared slot: buffer index plus kFresh.
+};
+
+} // namespace ptx
@@ -0,0 +1,182 @@
+/**
+ * @file audioanalyzer.hpp
+ * @brief Background audio analysis: capture ring in, smoothed spectrum bands and peaks out.
+ *
+ * The capture side pushes mono samples into a lock-free ring. An analysis thread drains
+ * the ring through a streaming STFT, maps the bins to log-spaced bands, smooths them and
+ * runs peak detection across the bands, then publishes the result through a triple
+ * buffer. The render thread acquires the latest snapshot once per frame without locking,
+ * so none of the analysis runs in frame time and no samples are lost when a frame runs long.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if !defined(ARDUINO)
+    #include <thread>
+#endif
+
+#include "stft.hpp"
+#include "filter/peakdetection.hpp"
+#include "../platform/spscring.hpp"
+#include "../platform/triplebuffer.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+/**
+ * @struct AudioAnalysis
+ * @brief One published analysis result.
+ */
+struct AudioAnalysis {
+    std::vector<float> bands;    ///< Smoothed band levels in [0, 1], low to high frequency.
+    std::vector<uint8_t> peaks;  ///< 1 for bands whose level jumped this frame, 0 otherwise.
+    uint64_t frame = 0;          ///< Analysis frames completed; 0 until the first one.
+};
+
+/**
+ * @class AudioAnalyzer
+ * @brief Owns the sample ring, the analysis thread and the published snapshots.
+ *
+ * Threading: PushSamples() belongs to the capture thread and Acquire() to the render
+ * thread. Start() runs the analysis on a dedicated thread; without it (or on targets
+ * without threads) call ProcessPending() from a single thread instead.
+ */
+class AudioAnalyzer {
+public:
+    /**
+     * @brief Constructor.
+     * @param sampleRate   Capture rate in Hz.
+     * @param frameSize    FFT size (power of two, >= 2).
+     * @param hopSize      Samples between analysis frames, in [1, frameSize].
+     * @param bandCount    Number of output bands (at least 1).
+     * @param minFrequency Lower edge of the first band in Hz; bands are log-spaced up to Nyquist.
+     * @throws std::invalid_argument if the frame or hop size is unsupported.
+     */
+    AudioAnalyzer(float sampleRate = 48000.0f, int frameSize = 1024, int hopSize = 256,
+                  size_t bandCount = 128, float minFrequency = 40.0f);
+
+    /** @brief Stops the analysis thread. */
+    ~AudioAnalyzer();
+
+    AudioAnalyzer(const AudioAnalyzer&) = delete;
+    AudioAnalyzer& operator=(const AudioAnalyzer&) = delete;
+
+    /**
+     * @brief Queues captured samples (capture thread). Never blocks or allocates.
+     * @param samples Mono samples, nominally in [-1, 1].
+     * @param count   Number of samples.
+     * @return Number accepted; the rest are counted in GetDroppedSamples().
+     */
+    size_t PushSamples(const float* samples, size_t count);
+
+    /**
+     * @brief Analyzes every complete hop waiting in the ring and publishes the result.
+     *
+     * Called by the analysis thread; call it directly only while the thread is stopped.
+     *
+     * @return Number of analysis frames completed.
+     */
+    size_t ProcessPending();
+
+    /**
+     * @brief Starts the analysis thread.
+     * @return False on targets without thread support; use ProcessPending() there.
+     */
+    bool Start();
+
+    /** @brief Stops and joins the analysis thread; queued samples are kept. */
+    void Stop();
+
+    /** @brief True while the analysis thread runs. */
+    bool IsRunning() const { return running.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Latest published analysis (render thread).
+     *
+     * The returned snapshot, including pointers into its vectors, stays valid and unchanged
+     * until the next Acquire(), so call it once per frame and bind the bands to materials.
+     */
+    const AudioAnalysis& Acquire();
+
+    /**
+     * @brief Sets the band smoothing (any thread).
+     * @param attack  Fraction of a rise applied per frame, in (0, 1]; 1 follows instantly.
+     * @param release Fraction of a fall applied per frame, in (0, 1].
+     */
+    void SetSmoothing(float attack, float release);
+
+    /**
+     * @brief Sets the level range mapped onto [0, 1] (any thread).
+     * @param decibels Span below full scale that maps to zero, e.g. 60.
+     */
+    void SetDynamicRange(float decibels);
+
+    /** @brief Number of output bands. */
+    size_t GetBandCount() const { return bandCount; }
+
+    /** @brief Capture rate in Hz. */
+    float GetSampleRate() const { return sampleRate; }
+
+    /** @brief STFT used by the analysis. */
+    const STFT& GetSTFT() const { return stft; }
+
+    /** @brief Samples rejected by PushSamples() because the ring was full. */
+    uint64_t GetDroppedSamples() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    float sampleRate;
+    size_t bandCount;
+    STFT stft;
+    PeakDetection peakDetection;
+    ptx::SPSCRing<float> ring;
+    ptx::TripleBuffer<AudioAnalysis> snapshots;
+
+    std::vector<size_t> bandEdges;     ///< bandCount + 1 bin indices; band b covers [edge b, edge b+1).
+    std::vector<float> rawBands;       ///< Unsmoothed band levels of the current frame.
+    std::vector<float> smoothedBands;  ///< Smoothed band levels carried between frames.
+    std::vector<uint8_t> bandPeaks;    ///< Peak flags of the current frame.
+    std::vector<float> scratch;        ///< Samples read from the ring.
+    float magnitudeScale;              ///< Converts bin magnitude to sine amplitude.
+    uint64_t frameCount = 0;
+
+    std::atomic<float> attack{0.6f};
+    std::atomic<float> release{0.15f};
+    std::atomic<float> dynamicRange{60.0f};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> running{false};
+
+#if !defined(ARDUINO)
+    std::thread worker;
+
+    void Run();
+#endif
+
+    void AnalyzeFrame();
+
+    PTX_BEGIN_FIELDS(AudioAnalyzer)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(AudioAnalyzer)
+        PTX_METHOD_AUTO(AudioAnalyzer, PushSamples, "Push samples"),
+        PTX_METHOD_AUTO(AudioAnalyzer, ProcessPending, "Process pending"),
+        PTX_METHOD_AUTO(AudioAnalyzer, Start, "Start"),
+        PTX_METHOD_AUTO(AudioAnalyzer, Stop, "Stop"),
+        PTX_METHOD_AUTO(AudioAnalyzer, IsRunning, "Is running"),
+        PTX_METHOD_AUTO(AudioAnalyzer, SetSmoothing, "Set smoothing"),
+        PTX_METHOD_AUTO(AudioAnalyzer, SetDynamicRange, "Set dynamic range"),
+        PTX_METHOD_AUTO(AudioAnalyzer, GetBandCount, "Get band count"),
+        PTX_METHOD_AUTO(AudioAnalyzer, GetSampleRate, "Get sample rate"),
+        PTX_METHOD_AUTO(AudioAnalyzer, GetDroppedSamples, "Get dropped samples")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(AudioAnalyzer)
+        PTX_CTOR(AudioAnalyzer, float, int, int, size_t, float)
+    PTX_END_DESCRIBE(AudioAnalyzer)
+};
@@ -9,6 +9,13 @@
 
 // Interleaved complex buffer layout: data[2*i] = Re, data[2*i+1] = Im.
 // The FFT size must be a power of two and at least two.
+//
+// Complex transforms run radix-4 passes (two radix-2 stages per sweep over the
+// data) with an extra radix-2 pass when log2(size) is odd. With SSE2 or NEON the
+// passes process four butterflies per step; otherwise a scalar loop is used.
+//
+// Real spectra hold the Size() / 2 + 1 non-negative frequency bins, interleaved
+// like complex data, so a real spectrum buffer has Size() + 2 floats.
 
 class FFT {
 public:
@@ -31,7 +38,7 @@ public:
     int Size() const noexcept { return size_; }
 
     /**
-     * @brief In-place Cooley–Tukey radix-2 FFT (complex -> complex).
+     * @brief In-place Cooley–Tukey FFT (complex -> complex).
      * @param data Interleaved complex buffer of length 2*Size().
      */
     void Forward(float* data) const;
@@ -43,6 +50,25 @@ public:
      */
     void Inverse(float* data, bool scale = true) const;
 
+    /**
+     * @brief Real -> complex FFT of Size() samples.
+     *
+     * Packs even and odd samples into a Size() / 2 point complex transform and
+     * untangles the result, roughly halving the work of Forward() on zero-imaginary data.
+     *
+     * @param input    Real samples, length Size().
+     * @param spectrum Output bins 0..Size()/2, length Size() + 2. May not alias @p input.
+     */
+    void ForwardReal(const float* input, float* spectrum) const;
+
+    /**
+     * @brief Complex -> real inverse of ForwardReal().
+     * @param spectrum Bins 0..Size()/2, length Size() + 2.
+     * @param output   Real samples, length Size(). May alias @p spectrum.
+     * @param scale    If true, divide the result by Size().
+     */
+    void InverseReal(const float* spectrum, float* output, bool scale = true) const;
+
     /**
      * @brief Compute magnitudes from an interleaved complex buffer.
      * @param complexData Input array of length 2*Size().
@@ -50,6 +76,13 @@ public:
      */
     void ComplexMagnitude(const float* complexData, float* magnitude) const;
 
+    /**
+     * @brief Compute magnitudes of a real spectrum from ForwardReal().
+     * @param spectrum  Input array of length Size() + 2.
+     * @param magnitude Output array of length Size() / 2 + 1.
+     */
+    void RealMagnitude(const float* spectrum, float* magnitude) const;
+
     /** @brief Validate that @p fftSize is a power of two and >= 2. */
     static bool IsValidSize(int fftSize) noexcept;
 
@@ -60,10 +93,13 @@ private:
     mutable std::vector<float> cosTable_;
     mutable std::vector<float> sinTable_;
     mutable std::vector<uint32_t> bitrevLUT_;
+    mutable std::vector<float> radix4Twiddles_;   ///< Per pass: split re/im twiddles for both merged stages
+    mutable const FFT* half_ = nullptr;           ///< Size() / 2 transform used by the real FFT
 
     void EnsureTables() const;
     void InitializeTables() const;
     void BitReverseOrder(float* data) const;
+    void Transform(float* data, float direction) const;
 
     static int ComputeBitCount(int size);
 
@@ -76,7 +112,10 @@ private:
         PTX_METHOD_AUTO(FFT, Size, "Size"),
         PTX_METHOD_AUTO(FFT, Forward, "Forward"),
         PTX_METHOD_AUTO(FFT, Inverse, "Inverse"),
+        PTX_METHOD_AUTO(FFT, ForwardReal, "Forward real"),
+        PTX_METHOD_AUTO(FFT, InverseReal, "Inverse real"),
         PTX_METHOD_AUTO(FFT, ComplexMagnitude, "Complex magnitude"),
+        PTX_METHOD_AUTO(FFT, RealMagnitude, "Real magnitude"),
         PTX_SMETHOD_AUTO(FFT::IsValidSize, "Is valid size")
     PTX_END_METHODS
 
@@ -14,6 +14,7 @@
 
 #include <cstddef>
 #include <vector>
+#include "monotonicwindow.hpp"
 #include "../../../registry/reflect_macros.hpp"
 
 /**
@@ -28,14 +29,10 @@ class MaxFilter {
 private:
     size_t capacity;              ///< Size of the sliding window.
     size_t blockCount;            ///< Number of blocks used for peak tracking.
-    std::vector<float> values;    ///< Circular buffer of values.
-    std::vector<float> maxValues; ///< Maximum values per block.
-    size_t currentAmount = 0;     ///< Number of values currently stored in the buffer.
-
-    /**
-     * @brief Shifts the values in the provided array to make room for a new value.
-     */
-    static void ShiftArray(std::vector<float>& arr);
+    MonotonicWindow<std::greater<float>> window; ///< Sliding-window maximum.
+    std::vector<float> maxValues; ///< Ring of recent window maximums, oldest at maxHead.
+    size_t maxHead = 0;           ///< Oldest entry in maxValues.
+    double maxSum = 0.0;          ///< Running sum of maxValues.
 
 public:
     /**
@@ -48,11 +45,22 @@ public:
     /**
      * @brief Filters the given value, updating the maximum value within the memory window.
      *
+     * Each sample costs amortized O(1) regardless of the window size.
+     *
      * @param value The input value to filter.
      * @return The maximum value within the memory window after updating with the new value.
      */
     float Filter(float value);
 
+    /**
+     * @brief Filters a block of samples, equivalent to calling Filter() on each in order.
+     *
+     * @param input Input samples.
+     * @param output Receives the filtered value for each sample; may alias @p input.
+     * @param count Number of samples.
+     */
+    void FilterBlock(const float* input, float* output, size_t count);
+
     /**
      * @brief Resets the filter to an initial state filled with zeros.
      */
@@ -69,6 +77,7 @@ public:
 
     PTX_BEGIN_METHODS(MaxFilter)
         PTX_METHOD_AUTO(MaxFilter, Filter, "Filter"),
+        PTX_METHOD_AUTO(MaxFilter, FilterBlock, "Filter block"),
         PTX_METHOD_AUTO(MaxFilter, Reset, "Reset"),
         PTX_METHOD_AUTO(MaxFilter, GetCapacity, "Get capacity")
     PTX_END_METHODS
@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <vector>
+#include "monotonicwindow.hpp"
 #include "../../../registry/reflect_macros.hpp"
 
 /**
@@ -29,16 +30,12 @@ class MinFilter {
 private:
     size_t capacity;                   ///< Size of the sliding window.
     size_t blockCount;                 ///< Number of blocks used for minimum tracking.
-    std::vector<float> values;         ///< Circular buffer of values.
-    std::vector<float> minValues;      ///< Minimum values per block.
-    size_t currentAmount = 0;          ///< Number of values currently stored in the buffer.
+    MonotonicWindow<std::less<float>> window; ///< Sliding-window minimum.
+    std::vector<float> minValues;      ///< Ring of recent window minimums, oldest at minHead.
+    size_t minHead = 0;                ///< Oldest entry in minValues.
+    double minSum = 0.0;               ///< Running sum of minValues.
     bool ignoreSame;                   ///< Whether to ignore consecutive identical values.
 
-    /**
-     * @brief Shifts the values in the provided array to make room for a new value.
-     */
-    static void ShiftArray(std::vector<float>& arr);
-
 public:
     /**
      * @brief Constructs a `MinFilter` with the specified memory size and behavior.
@@ -51,11 +48,22 @@ public:
     /**
      * @brief Filters the given value, updating the minimum value within the memory window.
      *
+     * Each sample costs amortized O(1) regardless of the window size.
+     *
      * @param value The input value to filter.
      * @return The minimum value within the memory window after updating with the new value.
      */
     float Filter(float value);
 
+    /**
+     * @brief Filters a block of samples, equivalent to calling Filter() on each in order.
+     *
+     * @param input Input samples.
+     * @param output Receives the filtered value for each sample; may alias @p input.
+     * @param count Number of samples.
+     */
+    void FilterBlock(const float* input, float* output, size_t count);
+
     /**
      * @brief Resets the filter to an initial state filled with zeros.
      */
@@ -72,6 +80,7 @@ public:
 
     PTX_BEGIN_METHODS(MinFilter)
         PTX_METHOD_AUTO(MinFilter, Filter, "Filter"),
+        PTX_METHOD_AUTO(MinFilter, FilterBlock, "Filter block"),
         PTX_METHOD_AUTO(MinFilter, Reset, "Reset"),
         PTX_METHOD_AUTO(MinFilter, GetCapacity, "Get capacity")
     PTX_END_METHODS
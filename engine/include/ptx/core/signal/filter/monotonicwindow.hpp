@@ -0,0 +1,89 @@
+/**
+ * @file monotonicwindow.hpp
+ * @brief Sliding-window minimum/maximum in amortized O(1) per sample.
+ *
+ * The window keeps a monotonic deque of candidate extremes in a fixed ring: each new
+ * sample evicts the candidates it dominates from the back and expired samples leave from
+ * the front, so every sample enters and leaves the deque once regardless of window size.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @class MonotonicWindow
+ * @brief Running extreme of the last N samples.
+ *
+ * @tparam Compare std::less<float> tracks the minimum, std::greater<float> the maximum.
+ */
+template <typename Compare>
+class MonotonicWindow {
+public:
+    /**
+     * @brief Constructor.
+     * @param window Number of samples covered, at least 1.
+     */
+    explicit MonotonicWindow(size_t window)
+        : window(window > 0 ? window : 1),
+          values(this->window),
+          indices(this->window) {}
+
+    /**
+     * @brief Adds a sample and returns the extreme of the window ending at it.
+     * @param value Newest sample.
+     * @return Minimum or maximum of the last GetWindow() samples (fewer until the window fills).
+     */
+    float Push(float value) {
+        // Exactly one sample leaves the window per push, and only the front can be that old.
+        if (count > 0 && indices[head] + window <= next) {
+            head = head + 1 == window ? 0 : head + 1;
+            --count;
+        }
+
+        // Candidates the new sample beats can never be the extreme again.
+        while (count > 0 && !compare(values[Slot(count - 1)], value)) {
+            --count;
+        }
+
+        const size_t slot = Slot(count);
+        values[slot] = value;
+        indices[slot] = next++;
+        ++count;
+
+        return values[head];
+    }
+
+    /** @brief Current extreme; zero before the first sample. */
+    float Get() const { return count > 0 ? values[head] : 0.0f; }
+
+    /** @brief Number of samples covered. */
+    size_t GetWindow() const { return window; }
+
+    /** @brief Forgets all samples. */
+    void Reset() {
+        head = 0;
+        count = 0;
+        next = 0;
+    }
+
+private:
+    size_t window;
+    std::vector<float> values;    ///< Candidate values, monotonic from head.
+    std::vector<uint64_t> indices;///< Sample index of each candidate.
+    size_t head = 0;              ///< Ring slot of the front candidate.
+    size_t count = 0;             ///< Candidates in the ring.
+    uint64_t next = 0;            ///< Index of the next sample.
+    Compare compare;
+
+    size_t Slot(size_t offset) const {
+        const size_t slot = head + offset;
+        return slot >= window ? slot - window : slot;
+    }
+};
@@ -4,6 +4,9 @@
  *
  * The `PeakDetection` class identifies peaks in a data stream by maintaining a moving
  * average and standard deviation and comparing incoming values against a dynamic threshold.
+ * The statistics are updated incrementally as the window slides, so each sample costs O(1)
+ * regardless of the lag. A multi-channel mode runs the same test on every element of a
+ * frame at once (e.g. every FFT bin of a spectrum), four channels per SIMD step.
  *
  * @date 22/12/2024
  * @version 1.0
@@ -25,6 +28,11 @@
  * template implementation while allowing the caller to choose the sample window
  * size at runtime. Incoming values are compared against a moving average and
  * standard deviation to determine whether they exceed a configurable threshold.
+ *
+ * Calculate() scans one buffer along its length. CalculateChannels() instead treats each of
+ * the `sampleSize` elements as an independent channel and each call as the next time step,
+ * keeping `lag` frames of history per channel. That history is allocated on the first
+ * CalculateChannels() call, so detectors that only use Calculate() do not carry it.
  */
 
 class PeakDetection {
@@ -34,10 +42,16 @@ private:
     float threshold;                ///< Standard deviation multiplier that triggers a peak.
     float influence;                ///< Influence of a detected peak on subsequent calculations.
     std::vector<float> filteredData; ///< Filtered data used to blend peak influence.
-    std::vector<float> averages;     ///< Cached moving averages of the window.
-    std::vector<float> deviations;   ///< Cached moving standard deviations of the window.
 
-    void GetStdDev(size_t start, size_t length, const float* data, float& avgRet, float& stdRet) const;
+    std::vector<float> channelHistory;  ///< `lag` frames of filtered channel values, one frame per row; empty until first used.
+    std::vector<float> channelMeans;    ///< Running mean of each channel's history.
+    std::vector<float> channelM2;       ///< Running sum of squared deviations of each channel's history.
+    std::vector<float> channelFiltered; ///< Latest filtered value of each channel.
+    size_t channelHead;                 ///< History row the next frame replaces.
+    size_t channelFrames;               ///< Frames seen, saturating at `lag`.
+    size_t channelUpdates;              ///< Sliding updates since the statistics were last recomputed.
+
+    void RecomputeChannelStatistics();
 
 public:
     /**
@@ -59,10 +73,27 @@ public:
     void Calculate(const float* data, std::vector<bool>& peaks);
 
     /**
-     * @brief Clears cached statistics, preparing the detector for a new sequence.
+     * @brief Runs one time step of peak detection on every channel.
+     *
+     * Element `i` of @p frame is the newest sample of channel `i`. A channel reports a peak
+     * when the sample rises more than `threshold` standard deviations above the mean of its
+     * last `lag` filtered samples. No peaks are reported until `lag` frames have been seen.
+     *
+     * @param frame  Pointer to `sampleSize` channel samples, e.g. a magnitude spectrum.
+     * @param peaks  Output vector (resized to `sampleSize`) set to 1 for channels that peaked, 0 otherwise.
+     */
+    void CalculateChannels(const float* frame, std::vector<uint8_t>& peaks);
+
+    /**
+     * @brief Clears cached statistics and channel history, preparing the detector for a new sequence.
      */
     void Reset();
 
+    /**
+     * @brief Checks whether the multi-channel state has been allocated by CalculateChannels().
+     */
+    bool HasChannelState() const { return !channelHistory.empty(); }
+
     /**
      * @brief Retrieves the configured sample window size.
      */
@@ -89,7 +120,9 @@ public:
 
     PTX_BEGIN_METHODS(PeakDetection)
         PTX_METHOD_AUTO(PeakDetection, Calculate, "Calculate"),
+        PTX_METHOD_AUTO(PeakDetection, CalculateChannels, "Calculate channels"),
         PTX_METHOD_AUTO(PeakDetection, Reset, "Reset"),
+        PTX_METHOD_AUTO(PeakDetection, HasChannelState, "Has channel state"),
         PTX_METHOD_AUTO(PeakDetection, GetSampleSize, "Get sample size"),
         PTX_METHOD_AUTO(PeakDetection, GetLag, "Get lag"),
         PTX_METHOD_AUTO(PeakDetection, GetThreshold, "Get threshold"),
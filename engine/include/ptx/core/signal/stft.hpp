@@ -0,0 +1,141 @@
+/**
+ * @file stft.hpp
+ * @brief Streaming short-time Fourier transform with hop size, cached windows and overlap-add resynthesis.
+ *
+ * Samples are pushed in arbitrary block sizes. Every hop, the last frame of samples is
+ * windowed with a precomputed window and transformed with FFT::ForwardReal(), leaving the
+ * spectrum and bin magnitudes ready to read. Synthesize() runs the inverse path: inverse
+ * real FFT, synthesis window and overlap-add, producing one hop of output per frame with
+ * the window overlap normalized away.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "fft.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+/**
+ * @class STFT
+ * @brief Frame-by-frame spectral analysis and overlap-add resynthesis of a sample stream.
+ *
+ * Analysis output lags the input by one frame; resynthesized output lags by
+ * FrameSize() - HopSize() samples. Nothing is allocated after construction.
+ */
+class STFT {
+public:
+    /**
+     * @enum Window
+     * @brief Analysis/synthesis window shapes (periodic forms, so Hann at 50% or 75% overlap sums flat).
+     */
+    enum class Window : uint8_t {
+        Rectangular,
+        Hann,
+        Hamming,
+        Blackman
+    };
+
+    /**
+     * @brief Constructor.
+     * @param frameSize Samples per frame (FFT size, power of two, >= 2).
+     * @param hopSize   Samples between frame starts, in [1, frameSize].
+     * @param shape     Window applied before analysis and after resynthesis.
+     * @throws std::invalid_argument if the sizes are unsupported.
+     */
+    STFT(int frameSize, int hopSize, Window shape = Window::Hann);
+
+    /** @brief Samples per frame. */
+    int GetFrameSize() const { return frameSize; }
+
+    /** @brief Samples between frame starts. */
+    int GetHopSize() const { return hopSize; }
+
+    /** @brief Number of spectrum bins, FrameSize() / 2 + 1. */
+    int GetBinCount() const { return frameSize / 2 + 1; }
+
+    /**
+     * @brief Consumes samples until the next frame completes.
+     *
+     * Call repeatedly with the remaining samples; after each call HasFrame() tells
+     * whether a new spectrum is ready.
+     *
+     * @param samples Input samples.
+     * @param count   Number of samples available.
+     * @return Number of samples consumed (less than @p count only when a frame completed).
+     */
+    size_t Push(const float* samples, size_t count);
+
+    /** @brief True if the last Push() completed a frame. */
+    bool HasFrame() const { return hasFrame; }
+
+    /** @brief Spectrum of the latest frame, GetBinCount() interleaved complex bins. */
+    const float* GetSpectrum() const { return spectrum.data(); }
+
+    /** @brief Magnitudes of the latest frame, GetBinCount() values. */
+    const float* GetMagnitudes() const { return magnitudes.data(); }
+
+    /** @brief Cached window, FrameSize() values. */
+    const float* GetWindow() const { return window.data(); }
+
+    /**
+     * @brief Inverse-transforms a spectrum and overlap-adds it into the output stream.
+     *
+     * Output positions where every overlapping window is zero (e.g. Hann with no
+     * overlap) cannot be recovered and come out as zero.
+     *
+     * @param frameSpectrum GetBinCount() interleaved complex bins, e.g. a modified GetSpectrum().
+     */
+    void Synthesize(const float* frameSpectrum);
+
+    /** @brief The HopSize() samples completed by the last Synthesize(). */
+    const float* GetOutput() const { return output.data(); }
+
+    /** @brief Drops buffered input and overlap-add state. */
+    void Reset();
+
+private:
+    int frameSize;
+    int hopSize;
+    const FFT& fft;
+
+    std::vector<float> window;        ///< Analysis and synthesis window.
+    std::vector<float> normalization; ///< Per output position: 1 / sum of overlapping squared windows.
+    std::vector<float> input;         ///< Current frame being filled; keeps the overlap between frames.
+    std::vector<float> frame;         ///< Windowed or resynthesized frame scratch.
+    std::vector<float> spectrum;      ///< Latest analysis spectrum.
+    std::vector<float> magnitudes;    ///< Latest analysis magnitudes.
+    std::vector<float> accumulator;   ///< Overlap-add sums for the next FrameSize() output samples.
+    std::vector<float> output;        ///< Last completed hop of output.
+    size_t filled = 0;
+    bool hasFrame = false;
+
+    void Analyze();
+
+    PTX_BEGIN_FIELDS(STFT)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(STFT)
+        PTX_METHOD_AUTO(STFT, GetFrameSize, "Get frame size"),
+        PTX_METHOD_AUTO(STFT, GetHopSize, "Get hop size"),
+        PTX_METHOD_AUTO(STFT, GetBinCount, "Get bin count"),
+        PTX_METHOD_AUTO(STFT, Push, "Push"),
+        PTX_METHOD_AUTO(STFT, HasFrame, "Has frame"),
+        PTX_METHOD_AUTO(STFT, GetSpectrum, "Get spectrum"),
+        PTX_METHOD_AUTO(STFT, GetMagnitudes, "Get magnitudes"),
+        PTX_METHOD_AUTO(STFT, GetWindow, "Get window"),
+        PTX_METHOD_AUTO(STFT, Synthesize, "Synthesize"),
+        PTX_METHOD_AUTO(STFT, GetOutput, "Get output"),
+        PTX_METHOD_AUTO(STFT, Reset, "Reset")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(STFT)
+        PTX_CTOR(STFT, int, int, Window)
+    PTX_END_DESCRIBE(STFT)
+
+};
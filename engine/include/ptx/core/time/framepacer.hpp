@@ -0,0 +1,244 @@
+/**
+ * @file framepacer.hpp
+ * @brief Deadline-based frame pacing with hybrid sleep/spin waiting and jitter telemetry.
+ *
+ * FramePacer keeps an absolute schedule on the monotonic nanosecond clock. Each wait
+ * sleeps coarsely until shortly before the deadline and spins for the remainder, so
+ * frames land on the deadline instead of drifting by the OS sleep granularity. Frame
+ * time, lateness and missed frames are recorded into fixed-bucket histograms that can
+ * be exported as JSON.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "timestep.hpp"
+#include "../platform/time.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+/**
+ * @class FrameHistogram
+ * @brief Fixed-width bucket histogram with an overflow bucket and running min/max/mean.
+ *
+ * Values are unit-agnostic; FramePacer records microseconds for times and frame counts
+ * for misses. Recording is O(1) and allocation-free after construction.
+ */
+class FrameHistogram {
+private:
+    std::vector<uint32_t> buckets; ///< Counts per bucket, bucket i covers [i*width, (i+1)*width).
+    uint32_t bucketWidth;          ///< Width of each bucket.
+    uint32_t overflow = 0;         ///< Values beyond the last bucket.
+    uint32_t count = 0;            ///< Total values recorded.
+    uint64_t sum = 0;              ///< Sum of recorded values.
+    uint32_t minValue = 0;         ///< Smallest recorded value.
+    uint32_t maxValue = 0;         ///< Largest recorded value.
+
+public:
+    /**
+     * @brief Creates a histogram.
+     * @param bucketWidth Width of each bucket (clamped to at least 1).
+     * @param bucketCount Number of buckets before the overflow bucket (clamped to at least 1).
+     */
+    FrameHistogram(uint32_t bucketWidth, uint16_t bucketCount);
+
+    /**
+     * @brief Records one value.
+     * @param value Value in the histogram's unit.
+     */
+    void Record(uint32_t value);
+
+    /**
+     * @brief Clears all counts and statistics.
+     */
+    void Reset();
+
+    /** @brief Gets the number of regular buckets. */
+    uint16_t GetBucketCount() const;
+
+    /** @brief Gets the width of each bucket. */
+    uint32_t GetBucketWidth() const;
+
+    /**
+     * @brief Gets the count of one bucket.
+     * @param index Bucket index; out of range returns 0.
+     */
+    uint32_t GetBucket(uint16_t index) const;
+
+    /** @brief Gets the number of values beyond the last bucket. */
+    uint32_t GetOverflow() const;
+
+    /** @brief Gets the total number of recorded values. */
+    uint32_t GetCount() const;
+
+    /** @brief Gets the smallest recorded value, 0 if empty. */
+    uint32_t GetMin() const;
+
+    /** @brief Gets the largest recorded value, 0 if empty. */
+    uint32_t GetMax() const;
+
+    /** @brief Gets the mean of recorded values, 0 if empty. */
+    float GetMean() const;
+
+    /**
+     * @brief Estimates a percentile from the buckets.
+     * @param fraction Percentile in [0, 1], e.g. 0.99.
+     * @return Upper edge of the bucket containing the percentile, or the max if it falls in the overflow.
+     */
+    uint32_t GetPercentile(float fraction) const;
+
+    /**
+     * @brief Serializes the histogram as a JSON object.
+     * @return JSON text with width, count, overflow, min/max/mean, p50/p90/p99 and bucket counts.
+     */
+    std::string ToJson() const;
+};
+
+/**
+ * @class FramePacer
+ * @brief Paces a loop to a target frequency and records how well it kept to it.
+ *
+ * Call WaitForNextFrame() once per iteration. The first call starts the schedule and
+ * returns immediately; later calls block until the next deadline. Deadlines advance by
+ * exactly one period, so a frame that finishes late is followed by a shorter wait. A
+ * frame that overruns by a whole period or more counts as missed and the schedule is
+ * restarted from the current time rather than trying to catch up.
+ */
+class FramePacer {
+public:
+    /**
+     * @brief Creates a pacer.
+     * @param frequency Target frequency in Hz.
+     */
+    explicit FramePacer(float frequency = 60.0f);
+
+    virtual ~FramePacer() = default;
+
+    // === Configuration ===
+
+    /**
+     * @brief Sets the target frequency; takes effect from the next deadline.
+     * @param frequency Target frequency in Hz, non-positive values are ignored.
+     */
+    void SetFrequency(float frequency);
+
+    /** @brief Gets the target frequency in Hz. */
+    float GetFrequency() const;
+
+    /** @brief Gets the target period in nanoseconds. */
+    uint64_t GetPeriodNanos() const;
+
+    /**
+     * @brief Sets how long before the deadline the pacer stops sleeping and starts spinning.
+     * @param micros Spin window in microseconds; larger absorbs more sleep overshoot at a CPU cost.
+     */
+    void SetSpinMicros(uint32_t micros);
+
+    /** @brief Gets the spin window in microseconds. */
+    uint32_t GetSpinMicros() const;
+
+    /**
+     * @brief Feeds each frame's elapsed time into a fixed-timestep accumulator.
+     * @param timeStep TimeStep to accumulate into, or nullptr to disable.
+     */
+    void SetFixedStep(TimeStep* timeStep);
+
+    // === Pacing ===
+
+    /**
+     * @brief Blocks until the next frame deadline.
+     * @return Seconds since the previous call returned, 0 on the first call.
+     */
+    float WaitForNextFrame();
+
+    /**
+     * @brief Restarts the schedule; the next wait returns immediately. Statistics are kept.
+     */
+    void Restart();
+
+    /** @brief Gets the delta returned by the last WaitForNextFrame(). */
+    float GetDeltaSeconds() const;
+
+    // === Telemetry ===
+
+    /** @brief Gets the number of paced frames. */
+    uint32_t GetFrameCount() const;
+
+    /** @brief Gets the total number of missed deadlines. */
+    uint32_t GetMissedFrames() const;
+
+    /** @brief Histogram of wake-to-wake frame times in microseconds. */
+    const FrameHistogram& GetFrameTimeHistogram() const;
+
+    /** @brief Histogram of wake lateness past the deadline in microseconds. */
+    const FrameHistogram& GetLatenessHistogram() const;
+
+    /** @brief Histogram of deadlines skipped per overrun. */
+    const FrameHistogram& GetMissedHistogram() const;
+
+    /**
+     * @brief Clears all statistics without disturbing the schedule.
+     */
+    void ResetStats();
+
+    /**
+     * @brief Serializes the configuration and all histograms as JSON.
+     * @return JSON object text.
+     */
+    std::string ExportJson() const;
+
+    PTX_BEGIN_FIELDS(FramePacer)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(FramePacer)
+        PTX_METHOD_AUTO(FramePacer, SetFrequency, "Set frequency"),
+        PTX_METHOD_AUTO(FramePacer, GetFrequency, "Get frequency"),
+        PTX_METHOD_AUTO(FramePacer, SetSpinMicros, "Set spin micros"),
+        PTX_METHOD_AUTO(FramePacer, GetSpinMicros, "Get spin micros"),
+        PTX_METHOD_AUTO(FramePacer, WaitForNextFrame, "Wait for next frame"),
+        PTX_METHOD_AUTO(FramePacer, Restart, "Restart"),
+        PTX_METHOD_AUTO(FramePacer, GetDeltaSeconds, "Get delta seconds"),
+        PTX_METHOD_AUTO(FramePacer, GetFrameCount, "Get frame count"),
+        PTX_METHOD_AUTO(FramePacer, GetMissedFrames, "Get missed frames"),
+        PTX_METHOD_AUTO(FramePacer, ResetStats, "Reset stats")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(FramePacer)
+        PTX_CTOR(FramePacer, float)
+    PTX_END_DESCRIBE(FramePacer)
+
+protected:
+    /**
+     * @brief Reads the monotonic clock; overridable for deterministic tests.
+     * @return Current time in nanoseconds.
+     */
+    virtual uint64_t Now();
+
+    /**
+     * @brief Coarse sleep; may overshoot, the spin phase absorbs it.
+     * @param nanos Requested sleep in nanoseconds.
+     */
+    virtual void Sleep(uint64_t nanos);
+
+private:
+    float frequency;                    ///< Target frequency in Hz.
+    uint64_t periodNanos;               ///< Target period in nanoseconds.
+    uint64_t spinNanos;                 ///< Spin window before each deadline.
+    TimeStep* fixedStep = nullptr;      ///< Optional fixed-timestep accumulator.
+
+    bool started = false;               ///< True once the schedule has a deadline.
+    uint64_t deadline = 0;              ///< Next frame deadline.
+    uint64_t lastWake = 0;              ///< Time the previous wait returned.
+    float deltaSeconds = 0.0f;          ///< Last returned delta.
+
+    uint32_t frameCount = 0;            ///< Frames paced since the last ResetStats().
+    uint32_t missedFrames = 0;          ///< Deadlines missed since the last ResetStats().
+    FrameHistogram frameTimes;          ///< Frame time histogram, microseconds.
+    FrameHistogram lateness;            ///< Lateness histogram, microseconds.
+    FrameHistogram missed;              ///< Deadlines skipped per overrun.
+};
@@ -21,6 +21,9 @@ class TimeStep {
 private:
     uint32_t previousMillis; ///< Stores the last recorded time in milliseconds.
     uint16_t updateInterval;      ///< Interval in milliseconds between updates.
+    float stepSeconds = 0.0f;     ///< Fixed step length in seconds for accumulation.
+    float accumulated = 0.0f;     ///< Time fed through Accumulate() not yet consumed.
+    uint16_t maxSteps = 5;        ///< Most steps the accumulator may hold; 0 for no limit.
 
 public:
     /**
@@ -41,13 +44,60 @@ public:
      */
     bool IsReady();
 
+    /**
+     * @brief Adds elapsed time for fixed-step updates, e.g. from a FramePacer.
+     *
+     * The backlog is capped at GetMaxSteps() steps, so after a long stall (debugger break,
+     * window drag, suspend) the time beyond the cap is dropped instead of being replayed
+     * as hundreds of catch-up steps.
+     *
+     * @param seconds Elapsed time in seconds; negative values are ignored.
+     */
+    void Accumulate(float seconds);
+
+    /**
+     * @brief Sets how many steps the accumulator may hold at most.
+     * @param steps Step cap, 0 for no limit.
+     */
+    void SetMaxSteps(uint16_t steps);
+
+    /**
+     * @brief Gets the step cap.
+     * @return Maximum steps held, 0 if unlimited.
+     */
+    uint16_t GetMaxSteps() const;
+
+    /**
+     * @brief Consumes one fixed step if enough time has accumulated.
+     * @return True if a step was consumed; call in a loop to drain the backlog.
+     */
+    bool ConsumeStep();
+
+    /**
+     * @brief Fraction of a step left in the accumulator, for interpolating between steps.
+     * @return Value in [0, 1).
+     */
+    float GetAlpha() const;
+
+    /**
+     * @brief Gets the fixed step length.
+     * @return Step length in seconds.
+     */
+    float GetStepSeconds() const;
+
     PTX_BEGIN_FIELDS(TimeStep)
         /* No reflected fields. */
     PTX_END_FIELDS
 
     PTX_BEGIN_METHODS(TimeStep)
         PTX_METHOD_AUTO(TimeStep, SetFrequency, "Set frequency"),
-        PTX_METHOD_AUTO(TimeStep, IsReady, "Is ready")
+        PTX_METHOD_AUTO(TimeStep, IsReady, "Is ready"),
+        PTX_METHOD_AUTO(TimeStep, Accumulate, "Accumulate"),
+        PTX_METHOD_AUTO(TimeStep, SetMaxSteps, "Set max steps"),
+        PTX_METHOD_AUTO(TimeStep, GetMaxSteps, "Get max steps"),
+        PTX_METHOD_AUTO(TimeStep, ConsumeStep, "Consume step"),
+        PTX_METHOD_AUTO(TimeStep, GetAlpha, "Get alpha"),
+        PTX_METHOD_AUTO(TimeStep, GetStepSeconds, "Get step seconds")
     PTX_END_METHODS
 
     PTX_BEGIN_DESCRIBE(TimeStep)
@@ -2,20 +2,32 @@
  * @file profiler.hpp
  * @brief Performance profiling system for measuring CPU and GPU time.
  *
+ * Two recording modes are available. Detailed mode keeps per-frame results and statistics
+ * behind a mutex. Low-overhead mode is meant for hot paths. Each thread appends
+ * (name id, start, end) events to its own lock-free ring, and scope names are interned
+ * once per PTX_PROFILE_SCOPE call site. A collector drains the rings into statistics and,
+ * while a trace is open, into a Chrome trace_event file with one lane per thread.
+ *
  * @date 11/10/2025
  * @author Coela
  */
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <thread>
 #include <mutex>
-#include "../../registry/reflect_macros.hpp"
+#include "../core/platform/spscring.hpp"
+#include "../registry/reflect_macros.hpp"
 
 namespace ptx {
 
@@ -82,17 +94,55 @@ struct ProfileStats {
 
 };
 
+/**
+ * @enum ProfilerMode
+ * @brief How scopes opened through PTX_PROFILE_SCOPE are recorded.
+ */
+enum class ProfilerMode : uint8_t {
+    Detailed,    ///< Per-frame results and statistics under the profiler mutex.
+    LowOverhead  ///< Lock-free per-thread event rings, drained by the collector.
+};
+
+/**
+ * @struct TraceEvent
+ * @brief One completed scope in a thread's event ring.
+ */
+struct TraceEvent {
+    uint64_t start;   ///< Steady-clock nanoseconds at scope entry.
+    uint64_t end;     ///< Steady-clock nanoseconds at scope exit.
+    uint32_t nameId;  ///< Interned scope name.
+};
+
 /**
  * @class Profiler
  * @brief Central profiling system for performance measurement.
  */
 class Profiler {
 private:
+    /**
+     * @brief Event ring owned by one recording thread.
+     *
+     * The thread is the only producer and the collector the only consumer. The buffer
+     * outlives its thread until the collector has drained it.
+     */
+    struct ThreadTrace {
+        ThreadTrace(size_t capacity, uint32_t lane) : events(capacity), lane(lane) {}
+
+        SPSCRing<TraceEvent> events;
+        std::atomic<uint64_t> dropped{0};    ///< Events lost because the ring was full.
+        std::atomic<bool> retired{false};    ///< Set when the owning thread exits.
+        uint32_t lane;                       ///< Trace tid, numbered from 1.
+        std::string name;                    ///< Lane label; guarded by registryMutex.
+        bool namePublished = false;          ///< Label written to the open trace; guarded by registryMutex.
+    };
+
     // Singleton instance
     static Profiler* instance;
 
     // Profiling state
     bool enabled;
+    ProfilerMode mode;
+    std::atomic<bool> recording;    ///< enabled && mode == LowOverhead, read by every scope.
     std::chrono::high_resolution_clock::time_point startTime;
 
     // Current frame results
@@ -113,6 +163,33 @@ private:
     double fps;
     int frameCount;
 
+    // Interned scope names; ids index names, which only grows
+    std::mutex internMutex;
+    std::unordered_map<std::string, uint32_t> nameIds;
+    std::deque<std::string> names;
+
+    // Per-thread event rings
+    std::mutex registryMutex;
+    std::vector<std::shared_ptr<ThreadTrace>> threads;
+    uint32_t nextLane;
+    size_t traceBufferSize;
+    uint64_t retiredDropped;
+
+    // Collector state; collectMutex serializes draining and trace file writes
+    std::mutex collectMutex;
+    std::vector<std::string> collectedNames;
+    std::vector<TraceEvent> collectScratch;
+    std::vector<ProfileStats> collectStats;
+    std::ofstream traceFile;
+    bool traceHasEvents;
+    uint64_t traceOrigin;
+    std::atomic<bool> tracing;
+
+    std::mutex collectorMutex;
+    std::condition_variable collectorWake;
+    std::thread collectorThread;
+    bool collectorRunning;
+
     Profiler();
 
 public:
@@ -124,18 +201,33 @@ public:
     /**
      * @brief Enables profiling.
      */
-    void Enable() { enabled = true; }
+    void Enable() { enabled = true; UpdateRecording(); }
 
     /**
      * @brief Disables profiling.
      */
-    void Disable() { enabled = false; }
+    void Disable() { enabled = false; UpdateRecording(); }
 
     /**
      * @brief Checks if profiling is enabled.
      */
     bool IsEnabled() const { return enabled; }
 
+    /**
+     * @brief Selects how PTX_PROFILE_SCOPE records; scopes already open finish in their mode.
+     */
+    void SetMode(ProfilerMode value) { mode = value; UpdateRecording(); }
+
+    /**
+     * @brief Gets the recording mode.
+     */
+    ProfilerMode GetMode() const { return mode; }
+
+    /**
+     * @brief True while scopes are written to the per-thread event rings.
+     */
+    bool IsRecording() const { return recording.load(std::memory_order_relaxed); }
+
     /**
      * @brief Begins a new frame.
      */
@@ -221,12 +313,102 @@ public:
      */
     void PrintStats();
 
+    // === Low-overhead mode ===
+
+    /**
+     * @brief Returns the id of a scope name, adding it on first use.
+     *
+     * Takes a lock, so call it once per call site; PTX_PROFILE_SCOPE keeps the id in a
+     * function-local static.
+     */
+    static uint32_t InternName(const char* name);
+
+    /**
+     * @brief Returns the id of a scope name, adding it on first use.
+     */
+    static uint32_t InternName(const std::string& name);
+
+    /**
+     * @brief Gets an interned name, or an empty string for an unknown id.
+     */
+    std::string GetName(uint32_t nameId);
+
+    /**
+     * @brief Steady-clock timestamp in nanoseconds, as stored in TraceEvent.
+     */
+    static uint64_t Now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Appends a completed scope to the calling thread's ring without locking.
+     *
+     * The first call on a thread registers its ring. Events are dropped and counted
+     * when the ring is full.
+     */
+    void RecordEvent(uint32_t nameId, uint64_t start, uint64_t end);
+
+    /**
+     * @brief Labels the calling thread's lane in exported traces.
+     */
+    void SetThreadName(const std::string& name);
+
+    /**
+     * @brief Sets the ring size, in events, for threads that start recording afterwards.
+     */
+    void SetTraceBufferSize(size_t events);
+
+    /**
+     * @brief Drains every thread ring into the statistics and the open trace file.
+     * @return Number of events drained.
+     */
+    size_t CollectTraceEvents();
+
+    /**
+     * @brief Opens a Chrome trace_event file and starts the background collector.
+     * @param filepath Path to write the trace file.
+     * @param flushIntervalMs Time between collector passes.
+     * @return False if a trace is already open or the file cannot be created.
+     */
+    bool StartTrace(const std::string& filepath, int flushIntervalMs = 50);
+
+    /**
+     * @brief Stops the collector, drains the remaining events and closes the trace file.
+     */
+    void StopTrace();
+
+    /**
+     * @brief Checks if a trace file is open.
+     */
+    bool IsTracing() const { return tracing.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Gets the number of events lost to full rings.
+     */
+    uint64_t GetDroppedTraceEvents();
+
+    /**
+     * @brief Gets the number of thread rings held, including exited threads not yet drained.
+     */
+    size_t GetTraceThreadCount();
+
 private:
     /**
      * @brief Gets the current time in microseconds since profiler start.
      */
     double GetCurrentTime() const;
 
+    void UpdateRecording() {
+        recording.store(enabled && mode == ProfilerMode::LowOverhead, std::memory_order_relaxed);
+    }
+
+    ThreadTrace* GetThreadTrace();
+    std::shared_ptr<ThreadTrace> RegisterThread();
+    void RunCollector(std::chrono::milliseconds interval);
+    void WriteTraceEvent(const TraceEvent& event, uint32_t lane);
+    void WriteThreadName(uint32_t lane, const std::string& name);
+
     PTX_BEGIN_FIELDS(Profiler)
         PTX_FIELD(Profiler, enabled, "Enabled", 0, 1),
         PTX_FIELD(Profiler, fps, "FPS", 0.0, 1000.0),
@@ -242,7 +424,16 @@ private:
         PTX_METHOD_AUTO(Profiler, GetLastFrameTime, "Get last frame time"),
         PTX_METHOD_AUTO(Profiler, GetFPS, "Get FPS"),
         PTX_METHOD_AUTO(Profiler, ClearStats, "Clear stats"),
-        PTX_METHOD_AUTO(Profiler, PrintStats, "Print stats")
+        PTX_METHOD_AUTO(Profiler, PrintStats, "Print stats"),
+        PTX_METHOD_AUTO(Profiler, IsRecording, "Is recording"),
+        PTX_METHOD_AUTO(Profiler, SetThreadName, "Set thread name"),
+        PTX_METHOD_AUTO(Profiler, SetTraceBufferSize, "Set trace buffer size"),
+        PTX_METHOD_AUTO(Profiler, CollectTraceEvents, "Collect trace events"),
+        PTX_METHOD_AUTO(Profiler, StartTrace, "Start trace"),
+        PTX_METHOD_AUTO(Profiler, StopTrace, "Stop trace"),
+        PTX_METHOD_AUTO(Profiler, IsTracing, "Is tracing"),
+        PTX_METHOD_AUTO(Profiler, GetDroppedTraceEvents, "Get dropped trace events"),
+        PTX_METHOD_AUTO(Profiler, GetTraceThreadCount, "Get trace thread count")
     PTX_END_METHODS
 
     PTX_BEGIN_DESCRIBE(Profiler)
@@ -284,17 +475,82 @@ public:
     PTX_END_METHODS
 
     PTX_BEGIN_DESCRIBE(ProfileScope)
-        PTX_CTOR(ProfileScope, const std::string &),
-        PTX_CTOR(ProfileScope, const ProfileScope &)
+        PTX_CTOR(ProfileScope, const std::string &)
     PTX_END_DESCRIBE(ProfileScope)
 
 };
 
+/**
+ * @class TraceScope
+ * @brief RAII scope for an interned name, recorded in the profiler's current mode.
+ *
+ * In low-overhead mode the scope reads the clock twice and writes one event to the
+ * thread's ring. It takes no locks and copies no strings.
+ */
+class TraceScope {
+private:
+    uint32_t nameId;
+    uint64_t start;
+    uint8_t state;    ///< 0 inactive, 1 detailed, 2 low-overhead
+
+public:
+    /**
+     * @brief Constructor that begins a scope.
+     * @param nameId Id from Profiler::InternName.
+     */
+    explicit TraceScope(uint32_t nameId) : nameId(nameId), start(0), state(0) {
+        Profiler& profiler = Profiler::GetInstance();
+        if (profiler.IsRecording()) {
+            state = 2;
+            start = Profiler::Now();
+        } else if (profiler.IsEnabled()) {
+            state = 1;
+            profiler.BeginScope(profiler.GetName(nameId));
+        }
+    }
+
+    /**
+     * @brief Destructor that ends the scope.
+     */
+    ~TraceScope() {
+        if (state == 2) {
+            const uint64_t end = Profiler::Now();
+            Profiler::GetInstance().RecordEvent(nameId, start, end);
+        } else if (state == 1) {
+            Profiler& profiler = Profiler::GetInstance();
+            profiler.EndScope(profiler.GetName(nameId));
+        }
+    }
+
+    // Delete copy/move
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    PTX_BEGIN_FIELDS(TraceScope)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(TraceScope)
+        /* No reflected methods. */
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(TraceScope)
+        /* No reflected ctors. */
+    PTX_END_DESCRIBE(TraceScope)
+
+};
+
 } // namespace ptx
 
-// Profiling macros
+#define PTX_PROFILE_CONCAT_INNER(a, b) a##b
+#define PTX_PROFILE_CONCAT(a, b) PTX_PROFILE_CONCAT_INNER(a, b)
+
+// Profiling macros. The scope name is interned once per call site, so it must be the same
+// every time the line runs; use ptx::ProfileScope directly for names built at runtime.
 #ifdef PTX_ENABLE_PROFILING
-    #define PTX_PROFILE_SCOPE(name) ptx::ProfileScope __profile_scope##__LINE__(name)
+    #define PTX_PROFILE_SCOPE(name) \
+        static const uint32_t PTX_PROFILE_CONCAT(ptxProfileId, __LINE__) = ptx::Profiler::InternName(name); \
+        ptx::TraceScope PTX_PROFILE_CONCAT(ptxProfileScope, __LINE__)(PTX_PROFILE_CONCAT(ptxProfileId, __LINE__))
     #define PTX_PROFILE_FUNCTION() PTX_PROFILE_SCOPE(__FUNCTION__)
     #define PTX_PROFILE_BEGIN_FRAME() ptx::Profiler::GetInstance().BeginFrame()
     #define PTX_PROFILE_END_FRAME() ptx::Profiler::GetInstance().EndFrame()
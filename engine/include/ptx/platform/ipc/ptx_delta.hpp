@@ -0,0 +1,360 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <cstring>
+
+#include "ptx_shm.hpp"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
+/**
+ * @file ptx_delta.hpp
+ * @brief Dirty-span delta frames for PTX framebuffers and the optional /ptx_delta{idx} channel.
+ *
+ * A delta packet describes frame N either as the full RGB888 payload or as a
+ * list of (offset, length, data) spans that changed since frame N-1, whichever
+ * is smaller. Spans are aligned to whole pixels and nearby changes are merged
+ * while the gap is cheaper than another span header, so a blinking cursor over
+ * a static face costs a few dozen bytes instead of the whole buffer.
+ *
+ * The full-frame ring (/ptx_fb{idx}) is unchanged; the delta channel is an
+ * extra ring of packets that bridges forward to LED links and that consumers
+ * can chain to keep a local copy of the frame current.
+ */
+
+#pragma pack(push, 1)
+
+/**
+ * @brief Delta packet header; spans or the full payload follow.
+ *
+ * magic: 'UCDL' (0x5543444C)
+ */
+struct PTXDeltaPacket {
+    uint32_t magic;          ///< Magic: 'UCDL'
+    uint16_t version;        ///< Version (1)
+    uint16_t kind;           ///< PTX_DELTA_FULL or PTX_DELTA_SPANS
+    uint64_t frame;          ///< Frame number this packet produces
+    uint64_t base_frame;     ///< Frame the spans apply to (0 for full packets)
+    uint32_t frame_bytes;    ///< Size of the complete frame
+    uint32_t span_count;     ///< Number of spans (0 for full packets)
+    uint32_t payload_bytes;  ///< Bytes after this header
+};
+
+/**
+ * @brief Span header; @c length bytes of new data follow.
+ */
+struct PTXDeltaSpan {
+    uint32_t offset;  ///< Byte offset into the frame
+    uint32_t length;  ///< Byte count
+};
+
+/**
+ * @brief Delta channel header.
+ *
+ * magic: 'UCDC' (0x55434443)
+ *
+ * Layout: header, then slot_count x (PTXDeltaSlot + capacity bytes).
+ */
+struct PTXDeltaHeader {
+    uint32_t magic;                      ///< Magic: 'UCDC'
+    uint16_t version;                    ///< Version (1)
+    uint16_t unit;                       ///< Span alignment in bytes (3 for RGB888)
+    uint32_t frame_bytes;                ///< Size of a complete frame
+    uint32_t capacity;                   ///< Bytes reserved per slot (>= ptx_delta_bound(frame_bytes))
+    uint32_t slot_count;                 ///< Packet ring length
+    std::atomic<uint32_t> active_index;  ///< Slot of the latest packet
+    std::atomic<uint64_t> frame;         ///< Frame number of the latest packet (0 = none)
+};
+
+/**
+ * @brief Delta slot header; the packet follows.
+ *
+ * seq: even = being written, odd = ready.
+ */
+struct PTXDeltaSlot {
+    std::atomic<uint64_t> seq;
+    uint32_t bytes;      ///< Packet size
+    uint32_t reserved;
+};
+
+#pragma pack(pop)
+
+/** @brief PTXDeltaPacket::kind: the payload is the whole frame. */
+constexpr uint16_t PTX_DELTA_FULL = 0;
+
+/** @brief PTXDeltaPacket::kind: the payload is a span list against base_frame. */
+constexpr uint16_t PTX_DELTA_SPANS = 1;
+
+/** @brief Default number of packets kept in the delta ring. */
+constexpr uint32_t PTX_DELTA_SLOTS = 8;
+
+/**
+ * @brief Delta channel producer handle.
+ */
+struct PTXDelta {
+    void* base = nullptr;
+    size_t size = 0;
+#if PTX_HAS_POSIX_SHM
+    int fd = -1;
+#endif
+    PTXDeltaHeader* hdr = nullptr;
+    uint8_t* slots = nullptr;   ///< First slot
+};
+
+// === Encoding ===
+
+/**
+ * @brief Largest packet for a frame of @p frame_bytes (a full packet).
+ */
+inline size_t ptx_delta_bound(size_t frame_bytes) {
+    return sizeof(PTXDeltaPacket) + frame_bytes;
+}
+
+/**
+ * @brief Index of the first byte in [@p begin, @p end) where @p a and @p b differ, or @p end.
+ *
+ * Compares 16 bytes per step with SSE2 or NEON where available and 8 bytes per
+ * step otherwise, so unchanged regions cost a fraction of a byte loop.
+ */
+inline size_t ptx_delta_first_diff(const uint8_t* a, const uint8_t* b, size_t begin, size_t end) {
+    size_t i = begin;
+#if defined(__SSE2__)
+    for (; i + 16 <= end; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const unsigned same = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+        if (same != 0xFFFFu) return i + size_t(__builtin_ctz(~same & 0xFFFFu));
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    for (; i + 16 <= end; i += 16) {
+        const uint8x16_t same = vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        if (vminvq_u8(same) != 0xFF) break;   // located by the tail loops
+    }
+#endif
+    for (; i + 8 <= end; i += 8) {
+        uint64_t x, y;
+        std::memcpy(&x, a + i, 8);
+        std::memcpy(&y, b + i, 8);
+        if (x != y) break;
+    }
+    for (; i < end; ++i) {
+        if (a[i] != b[i]) return i;
+    }
+    return end;
+}
+
+/**
+ * @brief Encode @p cur as a delta packet against @p prev.
+ *
+ * Writes spans when they are smaller than the frame and a full packet otherwise.
+ * Scanning stops as soon as the span list would outgrow a full packet.
+ *
+ * @param prev Previous frame, or nullptr to force a full packet.
+ * @param cur Frame to encode.
+ * @param bytes Frame size in bytes.
+ * @param unit Span alignment (3 keeps spans on RGB888 pixel boundaries).
+ * @param frame Frame number of @p cur.
+ * @param base_frame Frame number of @p prev.
+ * @param out Destination with at least ptx_delta_bound(@p bytes) bytes.
+ * @param capacity Bytes available at @p out.
+ * @return Packet size, or 0 if @p out is too small.
+ */
+inline size_t ptx_delta_encode(const uint8_t* prev, const uint8_t* cur, size_t bytes, uint32_t unit,
+                               uint64_t frame, uint64_t base_frame, uint8_t* out, size_t capacity) {
+    if (!cur || !out || capacity < ptx_delta_bound(bytes)) return 0;
+    if (unit == 0) unit = 1;
+
+    PTXDeltaPacket packet{};
+    packet.magic = 0x5543444C;   // 'UCDL'
+    packet.version = 1;
+    packet.frame = frame;
+    packet.frame_bytes = uint32_t(bytes);
+
+    if (prev) {
+        // A gap shorter than a span header is cheaper to resend than to split on.
+        const size_t gap = sizeof(PTXDeltaSpan);
+        const size_t limit = bytes;   // span payload must stay below a full payload
+        uint8_t* cursor = out + sizeof(PTXDeltaPacket);
+        size_t written = 0;
+        uint32_t spans = 0;
+        bool overflow = false;
+
+        size_t next = ptx_delta_first_diff(prev, cur, 0, bytes);
+        while (next < bytes) {
+            const size_t start = next - next % unit;
+            size_t stop = next;
+            for (;;) {
+                while (stop < bytes && prev[stop] != cur[stop]) ++stop;
+                next = ptx_delta_first_diff(prev, cur, stop, bytes);
+                if (next >= bytes || next - stop > gap) break;
+                stop = next;
+            }
+            stop = std::min(bytes, (stop + unit - 1) / unit * unit);
+            if (next < stop) next = ptx_delta_first_diff(prev, cur, stop, bytes);
+
+            const size_t length = stop - start;
+            if (written + sizeof(PTXDeltaSpan) + length >= limit) { overflow = true; break; }
+
+            const PTXDeltaSpan span{uint32_t(start), uint32_t(length)};
+            std::memcpy(cursor, &span, sizeof(span));
+            std::memcpy(cursor + sizeof(span), cur + start, length);
+            cursor += sizeof(span) + length;
+            written += sizeof(span) + length;
+            ++spans;
+        }
+
+        if (!overflow) {
+            packet.kind = PTX_DELTA_SPANS;
+            packet.base_frame = base_frame;
+            packet.span_count = spans;
+            packet.payload_bytes = uint32_t(written);
+            std::memcpy(out, &packet, sizeof(packet));
+            return sizeof(PTXDeltaPacket) + written;
+        }
+    }
+
+    packet.kind = PTX_DELTA_FULL;
+    packet.payload_bytes = uint32_t(bytes);
+    std::memcpy(out, &packet, sizeof(packet));
+    std::memcpy(out + sizeof(PTXDeltaPacket), cur, bytes);
+    return sizeof(PTXDeltaPacket) + bytes;
+}
+
+/**
+ * @brief Read and validate a packet header.
+ * @return false if @p data is not a well-formed packet of @p size bytes.
+ */
+inline bool ptx_delta_header(const uint8_t* data, size_t size, PTXDeltaPacket& packet) {
+    if (!data || size < sizeof(PTXDeltaPacket)) return false;
+    std::memcpy(&packet, data, sizeof(packet));
+    return packet.magic == 0x5543444C && packet.version == 1 &&
+           (packet.kind == PTX_DELTA_FULL || packet.kind == PTX_DELTA_SPANS) &&
+           size_t(packet.payload_bytes) == size - sizeof(PTXDeltaPacket);
+}
+
+/**
+ * @brief Apply a packet to @p frame.
+ *
+ * Span packets must be applied to the frame numbered @c base_frame; the caller
+ * checks that. Every span is bounds-checked before anything is written.
+ *
+ * @return false if the packet is malformed or sized for a different frame.
+ */
+inline bool ptx_delta_apply(uint8_t* frame, size_t bytes, const uint8_t* data, size_t size) {
+    PTXDeltaPacket packet;
+    if (!frame || !ptx_delta_header(data, size, packet) || packet.frame_bytes != bytes) return false;
+
+    const uint8_t* payload = data + sizeof(PTXDeltaPacket);
+    if (packet.kind == PTX_DELTA_FULL) {
+        if (packet.payload_bytes != bytes) return false;
+        std::memcpy(frame, payload, bytes);
+        return true;
+    }
+
+    for (int pass = 0; pass < 2; ++pass) {
+        const uint8_t* cursor = payload;
+        const uint8_t* end = payload + packet.payload_bytes;
+        for (uint32_t i = 0; i < packet.span_count; ++i) {
+            PTXDeltaSpan span;
+            if (size_t(end - cursor) < sizeof(span)) return false;
+            std::memcpy(&span, cursor, sizeof(span));
+            cursor += sizeof(span);
+            if (size_t(end - cursor) < span.length || size_t(span.offset) + span.length > bytes) return false;
+            if (pass == 1) std::memcpy(frame + span.offset, cursor, span.length);
+            cursor += span.length;
+        }
+        if (cursor != end) return false;
+    }
+    return true;
+}
+
+// === Channel ===
+
+/** @brief Bytes per delta slot including its header, padded to 8 bytes. */
+inline size_t ptx_delta_slot_bytes(uint32_t capacity) {
+    return sizeof(PTXDeltaSlot) + (size_t(capacity) + 7u) / 8u * 8u;
+}
+
+/**
+ * @brief Initialize a delta channel for frames of @p frame_bytes.
+ * @return true on success; false if POSIX SHM unsupported or any step fails.
+ */
+inline bool ptx_delta_init(PTXDelta& D, const char* name, uint32_t frame_bytes, uint32_t unit = 3,
+                           uint32_t slot_count = PTX_DELTA_SLOTS) {
+#if !PTX_HAS_POSIX_SHM
+    (void)D; (void)name; (void)frame_bytes; (void)unit; (void)slot_count;
+    return false;
+#else
+    if (slot_count == 0) return false;
+    const uint32_t capacity = uint32_t(ptx_delta_bound(frame_bytes));
+    const size_t bytes = sizeof(PTXDeltaHeader) + size_t(slot_count) * ptx_delta_slot_bytes(capacity);
+
+    D.fd = shm_open(name, O_CREAT | O_RDWR, 0666);
+    if (D.fd < 0) return false;
+    if (ftruncate(D.fd, bytes) != 0) return false;
+    void* base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, D.fd, 0);
+    if (base == MAP_FAILED) return false;
+
+    D.base = base;
+    D.size = bytes;
+    D.hdr = reinterpret_cast<PTXDeltaHeader*>(base);
+    D.slots = reinterpret_cast<uint8_t*>(base) + sizeof(PTXDeltaHeader);
+
+    D.hdr->magic = 0x55434443;   // 'UCDC'
+    D.hdr->version = 1;
+    D.hdr->unit = uint16_t(unit);
+    D.hdr->frame_bytes = frame_bytes;
+    D.hdr->capacity = capacity;
+    D.hdr->slot_count = slot_count;
+    D.hdr->active_index.store(0, std::memory_order_relaxed);
+    D.hdr->frame.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < slot_count; ++i) {
+        auto* slot = reinterpret_cast<PTXDeltaSlot*>(D.slots + i * ptx_delta_slot_bytes(capacity));
+        slot->seq.store(1, std::memory_order_relaxed);   // odd = ready/empty
+        slot->bytes = 0;
+    }
+    return true;
+#endif
+}
+
+/**
+ * @brief Encode @p cur against @p prev straight into the next ring slot and publish it.
+ *
+ * Call before committing the matching framebuffer so consumers woken by the
+ * framebuffer notification already find the packet.
+ *
+ * @param prev Previous frame (nullptr forces a full packet).
+ * @param frame Frame number of @p cur; @p frame - 1 is the base for spans.
+ * @return Packet size, or 0 if the channel is not mapped.
+ */
+inline size_t ptx_delta_publish(PTXDelta& D, const uint8_t* prev, const uint8_t* cur, uint64_t frame) {
+#if !PTX_HAS_POSIX_SHM
+    (void)D; (void)prev; (void)cur; (void)frame;
+    return 0;
+#else
+    if (!D.hdr || !D.slots) return 0;
+
+    const uint32_t index = (D.hdr->active_index.load(std::memory_order_relaxed) + 1) % D.hdr->slot_count;
+    auto* slot = reinterpret_cast<PTXDeltaSlot*>(D.slots + index * ptx_delta_slot_bytes(D.hdr->capacity));
+    uint8_t* data = reinterpret_cast<uint8_t*>(slot + 1);
+
+    uint64_t s = slot->seq.load(std::memory_order_relaxed);
+    if (s & 1ULL) s++;   // even = being written
+    slot->seq.store(s, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const size_t bytes = ptx_delta_encode(prev, cur, D.hdr->frame_bytes, D.hdr->unit,
+                                          frame, frame ? frame - 1 : 0, data, D.hdr->capacity);
+    slot->bytes = uint32_t(bytes);
+
+    slot->seq.store(s + 1, std::memory_order_release);   // odd = ready
+    D.hdr->active_index.store(index, std::memory_order_release);
+    D.hdr->frame.store(frame, std::memory_order_release);
+    return bytes;
+#endif
+}
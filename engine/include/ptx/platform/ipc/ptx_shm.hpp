@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <atomic>
 #include <cstring>
@@ -22,16 +23,32 @@
     #include <sys/stat.h>
     #include <fcntl.h>
     #include <unistd.h>
+    #include <ctime>
 #else
     #define PTX_HAS_POSIX_SHM 0
 #endif
 
+#if defined(__linux__)
+    #define PTX_HAS_FUTEX 1
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <climits>
+#else
+    #define PTX_HAS_FUTEX 0
+#endif
+
+#include <chrono>
+#include <thread>
+
 #pragma pack(push, 1)
 
 /**
  * @brief Framebuffer header (RGB888, ring of buffers).
  *
  * magic: 'UCFB' (0x55434642)
+ *
+ * Layout: header, then buffer_count x (PTXFbBuffer + payload), then the
+ * extension area (PTXNotify + buffer_count x PTXFbFrameInfo).
  */
 struct PTXFbHeader {
     uint32_t magic;        ///< Magic: 'UCFB'
@@ -53,6 +70,37 @@ struct PTXFbBuffer {
     std::atomic<uint64_t> seq;
 };
 
+/**
+ * @brief Wakeup block for consumers that block instead of polling.
+ *
+ * magic: 'UCNT' (0x55434E54)
+ *
+ * Lives in the extension area after the v1 layout (see ptx_fb_ext_offset()), so
+ * older consumers that ignore it keep working. @c event is bumped after every
+ * publish; on Linux it doubles as a process-shared futex word.
+ */
+struct PTXNotify {
+    uint32_t magic;                 ///< Magic: 'UCNT'
+    uint32_t flags;                 ///< PTX_NOTIFY_FUTEX when publishers issue futex wakeups
+    std::atomic<uint32_t> event;    ///< Incremented after every publish (futex word)
+    std::atomic<uint32_t> waiters;  ///< Consumers blocked in ptx_notify_wait()
+    std::atomic<uint64_t> frame;    ///< Frame number of the latest publish (0 = none)
+};
+
+/** @brief PTXNotify::flags bit: publishers wake futex waiters on @c event. */
+constexpr uint32_t PTX_NOTIFY_FUTEX = 1u;
+
+/**
+ * @brief Per-buffer frame info, one per ring buffer after the PTXNotify block.
+ *
+ * Written inside the buffer's seqlock, so a consistent read of the buffer also
+ * yields its frame number and timestamp. Gaps in @c frame are dropped frames.
+ */
+struct PTXFbFrameInfo {
+    uint64_t frame;       ///< Monotonic frame number (1 = first published frame)
+    uint64_t publish_ns;  ///< CLOCK_MONOTONIC nanoseconds at commit
+};
+
 /**
  * @brief Shared control block.
  */
@@ -70,6 +118,9 @@ struct PTXCtrl {
  * @brief Geometry header for interleaved XY float32 pairs.
  *
  * magic: 'UCGM' (0x5543474D)
+ *
+ * Geometry is published only when it changes. Consumers cache the payload and
+ * re-read it when @c generation differs from the value they last saw.
  */
 struct PTXGeomHeader {
     uint32_t magic;              ///< Magic: 'UCGM'
@@ -77,6 +128,7 @@ struct PTXGeomHeader {
     uint32_t width;              ///< Logical canvas width (optional)
     uint32_t height;             ///< Logical canvas height (optional)
     std::atomic<uint64_t> seq;   ///< Even=writing, odd=ready
+    std::atomic<uint64_t> generation; ///< Bumped on every payload change (0 = never published)
     // payload: count * struct { float x; float y; } tightly packed
 };
 
@@ -100,11 +152,34 @@ struct PTXRegCamera {
     uint32_t pixel_count; ///< N (for FB payload = 1xN)
     uint32_t width;       ///< Logical display width
     uint32_t height;      ///< Logical display height
-    // Convention: channels named /ptx_fb{index} and /ptx_geom{index}
+    // Convention: channels named {prefix}fb{index}, {prefix}geom{index} and {prefix}delta{index}
+};
+
+/**
+ * @brief Registry trailer recording the channel name prefix.
+ *
+ * Occupies the last bytes of the mapping, after the camera records. It is smaller than
+ * one record, so v1 readers that size the record table from the mapping are unaffected.
+ *
+ * magic: 'UCRX' (0x55435258)
+ */
+struct PTXRegExt {
+    uint32_t magic;            ///< Magic: 'UCRX'
+    char stream_prefix[28];    ///< Channel name prefix ("/ptx_" by default)
 };
 
 #pragma pack(pop)
 
+/**
+ * @brief Ring slot claimed by ptx_fb_acquire() and released by ptx_fb_commit().
+ */
+struct PTXFbSlot {
+    PTXFbBuffer* buf = nullptr;   ///< Buffer header of the claimed slot
+    uint8_t* data = nullptr;      ///< RGB888 payload (height * stride_bytes)
+    uint32_t index = 0;           ///< Ring index of the claimed slot
+    uint64_t seq = 0;             ///< Even sequence written while the slot is claimed
+};
+
 /**
  * @brief Framebuffer + control shared memory handles.
  */
@@ -114,9 +189,13 @@ struct PTXShm {
     PTXFbHeader* fb_hdr = nullptr;
     uint8_t* fb_payload_base = nullptr;
 
+    PTXNotify* fb_notify = nullptr;      ///< Framebuffer wakeup block (extension area)
+    PTXFbFrameInfo* fb_frames = nullptr; ///< Per-buffer frame info (extension area)
+
     void* ctrl_base = nullptr;    ///< Mapped base of control region
     size_t ctrl_size = 0;         ///< Size of control mapping
     PTXCtrl* ctrl = nullptr;
+    PTXNotify* ctrl_notify = nullptr;    ///< Control wakeup block, right after PTXCtrl
 
 #if PTX_HAS_POSIX_SHM
     int fb_fd = -1;               ///< shm fd for framebuffer
@@ -150,15 +229,136 @@ struct PTXRegistry {
 #endif
     PTXRegHeader* hdr = nullptr;
     PTXRegCamera* cams = nullptr;
-    
+    PTXRegExt* ext = nullptr;
 };
 
+/**
+ * @brief Atomic view of PTXFbHeader::active_index.
+ *
+ * The field stays a plain integer for wire compatibility; producer and
+ * consumers access it through this view so the store after a commit and the
+ * load before a read carry release/acquire ordering. The header is packed, so
+ * the field is addressed by offset rather than by reference.
+ */
+inline std::atomic<uint32_t>& ptx_fb_active_index(const PTXFbHeader* hdr) {
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "atomic<uint32_t> must be layout compatible");
+    static_assert(offsetof(PTXFbHeader, active_index) % alignof(uint32_t) == 0, "active_index must stay aligned");
+    auto* field = reinterpret_cast<uint8_t*>(const_cast<PTXFbHeader*>(hdr)) + offsetof(PTXFbHeader, active_index);
+    return *reinterpret_cast<std::atomic<uint32_t>*>(field);
+}
+
 /** @brief Bytes for RGB payload (h * stride). */
 inline size_t ptx_payload_bytes(uint32_t h, uint32_t stride) { return size_t(h) * size_t(stride); }
 
 /** @brief Bytes for a single framebuffer buffer (header + payload). */
 inline size_t ptx_onebuf_bytes(uint32_t h, uint32_t stride) { return sizeof(PTXFbBuffer) + ptx_payload_bytes(h, stride); }
 
+/** @brief Offset of the framebuffer extension area (PTXNotify + frame info), right after the ring. */
+inline size_t ptx_fb_ext_offset(uint32_t h, uint32_t stride, uint32_t bufcnt) {
+    return sizeof(PTXFbHeader) + size_t(bufcnt) * ptx_onebuf_bytes(h, stride);
+}
+
+/** @brief Bytes of the framebuffer extension area. */
+inline size_t ptx_fb_ext_bytes(uint32_t bufcnt) {
+    return sizeof(PTXNotify) + size_t(bufcnt) * sizeof(PTXFbFrameInfo);
+}
+
+/**
+ * @brief Locate the wakeup block in a mapped framebuffer region.
+ * @return nullptr if the mapping predates the extension area.
+ */
+inline PTXNotify* ptx_fb_find_notify(void* base, size_t size) {
+    if (!base || size < sizeof(PTXFbHeader)) return nullptr;
+    const auto* hdr = reinterpret_cast<const PTXFbHeader*>(base);
+    const size_t offset = ptx_fb_ext_offset(hdr->height, hdr->stride_bytes, hdr->buffer_count);
+    if (size < offset + ptx_fb_ext_bytes(hdr->buffer_count)) return nullptr;
+
+    auto* notify = reinterpret_cast<PTXNotify*>(reinterpret_cast<uint8_t*>(base) + offset);
+    return notify->magic == 0x55434E54 ? notify : nullptr;
+}
+
+/**
+ * @brief Locate the wakeup block in a mapped control region.
+ * @return nullptr if the mapping predates the extension area.
+ */
+inline PTXNotify* ptx_ctrl_find_notify(void* base, size_t size) {
+    if (!base || size < sizeof(PTXCtrl) + sizeof(PTXNotify)) return nullptr;
+    auto* notify = reinterpret_cast<PTXNotify*>(reinterpret_cast<uint8_t*>(base) + sizeof(PTXCtrl));
+    return notify->magic == 0x55434E54 ? notify : nullptr;
+}
+
+/** @brief CLOCK_MONOTONIC in nanoseconds; comparable across processes on the same machine. */
+inline uint64_t ptx_monotonic_ns() {
+#if PTX_HAS_POSIX_SHM
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec);
+#else
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/** @brief Initialize a wakeup block in place. */
+inline void ptx_notify_init(PTXNotify* N) {
+    N->magic = 0x55434E54;             // 'UCNT'
+    N->flags = PTX_HAS_FUTEX ? PTX_NOTIFY_FUTEX : 0u;
+    N->event.store(0, std::memory_order_relaxed);
+    N->waiters.store(0, std::memory_order_relaxed);
+    N->frame.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Announce a publish: bump @c event and wake blocked consumers.
+ *
+ * The futex syscall is only made when a consumer is actually waiting.
+ */
+inline void ptx_notify_signal(PTXNotify* N) {
+    if (!N) return;
+    N->event.fetch_add(1, std::memory_order_seq_cst);
+#if PTX_HAS_FUTEX
+    if (N->waiters.load(std::memory_order_seq_cst) != 0) {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&N->event), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+#endif
+}
+
+/**
+ * @brief Block until @c event differs from @p seen or @p timeout_ms elapses.
+ *
+ * Pass the value returned by the previous call (or a fresh load of @c event) as @p seen.
+ * Without futex support this falls back to a 1 ms sleep-poll.
+ *
+ * @param timeout_ms Timeout in milliseconds; negative waits forever.
+ * @return Current @c event value (equal to @p seen on timeout).
+ */
+inline uint32_t ptx_notify_wait(PTXNotify* N, uint32_t seen, int timeout_ms) {
+    if (!N) return seen;
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms < 0 ? 0 : timeout_ms);
+    N->waiters.fetch_add(1, std::memory_order_seq_cst);
+
+    uint32_t current = N->event.load(std::memory_order_acquire);
+    while (current == seen) {
+        const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+        if (timeout_ms >= 0 && remaining.count() <= 0) break;
+
+#if PTX_HAS_FUTEX
+        timespec ts;
+        ts.tv_sec = time_t(remaining.count() / 1000000000LL);
+        ts.tv_nsec = long(remaining.count() % 1000000000LL);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&N->event), FUTEX_WAIT, seen,
+                timeout_ms < 0 ? nullptr : &ts, nullptr, 0);
+#else
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#endif
+        current = N->event.load(std::memory_order_acquire);
+    }
+
+    N->waiters.fetch_sub(1, std::memory_order_seq_cst);
+    return current;
+}
+
 /** @brief Total bytes for a geometry segment (header + XY float32 pairs). */
 inline size_t ptx_geom_bytes(uint32_t count) {
     return sizeof(PTXGeomHeader) + size_t(count) * sizeof(float) * 2;
@@ -176,7 +376,8 @@ inline bool ptx_shm_init(PTXShm& S, const char* fb_name, uint32_t w, uint32_t h,
     const uint32_t stride = w * 3, bufcnt = 3;
     const size_t header_bytes = sizeof(PTXFbHeader);
     const size_t onebuf_bytes = sizeof(PTXFbBuffer) + size_t(h) * stride;
-    const size_t fb_bytes = header_bytes + bufcnt * onebuf_bytes;
+    const size_t ext_offset = ptx_fb_ext_offset(h, stride, bufcnt);
+    const size_t fb_bytes = ext_offset + ptx_fb_ext_bytes(bufcnt); // v1 layout, then the extension area
 
     S.fb_fd = shm_open(fb_name, O_CREAT | O_RDWR, 0666);
     if (S.fb_fd < 0) return false;
@@ -196,9 +397,14 @@ inline bool ptx_shm_init(PTXShm& S, const char* fb_name, uint32_t w, uint32_t h,
         b->seq.store(1, std::memory_order_relaxed); // odd = ready/empty
     }
 
+    S.fb_notify = reinterpret_cast<PTXNotify*>(reinterpret_cast<uint8_t*>(S.fb_base) + ext_offset);
+    S.fb_frames = reinterpret_cast<PTXFbFrameInfo*>(S.fb_notify + 1);
+    ptx_notify_init(S.fb_notify);
+    for (uint32_t i = 0; i < bufcnt; ++i) S.fb_frames[i] = PTXFbFrameInfo{0, 0};
+
     S.ctrl_fd = shm_open(ctrl_name, O_CREAT | O_RDWR, 0666);
     if (S.ctrl_fd < 0) return false;
-    S.ctrl_size = sizeof(PTXCtrl);
+    S.ctrl_size = sizeof(PTXCtrl) + sizeof(PTXNotify);
     if (ftruncate(S.ctrl_fd, S.ctrl_size) != 0) return false;
     S.ctrl_base = mmap(nullptr, S.ctrl_size, PROT_READ | PROT_WRITE, MAP_SHARED, S.ctrl_fd, 0);
     if (S.ctrl_base == MAP_FAILED) return false;
@@ -206,6 +412,8 @@ inline bool ptx_shm_init(PTXShm& S, const char* fb_name, uint32_t w, uint32_t h,
     new (S.ctrl) PTXCtrl{}; // placement-new value-initialization
     S.ctrl->dt_scale = 1.0f;
     S.ctrl->cam_look[2] = -1.0f;
+    S.ctrl_notify = reinterpret_cast<PTXNotify*>(S.ctrl + 1);
+    ptx_notify_init(S.ctrl_notify);
     return true;
 #endif
 }
@@ -220,29 +428,92 @@ inline uint8_t* ptx_payload_ptr(PTXShm& S, uint32_t buf_index, uint32_t w, uint3
 }
 
 /**
- * @brief Publish an RGB888 frame to the next ring buffer and mark it ready.
+ * @brief Claim the next ring buffer for writing and mark it as being written.
+ *
+ * The caller writes the frame straight into @c slot.data and then calls
+ * ptx_fb_commit(); no staging copy is needed.
+ *
+ * @return Payload pointer (also stored in @p slot), or nullptr if the region is not mapped.
  */
-inline void ptx_publish_rgb888(PTXShm& S, uint32_t w, uint32_t h, const uint8_t* src_rgb888) {
+inline uint8_t* ptx_fb_acquire(PTXShm& S, PTXFbSlot& slot) {
 #if !PTX_HAS_POSIX_SHM
-    (void)S; (void)w; (void)h; (void)src_rgb888;
+    (void)S; slot = PTXFbSlot{};
+    return nullptr;
 #else
+    if (!S.fb_hdr || !S.fb_payload_base) { slot = PTXFbSlot{}; return nullptr; }
+
     const uint32_t bufcnt = S.fb_hdr->buffer_count;
-    uint32_t idx = (S.fb_hdr->active_index + 1) % bufcnt;
-    const size_t stride = size_t(w) * 3;
-    const size_t onebuf = sizeof(PTXFbBuffer) + size_t(h) * stride;
-    auto* b = reinterpret_cast<PTXFbBuffer*>(reinterpret_cast<uint8_t*>(S.fb_payload_base) + idx * onebuf);
+    const uint32_t idx = (ptx_fb_active_index(S.fb_hdr).load(std::memory_order_relaxed) + 1) % bufcnt;
+    const size_t onebuf = ptx_onebuf_bytes(S.fb_hdr->height, S.fb_hdr->stride_bytes);
+    uint8_t* base = S.fb_payload_base + idx * onebuf;
 
-    uint64_t s = b->seq.load(std::memory_order_relaxed);
+    slot.buf = reinterpret_cast<PTXFbBuffer*>(base);
+    slot.data = base + sizeof(PTXFbBuffer);
+    slot.index = idx;
+
+    uint64_t s = slot.buf->seq.load(std::memory_order_relaxed);
     if (s & 1ULL) s++;                 // even = being written
-    b->seq.store(s, std::memory_order_release);
+    slot.buf->seq.store(s, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release); // order the mark before payload writes
+    slot.seq = s;
+    return slot.data;
+#endif
+}
 
-    std::memcpy(ptx_payload_ptr(S, idx, w, h), src_rgb888, size_t(h) * stride);
+/**
+ * @brief Mark a slot from ptx_fb_acquire() ready, make it the active buffer and wake consumers.
+ *
+ * Stamps the slot with the next frame number and the publish time before it is released.
+ */
+inline void ptx_fb_commit(PTXShm& S, PTXFbSlot& slot) {
+#if !PTX_HAS_POSIX_SHM
+    (void)S; (void)slot;
+#else
+    if (!slot.buf) return;
 
-    b->seq.store(s + 1, std::memory_order_release); // odd = ready
-    S.fb_hdr->active_index = idx;
+    uint64_t frame = 0;
+    if (S.fb_notify && S.fb_frames) {
+        frame = S.fb_notify->frame.load(std::memory_order_relaxed) + 1;
+        S.fb_frames[slot.index] = PTXFbFrameInfo{frame, ptx_monotonic_ns()};
+    }
+
+    slot.buf->seq.store(slot.seq + 1, std::memory_order_release); // odd = ready
+    ptx_fb_active_index(S.fb_hdr).store(slot.index, std::memory_order_release);
+
+    if (S.fb_notify) {
+        S.fb_notify->frame.store(frame, std::memory_order_release);
+        ptx_notify_signal(S.fb_notify);
+    }
+    slot = PTXFbSlot{};
 #endif
 }
 
+/**
+ * @brief Frame number of the latest committed frame (0 if none).
+ */
+inline uint64_t ptx_fb_frame(const PTXShm& S) {
+    return S.fb_notify ? S.fb_notify->frame.load(std::memory_order_acquire) : 0;
+}
+
+/**
+ * @brief Wake consumers waiting on the control block after it was written.
+ */
+inline void ptx_ctrl_notify(PTXShm& S) {
+    ptx_notify_signal(S.ctrl_notify);
+}
+
+/**
+ * @brief Publish an RGB888 frame to the next ring buffer and mark it ready.
+ */
+inline void ptx_publish_rgb888(PTXShm& S, uint32_t w, uint32_t h, const uint8_t* src_rgb888) {
+    PTXFbSlot slot;
+    uint8_t* dst = ptx_fb_acquire(S, slot);
+    if (!dst) return;
+
+    std::memcpy(dst, src_rgb888, ptx_payload_bytes(h, w * 3));
+    ptx_fb_commit(S, slot);
+}
+
 /**
  * @brief Initialize a geometry shared-memory segment with @p count XY pairs.
  * @return true on success; false if POSIX SHM unsupported or any step fails.
@@ -272,6 +543,7 @@ inline bool ptx_geom_init(PTXGeom& G, const char* name, uint32_t count) {
     G.hdr->width  = G.width;                   // optional meta
     G.hdr->height = G.height;                  // optional meta
     G.hdr->seq.store(1, std::memory_order_relaxed); // odd => ready/empty
+    G.hdr->generation.store(0, std::memory_order_relaxed);
     return true;
 #endif
 }
@@ -299,11 +571,42 @@ inline void ptx_geom_publish(PTXGeom& G, const float* xy, uint32_t count) {
     G.hdr->seq.store(s, std::memory_order_release);
 
     std::memcpy(G.xy, xy, size_t(count) * sizeof(float) * 2);
+    G.hdr->generation.store(G.hdr->generation.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 
     G.hdr->seq.store(s + 1, std::memory_order_release); // odd = ready
 #endif
 }
 
+/**
+ * @brief Publish @p count XY pairs only if they differ from the current payload.
+ * @return true if the geometry was published (and its generation bumped).
+ */
+inline bool ptx_geom_publish_if_changed(PTXGeom& G, const float* xy, uint32_t count) {
+#if !PTX_HAS_POSIX_SHM
+    (void)G; (void)xy; (void)count;
+    return false;
+#else
+    if (!G.base || !G.hdr || !G.xy) return false;
+    if (count != G.hdr->count)      return false;
+
+    // The producer is the only writer, so its own payload can be compared without the seqlock.
+    if (G.hdr->generation.load(std::memory_order_relaxed) != 0 &&
+        std::memcmp(G.xy, xy, size_t(count) * sizeof(float) * 2) == 0) {
+        return false;
+    }
+
+    ptx_geom_publish(G, xy, count);
+    return true;
+#endif
+}
+
+/**
+ * @brief Current geometry generation (0 if never published).
+ */
+inline uint64_t ptx_geom_generation(const PTXGeom& G) {
+    return G.hdr ? G.hdr->generation.load(std::memory_order_acquire) : 0;
+}
+
 /** @brief Alias of ptx_geom_publish (XY form). */
 inline void ptx_geom_publish_xy(PTXGeom& G, const float* xy, uint32_t count) {
     ptx_geom_publish(G, xy, count);
@@ -356,13 +659,17 @@ inline void ptx_rasterize_scatter_rgb888(
 
 /**
  * @brief Initialize registry with capacity for @p max_cameras records.
+ * @param stream_prefix Prefix of the per-camera channel names, recorded for readers
+ *        (at most 27 characters).
  * @return true on success; false if POSIX SHM unsupported or any step fails.
  */
-inline bool ptx_registry_init(PTXRegistry& R, const char* name, uint32_t max_cameras) {
+inline bool ptx_registry_init(PTXRegistry& R, const char* name, uint32_t max_cameras,
+                              const char* stream_prefix = "/ptx_") {
 #if !PTX_HAS_POSIX_SHM
-    (void)R; (void)name; (void)max_cameras; return false;
+    (void)R; (void)name; (void)max_cameras; (void)stream_prefix; return false;
 #else
-    const size_t bytes = sizeof(PTXRegHeader) + size_t(max_cameras) * sizeof(PTXRegCamera);
+    const size_t records = sizeof(PTXRegHeader) + size_t(max_cameras) * sizeof(PTXRegCamera);
+    const size_t bytes = records + sizeof(PTXRegExt);
     R.fd = shm_open(name, O_CREAT | O_RDWR, 0666);
     if (R.fd < 0) return false;
     if (ftruncate(R.fd, bytes) != 0) return false;
@@ -375,6 +682,10 @@ inline bool ptx_registry_init(PTXRegistry& R, const char* name, uint32_t max_cam
     R.hdr->magic = 0x55435247;   // 'UCRG'
     R.hdr->version = 1;
     R.hdr->cam_count.store(0, std::memory_order_relaxed);
+
+    R.ext = reinterpret_cast<PTXRegExt*>(reinterpret_cast<uint8_t*>(base) + records);
+    R.ext->magic = 0x55435258;   // 'UCRX'
+    std::snprintf(R.ext->stream_prefix, sizeof(R.ext->stream_prefix), "%s", stream_prefix ? stream_prefix : "/ptx_");
     return true;
 #endif
 }
@@ -0,0 +1,573 @@
+#pragma once
+#include "ptx_shm.hpp"
+#include "ptx_delta.hpp"
+
+#include <chrono>
+#include <thread>
+
+/**
+ * @file ptx_shm_reader.hpp
+ * @brief Consumer side of the PTX shared-memory protocol: registry discovery, zero-copy frames and geometry.
+ *
+ * Typical use:
+ *  - ptx_registry_attach() on "/ptx_reg", then ptx_registry_count()/ptx_registry_camera() to enumerate.
+ *  - ptx_registry_channel_names() with ptx_registry_stream_prefix() for the channel names below,
+ *    shown with the default "/ptx_" prefix.
+ *  - ptx_fb_attach() on "/ptx_fb{index}" for the chosen camera.
+ *  - ptx_fb_wait() for a new frame, ptx_fb_latest() for a zero-copy view into the ring, and
+ *    ptx_fb_still_valid() after consuming it; or ptx_fb_copy_latest() to copy with retry.
+ *  - ptx_geom_attach() on "/ptx_geom{index}" and ptx_geom_read() whenever the generation changes.
+ *  - Optionally ptx_delta_attach() on "/ptx_delta{index}" and ptx_delta_read_packet() to forward
+ *    changed spans, or ptx_delta_catch_up() to keep a local frame current.
+ *
+ * Reads follow the producer's seqlocks: the buffer sequence is loaded with acquire ordering before
+ * the payload and re-checked after an acquire fence, so a view is only reported consistent if no
+ * writer touched the buffer in between. Torn reads are retried on the newest buffer.
+ */
+
+/** @brief Default number of attempts before a torn read is reported as failure. */
+constexpr int PTX_READ_RETRIES = 16;
+
+/**
+ * @brief Attached registry (read-only).
+ */
+struct PTXRegistryReader {
+    void* base = nullptr;
+    size_t size = 0;
+#if PTX_HAS_POSIX_SHM
+    int fd = -1;
+#endif
+    const PTXRegHeader* hdr = nullptr;
+    const PTXRegCamera* cams = nullptr;
+    const PTXRegExt* ext = nullptr;  ///< Prefix trailer; nullptr for registries without one
+    uint32_t capacity = 0;  ///< Records that fit in the mapping
+};
+
+/**
+ * @brief Attached framebuffer ring.
+ */
+struct PTXFbReader {
+    void* base = nullptr;
+    size_t size = 0;
+#if PTX_HAS_POSIX_SHM
+    int fd = -1;
+#endif
+    const PTXFbHeader* hdr = nullptr;
+    const uint8_t* payload_base = nullptr;
+    const PTXNotify* ext = nullptr;          ///< Extension block; null for producers without it
+    PTXNotify* notify = nullptr;             ///< Same block when the mapping is writable (needed to block on it)
+    const PTXFbFrameInfo* frames = nullptr;  ///< Per-buffer stamps; null for producers without the extension area
+};
+
+/**
+ * @brief Attached geometry segment (read-only).
+ */
+struct PTXGeomReader {
+    void* base = nullptr;
+    size_t size = 0;
+#if PTX_HAS_POSIX_SHM
+    int fd = -1;
+#endif
+    const PTXGeomHeader* hdr = nullptr;
+    const float* xy = nullptr;
+};
+
+/**
+ * @brief Attached delta channel (read-only).
+ */
+struct PTXDeltaReader {
+    void* base = nullptr;
+    size_t size = 0;
+#if PTX_HAS_POSIX_SHM
+    int fd = -1;
+#endif
+    const PTXDeltaHeader* hdr = nullptr;
+    const uint8_t* slots = nullptr;
+};
+
+/**
+ * @brief Zero-copy view of one ring buffer.
+ *
+ * @c data points into shared memory; check ptx_fb_still_valid() after using it.
+ */
+struct PTXFrameView {
+    const uint8_t* data = nullptr;  ///< RGB888 payload inside the ring
+    size_t bytes = 0;               ///< height * stride
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t stride = 0;
+    uint32_t index = 0;             ///< Ring buffer index
+    uint64_t seq = 0;               ///< Buffer sequence observed when the view was taken
+    uint64_t frame = 0;             ///< Producer frame number (0 if the producer does not stamp frames)
+    uint64_t publish_ns = 0;        ///< CLOCK_MONOTONIC publish time (0 if not stamped)
+};
+
+/**
+ * @brief Map an existing SHM object; tries read-write first when @p writable, then read-only.
+ * @return true on success; @p writable is cleared if only a read-only mapping was possible.
+ */
+inline bool ptx_shm_map_existing(const char* name, bool& writable, void*& base, size_t& size, int& fd) {
+#if !PTX_HAS_POSIX_SHM
+    (void)name; (void)writable; (void)base; (void)size; (void)fd;
+    return false;
+#else
+    fd = writable ? shm_open(name, O_RDWR, 0) : -1;
+    if (fd < 0) {
+        writable = false;
+        fd = shm_open(name, O_RDONLY, 0);
+    }
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) { close(fd); fd = -1; return false; }
+
+    size = size_t(info.st_size);
+    base = mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) { base = nullptr; close(fd); fd = -1; return false; }
+    return true;
+#endif
+}
+
+/** @brief Unmap and close a mapping created by ptx_shm_map_existing(). */
+inline void ptx_shm_unmap(void*& base, size_t& size, int& fd) {
+#if PTX_HAS_POSIX_SHM
+    if (base) munmap(base, size);
+    if (fd >= 0) close(fd);
+#endif
+    base = nullptr; size = 0; fd = -1;
+}
+
+// === Registry ===
+
+/**
+ * @brief Attach to a registry published by ptx_registry_init().
+ * @return false if it does not exist yet or is not a PTX registry.
+ */
+inline bool ptx_registry_attach(PTXRegistryReader& R, const char* name = "/ptx_reg") {
+#if !PTX_HAS_POSIX_SHM
+    (void)R; (void)name;
+    return false;
+#else
+    bool writable = false;
+    if (!ptx_shm_map_existing(name, writable, R.base, R.size, R.fd)) return false;
+
+    R.hdr = reinterpret_cast<const PTXRegHeader*>(R.base);
+    if (R.size < sizeof(PTXRegHeader) || R.hdr->magic != 0x55435247) {
+        ptx_shm_unmap(R.base, R.size, R.fd);
+        R = PTXRegistryReader{};
+        return false;
+    }
+
+    // The prefix trailer sits at the end of the mapping; older producers do not write one.
+    size_t records = R.size - sizeof(PTXRegHeader);
+    if (records >= sizeof(PTXRegExt)) {
+        const auto* ext = reinterpret_cast<const PTXRegExt*>(
+            reinterpret_cast<const uint8_t*>(R.base) + R.size - sizeof(PTXRegExt));
+        if (ext->magic == 0x55435258 && std::memchr(ext->stream_prefix, 0, sizeof(ext->stream_prefix))) {
+            R.ext = ext;
+            records -= sizeof(PTXRegExt);
+        }
+    }
+
+    R.cams = reinterpret_cast<const PTXRegCamera*>(R.hdr + 1);
+    R.capacity = uint32_t(records / sizeof(PTXRegCamera));
+    return true;
+#endif
+}
+
+/** @brief Detach from the registry. */
+inline void ptx_registry_detach(PTXRegistryReader& R) {
+#if PTX_HAS_POSIX_SHM
+    ptx_shm_unmap(R.base, R.size, R.fd);
+#endif
+    R = PTXRegistryReader{};
+}
+
+/**
+ * @brief Number of published camera records (acquire; records below the count are complete).
+ */
+inline uint32_t ptx_registry_count(const PTXRegistryReader& R) {
+    if (!R.hdr) return 0;
+    return std::min(R.hdr->cam_count.load(std::memory_order_acquire), R.capacity);
+}
+
+/** @brief Camera record @p i, or nullptr if out of range. */
+inline const PTXRegCamera* ptx_registry_camera(const PTXRegistryReader& R, uint32_t i) {
+    return i < ptx_registry_count(R) ? &R.cams[i] : nullptr;
+}
+
+/** @brief Channel name prefix recorded by the producer ("/ptx_" if the registry has none). */
+inline const char* ptx_registry_stream_prefix(const PTXRegistryReader& R) {
+    return R.ext ? R.ext->stream_prefix : "/ptx_";
+}
+
+/**
+ * @brief Channel names for a registry record ("{prefix}fb{index}", "{prefix}geom{index}",
+ *        "{prefix}delta{index}").
+ *
+ * Pass ptx_registry_stream_prefix() as @p prefix to follow producers that use a non-default
+ * prefix. Null name buffers are skipped.
+ */
+inline void ptx_registry_channel_names(const PTXRegCamera& cam, char* fb_name, size_t fb_len,
+                                       char* geom_name, size_t geom_len, const char* prefix = "/ptx_",
+                                       char* delta_name = nullptr, size_t delta_len = 0) {
+    if (!prefix) prefix = "/ptx_";
+    if (fb_name)    std::snprintf(fb_name, fb_len, "%sfb%u", prefix, cam.index);
+    if (geom_name)  std::snprintf(geom_name, geom_len, "%sgeom%u", prefix, cam.index);
+    if (delta_name) std::snprintf(delta_name, delta_len, "%sdelta%u", prefix, cam.index);
+}
+
+// === Framebuffer ===
+
+/**
+ * @brief Attach to a framebuffer ring created by ptx_shm_init().
+ *
+ * The mapping is read-write when permitted so blocking waits can register as futex waiters;
+ * payloads are never written by consumers.
+ */
+inline bool ptx_fb_attach(PTXFbReader& F, const char* name) {
+#if !PTX_HAS_POSIX_SHM
+    (void)F; (void)name;
+    return false;
+#else
+    bool writable = true;
+    if (!ptx_shm_map_existing(name, writable, F.base, F.size, F.fd)) return false;
+
+    F.hdr = reinterpret_cast<const PTXFbHeader*>(F.base);
+    const bool valid = F.size >= sizeof(PTXFbHeader) && F.hdr->magic == 0x55434642 && F.hdr->buffer_count > 0 &&
+                       F.size >= ptx_fb_ext_offset(F.hdr->height, F.hdr->stride_bytes, F.hdr->buffer_count);
+    if (!valid) {
+        ptx_shm_unmap(F.base, F.size, F.fd);
+        F = PTXFbReader{};
+        return false;
+    }
+
+    F.payload_base = reinterpret_cast<const uint8_t*>(F.base) + sizeof(PTXFbHeader);
+    PTXNotify* notify = ptx_fb_find_notify(F.base, F.size);
+    if (notify) F.frames = reinterpret_cast<const PTXFbFrameInfo*>(notify + 1);
+    F.ext = notify;
+    F.notify = writable ? notify : nullptr;
+    return true;
+#endif
+}
+
+/** @brief Detach from a framebuffer ring. */
+inline void ptx_fb_detach(PTXFbReader& F) {
+#if PTX_HAS_POSIX_SHM
+    ptx_shm_unmap(F.base, F.size, F.fd);
+#endif
+    F = PTXFbReader{};
+}
+
+/** @brief Buffer header of ring slot @p index. */
+inline const PTXFbBuffer* ptx_fb_reader_buffer(const PTXFbReader& F, uint32_t index) {
+    return reinterpret_cast<const PTXFbBuffer*>(
+        F.payload_base + size_t(index) * ptx_onebuf_bytes(F.hdr->height, F.hdr->stride_bytes));
+}
+
+/**
+ * @brief Latest published frame number (0 if none or the producer does not stamp frames).
+ */
+inline uint64_t ptx_fb_latest_frame(const PTXFbReader& F) {
+    return F.ext ? F.ext->frame.load(std::memory_order_acquire) : 0;
+}
+
+/**
+ * @brief Take a zero-copy view of the newest complete buffer.
+ *
+ * Retries while the newest buffer is being written. The view stays usable until the producer
+ * wraps around the ring; confirm with ptx_fb_still_valid() after reading @c view.data.
+ *
+ * @return false if nothing has been published yet or every attempt hit a write in progress.
+ */
+inline bool ptx_fb_latest(const PTXFbReader& F, PTXFrameView& view, int retries = PTX_READ_RETRIES) {
+    if (!F.hdr) return false;
+
+    for (int attempt = 0; attempt < retries; ++attempt) {
+        const uint32_t index = ptx_fb_active_index(F.hdr).load(std::memory_order_acquire);
+        if (index >= F.hdr->buffer_count) return false;
+
+        const PTXFbBuffer* buffer = ptx_fb_reader_buffer(F, index);
+        const uint64_t seq = buffer->seq.load(std::memory_order_acquire);
+        if ((seq & 1ULL) == 0) { std::this_thread::yield(); continue; }  // being written
+        if (seq == 1) return false;                                      // never written
+
+        view.data = reinterpret_cast<const uint8_t*>(buffer) + sizeof(PTXFbBuffer);
+        view.width = F.hdr->width;
+        view.height = F.hdr->height;
+        view.stride = F.hdr->stride_bytes;
+        view.bytes = ptx_payload_bytes(view.height, view.stride);
+        view.index = index;
+        view.seq = seq;
+        view.frame = F.frames ? F.frames[index].frame : 0;
+        view.publish_ns = F.frames ? F.frames[index].publish_ns : 0;
+
+        // Frame info is written inside the seqlock; re-check so it matches the payload.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (buffer->seq.load(std::memory_order_relaxed) == seq) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Check that a view's buffer was not rewritten since ptx_fb_latest().
+ *
+ * Call after consuming @c view.data; false means the data may be torn and should be discarded.
+ */
+inline bool ptx_fb_still_valid(const PTXFbReader& F, const PTXFrameView& view) {
+    if (!F.hdr || !view.data) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return ptx_fb_reader_buffer(F, view.index)->seq.load(std::memory_order_relaxed) == view.seq;
+}
+
+/**
+ * @brief Copy the newest complete frame into @p dst, retrying torn reads.
+ * @param capacity Bytes available at @p dst; must hold height * stride.
+ * @param info Optional; receives the frame metadata (its @c data points at the ring, not @p dst).
+ */
+inline bool ptx_fb_copy_latest(const PTXFbReader& F, uint8_t* dst, size_t capacity,
+                               PTXFrameView* info = nullptr, int retries = PTX_READ_RETRIES) {
+    for (int attempt = 0; attempt < retries; ++attempt) {
+        PTXFrameView view;
+        if (!ptx_fb_latest(F, view, retries)) return false;
+        if (capacity < view.bytes) return false;
+
+        std::memcpy(dst, view.data, view.bytes);
+        if (ptx_fb_still_valid(F, view)) {
+            if (info) *info = view;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Wait until a frame newer than @p last_frame is published.
+ *
+ * Blocks on the producer's wakeup block when available; otherwise sleep-polls.
+ *
+ * @param timeout_ms Timeout in milliseconds; negative waits forever.
+ * @return true if a newer frame is available.
+ */
+inline bool ptx_fb_wait(const PTXFbReader& F, uint64_t last_frame, int timeout_ms) {
+    if (!F.hdr) return false;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto remaining = [&]() {
+        if (timeout_ms < 0) return -1;
+        const auto used = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        return int(std::max<int64_t>(0, timeout_ms - used.count()));
+    };
+
+    if (!F.frames) {
+        // Producer without frame stamps: watch the active buffer sequence instead.
+        const uint32_t index = ptx_fb_active_index(F.hdr).load(std::memory_order_acquire);
+        const uint64_t seq = ptx_fb_reader_buffer(F, index)->seq.load(std::memory_order_acquire);
+        for (;;) {
+            const uint32_t now = ptx_fb_active_index(F.hdr).load(std::memory_order_acquire);
+            if (now != index || ptx_fb_reader_buffer(F, now)->seq.load(std::memory_order_acquire) != seq) return true;
+            if (remaining() == 0) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    for (;;) {
+        // Load the event before the frame so a publish in between is never missed.
+        const uint32_t seen = F.notify ? F.notify->event.load(std::memory_order_acquire) : 0;
+        if (ptx_fb_latest_frame(F) > last_frame) return true;
+
+        const int wait_ms = remaining();
+        if (wait_ms == 0) return false;
+
+        if (F.notify) {
+            ptx_notify_wait(F.notify, seen, wait_ms);
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+// === Geometry ===
+
+/**
+ * @brief Attach to a geometry segment created by ptx_geom_init().
+ */
+inline bool ptx_geom_attach(PTXGeomReader& G, const char* name) {
+#if !PTX_HAS_POSIX_SHM
+    (void)G; (void)name;
+    return false;
+#else
+    bool writable = false;
+    if (!ptx_shm_map_existing(name, writable, G.base, G.size, G.fd)) return false;
+
+    G.hdr = reinterpret_cast<const PTXGeomHeader*>(G.base);
+    if (G.size < sizeof(PTXGeomHeader) || G.hdr->magic != 0x5543474D || G.size < ptx_geom_bytes(G.hdr->count)) {
+        ptx_shm_unmap(G.base, G.size, G.fd);
+        G = PTXGeomReader{};
+        return false;
+    }
+
+    G.xy = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(G.base) + sizeof(PTXGeomHeader));
+    return true;
+#endif
+}
+
+/** @brief Detach from a geometry segment. */
+inline void ptx_geom_detach(PTXGeomReader& G) {
+#if PTX_HAS_POSIX_SHM
+    ptx_shm_unmap(G.base, G.size, G.fd);
+#endif
+    G = PTXGeomReader{};
+}
+
+/** @brief Number of XY pairs in the segment. */
+inline uint32_t ptx_geom_count(const PTXGeomReader& G) {
+    return G.hdr ? G.hdr->count : 0;
+}
+
+/** @brief Published geometry generation; re-read the geometry when it changes. */
+inline uint64_t ptx_geom_reader_generation(const PTXGeomReader& G) {
+    return G.hdr ? G.hdr->generation.load(std::memory_order_acquire) : 0;
+}
+
+/**
+ * @brief Copy @p count XY pairs into @p dst, retrying torn reads.
+ * @param generation Optional; receives the generation of the copied geometry.
+ * @return false if @p count does not match, nothing was published yet, or every attempt was torn.
+ */
+inline bool ptx_geom_read(const PTXGeomReader& G, float* dst, uint32_t count,
+                          uint64_t* generation = nullptr, int retries = PTX_READ_RETRIES) {
+    if (!G.hdr || count != G.hdr->count) return false;
+
+    for (int attempt = 0; attempt < retries; ++attempt) {
+        const uint64_t seq = G.hdr->seq.load(std::memory_order_acquire);
+        if ((seq & 1ULL) == 0) { std::this_thread::yield(); continue; }
+
+        const uint64_t gen = G.hdr->generation.load(std::memory_order_relaxed);
+        if (gen == 0) return false;
+
+        std::memcpy(dst, G.xy, size_t(count) * sizeof(float) * 2);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (G.hdr->seq.load(std::memory_order_relaxed) == seq) {
+            if (generation) *generation = gen;
+            return true;
+        }
+    }
+    return false;
+}
+
+// === Delta ===
+
+/**
+ * @brief Attach to a delta channel created by ptx_delta_init().
+ */
+inline bool ptx_delta_attach(PTXDeltaReader& D, const char* name) {
+#if !PTX_HAS_POSIX_SHM
+    (void)D; (void)name;
+    return false;
+#else
+    bool writable = false;
+    if (!ptx_shm_map_existing(name, writable, D.base, D.size, D.fd)) return false;
+
+    D.hdr = reinterpret_cast<const PTXDeltaHeader*>(D.base);
+    const bool valid = D.size >= sizeof(PTXDeltaHeader) && D.hdr->magic == 0x55434443 && D.hdr->slot_count > 0 &&
+                       D.hdr->capacity >= ptx_delta_bound(D.hdr->frame_bytes) &&
+                       D.size >= sizeof(PTXDeltaHeader) + size_t(D.hdr->slot_count) * ptx_delta_slot_bytes(D.hdr->capacity);
+    if (!valid) {
+        ptx_shm_unmap(D.base, D.size, D.fd);
+        D = PTXDeltaReader{};
+        return false;
+    }
+
+    D.slots = reinterpret_cast<const uint8_t*>(D.base) + sizeof(PTXDeltaHeader);
+    return true;
+#endif
+}
+
+/** @brief Detach from a delta channel. */
+inline void ptx_delta_detach(PTXDeltaReader& D) {
+#if PTX_HAS_POSIX_SHM
+    ptx_shm_unmap(D.base, D.size, D.fd);
+#endif
+    D = PTXDeltaReader{};
+}
+
+/** @brief Frame number of the latest packet (0 if none). */
+inline uint64_t ptx_delta_latest_frame(const PTXDeltaReader& D) {
+    return D.hdr ? D.hdr->frame.load(std::memory_order_acquire) : 0;
+}
+
+/**
+ * @brief Copy the packet that produces frame @p frame, if it is still in the ring.
+ * @param capacity Bytes available at @p dst; ptx_delta_bound(frame_bytes) always suffices.
+ * @return Packet size, or 0 if the packet was overwritten, never published, or every attempt was torn.
+ */
+inline size_t ptx_delta_read_packet(const PTXDeltaReader& D, uint64_t frame, uint8_t* dst, size_t capacity,
+                                    int retries = PTX_READ_RETRIES) {
+    if (!D.hdr || !dst || frame == 0) return 0;
+
+    const uint32_t count = D.hdr->slot_count;
+    const size_t stride = ptx_delta_slot_bytes(D.hdr->capacity);
+
+    for (int attempt = 0; attempt < retries; ++attempt) {
+        // Packets are written round-robin, so frame N sits latest - N slots behind the active one.
+        const uint64_t latest = ptx_delta_latest_frame(D);
+        if (frame > latest || latest - frame >= count) return 0;
+        const uint32_t active = D.hdr->active_index.load(std::memory_order_acquire);
+        const uint32_t index = uint32_t((active + count - (latest - frame) % count) % count);
+
+        const auto* slot = reinterpret_cast<const PTXDeltaSlot*>(D.slots + index * stride);
+        const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+        if ((seq & 1ULL) == 0) { std::this_thread::yield(); continue; }
+        if (seq == 1) return 0;
+
+        const size_t bytes = slot->bytes;
+        if (bytes < sizeof(PTXDeltaPacket) || bytes > capacity || bytes > D.hdr->capacity) return 0;
+        std::memcpy(dst, slot + 1, bytes);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->seq.load(std::memory_order_relaxed) != seq) continue;
+
+        // A publish between reading the frame and the index shifts the slot; look again.
+        PTXDeltaPacket packet;
+        if (ptx_delta_header(dst, bytes, packet) && packet.frame == frame) return bytes;
+    }
+    return 0;
+}
+
+/**
+ * @brief Bring a local copy of the frame from @p frame up to the latest packet.
+ *
+ * Applies the newest packet directly when it is a full frame, otherwise chains
+ * span packets from @p frame + 1. On success @p frame is the latest frame number.
+ *
+ * @param local Frame contents for @p frame (frame_bytes bytes); may be anything when @p frame is 0.
+ * @param scratch Packet buffer of at least ptx_delta_bound(frame_bytes) bytes.
+ * @return false if a packet in the chain was overwritten; resync from ptx_fb_copy_latest() then.
+ */
+inline bool ptx_delta_catch_up(const PTXDeltaReader& D, uint8_t* local, uint64_t& frame,
+                               uint8_t* scratch, size_t scratch_bytes) {
+    if (!D.hdr || !local || !scratch) return false;
+
+    const uint64_t latest = ptx_delta_latest_frame(D);
+    const size_t frame_bytes = D.hdr->frame_bytes;
+    if (latest <= frame) return true;
+
+    size_t bytes = ptx_delta_read_packet(D, latest, scratch, scratch_bytes);
+    PTXDeltaPacket packet;
+    if (bytes && ptx_delta_header(scratch, bytes, packet) && packet.kind == PTX_DELTA_FULL) {
+        if (!ptx_delta_apply(local, frame_bytes, scratch, bytes)) return false;
+        frame = latest;
+        return true;
+    }
+
+    for (uint64_t next = frame + 1; next <= latest; ++next) {
+        bytes = ptx_delta_read_packet(D, next, scratch, scratch_bytes);
+        if (!bytes || !ptx_delta_header(scratch, bytes, packet)) return false;
+        if (packet.kind == PTX_DELTA_SPANS && packet.base_frame != frame) return false;
+        if (!ptx_delta_apply(local, frame_bytes, scratch, bytes)) return false;
+        frame = next;
+    }
+    return true;
+}
@@ -19,29 +19,70 @@
 #include "../core/platform/time.hpp"
 #include "../core/platform/console.hpp"
 
+#include <cstdint>
+#include <vector>
+
+#if !defined(ARDUINO)
+    #include <condition_variable>
+    #include <mutex>
+    #include <thread>
+#endif
+
 /**
  * @class Project
  * @brief Manages animations, rendering, and display operations.
  *
  * The Project class integrates various subsystems including camera management, scene rendering,
  * and display updates. It also tracks and reports performance metrics such as frame rate and
- * individual operation times.
+ * per-stage timings.
+ *
+ * In pipelined mode (@ref SetPipelined), @ref Display() copies every camera's colors into a
+ * back buffer, swaps it with the buffer the controller displays, and hands the controller to a
+ * dedicated display thread. Frame N is displayed while frame N+1 is animated and rendered into
+ * the pixel groups, so display I/O no longer stalls the next frame.
  */
 class Project {
+public:
+    /**
+     * @enum FrameStage
+     * @brief Timed stages of a frame.
+     */
+    enum class FrameStage : uint8_t {
+        Animate,   ///< Update(ratio)
+        Render,    ///< Rasterization and particles
+        Present,   ///< Pipelined hand-off: color copy plus waiting for the previous display
+        Display,   ///< Controller::Display (on the display thread when pipelined)
+        Frame,     ///< Whole Frame() call on the caller's thread
+        Count
+    };
+
+    /**
+     * @struct StageTiming
+     * @brief Timing of one stage in seconds.
+     */
+    struct StageTiming {
+        float last = 0.0f;        ///< Most recent sample
+        float average = 0.0f;     ///< Exponential moving average
+        float max = 0.0f;         ///< Largest sample since the last reset
+        uint32_t samples = 0;     ///< Samples since the last reset
+    };
+
 protected:
     CameraManager* cameras; ///< Pointer to the CameraManager for managing cameras.
     Controller* controller; ///< Pointer to the Controller for controlling the display.
     Scene scene; ///< The Scene object representing the rendered environment.
+    ParticleSplatter* particles = nullptr; ///< Optional particle renderer composed over the scene (not owned).
 
     RunningAverageFilter avgFPS{50, 0.05f}; ///< Running average filter for frame rate calculation.
 
-    long previousAnimationTime = 0; ///< Time of the previous animation frame in microseconds.
-    long previousRenderTime = 0; ///< Time of the previous render frame in microseconds.
-    long previousDisplayTime = 0; ///< Time of the previous display frame in microseconds.
+    uint32_t renderStart = 0; ///< Start of the current render in microseconds.
     float fade = 0.0f; ///< Fade parameter for animations.
-    float animationTime = 0.0f; ///< Time spent on animation in milliseconds.
-    float renderTime = 0.0f; ///< Time spent on rendering in milliseconds.
-    float displayTime = 0.0f; ///< Time spent on display in milliseconds.
+    StageTiming stageTimings[static_cast<uint8_t>(FrameStage::Count)]; ///< Per-stage timings in seconds.
+
+    /**
+     * @brief Records a stage sample in seconds.
+     */
+    void RecordStage(FrameStage stage, float seconds);
 
     /**
      * @brief Updates the project state based on the given ratio.
@@ -63,10 +104,47 @@ protected:
      */
     void RenderEndTimer();
 
+private:
+    bool pipelined = false; ///< Display runs on its own thread.
+    bool parallelRender = false; ///< Cameras render concurrently on the shared thread pool.
+    uint8_t frontIndex = 0; ///< colorBuffers set the controller currently displays.
+    std::vector<std::vector<RGBColor>> colorBuffers[2]; ///< Per-camera front and back color snapshots.
+    std::vector<RGBColor*> displayPointers; ///< Front buffer pointers handed to the controller.
+
+#if !defined(ARDUINO)
+    std::thread displayThread;
+    std::mutex displayMutex;
+    std::condition_variable displayCondition;
+    bool displayPending = false; ///< A presented frame is waiting for or being displayed.
+    bool displayStop = false;
+    float displaySeconds = -1.0f; ///< Duration of the last threaded display, -1 when already recorded.
+
+    void DisplayLoop();
+    void StopDisplayThread();
+#endif
+
+    /**
+     * @brief Copies colors into the back buffers and hands them to the display thread.
+     */
+    void Present();
+
+    /**
+     * @brief Waits for the display thread to go idle and records its last display time.
+     */
+    void WaitForDisplay();
+
 public:
 
     Project() : cameras(nullptr), controller(nullptr), scene(0) {}
 
+    /**
+     * @brief Stops the display thread, if any.
+     */
+    virtual ~Project();
+
+    Project(const Project&) = delete;
+    Project& operator=(const Project&) = delete;
+
     /**
      * @brief Constructs a Project with specified camera manager and controller.
      *
@@ -81,29 +159,75 @@ public:
     void SetController(Controller* c)        { controller = c; }
 
     /**
-     * @brief Retrieves the time spent on animations.
+     * @brief Sets the particle renderer drawn over the scene in Render() (not owned, may be null).
+     */
+    void SetParticleRenderer(ParticleSplatter* p) { particles = p; }
+
+    /**
+     * @brief Enables or disables the pipelined frame loop.
      *
-     * @return The animation time in milliseconds.
+     * Disabling waits for the frame in flight, stops the display thread and displays live
+     * pixel colors again. Derived projects that own their controller should disable it (or
+     * call @ref Flush()) before that controller is destroyed.
      */
-    float GetAnimationTime();
+    void SetPipelined(bool enabled);
 
     /**
-     * @brief Retrieves the time spent on rendering.
+     * @brief Whether display runs on its own thread, overlapped with the next frame.
+     */
+    bool IsPipelined() const { return pipelined; }
+
+    /**
+     * @brief Waits until the frame handed to the display thread has been displayed.
+     */
+    void Flush();
+
+    /**
+     * @brief Renders cameras concurrently on the shared thread pool (see RenderingEngine::RasterizeParallel).
      *
-     * @return The render time in milliseconds.
+     * Update() must not modify the scene from other threads while Render() runs; output is
+     * identical to the serial render.
+     */
+    void SetParallelRender(bool enabled) { parallelRender = enabled; }
+
+    /**
+     * @brief Whether cameras render concurrently.
+     */
+    bool IsParallelRender() const { return parallelRender; }
+
+    /**
+     * @brief Gets the timing of one stage.
+     */
+    StageTiming GetStageTiming(FrameStage stage) const;
+
+    /**
+     * @brief Clears every stage timing.
+     */
+    void ResetStageTimings();
+
+    /**
+     * @brief Retrieves the last animation time in seconds.
+     */
+    float GetAnimationTime();
+
+    /**
+     * @brief Retrieves the last render time in seconds.
      */
     float GetRenderTime();
 
     /**
-     * @brief Retrieves the time spent on display operations.
+     * @brief Retrieves the last display time in seconds.
      *
-     * @return The display time in milliseconds.
+     * When pipelined this is measured on the display thread and lags one frame behind.
      */
     float GetDisplayTime();
 
     /**
      * @brief Retrieves the current frame rate.
      *
+     * Uses the Frame stage when frames run through @ref Frame(), otherwise the sum of the
+     * serial stages. A pipelined frame is bounded by its slowest side, not the sum.
+     *
      * @return The frame rate in frames per second (FPS).
      */
     float GetFrameRate();
@@ -130,9 +254,19 @@ public:
 
     /**
      * @brief Updates the display with the rendered content.
+     *
+     * When pipelined, snapshots the current colors and returns while the display thread
+     * shows them.
      */
     void Display();
 
+    /**
+     * @brief Runs one frame: Animate, Render and Display, recording the Frame stage.
+     *
+     * @param ratio A float representing the interpolation ratio for animations.
+     */
+    void Frame(float ratio);
+
     /**
      * @brief Prints performance statistics such as frame rate and operation times.
      */
@@ -11,7 +11,7 @@
 #include <memory>
 #include <string>
 #include <cstdint>
-#include "../../registry/reflect_macros.hpp"
+#include "../registry/reflect_macros.hpp"
 
 namespace ptx {
 
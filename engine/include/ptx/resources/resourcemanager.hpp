@@ -2,6 +2,11 @@
  * @file resourcemanager.hpp
  * @brief Central resource management system for loading and caching assets.
  *
+ * Loaders never run under the cache lock. A request for an uncached path inserts a pending
+ * entry holding a shared future, then runs the loader outside the lock; concurrent requests
+ * for the same path join that future instead of loading twice. Asynchronous loads run on a
+ * small bounded loader pool with priority classes.
+ *
  * @date 11/10/2025
  * @author Coela
  */
@@ -15,8 +20,14 @@
 #include <mutex>
 #include <vector>
 #include <typeindex>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <thread>
 #include "resourcehandle.hpp"
-#include "../../registry/reflect_macros.hpp"
+#include "../registry/reflect_macros.hpp"
 
 namespace ptx {
 
@@ -27,12 +38,46 @@ namespace ptx {
 template<typename T>
 using ResourceLoader = std::function<std::shared_ptr<T>(const std::string&)>;
 
+/**
+ * @enum LoadPriority
+ * @brief Scheduling class of an asynchronous load; lower values are served first.
+ */
+enum class LoadPriority : uint8_t {
+    Critical = 0,  ///< Needed for the current or next frame.
+    Normal = 1,    ///< Needed soon.
+    Streaming = 2  ///< Background prefetch; leaves one loader thread free when there are two or more.
+};
+
 /**
  * @class ResourceManager
  * @brief Manages loading, caching, and lifecycle of resources.
  */
 class ResourceManager {
 private:
+    /**
+     * @brief One in-flight load shared by every request for the same type and path.
+     *
+     * Whoever claims the entry first (a loader thread or a synchronous Load()) runs it;
+     * everyone else waits on the shared future.
+     */
+    struct PendingLoad {
+        std::type_index type;
+        std::string path;
+        std::function<std::shared_ptr<Resource>()> load;                                    ///< Bound loader call.
+        std::promise<std::shared_ptr<Resource>> promise;
+        std::shared_future<std::shared_ptr<Resource>> future;
+        std::vector<std::function<void(const std::shared_ptr<Resource>&, uint32_t)>> callbacks; ///< Guarded by cacheMutex.
+        std::atomic<bool> claimed{false};
+        std::atomic<uint8_t> priority{static_cast<uint8_t>(LoadPriority::Streaming)};       ///< Best class requested so far.
+        uint32_t generation = 0;                                                            ///< Set before the promise is fulfilled.
+
+        PendingLoad(std::type_index type, std::string path)
+            : type(type), path(std::move(path)), future(promise.get_future().share()) {}
+    };
+
+    using PendingPtr = std::shared_ptr<PendingLoad>;
+
+
     // Singleton instance
     static ResourceManager* instance;
 
@@ -46,9 +91,21 @@ private:
     uint64_t nextID;
     uint32_t generation;
 
+    // In-flight loads (type -> path -> pending entry), guarded by cacheMutex
+    std::unordered_map<std::type_index, std::unordered_map<std::string, PendingPtr>> pending;
+
     // Thread safety
     std::mutex cacheMutex;
 
+    // Loader pool: one queue per LoadPriority, guarded by queueMutex
+    std::vector<std::thread> loaderThreads;
+    std::deque<PendingPtr> loadQueues[3];
+    std::mutex queueMutex;
+    std::condition_variable queueChanged;
+    size_t loaderThreadCount;
+    size_t streamingActive;
+    bool stoppingLoaders;
+
     // Hot-reload tracking
     bool hotReloadEnabled;
     std::unordered_map<std::string, time_t> fileTimestamps;
@@ -73,7 +130,12 @@ public:
     // === Resource Loading ===
 
     /**
-     * @brief Loads a resource from disk.
+     * @brief Loads a resource from disk, blocking until it is available.
+     *
+     * The loader runs on the calling thread outside the cache lock. If the same path is
+     * already loading, the call waits for that load instead; if it is only queued, the
+     * call takes it over rather than waiting behind the queue.
+     *
      * @param path The resource path.
      * @return Handle to the loaded resource.
      */
@@ -81,12 +143,37 @@ public:
     ResourceHandle<T> Load(const std::string& path);
 
     /**
-     * @brief Loads a resource asynchronously (future implementation).
+     * @brief Loads a resource on the loader pool.
+     *
+     * Cached resources invoke @p callback immediately on the calling thread; otherwise it
+     * runs on the thread that finished the load, before waiting Load() calls return.
+     * Requests for a path already in flight join it, raising its priority if needed.
+     *
      * @param path The resource path.
-     * @param callback Callback when loaded.
+     * @param callback Callback when loaded (null handle on failure).
+     * @param priority Scheduling class; queues are served Critical first, Streaming last.
      */
     template<typename T>
-    void LoadAsync(const std::string& path, std::function<void(ResourceHandle<T>)> callback);
+    void LoadAsync(const std::string& path, std::function<void(ResourceHandle<T>)> callback,
+                   LoadPriority priority = LoadPriority::Normal);
+
+    /**
+     * @brief Blocks until every load in flight at the time of the call, and any it triggers, has finished.
+     */
+    void WaitForPendingLoads();
+
+    /**
+     * @brief Gets the number of loads in flight.
+     */
+    size_t GetPendingLoadCount() const;
+
+    /**
+     * @brief Sets the number of loader threads used by LoadAsync().
+     * @param count Thread count; zero selects hardware concurrency minus one, capped at four.
+     *
+     * Running threads finish the queued work and are replaced on the next LoadAsync().
+     */
+    void SetLoaderThreadCount(size_t count);
 
     /**
      * @brief Unloads a specific resource.
@@ -232,6 +319,38 @@ private:
     template<typename T>
     std::shared_ptr<T> DefaultLoader(const std::string& path);
 
+    /**
+     * @brief Finds the in-flight load for a path or creates one bound to the current loader.
+     * @note Caller holds cacheMutex.
+     */
+    template<typename T>
+    PendingPtr FindOrCreatePending(const std::string& path, bool& created);
+
+    /**
+     * @brief Runs the entry's loader unless another thread already claimed it.
+     */
+    void RunPending(const PendingPtr& entry);
+
+    /**
+     * @brief Publishes a finished load to the cache, waiters and callbacks.
+     */
+    void FinishPending(const PendingPtr& entry, std::shared_ptr<Resource> resource, std::exception_ptr error);
+
+    /**
+     * @brief Queues an entry on the loader pool, starting the threads if needed.
+     */
+    void EnqueuePending(const PendingPtr& entry, LoadPriority priority);
+
+    /**
+     * @brief Loader thread body.
+     */
+    void LoaderLoop();
+
+    /**
+     * @brief Drains the queues and joins the loader threads.
+     */
+    void StopLoaderThreads();
+
     /**
      * @brief Updates memory tracking.
      */
@@ -248,7 +367,7 @@ private:
         PTX_METHOD_AUTO(ResourceManager, GetTotalMemoryUsed, "Get total memory used"),
         PTX_METHOD_AUTO(ResourceManager, SetMemoryLimit, "Set memory limit"),
         PTX_METHOD_AUTO(ResourceManager, GarbageCollect, "Garbage collect"),
-        PTX_METHOD_AUTO(ResourceManager, GetCachedResourceCount, "Get cached resource count"),
+        /* Get cached resource count */ PTX_METHOD_OVLD_CONST0(ResourceManager, GetCachedResourceCount, size_t),
         PTX_METHOD_AUTO(ResourceManager, PrintStatistics, "Print statistics"),
         PTX_METHOD_AUTO(ResourceManager, EnableHotReload, "Enable hot reload"),
         PTX_METHOD_AUTO(ResourceManager, CheckHotReload, "Check hot reload")
@@ -263,56 +382,80 @@ private:
 
 template<typename T>
 ResourceHandle<T> ResourceManager::Load(const std::string& path) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
+    PendingPtr entry;
 
-    auto typeIdx = GetTypeIndex<T>();
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
 
-    // Check if already cached
-    auto& typeCache = cache[typeIdx];
-    auto it = typeCache.find(path);
-    if (it != typeCache.end()) {
-        // Cast to specific type
-        auto resource = std::static_pointer_cast<T>(it->second);
-        return ResourceHandle<T>(resource, resource->GetID(), generation);
-    }
-
-    // Load new resource
-    std::shared_ptr<T> resource;
+        // Check if already cached
+        auto& typeCache = cache[GetTypeIndex<T>()];
+        auto it = typeCache.find(path);
+        if (it != typeCache.end()) {
+            auto resource = std::static_pointer_cast<T>(it->second);
+            return ResourceHandle<T>(resource, resource->GetID(), generation);
+        }
 
-    // Check for custom loader
-    auto loaderIt = loaders.find(typeIdx);
-    if (loaderIt != loaders.end()) {
-        // Use custom loader (cast is safe because we registered it)
-        auto loader = reinterpret_cast<ResourceLoader<T>*>(&loaderIt->second);
-        resource = (*loader)(path);
-    } else {
-        // Use default loader
-        resource = DefaultLoader<T>(path);
+        bool created = false;
+        entry = FindOrCreatePending<T>(path, created);
     }
 
-    if (resource) {
-        resource->SetPath(path);
-        resource->SetID(GenerateID());
-
-        // Cache the resource
-        typeCache[path] = resource;
-
-        // Update memory tracking
-        totalMemoryUsed += resource->GetMemorySize();
+    // Load outside the lock; a load someone else already started is simply awaited
+    RunPending(entry);
 
-        return ResourceHandle<T>(resource, resource->GetID(), generation);
+    auto resource = std::static_pointer_cast<T>(entry->future.get());
+    if (resource) {
+        return ResourceHandle<T>(resource, resource->GetID(), entry->generation);
     }
 
     return ResourceHandle<T>();  // Null handle
 }
 
 template<typename T>
-void ResourceManager::LoadAsync(const std::string& path, std::function<void(ResourceHandle<T>)> callback) {
-    // TODO: Implement async loading with thread pool
-    // For now, just load synchronously and call callback
-    auto handle = Load<T>(path);
-    if (callback) {
-        callback(handle);
+void ResourceManager::LoadAsync(const std::string& path, std::function<void(ResourceHandle<T>)> callback,
+                                LoadPriority priority) {
+    PendingPtr entry;
+    ResourceHandle<T> cached;
+    bool created = false;
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+
+        auto& typeCache = cache[GetTypeIndex<T>()];
+        auto it = typeCache.find(path);
+        if (it != typeCache.end()) {
+            auto resource = std::static_pointer_cast<T>(it->second);
+            cached = ResourceHandle<T>(resource, resource->GetID(), generation);
+        } else {
+            entry = FindOrCreatePending<T>(path, created);
+
+            if (callback) {
+                entry->callbacks.emplace_back([callback](const std::shared_ptr<Resource>& loaded, uint32_t gen) {
+                    if (loaded) {
+                        auto resource = std::static_pointer_cast<T>(loaded);
+                        callback(ResourceHandle<T>(resource, resource->GetID(), gen));
+                    } else {
+                        callback(ResourceHandle<T>());
+                    }
+                });
+            }
+        }
+    }
+
+    if (!entry) {
+        if (callback) {
+            callback(cached);
+        }
+        return;
+    }
+
+    // Queue new entries, and queue joined ones again when this request outranks them
+    const uint8_t requested = static_cast<uint8_t>(priority);
+    uint8_t current = entry->priority.load();
+    while (requested < current && !entry->priority.compare_exchange_weak(current, requested)) {
+    }
+
+    if (created || requested < current) {
+        EnqueuePending(entry, priority);
     }
 }
 
@@ -411,17 +554,26 @@ void ResourceManager::UnregisterLoader() {
 
 template<typename T>
 bool ResourceManager::Reload(const std::string& path) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
+    std::shared_ptr<Resource> resource;
 
-    auto typeIdx = GetTypeIndex<T>();
-    auto& typeCache = cache[typeIdx];
-    auto it = typeCache.find(path);
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
 
-    if (it != typeCache.end()) {
-        return it->second->Reload();
+        auto& typeCache = cache[GetTypeIndex<T>()];
+        auto it = typeCache.find(path);
+        if (it == typeCache.end()) {
+            return false;
+        }
+        resource = it->second;
     }
 
-    return false;
+    // Reload outside the lock so other lookups are not held up by the decode
+    const size_t oldSize = resource->GetMemorySize();
+    const bool success = resource->Reload();
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    totalMemoryUsed = totalMemoryUsed - oldSize + resource->GetMemorySize();
+    return success;
 }
 
 template<typename T>
@@ -447,4 +599,31 @@ std::shared_ptr<T> ResourceManager::DefaultLoader(const std::string& path) {
     return nullptr;
 }
 
+template<typename T>
+typename ResourceManager::PendingPtr ResourceManager::FindOrCreatePending(const std::string& path, bool& created) {
+    auto typeIdx = GetTypeIndex<T>();
+    auto& typePending = pending[typeIdx];
+
+    auto it = typePending.find(path);
+    if (it != typePending.end()) {
+        created = false;
+        return it->second;
+    }
+
+    auto entry = std::make_shared<PendingLoad>(typeIdx, path);
+
+    // Bind the loader now so a later RegisterLoader() does not affect this load
+    auto loaderIt = loaders.find(typeIdx);
+    if (loaderIt != loaders.end()) {
+        auto loader = loaderIt->second;
+        entry->load = [loader, path]() { return loader(path); };
+    } else {
+        entry->load = [this, path]() -> std::shared_ptr<Resource> { return DefaultLoader<T>(path); };
+    }
+
+    typePending.emplace(path, entry);
+    created = true;
+    return entry;
+}
+
 } // namespace ptx
@@ -24,6 +24,8 @@
 class Controller {
 protected:
     CameraManager* cameras; ///< Pointer to the CameraManager for managing camera data.
+    RGBColor* const* displayBuffers = nullptr; ///< Optional per-camera color snapshots (not owned).
+    uint8_t displayBufferCount = 0; ///< Number of entries in displayBuffers.
 
     /**
      * @brief Constructs a Controller with specified parameters.
@@ -32,7 +34,31 @@ protected:
      */
     Controller(CameraManager* cameras);
 
+    /**
+     * @brief Gets the colors to display for camera @p index.
+     *
+     * Returns the buffer set with @ref SetDisplayBuffers() when there is one, otherwise the
+     * pixel group's live colors. Implementations should read colors through this.
+     *
+     * @param index Camera index in the CameraManager.
+     * @param pixelGroup The camera's pixel group.
+     */
+    RGBColor* GetDisplayColors(uint8_t index, IPixelGroup* pixelGroup) const;
+
 public:
+    virtual ~Controller() = default;
+
+    /**
+     * @brief Displays per-camera color snapshots instead of the live pixel groups.
+     *
+     * Used by pipelined frame loops so the next frame can render into the pixel groups
+     * while this one is displayed. Each buffer holds the camera's pixel count colors.
+     *
+     * @param buffers One buffer per camera (not owned), or nullptr to display live colors.
+     * @param count Number of buffers.
+     */
+    void SetDisplayBuffers(RGBColor* const* buffers, uint8_t count);
+
     /**
      * @brief Initializes the controller.
      */
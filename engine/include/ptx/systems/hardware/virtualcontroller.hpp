@@ -7,6 +7,7 @@
  *  - Registry:   /ptx_reg        (lists all cameras + metadata)
  *  - Per-camera: /ptx_fb{idx}    (1×N RGB888 stream for colors)
  *               /ptx_geom{idx}  (N XY float32 pairs for pixel positions)
+ *               /ptx_delta{idx} (optional changed-span packets, see SetDeltaOutput())
  *  - Control:    /ptx_ctrl       (shared control block)
  *
  * The frontend enumerates /ptx_reg and opens the /ptx_fb{idx} + /ptx_geom{idx} pair for the chosen camera.
@@ -21,6 +22,7 @@
 #include "../../core/color/rgbcolor.hpp"
 #include "../render/core/cameramanager.hpp"
 #include "../../platform/ipc/ptx_shm.hpp"
+#include "../../platform/ipc/ptx_delta.hpp"
 #include "controller.hpp"
 
 /**
@@ -28,8 +30,10 @@
  * @brief Controller that publishes all cameras to shared memory for external UIs/clients.
  *
  * Lifecycle:
- * - @ref Initialize() creates registry and per-camera SHM channels sized to each camera’s pixel group.
- * - @ref Display() samples each camera’s IPixelGroup and publishes XY (geometry) and RGB888 (colors).
+ * - @ref Initialize() creates registry and per-camera SHM channels sized to each camera’s pixel group,
+ *   and publishes each camera's XY geometry once.
+ * - @ref Display() writes each camera's colors straight into the next framebuffer ring slot. Geometry
+ *   is republished only when the pixel group changes or @ref InvalidateGeometry() is called.
  *
  * Topology:
  * - Each camera is published as a 1×N framebuffer (RGB888) and a geometry buffer of N (x,y) pairs.
@@ -42,10 +46,14 @@ public:
      * @param cams      Camera manager providing cameras and pixel groups (not owned).
      * @param ctrl_name SHM control channel name (shared for all cameras), defaults to "/ptx_ctrl".
      * @param reg_name  SHM registry name (enumeration + meta), defaults to "/ptx_reg".
+     * @param stream_prefix Prefix of the per-camera channel names, defaults to "/ptx_"
+     *                  ("/ptx_fb{idx}", "/ptx_geom{idx}", "/ptx_delta{idx}"); recorded in the
+     *                  registry, so at most 27 characters.
      */
     VirtualController(CameraManager* cams,
                       const char* ctrl_name = "/ptx_ctrl",
-                      const char* reg_name  = "/ptx_reg");
+                      const char* reg_name  = "/ptx_reg",
+                      const char* stream_prefix = "/ptx_");
 
     /**
      * @brief Create registry and per-camera SHM objects, sized from current camera set.
@@ -60,37 +68,73 @@ public:
     void Initialize() override;
 
     /**
-     * @brief Publish XY + RGB888 for each camera’s pixel group into its SHM channels.
+     * @brief Publish RGB888 for each camera’s pixel group into its SHM channels.
      *
      * Steps per camera:
-     * - Fill staging arrays: XY from IPixelGroup::GetCoordinate(j), RGB from IPixelGroup::GetColor(j).
-     * - Publish geometry via ptx_geom_publish().
-     * - Publish framebuffer via ptx_publish_rgb888().
+     * - Republish geometry if it was invalidated or the camera's pixel group changed.
+     * - Claim the next ring slot with ptx_fb_acquire(), convert the camera's display colors into it,
+     *   and release it with ptx_fb_commit().
+     * - With delta output, diff the new slot against the previous one and publish the packet
+     *   before the commit.
      *
      * Cameras with mismatched pixel counts (vs. initial sizing) are skipped.
      */
     void Display() override;
 
+    /**
+     * @brief Request a geometry republish for every camera on the next @ref Display().
+     *
+     * Call after moving pixels of an existing pixel group. The geometry generation is only
+     * bumped if the coordinates actually changed.
+     */
+    void InvalidateGeometry();
+
+    /**
+     * @brief Geometry generation currently published for camera @p index (0 if none).
+     */
+    uint64_t GetGeometryGeneration(uint32_t index) const;
+
+    /**
+     * @brief Enable or disable the per-camera delta channels (/ptx_delta{idx}).
+     *
+     * When enabled, every @ref Display() also publishes a packet holding either the spans
+     * that changed since the previous frame or the full frame, whichever is smaller. Channels
+     * are created on the next @ref Display(). The full-frame ring is always published.
+     */
+    void SetDeltaOutput(bool enabled);
+
+    /**
+     * @brief Whether delta channels are published.
+     */
+    bool IsDeltaOutput() const { return delta_output_; }
+
+    /**
+     * @brief Size of the last delta packet published for camera @p index (0 if none).
+     */
+    uint32_t GetDeltaBytes(uint32_t index) const;
+
 private:
     /**
-     * @brief Per-camera SHM state and staging buffers.
+     * @brief Per-camera SHM state.
      *
      * - @ref shm : Framebuffer (RGB888) and handle to shared control block.
      * - @ref geom: Geometry buffer for N XY pairs.
-     * - @ref rgb : Staging RGB888 bytes (size 3*N).
-     * - @ref xy  : Staging XY floats (size 2*N).
-     * - Names are fixed per index: "/ptx_fb{idx}", "/ptx_geom{idx}", and a human label "Camera{idx}".
+     * - @ref pixels: Pixel group whose geometry was last published.
+     * - Names are fixed per index: "{prefix}fb{idx}", "{prefix}geom{idx}", and a human label "Camera{idx}".
      */
     struct PerCam {
         PTXShm  shm;             ///< Color FB (RGB888) + shared control handle
         PTXGeom geom;            ///< Geometry (XY pairs)
+        PTXDelta delta;          ///< Changed-span packets (only with delta output)
         uint32_t count = 0;       ///< Number of pixels (N)
         uint32_t W = 0;           ///< Framebuffer width  (W = N)
         uint32_t H = 1;           ///< Framebuffer height (H = 1)
-        std::vector<uint8_t> rgb; ///< RGB888 staging buffer (3*N bytes)
-        std::vector<float>   xy;  ///< XY staging buffer (2*N floats)
+        IPixelGroup* pixels = nullptr; ///< Pixel group of the published geometry
+        bool geom_dirty = true;   ///< Geometry must be republished
+        uint32_t delta_bytes = 0; ///< Size of the last delta packet
         std::string fb_name;      ///< SHM name: "/ptx_fb{idx}"
         std::string geom_name;    ///< SHM name: "/ptx_geom{idx}"
+        std::string delta_name;   ///< SHM name: "/ptx_delta{idx}"
         std::string ui_name;      ///< UI label: "Camera{idx}" or custom
 
     PTX_BEGIN_FIELDS(PerCam)
@@ -99,10 +143,10 @@ private:
         PTX_FIELD(PerCam, count, "Count", 0, 4294967295),
         PTX_FIELD(PerCam, W, "W", 0, 4294967295),
         PTX_FIELD(PerCam, H, "H", 0, 4294967295),
-        PTX_FIELD(PerCam, rgb, "Rgb", -2147483648, 2147483647),
-        PTX_FIELD(PerCam, xy, "Xy", -2147483648, 2147483647),
+        PTX_FIELD(PerCam, geom_dirty, "Geom dirty", 0, 1),
         PTX_FIELD(PerCam, fb_name, "Fb name", 0, 0),
         PTX_FIELD(PerCam, geom_name, "Geom name", 0, 0),
+        PTX_FIELD(PerCam, delta_name, "Delta name", 0, 0),
         PTX_FIELD(PerCam, ui_name, "Ui name", 0, 0)
     PTX_END_FIELDS
 
@@ -118,9 +162,22 @@ private:
 
     std::string ctrl_name_;  ///< Shared control channel name
     std::string reg_name_;   ///< Registry channel name
+    std::string stream_prefix_; ///< Prefix of the per-camera channel names
 
     PTXRegistry reg_{};           ///< Registry object (enumeration + camera meta)
     std::vector<PerCam> cams_;     ///< Per-camera SHM/state
+    std::vector<float> xy_;        ///< XY scratch used only when geometry is republished
+    bool delta_output_ = false;    ///< Publish /ptx_delta{idx} packets
+
+    /**
+     * @brief Publish @p pg's coordinates into @p pc's geometry channel if they changed.
+     */
+    void PublishGeometry(PerCam& pc, IPixelGroup* pg);
+
+    /**
+     * @brief Diff @p slot against the previous frame and publish the packet to @p pc's delta channel.
+     */
+    void PublishDelta(PerCam& pc, const PTXFbSlot& slot);
 
     PTX_BEGIN_FIELDS(VirtualController)
         /* No reflected fields. */
@@ -128,11 +185,16 @@ private:
 
     PTX_BEGIN_METHODS(VirtualController)
         PTX_METHOD_AUTO(VirtualController, Initialize, "Initialize"),
-        PTX_METHOD_AUTO(VirtualController, Display, "Display")
+        PTX_METHOD_AUTO(VirtualController, Display, "Display"),
+        PTX_METHOD_AUTO(VirtualController, InvalidateGeometry, "Invalidate geometry"),
+        PTX_METHOD_AUTO(VirtualController, GetGeometryGeneration, "Get geometry generation"),
+        PTX_METHOD_AUTO(VirtualController, SetDeltaOutput, "Set delta output"),
+        PTX_METHOD_AUTO(VirtualController, IsDeltaOutput, "Is delta output"),
+        PTX_METHOD_AUTO(VirtualController, GetDeltaBytes, "Get delta bytes")
     PTX_END_METHODS
 
     PTX_BEGIN_DESCRIBE(VirtualController)
-        PTX_CTOR(VirtualController, CameraManager *, const char *, const char *)
+        PTX_CTOR(VirtualController, CameraManager *, const char *, const char *, const char *)
     PTX_END_DESCRIBE(VirtualController)
 
 };
@@ -0,0 +1,95 @@
+/**
+ * @file attractoraffector.hpp
+ * @brief Point attractor (or repulsor) with linear falloff.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../particleaffector.hpp"
+#include "../../../core/math/vector3d.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class AttractorAffector
+ * @brief Accelerates particles toward a point.
+ *
+ * Acceleration is strength * (1 - distance / radius) inside the radius and zero
+ * outside; a negative strength repels.
+ */
+class AttractorAffector : public ParticleAffector {
+private:
+    Vector3D point;    ///< Attraction center
+    float strength;    ///< Acceleration at the center (units/s^2)
+    float radius;      ///< Influence radius (units)
+
+public:
+    /**
+     * @brief Constructor.
+     * @param point Attraction center.
+     * @param strength Acceleration at the center (units/s^2, negative repels).
+     * @param radius Influence radius (units).
+     */
+    AttractorAffector(const Vector3D& point = Vector3D(0, 0, 0), float strength = 10.0f, float radius = 10.0f);
+
+    /**
+     * @brief Gets the attraction center.
+     */
+    Vector3D GetPoint() const { return point; }
+
+    /**
+     * @brief Sets the attraction center.
+     */
+    void SetPoint(const Vector3D& value) { point = value; }
+
+    /**
+     * @brief Gets the acceleration at the center.
+     */
+    float GetStrength() const { return strength; }
+
+    /**
+     * @brief Sets the acceleration at the center.
+     */
+    void SetStrength(float value) { strength = value; }
+
+    /**
+     * @brief Gets the influence radius.
+     */
+    float GetRadius() const { return radius; }
+
+    /**
+     * @brief Sets the influence radius (clamped above zero).
+     */
+    void SetRadius(float value) { radius = value > 1e-6f ? value : 1e-6f; }
+
+    /**
+     * @brief Accelerates particles inside the radius toward the point.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(AttractorAffector)
+        PTX_FIELD(AttractorAffector, point, "Point", 0, 0),
+        PTX_FIELD(AttractorAffector, strength, "Strength", 0, 0),
+        PTX_FIELD(AttractorAffector, radius, "Radius", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(AttractorAffector)
+        PTX_METHOD_AUTO(AttractorAffector, GetPoint, "Get point"),
+        PTX_METHOD_AUTO(AttractorAffector, SetPoint, "Set point"),
+        PTX_METHOD_AUTO(AttractorAffector, GetStrength, "Get strength"),
+        PTX_METHOD_AUTO(AttractorAffector, SetStrength, "Set strength"),
+        PTX_METHOD_AUTO(AttractorAffector, GetRadius, "Get radius"),
+        PTX_METHOD_AUTO(AttractorAffector, SetRadius, "Set radius")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(AttractorAffector)
+        PTX_CTOR0(AttractorAffector),
+        PTX_CTOR(AttractorAffector, Vector3D, float, float)
+    PTX_END_DESCRIBE(AttractorAffector)
+};
+
+} // namespace ptx
@@ -0,0 +1,69 @@
+/**
+ * @file callbackaffector.hpp
+ * @brief User-defined batch kernel.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <functional>
+#include "../particleaffector.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @typedef ParticleBatchCallback
+ * @brief Custom update over a span of particles.
+ *
+ * To kill a particle, set its age to at least its lifetime (age * inverseLifetime >= 1);
+ * it is removed when the update finishes. The span must not be resized from the callback.
+ */
+using ParticleBatchCallback = std::function<void(const ParticleSpan&, float)>;
+
+/**
+ * @class CallbackAffector
+ * @brief Wraps a ParticleBatchCallback as an affector.
+ *
+ * One std::function call per span instead of one per particle.
+ */
+class CallbackAffector : public ParticleAffector {
+private:
+    ParticleBatchCallback callback;   ///< User kernel
+    ParticleAffectorStage stage;      ///< When the kernel runs
+
+public:
+    /**
+     * @brief Constructor.
+     * @param callback User kernel.
+     * @param stage When the kernel runs.
+     */
+    explicit CallbackAffector(ParticleBatchCallback callback,
+                              ParticleAffectorStage stage = ParticleAffectorStage::Forces);
+
+    /**
+     * @brief Gets the stage the kernel runs in.
+     */
+    ParticleAffectorStage GetStage() const override { return stage; }
+
+    /**
+     * @brief Invokes the callback on the span.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(CallbackAffector)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(CallbackAffector)
+        /* No reflected methods. */
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(CallbackAffector)
+        /* No reflected ctors. */
+    PTX_END_DESCRIBE(CallbackAffector)
+};
+
+} // namespace ptx
@@ -0,0 +1,61 @@
+/**
+ * @file dragaffector.hpp
+ * @brief Linear velocity damping.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../particleaffector.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class DragAffector
+ * @brief Scales velocities by max(0, 1 - coefficient * deltaTime) each update.
+ */
+class DragAffector : public ParticleAffector {
+private:
+    float coefficient;   ///< Fraction of velocity removed per second
+
+public:
+    /**
+     * @brief Constructor.
+     * @param coefficient Fraction of velocity removed per second.
+     */
+    explicit DragAffector(float coefficient = 0.5f);
+
+    /**
+     * @brief Gets the drag coefficient.
+     */
+    float GetCoefficient() const { return coefficient; }
+
+    /**
+     * @brief Sets the drag coefficient (clamped to >= 0).
+     */
+    void SetCoefficient(float value) { coefficient = value > 0.0f ? value : 0.0f; }
+
+    /**
+     * @brief Damps every velocity.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(DragAffector)
+        PTX_FIELD(DragAffector, coefficient, "Coefficient", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(DragAffector)
+        PTX_METHOD_AUTO(DragAffector, GetCoefficient, "Get coefficient"),
+        PTX_METHOD_AUTO(DragAffector, SetCoefficient, "Set coefficient")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(DragAffector)
+        PTX_CTOR0(DragAffector),
+        PTX_CTOR(DragAffector, float)
+    PTX_END_DESCRIBE(DragAffector)
+};
+
+} // namespace ptx
@@ -0,0 +1,65 @@
+/**
+ * @file gravityaffector.hpp
+ * @brief Constant acceleration applied to every particle.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../particleaffector.hpp"
+#include "../../../core/math/vector3d.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class GravityAffector
+ * @brief Adds a constant acceleration to particle velocities.
+ *
+ * Stacks with ParticleEmitterConfig::gravity, which the pool integrates directly;
+ * use this for additional or per-system fields such as wind.
+ */
+class GravityAffector : public ParticleAffector {
+private:
+    Vector3D acceleration;   ///< Acceleration (units/s^2)
+
+public:
+    /**
+     * @brief Constructor.
+     * @param acceleration Acceleration (units/s^2).
+     */
+    explicit GravityAffector(const Vector3D& acceleration = Vector3D(0, -9.8f, 0));
+
+    /**
+     * @brief Gets the acceleration.
+     */
+    Vector3D GetAcceleration() const { return acceleration; }
+
+    /**
+     * @brief Sets the acceleration.
+     */
+    void SetAcceleration(const Vector3D& value) { acceleration = value; }
+
+    /**
+     * @brief Adds acceleration * deltaTime to every velocity.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(GravityAffector)
+        PTX_FIELD(GravityAffector, acceleration, "Acceleration", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(GravityAffector)
+        PTX_METHOD_AUTO(GravityAffector, GetAcceleration, "Get acceleration"),
+        PTX_METHOD_AUTO(GravityAffector, SetAcceleration, "Set acceleration")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(GravityAffector)
+        PTX_CTOR0(GravityAffector),
+        PTX_CTOR(GravityAffector, Vector3D)
+    PTX_END_DESCRIBE(GravityAffector)
+};
+
+} // namespace ptx
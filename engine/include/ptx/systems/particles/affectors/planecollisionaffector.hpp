@@ -0,0 +1,97 @@
+/**
+ * @file planecollisionaffector.hpp
+ * @brief Keeps particles on the positive side of a plane.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../particleaffector.hpp"
+#include "../../../core/math/vector3d.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class PlaneCollisionAffector
+ * @brief Projects penetrating particles back onto the plane dot(normal, p) = offset.
+ *
+ * The normal velocity is reflected and scaled by bounce, and the tangential
+ * velocity is scaled by (1 - friction).
+ */
+class PlaneCollisionAffector : public ParticleAffector {
+private:
+    Vector3D normal;   ///< Unit plane normal (points to the free side)
+    float offset;      ///< Plane distance from the origin along the normal
+    float bounce;      ///< Normal restitution (0-1)
+    float friction;    ///< Tangential velocity removed on contact (0-1)
+
+public:
+    /**
+     * @brief Constructor.
+     * @param normal Plane normal (normalized internally).
+     * @param offset Plane distance from the origin along the normal.
+     * @param bounce Normal restitution (0-1).
+     * @param friction Tangential velocity removed on contact (0-1).
+     */
+    PlaneCollisionAffector(const Vector3D& normal = Vector3D(0, 1, 0), float offset = 0.0f,
+                           float bounce = 0.5f, float friction = 0.1f);
+
+    /**
+     * @brief Runs after integration.
+     */
+    ParticleAffectorStage GetStage() const override { return ParticleAffectorStage::Constraints; }
+
+    /**
+     * @brief Sets the plane (normal is normalized).
+     */
+    void SetPlane(const Vector3D& planeNormal, float planeOffset);
+
+    /**
+     * @brief Gets the unit plane normal.
+     */
+    Vector3D GetNormal() const { return normal; }
+
+    /**
+     * @brief Gets the plane offset.
+     */
+    float GetOffset() const { return offset; }
+
+    /**
+     * @brief Sets the normal restitution.
+     */
+    void SetBounce(float value) { bounce = value; }
+
+    /**
+     * @brief Sets the tangential velocity removed on contact.
+     */
+    void SetFriction(float value) { friction = value; }
+
+    /**
+     * @brief Resolves every particle behind the plane.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(PlaneCollisionAffector)
+        PTX_FIELD(PlaneCollisionAffector, offset, "Offset", 0, 0),
+        PTX_FIELD(PlaneCollisionAffector, bounce, "Bounce", 0, 1),
+        PTX_FIELD(PlaneCollisionAffector, friction, "Friction", 0, 1)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(PlaneCollisionAffector)
+        PTX_METHOD_AUTO(PlaneCollisionAffector, SetPlane, "Set plane"),
+        PTX_METHOD_AUTO(PlaneCollisionAffector, GetNormal, "Get normal"),
+        PTX_METHOD_AUTO(PlaneCollisionAffector, GetOffset, "Get offset"),
+        PTX_METHOD_AUTO(PlaneCollisionAffector, SetBounce, "Set bounce"),
+        PTX_METHOD_AUTO(PlaneCollisionAffector, SetFriction, "Set friction")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(PlaneCollisionAffector)
+        PTX_CTOR0(PlaneCollisionAffector),
+        PTX_CTOR(PlaneCollisionAffector, Vector3D, float, float, float)
+    PTX_END_DESCRIBE(PlaneCollisionAffector)
+};
+
+} // namespace ptx
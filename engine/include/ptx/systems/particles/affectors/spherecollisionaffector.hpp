@@ -0,0 +1,120 @@
+/**
+ * @file spherecollisionaffector.hpp
+ * @brief Sphere obstacle or container for particles.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../particleaffector.hpp"
+#include "../../../core/math/vector3d.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class SphereCollisionAffector
+ * @brief Keeps particles outside a sphere, or inside it when containing.
+ *
+ * Penetrating particles are projected onto the surface; the velocity component
+ * into the surface is reflected and scaled by bounce, and the tangential part is
+ * scaled by (1 - friction).
+ */
+class SphereCollisionAffector : public ParticleAffector {
+private:
+    Vector3D center;   ///< Sphere center
+    float radius;      ///< Sphere radius
+    float bounce;      ///< Normal restitution (0-1)
+    float friction;    ///< Tangential velocity removed on contact (0-1)
+    bool contain;      ///< Keep particles inside instead of outside
+
+public:
+    /**
+     * @brief Constructor.
+     * @param center Sphere center.
+     * @param radius Sphere radius.
+     * @param bounce Normal restitution (0-1).
+     * @param friction Tangential velocity removed on contact (0-1).
+     * @param contain Keep particles inside instead of outside.
+     */
+    SphereCollisionAffector(const Vector3D& center = Vector3D(0, 0, 0), float radius = 1.0f,
+                            float bounce = 0.5f, float friction = 0.1f, bool contain = false);
+
+    /**
+     * @brief Runs after integration.
+     */
+    ParticleAffectorStage GetStage() const override { return ParticleAffectorStage::Constraints; }
+
+    /**
+     * @brief Gets the sphere center.
+     */
+    Vector3D GetCenter() const { return center; }
+
+    /**
+     * @brief Sets the sphere center.
+     */
+    void SetCenter(const Vector3D& value) { center = value; }
+
+    /**
+     * @brief Gets the sphere radius.
+     */
+    float GetRadius() const { return radius; }
+
+    /**
+     * @brief Sets the sphere radius (clamped to >= 0).
+     */
+    void SetRadius(float value) { radius = value > 0.0f ? value : 0.0f; }
+
+    /**
+     * @brief Sets the normal restitution.
+     */
+    void SetBounce(float value) { bounce = value; }
+
+    /**
+     * @brief Sets the tangential velocity removed on contact.
+     */
+    void SetFriction(float value) { friction = value; }
+
+    /**
+     * @brief Checks if particles are kept inside.
+     */
+    bool IsContaining() const { return contain; }
+
+    /**
+     * @brief Keeps particles inside (true) or outside (false).
+     */
+    void SetContaining(bool value) { contain = value; }
+
+    /**
+     * @brief Resolves every penetrating particle.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(SphereCollisionAffector)
+        PTX_FIELD(SphereCollisionAffector, center, "Center", 0, 0),
+        PTX_FIELD(SphereCollisionAffector, radius, "Radius", 0, 0),
+        PTX_FIELD(SphereCollisionAffector, bounce, "Bounce", 0, 1),
+        PTX_FIELD(SphereCollisionAffector, friction, "Friction", 0, 1),
+        PTX_FIELD(SphereCollisionAffector, contain, "Contain", 0, 1)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(SphereCollisionAffector)
+        PTX_METHOD_AUTO(SphereCollisionAffector, GetCenter, "Get center"),
+        PTX_METHOD_AUTO(SphereCollisionAffector, SetCenter, "Set center"),
+        PTX_METHOD_AUTO(SphereCollisionAffector, GetRadius, "Get radius"),
+        PTX_METHOD_AUTO(SphereCollisionAffector, SetRadius, "Set radius"),
+        PTX_METHOD_AUTO(SphereCollisionAffector, SetBounce, "Set bounce"),
+        PTX_METHOD_AUTO(SphereCollisionAffector, SetFriction, "Set friction"),
+        PTX_METHOD_AUTO(SphereCollisionAffector, IsContaining, "Is containing"),
+        PTX_METHOD_AUTO(SphereCollisionAffector, SetContaining, "Set containing")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(SphereCollisionAffector)
+        PTX_CTOR0(SphereCollisionAffector),
+        PTX_CTOR(SphereCollisionAffector, Vector3D, float, float, float, bool)
+    PTX_END_DESCRIBE(SphereCollisionAffector)
+};
+
+} // namespace ptx
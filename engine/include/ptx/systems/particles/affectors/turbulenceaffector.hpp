@@ -0,0 +1,102 @@
+/**
+ * @file turbulenceaffector.hpp
+ * @brief Time-varying SimplexNoise acceleration field.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../particleaffector.hpp"
+#include "../../../core/signal/noise/simplexnoise.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class TurbulenceAffector
+ * @brief Pushes particles along a 3D noise field that scrolls over time.
+ *
+ * Each axis samples the shared noise at a fixed offset so the three components
+ * are decorrelated. The noise source is not owned and is only read, so one
+ * SimplexNoise may back several affectors.
+ */
+class TurbulenceAffector : public ParticleAffector {
+private:
+    const SimplexNoise* noise;   ///< Noise source (not owned)
+    float strength;              ///< Peak acceleration (units/s^2)
+    float frequency;             ///< Spatial frequency (1/units)
+    float speed;                 ///< Field scroll rate (noise units/s)
+    float time;                  ///< Accumulated scroll
+
+public:
+    /**
+     * @brief Constructor.
+     * @param noise Noise source (not owned, may be null to disable).
+     * @param strength Peak acceleration (units/s^2).
+     * @param frequency Spatial frequency (1/units).
+     * @param speed Field scroll rate (noise units/s).
+     */
+    TurbulenceAffector(const SimplexNoise* noise, float strength = 1.0f, float frequency = 0.1f, float speed = 0.5f);
+
+    /**
+     * @brief Sets the noise source (not owned).
+     */
+    void SetNoise(const SimplexNoise* source) { noise = source; }
+
+    /**
+     * @brief Gets the peak acceleration.
+     */
+    float GetStrength() const { return strength; }
+
+    /**
+     * @brief Sets the peak acceleration.
+     */
+    void SetStrength(float value) { strength = value; }
+
+    /**
+     * @brief Gets the spatial frequency.
+     */
+    float GetFrequency() const { return frequency; }
+
+    /**
+     * @brief Sets the spatial frequency.
+     */
+    void SetFrequency(float value) { frequency = value; }
+
+    /**
+     * @brief Sets the field scroll rate.
+     */
+    void SetSpeed(float value) { speed = value; }
+
+    /**
+     * @brief Advances the field scroll.
+     */
+    void Prepare(float deltaTime) override;
+
+    /**
+     * @brief Adds the sampled noise acceleration to every velocity.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(TurbulenceAffector)
+        PTX_FIELD(TurbulenceAffector, strength, "Strength", 0, 0),
+        PTX_FIELD(TurbulenceAffector, frequency, "Frequency", 0, 0),
+        PTX_FIELD(TurbulenceAffector, speed, "Speed", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(TurbulenceAffector)
+        PTX_METHOD_AUTO(TurbulenceAffector, GetStrength, "Get strength"),
+        PTX_METHOD_AUTO(TurbulenceAffector, SetStrength, "Set strength"),
+        PTX_METHOD_AUTO(TurbulenceAffector, GetFrequency, "Get frequency"),
+        PTX_METHOD_AUTO(TurbulenceAffector, SetFrequency, "Set frequency"),
+        PTX_METHOD_AUTO(TurbulenceAffector, SetSpeed, "Set speed")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(TurbulenceAffector)
+        PTX_CTOR(TurbulenceAffector, const SimplexNoise*, float, float, float)
+    PTX_END_DESCRIBE(TurbulenceAffector)
+};
+
+} // namespace ptx
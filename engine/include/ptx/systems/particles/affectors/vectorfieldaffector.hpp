@@ -0,0 +1,71 @@
+/**
+ * @file vectorfieldaffector.hpp
+ * @brief Drives particles with a VectorField2D velocity field.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../particleaffector.hpp"
+#include "../../physics/vectorfield2d.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class VectorFieldAffector
+ * @brief Pulls particle XY velocity toward the field velocity at each particle.
+ *
+ * Particles outside the field are untouched. The field is only read, so it must
+ * not be stepped while the emitter updates.
+ */
+class VectorFieldAffector : public ParticleAffector {
+private:
+    const VectorField2D* field;   ///< Velocity source (not owned)
+    float strength;               ///< Fraction of the velocity difference removed per second
+
+public:
+    /**
+     * @brief Constructor.
+     * @param field Velocity source (not owned, may be null to disable).
+     * @param strength Fraction of the velocity difference removed per second.
+     */
+    explicit VectorFieldAffector(const VectorField2D* field, float strength = 1.0f);
+
+    /**
+     * @brief Sets the velocity source (not owned).
+     */
+    void SetField(const VectorField2D* source) { field = source; }
+
+    /**
+     * @brief Gets the coupling strength.
+     */
+    float GetStrength() const { return strength; }
+
+    /**
+     * @brief Sets the coupling strength.
+     */
+    void SetStrength(float value) { strength = value; }
+
+    /**
+     * @brief Blends every in-field velocity toward the sampled field velocity.
+     */
+    void Apply(const ParticleSpan& span, float deltaTime) override;
+
+    PTX_BEGIN_FIELDS(VectorFieldAffector)
+        PTX_FIELD(VectorFieldAffector, strength, "Strength", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(VectorFieldAffector)
+        PTX_METHOD_AUTO(VectorFieldAffector, GetStrength, "Get strength"),
+        PTX_METHOD_AUTO(VectorFieldAffector, SetStrength, "Set strength")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(VectorFieldAffector)
+        PTX_CTOR(VectorFieldAffector, const VectorField2D*, float)
+    PTX_END_DESCRIBE(VectorFieldAffector)
+};
+
+} // namespace ptx
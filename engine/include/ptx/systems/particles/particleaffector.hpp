@@ -0,0 +1,74 @@
+/**
+ * @file particleaffector.hpp
+ * @brief Base class for batch kernels that modify particles between emission and integration.
+ *
+ * Affectors operate on a ParticleSpan (raw SoA arrays) instead of one Particle at
+ * a time, so each kernel is a tight unit-stride loop with no per-particle virtual
+ * call or std::function dispatch. Typical call order per update:
+ * @ref Prepare once, then @ref Apply on one or more disjoint slices of the pool.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "particlepool.hpp"
+
+namespace ptx {
+
+/**
+ * @enum ParticleAffectorStage
+ * @brief When an affector runs relative to integration.
+ */
+enum class ParticleAffectorStage {
+    Forces,       ///< Before integration; modifies velocity
+    Constraints   ///< After integration; corrects position and velocity (collisions)
+};
+
+/**
+ * @class ParticleAffector
+ * @brief Abstract batch kernel over a span of alive particles.
+ *
+ * Apply() may be called on several disjoint slices of the same pool, possibly
+ * concurrently, so implementations must not write shared state there; anything
+ * that changes once per update (time, cached transforms) belongs in Prepare().
+ */
+class ParticleAffector {
+public:
+    /** @brief Virtual destructor. */
+    virtual ~ParticleAffector() = default;
+
+    /**
+     * @brief Gets the stage the affector runs in.
+     */
+    virtual ParticleAffectorStage GetStage() const { return ParticleAffectorStage::Forces; }
+
+    /**
+     * @brief Called once per update before any Apply().
+     * @param deltaTime Time step (seconds).
+     */
+    virtual void Prepare(float deltaTime) { (void)deltaTime; }
+
+    /**
+     * @brief Applies the affector to a range of particles.
+     * @param span Particles to modify.
+     * @param deltaTime Time step (seconds).
+     */
+    virtual void Apply(const ParticleSpan& span, float deltaTime) = 0;
+
+    /**
+     * @brief Checks if the affector runs.
+     */
+    bool IsEnabled() const { return enabled; }
+
+    /**
+     * @brief Enables or disables the affector.
+     */
+    void SetEnabled(bool value) { enabled = value; }
+
+protected:
+    bool enabled = true;   ///< Skipped by the emitter when false
+};
+
+} // namespace ptx
@@ -10,8 +10,13 @@
 
 #include <vector>
 #include <functional>
+#include <memory>
 #include "particle.hpp"
+#include "particlepool.hpp"
+#include "particleaffector.hpp"
+#include "affectors/callbackaffector.hpp"
 #include "../../core/math/transform.hpp"
+#include "../../core/platform/randomstream.hpp"
 #include "../../registry/reflect_macros.hpp"
 
 namespace ptx {
@@ -109,26 +114,62 @@ struct ParticleEmitterConfig {
 /**
  * @typedef ParticleUpdateCallback
  * @brief Custom particle update function.
+ *
+ * Called once per particle with a copied Particle; prefer a ParticleAffector or
+ * ParticleBatchCallback, which run on the pool arrays directly.
  */
 using ParticleUpdateCallback = std::function<void(Particle&, float)>;
 
 /**
  * @class ParticleEmitter
  * @brief Emits and manages a pool of particles.
+ *
+ * Particles live in a ParticlePool, so emission and death are O(1) and the
+ * per-frame update only touches alive particles. Size, color and alpha
+ * endpoints come from the current configuration.
+ *
+ * An update runs in three phases: BeginUpdate() advances timers and claims
+ * slots for new particles, UpdateChunk() initializes, ages, applies affectors to
+ * and integrates one fixed-size range of particles, and EndUpdate() retires
+ * expired particles and runs the legacy per-particle callbacks. Chunks touch
+ * disjoint particles and each draws from its own RandomStream (derived from the
+ * seed, the update number and the chunk index), so they may run concurrently
+ * and the result depends only on the seed and chunk size.
+ *
+ * Within a chunk: initialize new particles, age, Forces affectors, integrate,
+ * Constraints affectors.
  */
 class ParticleEmitter {
 private:
     Transform transform;                      ///< Emitter transform
     ParticleEmitterConfig config;             ///< Emitter configuration
-    std::vector<Particle> particles;          ///< Particle pool
+    ParticlePool pool;                        ///< Particle pool
 
     float emissionTimer;                      ///< Time since last emission
     float durationTimer;                      ///< Time since emission started
     bool isPlaying;                           ///< Is emitter playing?
 
+    std::vector<std::shared_ptr<ParticleAffector>> affectors;  ///< Batch kernels, in insertion order
     std::vector<ParticleUpdateCallback> updateCallbacks;  ///< Custom update functions
 
+    RandomStream random;                      ///< Stream for immediate Emit()/EmitBurst()
+    uint64_t seed;                            ///< Base seed for chunk streams
+    uint64_t updateCount;                     ///< Updates begun, mixed into chunk streams
+    size_t chunkSize;                         ///< Particles per update chunk
+
+    // === In-flight update (BeginUpdate .. EndUpdate) ===
+    bool updating;                            ///< Between BeginUpdate and EndUpdate
+    float updateDelta;                        ///< Time step of the current update
+    size_t spawnBegin;                        ///< First slot claimed this update
+    size_t spawnEnd;                          ///< One past the last slot claimed this update
+    size_t chunkCount;                        ///< Chunks in the current update
+    size_t lastRetired;                       ///< Particles retired by the last update
+    ParticleGradient gradient;                ///< Gradient snapshot for the current update
+    std::vector<std::vector<uint32_t>> expired;  ///< Expired particle indices per chunk
+
 public:
+    static constexpr size_t kDefaultChunkSize = 4096;   ///< Particles per update chunk by default
+
     /**
      * @brief Constructor.
      */
@@ -169,11 +210,61 @@ public:
     // === Update ===
 
     /**
-     * @brief Updates all particles.
+     * @brief Updates all particles (BeginUpdate, every chunk, EndUpdate).
      * @param deltaTime Time since last update (seconds).
      */
     void Update(float deltaTime);
 
+    /**
+     * @brief Starts an update: advances emission and claims slots for new particles.
+     * @param deltaTime Time since last update (seconds).
+     * @return Number of chunks to pass to UpdateChunk().
+     */
+    size_t BeginUpdate(float deltaTime);
+
+    /**
+     * @brief Updates one chunk of particles; distinct chunks may run concurrently.
+     * @param chunk Chunk index in [0, BeginUpdate()).
+     */
+    void UpdateChunk(size_t chunk);
+
+    /**
+     * @brief Finishes an update: retires expired particles and runs legacy callbacks.
+     */
+    void EndUpdate();
+
+    // === Determinism ===
+
+    /**
+     * @brief Sets the seed for particle initialization (restarts all streams).
+     */
+    void SetSeed(uint64_t value);
+
+    /**
+     * @brief Gets the seed for particle initialization.
+     */
+    uint64_t GetSeed() const { return seed; }
+
+    /**
+     * @brief Sets the number of particles per update chunk (at least 1).
+     */
+    void SetChunkSize(size_t size) { chunkSize = size > 0 ? size : 1; }
+
+    /**
+     * @brief Gets the number of particles per update chunk.
+     */
+    size_t GetChunkSize() const { return chunkSize; }
+
+    /**
+     * @brief Gets the number of particles spawned by the last update.
+     */
+    size_t GetLastSpawnedCount() const { return spawnEnd - spawnBegin; }
+
+    /**
+     * @brief Gets the number of particles retired by the last update.
+     */
+    size_t GetLastRetiredCount() const { return lastRetired; }
+
     // === Configuration ===
 
     /**
@@ -199,24 +290,70 @@ public:
     // === Particle Access ===
 
     /**
-     * @brief Gets all particles.
+     * @brief Gets the particle pool.
      */
-    const std::vector<Particle>& GetParticles() const { return particles; }
+    ParticlePool& GetPool() { return pool; }
+
+    /**
+     * @brief Gets the particle pool (const).
+     */
+    const ParticlePool& GetPool() const { return pool; }
+
+    /**
+     * @brief Gets a copy of an alive particle.
+     * @param index Index in [0, GetActiveParticleCount()).
+     */
+    Particle GetParticle(size_t index) const;
 
     /**
      * @brief Gets the number of active particles.
      */
-    int GetActiveParticleCount() const;
+    int GetActiveParticleCount() const { return static_cast<int>(pool.GetAliveCount()); }
 
     /**
      * @brief Clears all particles.
      */
     void Clear();
 
+    // === Affectors ===
+
+    /**
+     * @brief Adds a batch affector; affectors in the same stage run in insertion order.
+     */
+    void AddAffector(std::shared_ptr<ParticleAffector> affector);
+
+    /**
+     * @brief Removes an affector.
+     * @return True if it was found.
+     */
+    bool RemoveAffector(const std::shared_ptr<ParticleAffector>& affector);
+
+    /**
+     * @brief Removes every affector.
+     */
+    void ClearAffectors();
+
+    /**
+     * @brief Gets the affectors in insertion order.
+     */
+    const std::vector<std::shared_ptr<ParticleAffector>>& GetAffectors() const { return affectors; }
+
+    /**
+     * @brief Adds a span-based callback as a CallbackAffector.
+     * @param callback Kernel called on the alive particles.
+     * @param stage When the kernel runs.
+     * @return The created affector (for RemoveAffector()).
+     */
+    std::shared_ptr<ParticleAffector> AddBatchCallback(ParticleBatchCallback callback,
+                                                       ParticleAffectorStage stage = ParticleAffectorStage::Forces);
+
     // === Custom Updates ===
 
     /**
      * @brief Adds a custom particle update callback.
+     *
+     * Each particle is copied out, passed to every callback and written back; use
+     * AddBatchCallback() for large pools.
      */
     void AddUpdateCallback(ParticleUpdateCallback callback);
 
@@ -242,22 +379,32 @@ private:
     /**
      * @brief Initializes a particle with random values based on config.
      */
-    void InitializeParticle(Particle& particle);
+    void InitializeParticle(size_t index, RandomStream& stream);
 
     /**
-     * @brief Gets a random value between min and max.
+     * @brief Gets the lifetime interpolation endpoints from config.
      */
-    float RandomRange(float min, float max);
+    ParticleGradient GetGradient() const;
 
     /**
-     * @brief Gets a random vector between min and max.
+     * @brief Applies every enabled affector in a stage to a span.
      */
-    Vector3D RandomRange(const Vector3D& min, const Vector3D& max);
+    void RunAffectors(ParticleAffectorStage stage, const ParticleSpan& span, float deltaTime);
 
     /**
-     * @brief Finds an inactive particle slot.
+     * @brief Runs the per-particle update callbacks.
+     */
+    void RunUpdateCallbacks(float deltaTime);
+
+    /**
+     * @brief Gets a random value between min and max.
+     */
+    static float RandomRange(RandomStream& stream, float min, float max);
+
+    /**
+     * @brief Gets a random vector between min and max.
      */
-    Particle* GetInactiveParticle();
+    static Vector3D RandomRange(RandomStream& stream, const Vector3D& min, const Vector3D& max);
 
     PTX_BEGIN_FIELDS(ParticleEmitter)
         PTX_FIELD(ParticleEmitter, transform, "Transform", 0, 0),
@@ -271,10 +418,14 @@ private:
         PTX_METHOD_AUTO(ParticleEmitter, Pause, "Pause"),
         PTX_METHOD_AUTO(ParticleEmitter, IsPlaying, "Is playing"),
         PTX_METHOD_AUTO(ParticleEmitter, Update, "Update"),
+        PTX_METHOD_AUTO(ParticleEmitter, SetSeed, "Set seed"),
+        PTX_METHOD_AUTO(ParticleEmitter, GetSeed, "Get seed"),
+        PTX_METHOD_AUTO(ParticleEmitter, SetChunkSize, "Set chunk size"),
         PTX_METHOD_AUTO(ParticleEmitter, GetConfig, "Get config"),
         PTX_METHOD_AUTO(ParticleEmitter, SetConfig, "Set config"),
         PTX_METHOD_AUTO(ParticleEmitter, GetActiveParticleCount, "Get active particle count"),
         PTX_METHOD_AUTO(ParticleEmitter, Clear, "Clear"),
+        PTX_METHOD_AUTO(ParticleEmitter, ClearAffectors, "Clear affectors"),
         PTX_METHOD_AUTO(ParticleEmitter, Emit, "Emit"),
         PTX_METHOD_AUTO(ParticleEmitter, EmitBurst, "Emit burst")
     PTX_END_METHODS
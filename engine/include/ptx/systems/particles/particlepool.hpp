@@ -0,0 +1,286 @@
+/**
+ * @file particlepool.hpp
+ * @brief Structure-of-arrays particle storage with O(1) spawn and kill.
+ *
+ * Each particle attribute lives in its own contiguous float array, and alive
+ * particles are always packed into [0, GetAliveCount()). Spawning appends at the
+ * end of the alive range and killing swaps the last alive particle into the hole,
+ * so neither operation searches the pool and per-frame loops never visit dead slots.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "../../core/math/vector3d.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @struct ParticleSpan
+ * @brief Raw view of a contiguous range of alive particles.
+ *
+ * All pointers index the same range [0, count). Valid until the pool is
+ * resized, spawned into or killed from.
+ */
+struct ParticleSpan {
+    size_t count = 0;                   ///< Number of particles in the span
+    float* positionX = nullptr;         ///< Position X
+    float* positionY = nullptr;         ///< Position Y
+    float* positionZ = nullptr;         ///< Position Z
+    float* velocityX = nullptr;         ///< Velocity X
+    float* velocityY = nullptr;         ///< Velocity Y
+    float* velocityZ = nullptr;         ///< Velocity Z
+    float* age = nullptr;               ///< Age (seconds)
+    float* inverseLifetime = nullptr;   ///< 1 / lifetime (seconds^-1)
+    float* size = nullptr;              ///< Current size
+    float* colorR = nullptr;            ///< Current red (0-1)
+    float* colorG = nullptr;            ///< Current green (0-1)
+    float* colorB = nullptr;            ///< Current blue (0-1)
+    float* alpha = nullptr;             ///< Current alpha (0-1)
+    float* rotation = nullptr;          ///< Rotation (radians)
+    float* rotationSpeed = nullptr;     ///< Rotation speed (radians/second)
+
+    /**
+     * @brief Returns the sub-range [begin, end) of this span.
+     */
+    ParticleSpan Slice(size_t begin, size_t end) const;
+};
+
+/**
+ * @struct ParticleGradient
+ * @brief Start and end values interpolated over each particle's lifetime.
+ */
+struct ParticleGradient {
+    float sizeStart = 1.0f;                 ///< Size at birth
+    float sizeEnd = 1.0f;                   ///< Size at death
+    Vector3D colorStart = Vector3D(1, 1, 1); ///< Color at birth
+    Vector3D colorEnd = Vector3D(1, 1, 1);   ///< Color at death
+    float alphaStart = 1.0f;                ///< Alpha at birth
+    float alphaEnd = 1.0f;                  ///< Alpha at death
+};
+
+/**
+ * @class ParticlePool
+ * @brief Fixed-capacity SoA particle storage with packed alive particles.
+ *
+ * Storage is allocated once per capacity change; spawning and killing never
+ * allocate. Particle indices are not stable across kills.
+ */
+class ParticlePool {
+public:
+    static constexpr size_t kInvalidIndex = static_cast<size_t>(-1);  ///< Returned when the pool is full
+
+    /**
+     * @brief Constructor.
+     * @param capacity Maximum number of particles.
+     */
+    explicit ParticlePool(size_t capacity = 0);
+
+    // === Capacity ===
+
+    /**
+     * @brief Changes the capacity; particles beyond the new capacity are dropped.
+     */
+    void SetCapacity(size_t capacity);
+
+    /**
+     * @brief Gets the maximum number of particles.
+     */
+    size_t GetCapacity() const { return capacity; }
+
+    /**
+     * @brief Gets the number of alive particles.
+     */
+    size_t GetAliveCount() const { return aliveCount; }
+
+    /**
+     * @brief Checks if no more particles can be spawned.
+     */
+    bool IsFull() const { return aliveCount >= capacity; }
+
+    // === Lifecycle ===
+
+    /**
+     * @brief Claims the next free slot and resets it to defaults.
+     * @return Index of the new particle, or kInvalidIndex if the pool is full.
+     */
+    size_t Spawn();
+
+    /**
+     * @brief Kills a particle by moving the last alive particle into its slot.
+     * @param index Alive particle index.
+     */
+    void Kill(size_t index);
+
+    /**
+     * @brief Kills every particle.
+     */
+    void Clear() { aliveCount = 0; }
+
+    // === Simulation ===
+
+    /**
+     * @brief Ages particles and removes the ones whose lifetime has elapsed.
+     * @param deltaTime Time step (seconds).
+     * @return Number of particles removed.
+     */
+    size_t Age(float deltaTime);
+
+    /**
+     * @brief Integrates velocity, position and rotation, and interpolates size, color and alpha.
+     * @param deltaTime Time step (seconds).
+     * @param acceleration Acceleration applied to every particle.
+     * @param gradient Lifetime interpolation endpoints.
+     */
+    void Integrate(float deltaTime, const Vector3D& acceleration, const ParticleGradient& gradient);
+
+    /**
+     * @brief Integrates a range of particles.
+     * @param span Particles to integrate (usually a slice of GetSpan()).
+     * @param deltaTime Time step (seconds).
+     * @param acceleration Acceleration applied to every particle.
+     * @param gradient Lifetime interpolation endpoints.
+     */
+    static void Integrate(const ParticleSpan& span, float deltaTime, const Vector3D& acceleration,
+                          const ParticleGradient& gradient);
+
+    // === Access ===
+
+    /**
+     * @brief Gets a view of all alive particles.
+     */
+    ParticleSpan GetSpan();
+
+    /**
+     * @brief Gets a particle position.
+     */
+    Vector3D GetPosition(size_t index) const { return Vector3D(positionX[index], positionY[index], positionZ[index]); }
+
+    /**
+     * @brief Sets a particle position.
+     */
+    void SetPosition(size_t index, const Vector3D& position);
+
+    /**
+     * @brief Gets a particle velocity.
+     */
+    Vector3D GetVelocity(size_t index) const { return Vector3D(velocityX[index], velocityY[index], velocityZ[index]); }
+
+    /**
+     * @brief Sets a particle velocity.
+     */
+    void SetVelocity(size_t index, const Vector3D& velocity);
+
+    /**
+     * @brief Gets a particle color.
+     */
+    Vector3D GetColor(size_t index) const { return Vector3D(colorR[index], colorG[index], colorB[index]); }
+
+    /**
+     * @brief Sets a particle color.
+     */
+    void SetColor(size_t index, const Vector3D& color);
+
+    /**
+     * @brief Gets a particle age (seconds).
+     */
+    float GetAge(size_t index) const { return age[index]; }
+
+    /**
+     * @brief Sets a particle age (seconds).
+     */
+    void SetAge(size_t index, float value) { age[index] = value; }
+
+    /**
+     * @brief Gets a particle lifetime (seconds).
+     */
+    float GetLifetime(size_t index) const { return 1.0f / inverseLifetime[index]; }
+
+    /**
+     * @brief Sets a particle lifetime (seconds, clamped above zero).
+     */
+    void SetLifetime(size_t index, float lifetime);
+
+    /**
+     * @brief Gets a particle size.
+     */
+    float GetSize(size_t index) const { return size[index]; }
+
+    /**
+     * @brief Sets a particle size.
+     */
+    void SetSize(size_t index, float value) { size[index] = value; }
+
+    /**
+     * @brief Gets a particle alpha.
+     */
+    float GetAlpha(size_t index) const { return alpha[index]; }
+
+    /**
+     * @brief Sets a particle alpha.
+     */
+    void SetAlpha(size_t index, float value) { alpha[index] = value; }
+
+    /**
+     * @brief Gets a particle rotation (radians).
+     */
+    float GetRotation(size_t index) const { return rotation[index]; }
+
+    /**
+     * @brief Sets a particle rotation (radians).
+     */
+    void SetRotation(size_t index, float value) { rotation[index] = value; }
+
+    /**
+     * @brief Gets a particle rotation speed (radians/second).
+     */
+    float GetRotationSpeed(size_t index) const { return rotationSpeed[index]; }
+
+    /**
+     * @brief Sets a particle rotation speed (radians/second).
+     */
+    void SetRotationSpeed(size_t index, float value) { rotationSpeed[index] = value; }
+
+private:
+    size_t capacity;
+    size_t aliveCount;
+
+    std::vector<float> positionX, positionY, positionZ;
+    std::vector<float> velocityX, velocityY, velocityZ;
+    std::vector<float> age;
+    std::vector<float> inverseLifetime;
+    std::vector<float> size;
+    std::vector<float> colorR, colorG, colorB;
+    std::vector<float> alpha;
+    std::vector<float> rotation;
+    std::vector<float> rotationSpeed;
+
+    void Move(size_t from, size_t to);
+
+    PTX_BEGIN_FIELDS(ParticlePool)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(ParticlePool)
+        PTX_METHOD_AUTO(ParticlePool, SetCapacity, "Set capacity"),
+        PTX_METHOD_AUTO(ParticlePool, GetCapacity, "Get capacity"),
+        PTX_METHOD_AUTO(ParticlePool, GetAliveCount, "Get alive count"),
+        PTX_METHOD_AUTO(ParticlePool, IsFull, "Is full"),
+        PTX_METHOD_AUTO(ParticlePool, Spawn, "Spawn"),
+        PTX_METHOD_AUTO(ParticlePool, Kill, "Kill"),
+        PTX_METHOD_AUTO(ParticlePool, Clear, "Clear"),
+        PTX_METHOD_AUTO(ParticlePool, Age, "Age")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(ParticlePool)
+        PTX_CTOR0(ParticlePool),
+        PTX_CTOR(ParticlePool, size_t)
+    PTX_END_DESCRIBE(ParticlePool)
+};
+
+} // namespace ptx
@@ -18,11 +18,30 @@ namespace ptx {
 /**
  * @class ParticleSystem
  * @brief Manages multiple particle emitters.
+ *
+ * In parallel mode every emitter is split into chunks of GetChunkSize()
+ * particles and all chunks of all emitters are spread over the shared
+ * ThreadPool. Serial and parallel updates run the same per-chunk code with the
+ * same per-chunk random streams, so they produce identical particles for a
+ * given seed.
  */
 class ParticleSystem {
 private:
     std::vector<std::shared_ptr<ParticleEmitter>> emitters;
 
+    bool parallel;                  ///< Spread chunks over the ThreadPool
+    size_t chunkSize;               ///< Particles per chunk for every emitter
+    uint64_t seed;                  ///< Base seed; emitter seeds derive from it
+    uint64_t emitterSerial;         ///< Emitters created so far (seed stream ids)
+
+    struct ChunkTask {
+        ParticleEmitter* emitter;
+        size_t chunk;
+    };
+    std::vector<ChunkTask> chunkTasks;   ///< Scratch reused across updates
+
+    void AddEmitter(const std::shared_ptr<ParticleEmitter>& emitter);
+
 public:
     /**
      * @brief Constructor.
@@ -78,20 +97,60 @@ public:
      */
     void Update(float deltaTime);
 
+    // === Parallelism ===
+
+    /**
+     * @brief Enables or disables spreading chunks over the shared ThreadPool.
+     */
+    void SetParallel(bool enabled) { parallel = enabled; }
+
+    /**
+     * @brief Checks if updates run in parallel.
+     */
+    bool IsParallel() const { return parallel; }
+
+    /**
+     * @brief Sets the particles per chunk for every emitter (at least 1).
+     */
+    void SetChunkSize(size_t size);
+
+    /**
+     * @brief Gets the particles per chunk.
+     */
+    size_t GetChunkSize() const { return chunkSize; }
+
+    /**
+     * @brief Reseeds every emitter; emitter i gets a seed derived from (seed, i).
+     */
+    void SetSeed(uint64_t value);
+
+    /**
+     * @brief Gets the base seed.
+     */
+    uint64_t GetSeed() const { return seed; }
+
     // === Statistics ===
 
     /**
      * @brief Gets the total number of active particles across all emitters.
+     *
+     * Summed from each emitter's pool on every call, so emitters driven directly
+     * (Emit, EmitBurst, Clear, Update) are always reflected.
      */
     int GetTotalActiveParticles() const;
 
     PTX_BEGIN_FIELDS(ParticleSystem)
+        PTX_FIELD(ParticleSystem, parallel, "Parallel", 0, 1)
     PTX_END_FIELDS
 
     PTX_BEGIN_METHODS(ParticleSystem)
         PTX_METHOD_AUTO(ParticleSystem, ClearEmitters, "Clear emitters"),
         PTX_METHOD_AUTO(ParticleSystem, GetEmitterCount, "Get emitter count"),
         PTX_METHOD_AUTO(ParticleSystem, Update, "Update"),
+        PTX_METHOD_AUTO(ParticleSystem, SetParallel, "Set parallel"),
+        PTX_METHOD_AUTO(ParticleSystem, IsParallel, "Is parallel"),
+        PTX_METHOD_AUTO(ParticleSystem, SetChunkSize, "Set chunk size"),
+        PTX_METHOD_AUTO(ParticleSystem, SetSeed, "Set seed"),
         PTX_METHOD_AUTO(ParticleSystem, GetTotalActiveParticles, "Get total active particles")
     PTX_END_METHODS
 
@@ -0,0 +1,184 @@
+/**
+ * @file aabb.hpp
+ * @brief Axis-aligned bounding box used by the physics broadphase.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <algorithm>
+#include "../../core/math/vector3d.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @struct AABB
+ * @brief Lightweight min/max box with the overlap and slab tests needed by spatial queries.
+ */
+struct AABB {
+    Vector3D minimum; ///< Minimum corner in world space
+    Vector3D maximum; ///< Maximum corner in world space
+
+    /**
+     * @brief Default constructor (degenerate box at the origin).
+     */
+    AABB() : minimum(0, 0, 0), maximum(0, 0, 0) {}
+
+    /**
+     * @brief Constructor from corners.
+     */
+    AABB(const Vector3D& minimum, const Vector3D& maximum) : minimum(minimum), maximum(maximum) {}
+
+    /**
+     * @brief Builds the bounds of a sphere.
+     */
+    static AABB FromSphere(const Vector3D& center, float radius) {
+        return AABB(Vector3D(center.X - radius, center.Y - radius, center.Z - radius),
+                    Vector3D(center.X + radius, center.Y + radius, center.Z + radius));
+    }
+
+    /**
+     * @brief Smallest box containing both inputs.
+     */
+    static AABB Union(const AABB& a, const AABB& b) {
+        return AABB(Vector3D(std::min(a.minimum.X, b.minimum.X), std::min(a.minimum.Y, b.minimum.Y), std::min(a.minimum.Z, b.minimum.Z)),
+                    Vector3D(std::max(a.maximum.X, b.maximum.X), std::max(a.maximum.Y, b.maximum.Y), std::max(a.maximum.Z, b.maximum.Z)));
+    }
+
+    /**
+     * @brief Gets the box center.
+     */
+    Vector3D GetCenter() const {
+        return Vector3D((minimum.X + maximum.X) * 0.5f, (minimum.Y + maximum.Y) * 0.5f, (minimum.Z + maximum.Z) * 0.5f);
+    }
+
+    /**
+     * @brief Gets the half-size of the box.
+     */
+    Vector3D GetExtents() const {
+        return Vector3D((maximum.X - minimum.X) * 0.5f, (maximum.Y - minimum.Y) * 0.5f, (maximum.Z - minimum.Z) * 0.5f);
+    }
+
+    /**
+     * @brief Surface area, used as the insertion cost metric.
+     */
+    float GetSurfaceArea() const {
+        const float dx = maximum.X - minimum.X;
+        const float dy = maximum.Y - minimum.Y;
+        const float dz = maximum.Z - minimum.Z;
+        return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+
+    /**
+     * @brief Returns a copy grown by @p margin on every side.
+     */
+    AABB Expanded(float margin) const {
+        return AABB(Vector3D(minimum.X - margin, minimum.Y - margin, minimum.Z - margin),
+                    Vector3D(maximum.X + margin, maximum.Y + margin, maximum.Z + margin));
+    }
+
+    /**
+     * @brief Checks if two boxes overlap (touching counts as overlap).
+     */
+    bool Overlaps(const AABB& other) const {
+        return minimum.X <= other.maximum.X && maximum.X >= other.minimum.X &&
+               minimum.Y <= other.maximum.Y && maximum.Y >= other.minimum.Y &&
+               minimum.Z <= other.maximum.Z && maximum.Z >= other.minimum.Z;
+    }
+
+    /**
+     * @brief Checks if @p other lies fully inside this box.
+     */
+    bool Contains(const AABB& other) const {
+        return minimum.X <= other.minimum.X && minimum.Y <= other.minimum.Y && minimum.Z <= other.minimum.Z &&
+               maximum.X >= other.maximum.X && maximum.Y >= other.maximum.Y && maximum.Z >= other.maximum.Z;
+    }
+
+    /**
+     * @brief Checks if a point lies inside the box.
+     */
+    bool ContainsPoint(const Vector3D& point) const {
+        return point.X >= minimum.X && point.X <= maximum.X &&
+               point.Y >= minimum.Y && point.Y <= maximum.Y &&
+               point.Z >= minimum.Z && point.Z <= maximum.Z;
+    }
+
+    /**
+     * @brief Clamps a point onto the box.
+     */
+    Vector3D ClosestPoint(const Vector3D& point) const {
+        return Vector3D(std::clamp(point.X, minimum.X, maximum.X),
+                        std::clamp(point.Y, minimum.Y, maximum.Y),
+                        std::clamp(point.Z, minimum.Z, maximum.Z));
+    }
+
+    /**
+     * @brief Squared distance from a point to the box (zero inside).
+     */
+    float DistanceSquared(const Vector3D& point) const {
+        const Vector3D delta = point - ClosestPoint(point);
+        return delta.DotProduct(delta);
+    }
+
+    /**
+     * @brief Slab test against a ray with precomputed reciprocal direction.
+     * @param origin Ray origin.
+     * @param inverseDirection Component-wise reciprocal of the ray direction (see SafeInverse()).
+     * @param maxDistance Maximum ray parameter.
+     * @param entry Output entry parameter (clamped to zero when the origin is inside).
+     * @return True if the ray enters the box within [0, maxDistance].
+     */
+    bool IntersectsRay(const Vector3D& origin, const Vector3D& inverseDirection,
+                       float maxDistance, float& entry) const {
+        const float tx1 = (minimum.X - origin.X) * inverseDirection.X;
+        const float tx2 = (maximum.X - origin.X) * inverseDirection.X;
+        const float ty1 = (minimum.Y - origin.Y) * inverseDirection.Y;
+        const float ty2 = (maximum.Y - origin.Y) * inverseDirection.Y;
+        const float tz1 = (minimum.Z - origin.Z) * inverseDirection.Z;
+        const float tz2 = (maximum.Z - origin.Z) * inverseDirection.Z;
+
+        const float tmin = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::max(std::min(tz1, tz2), 0.0f));
+        const float tmax = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::min(std::max(tz1, tz2), maxDistance));
+
+        entry = tmin;
+        return tmin <= tmax;
+    }
+
+    /**
+     * @brief Component-wise reciprocal that maps zero to a large finite value.
+     *
+     * Keeping the result finite avoids 0 * inf NaNs in IntersectsRay() for rays
+     * that start exactly on a slab plane.
+     */
+    static Vector3D SafeInverse(const Vector3D& direction) {
+        constexpr float kHuge = 1e30f;
+        auto inv = [](float v) {
+            if (v > 1e-30f || v < -1e-30f) return 1.0f / v;
+            return v < 0.0f ? -kHuge : kHuge;
+        };
+        return Vector3D(inv(direction.X), inv(direction.Y), inv(direction.Z));
+    }
+
+    PTX_BEGIN_FIELDS(AABB)
+        PTX_FIELD(AABB, minimum, "Minimum", 0, 0),
+        PTX_FIELD(AABB, maximum, "Maximum", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(AABB)
+        PTX_METHOD_AUTO(AABB, GetCenter, "Get center"),
+        PTX_METHOD_AUTO(AABB, GetExtents, "Get extents"),
+        PTX_METHOD_AUTO(AABB, GetSurfaceArea, "Get surface area"),
+        PTX_METHOD_AUTO(AABB, Overlaps, "Overlaps"),
+        PTX_METHOD_AUTO(AABB, ContainsPoint, "Contains point")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(AABB)
+        PTX_CTOR0(AABB),
+        PTX_CTOR(AABB, Vector3D, Vector3D)
+    PTX_END_DESCRIBE(AABB)
+};
+
+} // namespace ptx
@@ -2,8 +2,10 @@
  * @file BoundaryMotionSimulator.h
  * @brief Defines the BoundaryMotionSimulator class for simulating motion and collisions of boundary objects.
  *
- * The BoundaryMotionSimulator class manages the simulation of motion, collisions, and interactions
- * between a boundary cube and multiple boundary spheres in 3D space. Includes randomized velocity and acceleration.
+ * The BoundaryMotionSimulator class manages the simulation of bouncing spheres inside a boundary
+ * cube. Sphere state is kept in contiguous arrays, neighbor collisions are found through a uniform
+ * spatial-hash grid, and integration runs on a fixed timestep with adaptive substeps so fast
+ * spheres do not tunnel through each other or the boundary.
  *
  * @date 22/12/2024
  * @version 1.0
@@ -12,39 +14,91 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "../../core/math/rotation.hpp"
 #include "../../core/math/vector3d.hpp"
-#include "../../core/math/rotation.hpp"
 #include "../scene/mesh.hpp"
 #include "../../core/geometry/3d/cube.hpp"
-#include "../../core/geometry/3d/sphere.hpp"
 #include "../../core/platform/random.hpp"
 #include "../../registry/reflect_macros.hpp"
 
 /**
  * @class BoundaryMotionSimulator
- * @brief Simulates motion and collision interactions between a BoundaryCube and multiple BoundarySpheres.
+ * @brief Simulates motion and collision interactions between a boundary cube and multiple spheres.
  */
 class BoundaryMotionSimulator {
 private:
-    Cube* bC; ///< Pointer to the boundary cube.
-    std::vector<Sphere*> spheres; ///< Collection of boundary spheres (non-owning pointers).
-    int sphereCount; ///< Number of boundary spheres.
+    Cube* bC; ///< Pointer to the boundary cube (optional, not owned).
     float elasticity = 0.8f; ///< Elasticity coefficient for collisions.
+    float damping = 0.999f; ///< Velocity retained per fixed step.
+    float maxSpeed = 2500.0f; ///< Per-axis velocity clamp (mm/s).
+    float fixedTimeStep = 1.0f / 120.0f; ///< Simulation step (s).
+    int maxSteps = 8; ///< Fixed steps allowed per Update before time is dropped.
+    int maxSubsteps = 16; ///< Substeps allowed per fixed step.
+    float accumulator = 0.0f; ///< Unsimulated time carried between updates.
+    Quaternion previousRotation; ///< Rotation from the previous update.
+
+    // Sphere state (contiguous, indexed by sphere)
+    std::vector<Vector3D> positions; ///< Sphere centers.
+    std::vector<Vector3D> velocities; ///< Sphere velocities.
+    std::vector<Vector3D> accelerationScales; ///< Per-sphere acceleration ratio, drawn once at creation.
+    std::vector<float> radii; ///< Sphere radii.
+    std::vector<float> inverseMasses; ///< Inverse masses (proportional to 1 / r^3).
+    std::vector<Mesh*> meshes; ///< Meshes driven by each sphere (optional, not owned).
+    float maxRadius = 0.0f; ///< Largest radius, sets the grid cell size.
+    float minRadius = 0.0f; ///< Smallest radius, bounds the substep length.
+
+    // Uniform grid (rebuilt every substep, storage reused)
+    std::vector<uint32_t> cellKeys; ///< Hashed cell of each sphere.
+    std::vector<uint32_t> cellStarts; ///< Prefix offsets into sortedSpheres per hash bucket.
+    std::vector<uint32_t> sortedSpheres; ///< Sphere indices grouped by bucket.
+    float inverseCellSize = 1.0f; ///< 1 / cell size.
+    uint32_t bucketMask = 0; ///< Bucket count - 1 (power of two).
+    uint32_t pairTests = 0; ///< Narrow-phase tests in the last substep.
+
+    void Step(float dT, const Vector3D& acceleration);
+    void BuildGrid();
+    void CollideSpheres();
+    void CollideBoundary();
+    void ResolvePair(uint32_t a, uint32_t b);
+    uint32_t HashCell(int32_t x, int32_t y, int32_t z) const;
+    void CellOf(const Vector3D& position, int32_t& x, int32_t& y, int32_t& z) const;
 
 public:
     /**
-     * @brief Constructs a BoundaryMotionSimulator.
-     * @param objects Array of Object3D pointers representing the objects.
+     * @brief Constructs a BoundaryMotionSimulator with one sphere per mesh.
+     * @param objects Array of Mesh pointers; each sphere starts at its mesh position and drives it.
+     *        May be null, or contain null entries, for spheres at the origin without a mesh.
      * @param objectCount Number of objects in the simulation.
-     * @param bC Pointer to the boundary cube.
+     * @param bC Pointer to the boundary cube (may be null for an unbounded simulation).
      * @param radius Radius of the boundary spheres.
      * @param elasticity Elasticity coefficient for collisions.
      */
     BoundaryMotionSimulator(Mesh** objects, int objectCount, Cube* bC, float radius, float elasticity);
 
+    /**
+     * @brief Constructs an empty simulator; add spheres with AddSphere().
+     * @param bC Pointer to the boundary cube (may be null).
+     * @param elasticity Elasticity coefficient for collisions.
+     */
+    BoundaryMotionSimulator(Cube* bC, float elasticity);
+
+    /**
+     * @brief Adds a sphere.
+     * @param position Initial center.
+     * @param radius Sphere radius.
+     * @param mesh Mesh whose position follows the sphere (optional).
+     * @return Index of the new sphere.
+     */
+    int AddSphere(const Vector3D& position, float radius, Mesh* mesh = nullptr);
+
+    /**
+     * @brief Removes every sphere.
+     */
+    void Clear();
+
     /**
      * @brief Randomizes the velocities of all boundary spheres within a specified range.
      * @param range Maximum velocity range (mm/s).
@@ -59,25 +113,101 @@ public:
     Vector3D RandomRatio(float range);
 
     /**
-     * @brief Updates the simulation by applying physics and resolving collisions.
+     * @brief Advances the simulation by applying physics and resolving collisions.
+     *
+     * Time is accumulated and simulated in fixed steps; leftover time carries
+     * over to the next call.
+     *
      * @param dT Time step in seconds.
      * @param acceleration Acceleration vector applied to the spheres.
      * @param rotation Rotation quaternion applied to the spheres.
      */
     void Update(float dT, Vector3D acceleration, Quaternion rotation);
 
+    /**
+     * @brief Gets the number of spheres.
+     */
+    int GetSphereCount() const { return static_cast<int>(positions.size()); }
+
+    /**
+     * @brief Gets the contiguous array of sphere centers.
+     */
+    const Vector3D* GetPositions() const { return positions.data(); }
+
+    /**
+     * @brief Gets a sphere center.
+     */
+    Vector3D GetPosition(int index) const { return positions[index]; }
+
+    /**
+     * @brief Sets a sphere center.
+     */
+    void SetPosition(int index, const Vector3D& position) { positions[index] = position; }
+
+    /**
+     * @brief Gets a sphere velocity.
+     */
+    Vector3D GetVelocity(int index) const { return velocities[index]; }
+
+    /**
+     * @brief Sets a sphere velocity.
+     */
+    void SetVelocity(int index, const Vector3D& velocity) { velocities[index] = velocity; }
+
+    /**
+     * @brief Gets a sphere radius.
+     */
+    float GetRadius(int index) const { return radii[index]; }
+
+    /**
+     * @brief Sets the per-sphere acceleration ratio (1 = unscaled).
+     */
+    void SetAccelerationScale(int index, const Vector3D& scale) { accelerationScales[index] = scale; }
+
+    /**
+     * @brief Gets the fixed simulation step in seconds.
+     */
+    float GetFixedTimeStep() const { return fixedTimeStep; }
+
+    /**
+     * @brief Sets the fixed simulation step in seconds.
+     */
+    void SetFixedTimeStep(float step) { fixedTimeStep = step > 0.0f ? step : fixedTimeStep; }
+
+    /**
+     * @brief Sets how many substeps a fixed step may be split into.
+     */
+    void SetMaxSubsteps(int count) { maxSubsteps = count < 1 ? 1 : count; }
+
+    /**
+     * @brief Sets the velocity retained per fixed step (1 = no damping).
+     */
+    void SetDamping(float value) { damping = value; }
+
+    /**
+     * @brief Number of sphere pairs tested in the last substep (grid efficiency metric).
+     */
+    uint32_t GetPairTestCount() const { return pairTests; }
+
     PTX_BEGIN_FIELDS(BoundaryMotionSimulator)
-        /* No reflected fields. */
+        PTX_FIELD(BoundaryMotionSimulator, elasticity, "Elasticity", 0, 1),
+        PTX_FIELD(BoundaryMotionSimulator, damping, "Damping", 0, 1),
+        PTX_FIELD(BoundaryMotionSimulator, fixedTimeStep, "Fixed time step", 0, 0)
     PTX_END_FIELDS
 
     PTX_BEGIN_METHODS(BoundaryMotionSimulator)
         PTX_METHOD_AUTO(BoundaryMotionSimulator, Randomize, "Randomize"),
         PTX_METHOD_AUTO(BoundaryMotionSimulator, RandomRatio, "Random ratio"),
-        PTX_METHOD_AUTO(BoundaryMotionSimulator, Update, "Update")
+        PTX_METHOD_AUTO(BoundaryMotionSimulator, Update, "Update"),
+        PTX_METHOD_AUTO(BoundaryMotionSimulator, Clear, "Clear"),
+        PTX_METHOD_AUTO(BoundaryMotionSimulator, GetSphereCount, "Get sphere count"),
+        PTX_METHOD_AUTO(BoundaryMotionSimulator, GetFixedTimeStep, "Get fixed time step"),
+        PTX_METHOD_AUTO(BoundaryMotionSimulator, SetFixedTimeStep, "Set fixed time step")
     PTX_END_METHODS
 
     PTX_BEGIN_DESCRIBE(BoundaryMotionSimulator)
-        PTX_CTOR(BoundaryMotionSimulator, Mesh **, int, Cube *, float, float)
+        PTX_CTOR(BoundaryMotionSimulator, Mesh **, int, Cube *, float, float),
+        PTX_CTOR(BoundaryMotionSimulator, Cube *, float)
     PTX_END_DESCRIBE(BoundaryMotionSimulator)
 
 };
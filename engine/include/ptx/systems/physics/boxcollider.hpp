@@ -66,6 +66,11 @@ public:
      */
     virtual void SetPosition(const Vector3D& pos) override;
 
+    /**
+     * @brief Gets box bounds.
+     */
+    virtual AABB GetBounds() override;
+
     PTX_BEGIN_FIELDS(BoxCollider)
         // Inherits fields from Collider and Cube
     PTX_END_FIELDS
@@ -0,0 +1,334 @@
+/**
+ * @file broadphasetree.hpp
+ * @brief Dynamic AABB tree used as the physics broadphase.
+ *
+ * Leaves store fattened bounds so small movements do not require a reinsert.
+ * Internal nodes are kept balanced with AVL-style rotations and new leaves are
+ * placed with a surface-area cost heuristic, so queries stay O(log n).
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "aabb.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class BroadPhaseTree
+ * @brief Bounding volume hierarchy over proxies identified by integer handles.
+ *
+ * Traversals are read-only and may run concurrently with each other, but not
+ * with CreateProxy/DestroyProxy/MoveProxy.
+ */
+class BroadPhaseTree {
+public:
+    static constexpr int32_t kNullNode = -1;     ///< Invalid node / proxy handle
+    static constexpr size_t kPacketSize = 64;    ///< Maximum queries per packet traversal
+    static constexpr int kMaxStackDepth = 256;   ///< Traversal stack size (balanced trees stay far below this)
+
+    /**
+     * @brief Constructor.
+     * @param margin Distance leaves are fattened by.
+     */
+    explicit BroadPhaseTree(float margin = 1.0f);
+
+    /**
+     * @brief Inserts a proxy.
+     * @param bounds Tight bounds of the object.
+     * @param userData Opaque pointer returned by GetUserData().
+     * @return Proxy handle.
+     */
+    int32_t CreateProxy(const AABB& bounds, void* userData);
+
+    /**
+     * @brief Removes a proxy.
+     */
+    void DestroyProxy(int32_t proxy);
+
+    /**
+     * @brief Updates a proxy's bounds.
+     * @return True if the proxy left its fat bounds and was reinserted.
+     */
+    bool MoveProxy(int32_t proxy, const AABB& bounds);
+
+    /**
+     * @brief Removes every proxy.
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the user pointer attached to a proxy.
+     */
+    void* GetUserData(int32_t proxy) const { return nodes[proxy].userData; }
+
+    /**
+     * @brief Gets the fattened bounds stored for a proxy.
+     */
+    const AABB& GetFatBounds(int32_t proxy) const { return nodes[proxy].bounds; }
+
+    /**
+     * @brief Number of live proxies.
+     */
+    size_t GetProxyCount() const { return proxyCount; }
+
+    /**
+     * @brief Height of the tree (zero when empty or a single leaf).
+     */
+    int GetHeight() const { return root == kNullNode ? 0 : nodes[root].height; }
+
+    /**
+     * @brief Gets the fat margin.
+     */
+    float GetMargin() const { return margin; }
+
+    /**
+     * @brief Sets the fat margin (applies to proxies created or moved afterwards).
+     */
+    void SetMargin(float value) { margin = value < 0.0f ? 0.0f : value; }
+
+    /**
+     * @brief Visits every proxy whose fat bounds overlap @p bounds.
+     * @param callback bool(int32_t proxy); return false to stop the query.
+     */
+    template <typename Callback>
+    void Query(const AABB& bounds, Callback&& callback) const;
+
+    /**
+     * @brief Visits proxies whose fat bounds intersect a ray, nearest subtrees first.
+     * @param origin Ray origin.
+     * @param direction Ray direction (normalized).
+     * @param maxDistance Maximum ray distance.
+     * @param callback float(int32_t proxy, float currentMax); return the new maximum
+     *        distance to clip the ray, or a negative value to stop.
+     */
+    template <typename Callback>
+    void Raycast(const Vector3D& origin, const Vector3D& direction, float maxDistance, Callback&& callback) const;
+
+    /**
+     * @brief Shared traversal for up to kPacketSize rays.
+     *
+     * Each node's bounds are loaded once and tested against every ray still
+     * active in the packet, so coherent rays share the upper levels of the tree.
+     *
+     * @param origins Ray origins.
+     * @param inverseDirections Reciprocal ray directions (AABB::SafeInverse()).
+     * @param maxDistances Per-ray maximum distance; callbacks may shrink entries to clip.
+     * @param count Number of rays (at most kPacketSize).
+     * @param callback void(int32_t proxy, uint64_t rayMask) for each leaf reached.
+     */
+    template <typename Callback>
+    void RaycastPacket(const Vector3D* origins, const Vector3D* inverseDirections,
+                       const float* maxDistances, size_t count, Callback&& callback) const;
+
+    /**
+     * @brief Shared traversal for up to kPacketSize bounding boxes.
+     * @param bounds Query boxes.
+     * @param count Number of boxes (at most kPacketSize).
+     * @param activeMask Bits of queries to run; callbacks may clear bits to retire queries early.
+     * @param callback void(int32_t proxy, uint64_t queryMask, uint64_t& activeMask).
+     */
+    template <typename Callback>
+    void QueryPacket(const AABB* bounds, size_t count, uint64_t activeMask, Callback&& callback) const;
+
+private:
+    struct Node {
+        AABB bounds;
+        void* userData = nullptr;
+        int32_t parent = kNullNode;   ///< Parent index, or next free node while on the free list
+        int32_t child1 = kNullNode;
+        int32_t child2 = kNullNode;
+        int32_t height = -1;          ///< Leaf = 0, free = -1
+
+        bool IsLeaf() const { return child1 == kNullNode; }
+    };
+
+    std::vector<Node> nodes;
+    int32_t root;
+    int32_t freeList;
+    size_t proxyCount;
+    float margin;
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t node);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t node);
+    void Refit(int32_t node);
+
+    PTX_BEGIN_FIELDS(BroadPhaseTree)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(BroadPhaseTree)
+        PTX_METHOD_AUTO(BroadPhaseTree, DestroyProxy, "Destroy proxy"),
+        PTX_METHOD_AUTO(BroadPhaseTree, Clear, "Clear"),
+        PTX_METHOD_AUTO(BroadPhaseTree, GetProxyCount, "Get proxy count"),
+        PTX_METHOD_AUTO(BroadPhaseTree, GetHeight, "Get height"),
+        PTX_METHOD_AUTO(BroadPhaseTree, GetMargin, "Get margin"),
+        PTX_METHOD_AUTO(BroadPhaseTree, SetMargin, "Set margin")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(BroadPhaseTree)
+        PTX_CTOR(BroadPhaseTree, float)
+    PTX_END_DESCRIBE(BroadPhaseTree)
+};
+
+// === Traversal templates ===
+
+template <typename Callback>
+void BroadPhaseTree::Query(const AABB& bounds, Callback&& callback) const {
+    if (root == kNullNode) return;
+
+    int32_t stack[kMaxStackDepth];
+    int top = 0;
+    stack[top++] = root;
+
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (!node.bounds.Overlaps(bounds)) continue;
+
+        if (node.IsLeaf()) {
+            if (!callback(static_cast<int32_t>(&node - nodes.data()))) return;
+        } else if (top + 2 <= kMaxStackDepth) {
+            stack[top++] = node.child1;
+            stack[top++] = node.child2;
+        }
+    }
+}
+
+template <typename Callback>
+void BroadPhaseTree::Raycast(const Vector3D& origin, const Vector3D& direction,
+                             float maxDistance, Callback&& callback) const {
+    if (root == kNullNode) return;
+
+    const Vector3D inverse = AABB::SafeInverse(direction);
+    float currentMax = maxDistance;
+
+    int32_t stack[kMaxStackDepth];
+    int top = 0;
+    stack[top++] = root;
+
+    while (top > 0) {
+        const int32_t index = stack[--top];
+        const Node& node = nodes[index];
+
+        float entry;
+        if (!node.bounds.IntersectsRay(origin, inverse, currentMax, entry)) continue;
+
+        if (node.IsLeaf()) {
+            const float result = callback(index, currentMax);
+            if (result < 0.0f) return;
+            currentMax = result < currentMax ? result : currentMax;
+            continue;
+        }
+
+        if (top + 2 > kMaxStackDepth) continue;
+
+        // Push the farther child first so the nearer one is visited (and clips) first.
+        float entry1, entry2;
+        const bool hit1 = nodes[node.child1].bounds.IntersectsRay(origin, inverse, currentMax, entry1);
+        const bool hit2 = nodes[node.child2].bounds.IntersectsRay(origin, inverse, currentMax, entry2);
+
+        if (hit1 && hit2) {
+            if (entry1 <= entry2) {
+                stack[top++] = node.child2;
+                stack[top++] = node.child1;
+            } else {
+                stack[top++] = node.child1;
+                stack[top++] = node.child2;
+            }
+        } else if (hit1) {
+            stack[top++] = node.child1;
+        } else if (hit2) {
+            stack[top++] = node.child2;
+        }
+    }
+}
+
+template <typename Callback>
+void BroadPhaseTree::RaycastPacket(const Vector3D* origins, const Vector3D* inverseDirections,
+                                   const float* maxDistances, size_t count, Callback&& callback) const {
+    if (root == kNullNode || count == 0) return;
+    if (count > kPacketSize) count = kPacketSize;
+
+    const uint64_t allRays = count == 64 ? ~0ULL : ((1ULL << count) - 1ULL);
+
+    int32_t stack[kMaxStackDepth];
+    uint64_t masks[kMaxStackDepth];
+    int top = 0;
+    stack[top] = root;
+    masks[top++] = allRays;
+
+    while (top > 0) {
+        --top;
+        const Node& node = nodes[stack[top]];
+        const uint64_t parentMask = masks[top];
+
+        uint64_t mask = 0;
+        for (uint64_t bits = parentMask; bits != 0; bits &= bits - 1) {
+            const int ray = __builtin_ctzll(bits);
+            float entry;
+            if (node.bounds.IntersectsRay(origins[ray], inverseDirections[ray], maxDistances[ray], entry)) {
+                mask |= 1ULL << ray;
+            }
+        }
+
+        if (mask == 0) continue;
+
+        if (node.IsLeaf()) {
+            callback(static_cast<int32_t>(&node - nodes.data()), mask);
+        } else if (top + 2 <= kMaxStackDepth) {
+            stack[top] = node.child2;
+            masks[top++] = mask;
+            stack[top] = node.child1;
+            masks[top++] = mask;
+        }
+    }
+}
+
+template <typename Callback>
+void BroadPhaseTree::QueryPacket(const AABB* bounds, size_t count, uint64_t activeMask, Callback&& callback) const {
+    if (root == kNullNode || count == 0) return;
+    if (count > kPacketSize) count = kPacketSize;
+
+    if (count < 64) activeMask &= (1ULL << count) - 1ULL;
+
+    int32_t stack[kMaxStackDepth];
+    uint64_t masks[kMaxStackDepth];
+    int top = 0;
+    stack[top] = root;
+    masks[top++] = activeMask;
+
+    while (top > 0 && activeMask != 0) {
+        --top;
+        const Node& node = nodes[stack[top]];
+
+        uint64_t mask = 0;
+        for (uint64_t bits = masks[top] & activeMask; bits != 0; bits &= bits - 1) {
+            const int query = __builtin_ctzll(bits);
+            if (node.bounds.Overlaps(bounds[query])) {
+                mask |= 1ULL << query;
+            }
+        }
+
+        if (mask == 0) continue;
+
+        if (node.IsLeaf()) {
+            callback(static_cast<int32_t>(&node - nodes.data()), mask, activeMask);
+        } else if (top + 2 <= kMaxStackDepth) {
+            stack[top] = node.child2;
+            masks[top++] = mask;
+            stack[top] = node.child1;
+            masks[top++] = mask;
+        }
+    }
+}
+
+} // namespace ptx
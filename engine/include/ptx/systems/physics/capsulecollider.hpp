@@ -98,6 +98,11 @@ public:
      */
     virtual void SetPosition(const Vector3D& pos) override;
 
+    /**
+     * @brief Gets capsule bounds.
+     */
+    virtual AABB GetBounds() override;
+
     PTX_BEGIN_FIELDS(CapsuleCollider)
         PTX_FIELD(CapsuleCollider, radius, "Radius", 0, 0),
         PTX_FIELD(CapsuleCollider, height, "Height", 0, 0)
@@ -8,11 +8,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include "../../core/math/vector3d.hpp"
 #include "../../core/math/rotation.hpp"
 #include "physicsmaterial.hpp"
 #include "raycasthit.hpp"
+#include "aabb.hpp"
 #include "../../registry/reflect_macros.hpp"
 
 namespace ptx {
@@ -39,6 +41,7 @@ enum class ColliderType {
 class Collider {
 protected:
     ColliderType type;           ///< Type of collider
+    uint32_t id;                 ///< Process-unique identifier (never reused)
     bool isTrigger;              ///< If true, collider is a trigger (no physics response)
     bool isEnabled;              ///< If true, collider is active
     int layer;                   ///< Collision layer (0-31)
@@ -53,6 +56,16 @@ public:
      */
     explicit Collider(ColliderType type);
 
+    /**
+     * @brief Copy constructor (the copy receives a new ID).
+     */
+    Collider(const Collider& other);
+
+    /**
+     * @brief Copy assignment (keeps this collider's ID).
+     */
+    Collider& operator=(const Collider& other);
+
     /**
      * @brief Virtual destructor.
      */
@@ -65,6 +78,11 @@ public:
      */
     ColliderType GetType() const { return type; }
 
+    /**
+     * @brief Gets the collider's unique ID (used to key contact pairs).
+     */
+    uint32_t GetID() const { return id; }
+
     /**
      * @brief Checks if collider is a trigger.
      */
@@ -171,6 +189,11 @@ public:
      */
     virtual void SetPosition(const Vector3D& pos) = 0;
 
+    /**
+     * @brief Gets the world-space bounds of the collider (used by the broadphase).
+     */
+    virtual AABB GetBounds() = 0;
+
     PTX_BEGIN_FIELDS(Collider)
         PTX_FIELD(Collider, isTrigger, "Is trigger", 0, 1),
         PTX_FIELD(Collider, isEnabled, "Is enabled", 0, 1),
@@ -181,6 +204,7 @@ public:
 
     PTX_BEGIN_METHODS(Collider)
         PTX_METHOD_AUTO(Collider, GetType, "Get type"),
+        PTX_METHOD_AUTO(Collider, GetID, "Get ID"),
         PTX_METHOD_AUTO(Collider, IsTrigger, "Is trigger"),
         PTX_METHOD_AUTO(Collider, SetTrigger, "Set trigger"),
         PTX_METHOD_AUTO(Collider, IsEnabled, "Is enabled"),
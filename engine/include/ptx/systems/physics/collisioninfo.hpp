@@ -0,0 +1,48 @@
+/**
+ * @file collisioninfo.hpp
+ * @brief Contact data reported for a pair of colliders.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "collider.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @struct CollisionInfo
+ * @brief Information about a collision between two colliders.
+ */
+struct CollisionInfo {
+    Collider* colliderA;          ///< First collider
+    Collider* colliderB;          ///< Second collider
+    Vector3D contactPoint;        ///< Contact point in world space
+    Vector3D normal;              ///< Collision normal (from A to B)
+    float penetrationDepth;       ///< How deep the collision is
+
+    /**
+     * @brief Default constructor.
+     */
+    CollisionInfo()
+        : colliderA(nullptr), colliderB(nullptr),
+          contactPoint(0, 0, 0), normal(0, 1, 0), penetrationDepth(0.0f) {}
+
+    PTX_BEGIN_FIELDS(CollisionInfo)
+        PTX_FIELD(CollisionInfo, contactPoint, "Contact point", 0, 0),
+        PTX_FIELD(CollisionInfo, normal, "Normal", 0, 0),
+        PTX_FIELD(CollisionInfo, penetrationDepth, "Penetration depth", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(CollisionInfo)
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(CollisionInfo)
+        PTX_CTOR0(CollisionInfo)
+    PTX_END_DESCRIBE(CollisionInfo)
+};
+
+} // namespace ptx
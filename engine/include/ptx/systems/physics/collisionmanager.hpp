@@ -9,46 +9,88 @@
 #pragma once
 
 #include <vector>
-#include <unordered_set>
 #include <functional>
 #include "collider.hpp"
 #include "spherecollider.hpp"
 #include "boxcollider.hpp"
 #include "capsulecollider.hpp"
+#include "broadphasetree.hpp"
+#include "contactcache.hpp"
 #include "../../registry/reflect_macros.hpp"
 
 namespace ptx {
 
 /**
- * @struct CollisionInfo
- * @brief Information about a collision between two colliders.
+ * @struct RaycastQuery
+ * @brief A single ray for batched raycasts.
  */
-struct CollisionInfo {
-    Collider* colliderA;          ///< First collider
-    Collider* colliderB;          ///< Second collider
-    Vector3D contactPoint;        ///< Contact point in world space
-    Vector3D normal;              ///< Collision normal (from A to B)
-    float penetrationDepth;       ///< How deep the collision is
+struct RaycastQuery {
+    Vector3D origin;       ///< Ray origin
+    Vector3D direction;    ///< Ray direction (must be normalized)
+    float maxDistance;     ///< Maximum ray distance
+    uint32_t layerMask;    ///< Layer mask for filtering
 
     /**
      * @brief Default constructor.
      */
-    CollisionInfo()
-        : colliderA(nullptr), colliderB(nullptr),
-          contactPoint(0, 0, 0), normal(0, 1, 0), penetrationDepth(0.0f) {}
+    RaycastQuery()
+        : origin(0, 0, 0), direction(0, 0, 1), maxDistance(0.0f), layerMask(0xFFFFFFFF) {}
 
-    PTX_BEGIN_FIELDS(CollisionInfo)
-        PTX_FIELD(CollisionInfo, contactPoint, "Contact point", 0, 0),
-        PTX_FIELD(CollisionInfo, normal, "Normal", 0, 0),
-        PTX_FIELD(CollisionInfo, penetrationDepth, "Penetration depth", 0, 0)
+    /**
+     * @brief Constructor.
+     */
+    RaycastQuery(const Vector3D& origin, const Vector3D& direction, float maxDistance,
+                 uint32_t layerMask = 0xFFFFFFFF)
+        : origin(origin), direction(direction), maxDistance(maxDistance), layerMask(layerMask) {}
+
+    PTX_BEGIN_FIELDS(RaycastQuery)
+        PTX_FIELD(RaycastQuery, origin, "Origin", 0, 0),
+        PTX_FIELD(RaycastQuery, direction, "Direction", 0, 0),
+        PTX_FIELD(RaycastQuery, maxDistance, "Max distance", 0, 0),
+        PTX_FIELD(RaycastQuery, layerMask, "Layer mask", 0, 0)
     PTX_END_FIELDS
 
-    PTX_BEGIN_METHODS(CollisionInfo)
+    PTX_BEGIN_METHODS(RaycastQuery)
     PTX_END_METHODS
 
-    PTX_BEGIN_DESCRIBE(CollisionInfo)
-        PTX_CTOR0(CollisionInfo)
-    PTX_END_DESCRIBE(CollisionInfo)
+    PTX_BEGIN_DESCRIBE(RaycastQuery)
+        PTX_CTOR0(RaycastQuery)
+    PTX_END_DESCRIBE(RaycastQuery)
+};
+
+/**
+ * @struct OverlapSphereQuery
+ * @brief A single sphere for batched overlap tests.
+ */
+struct OverlapSphereQuery {
+    Vector3D center;       ///< Sphere center
+    float radius;          ///< Sphere radius
+    uint32_t layerMask;    ///< Layer mask for filtering
+
+    /**
+     * @brief Default constructor.
+     */
+    OverlapSphereQuery()
+        : center(0, 0, 0), radius(0.0f), layerMask(0xFFFFFFFF) {}
+
+    /**
+     * @brief Constructor.
+     */
+    OverlapSphereQuery(const Vector3D& center, float radius, uint32_t layerMask = 0xFFFFFFFF)
+        : center(center), radius(radius), layerMask(layerMask) {}
+
+    PTX_BEGIN_FIELDS(OverlapSphereQuery)
+        PTX_FIELD(OverlapSphereQuery, center, "Center", 0, 0),
+        PTX_FIELD(OverlapSphereQuery, radius, "Radius", 0, 0),
+        PTX_FIELD(OverlapSphereQuery, layerMask, "Layer mask", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(OverlapSphereQuery)
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(OverlapSphereQuery)
+        PTX_CTOR0(OverlapSphereQuery)
+    PTX_END_DESCRIBE(OverlapSphereQuery)
 };
 
 /**
@@ -57,20 +99,46 @@ struct CollisionInfo {
  */
 using CollisionCallback = std::function<void(const CollisionInfo&)>;
 
+/**
+ * @typedef CollisionBatchCallback
+ * @brief Callback receiving every event of one kind for a frame.
+ *
+ * The array is only valid for the duration of the call.
+ */
+using CollisionBatchCallback = std::function<void(const CollisionInfo* events, size_t count)>;
+
 /**
  * @class CollisionManager
  * @brief Manages collision detection between registered colliders.
+ *
+ * Colliders are tracked in a dynamic AABB tree that drives both pair
+ * generation and scene queries. The tree is synchronized with collider bounds
+ * at the start of Update(); call SyncBroadPhase() after moving colliders
+ * outside Update() if queries must see the new positions immediately.
  */
 class CollisionManager {
 private:
     std::vector<Collider*> colliders;                    ///< Registered colliders
+    std::vector<int32_t> proxies;                        ///< Broadphase proxy per collider (parallel to colliders)
+    BroadPhaseTree broadPhase;                           ///< Spatial structure for pairs and queries
     bool collisionMatrix[32][32];                        ///< Layer collision matrix
-    std::unordered_set<uint64_t> previousCollisions;    ///< Collisions from last frame
-    std::unordered_set<uint64_t> currentCollisions;     ///< Collisions this frame
+
+    // Contact state is reused across frames; after warm-up Update() does not allocate.
+    ContactCache contacts;                               ///< Persistent manifolds keyed by collider IDs
+    std::vector<uint32_t> currentContacts;               ///< Manifolds touching this frame
+    std::vector<uint32_t> previousContacts;              ///< Manifolds touching last frame (swapped, never copied)
+    std::vector<std::pair<Collider*, Collider*>> candidatePairs; ///< Broadphase output
+    std::vector<CollisionInfo> enterEvents;              ///< Enter events for this frame
+    std::vector<CollisionInfo> stayEvents;               ///< Stay events for this frame
+    std::vector<CollisionInfo> exitEvents;               ///< Exit events for this frame (last known contact)
+    uint32_t frameIndex;                                 ///< Incremented by every Update()
 
     std::vector<CollisionCallback> onCollisionEnterCallbacks;  ///< Enter callbacks
     std::vector<CollisionCallback> onCollisionStayCallbacks;   ///< Stay callbacks
     std::vector<CollisionCallback> onCollisionExitCallbacks;   ///< Exit callbacks
+    std::vector<CollisionBatchCallback> onCollisionEnterBatchCallbacks;  ///< Batched enter callbacks
+    std::vector<CollisionBatchCallback> onCollisionStayBatchCallbacks;   ///< Batched stay callbacks
+    std::vector<CollisionBatchCallback> onCollisionExitBatchCallbacks;   ///< Batched exit callbacks
 
 public:
     /**
@@ -93,6 +161,9 @@ public:
 
     /**
      * @brief Unregisters a collider.
+     *
+     * Cached contacts involving the collider are dropped without an exit event.
+     *
      * @param collider Pointer to collider.
      */
     void UnregisterCollider(Collider* collider);
@@ -107,6 +178,28 @@ public:
      */
     size_t GetColliderCount() const { return colliders.size(); }
 
+    // === Broadphase ===
+
+    /**
+     * @brief Refreshes broadphase bounds from the current collider positions.
+     */
+    void SyncBroadPhase();
+
+    /**
+     * @brief Sets how far broadphase bounds are fattened (trades reinserts for looser culling).
+     */
+    void SetBroadPhaseMargin(float margin) { broadPhase.SetMargin(margin); }
+
+    /**
+     * @brief Gets the broadphase fattening margin.
+     */
+    float GetBroadPhaseMargin() const { return broadPhase.GetMargin(); }
+
+    /**
+     * @brief Gets the broadphase tree (read-only).
+     */
+    const BroadPhaseTree& GetBroadPhase() const { return broadPhase; }
+
     // === Collision Matrix ===
 
     /**
@@ -131,9 +224,32 @@ public:
 
     /**
      * @brief Updates collision detection (call once per frame).
+     *
+     * Runs the broadphase and narrowphase, refreshes the contact cache, then
+     * dispatches enter, stay and exit events in that order.
      */
     void Update();
 
+    /**
+     * @brief Number of pairs currently in contact.
+     */
+    size_t GetContactCount() const { return currentContacts.size(); }
+
+    /**
+     * @brief Gets the contact cache.
+     */
+    const ContactCache& GetContacts() const { return contacts; }
+
+    /**
+     * @brief Gets the contact cache (mutable, e.g. for solver state).
+     */
+    ContactCache& GetContacts() { return contacts; }
+
+    /**
+     * @brief Indices into GetContacts() of the pairs touching this frame.
+     */
+    const std::vector<uint32_t>& GetActiveContacts() const { return currentContacts; }
+
     /**
      * @brief Tests collision between two specific colliders.
      * @param a First collider.
@@ -205,6 +321,36 @@ public:
     bool OverlapBox(const Vector3D& center, const Vector3D& extents,
                     uint32_t layerMask = 0xFFFFFFFF);
 
+    // === Batched Queries ===
+
+    /**
+     * @brief Casts many rays and finds the closest hit for each.
+     *
+     * Rays are grouped into packets that share one tree traversal, and packets
+     * are answered in parallel on the shared thread pool. Consecutive rays with
+     * similar origins and directions traverse most efficiently.
+     *
+     * @param queries Array of rays.
+     * @param count Number of rays.
+     * @param hits Output array of @p count hits; a miss leaves collider == nullptr.
+     * @return Number of rays that hit something.
+     */
+    int RaycastBatch(const RaycastQuery* queries, size_t count, RaycastHit* hits);
+
+    /**
+     * @brief Vector convenience overload of RaycastBatch().
+     */
+    int RaycastBatch(const std::vector<RaycastQuery>& queries, std::vector<RaycastHit>& hits);
+
+    /**
+     * @brief Tests many spheres for overlap with any collider.
+     * @param queries Array of spheres.
+     * @param count Number of spheres.
+     * @param results Output array of @p count flags.
+     * @return Number of spheres that overlap something.
+     */
+    int OverlapSphereBatch(const OverlapSphereQuery* queries, size_t count, bool* results);
+
     // === Callbacks ===
 
     /**
@@ -222,6 +368,21 @@ public:
      */
     void AddCollisionExitCallback(CollisionCallback callback);
 
+    /**
+     * @brief Adds a callback that receives all enter events of a frame at once.
+     */
+    void AddCollisionEnterBatchCallback(CollisionBatchCallback callback);
+
+    /**
+     * @brief Adds a callback that receives all stay events of a frame at once.
+     */
+    void AddCollisionStayBatchCallback(CollisionBatchCallback callback);
+
+    /**
+     * @brief Adds a callback that receives all exit events of a frame at once.
+     */
+    void AddCollisionExitBatchCallback(CollisionBatchCallback callback);
+
     /**
      * @brief Clears all callbacks.
      */
@@ -239,9 +400,44 @@ private:
     void NarrowPhase(const std::vector<std::pair<Collider*, Collider*>>& pairs);
 
     /**
-     * @brief Gets a unique ID for a collider pair.
+     * @brief Delivers the frame's buffered events to the registered callbacks.
+     */
+    void DispatchEvents();
+
+    /**
+     * @brief Drops contact list entries whose manifolds were removed.
+     */
+    void PruneContactLists();
+
+    /**
+     * @brief Checks enabled state and layer mask for a query.
+     */
+    bool PassesFilter(Collider* collider, uint32_t mask) const;
+
+    /**
+     * @brief Checks if a collider overlaps a sphere.
+     */
+    bool OverlapsSphere(Collider* collider, const Vector3D& center, float radius) const;
+
+    /**
+     * @brief Checks if a collider overlaps an axis-aligned box.
+     */
+    bool OverlapsBox(Collider* collider, const AABB& box) const;
+
+    /**
+     * @brief Answers one packet of RaycastBatch().
+     */
+    int RaycastPacket(const RaycastQuery* queries, size_t count, RaycastHit* hits) const;
+
+    /**
+     * @brief Answers one packet of OverlapSphereBatch().
+     */
+    int OverlapSpherePacket(const OverlapSphereQuery* queries, size_t count, bool* results) const;
+
+    /**
+     * @brief Gets a unique ID for a collider pair (built from collider IDs).
      */
-    uint64_t GetPairID(Collider* a, Collider* b) const;
+    uint64_t GetPairID(const Collider* a, const Collider* b) const;
 
     /**
      * @brief Checks if a layer is in a layer mask.
@@ -274,6 +470,10 @@ private:
         PTX_METHOD_AUTO(CollisionManager, CanLayersCollide, "Can layers collide"),
         PTX_METHOD_AUTO(CollisionManager, SetDefaultCollisionMatrix, "Set default collision matrix"),
         PTX_METHOD_AUTO(CollisionManager, Update, "Update"),
+        PTX_METHOD_AUTO(CollisionManager, GetContactCount, "Get contact count"),
+        PTX_METHOD_AUTO(CollisionManager, SyncBroadPhase, "Sync broad phase"),
+        PTX_METHOD_AUTO(CollisionManager, SetBroadPhaseMargin, "Set broad phase margin"),
+        PTX_METHOD_AUTO(CollisionManager, GetBroadPhaseMargin, "Get broad phase margin"),
         PTX_METHOD_AUTO(CollisionManager, ClearCallbacks, "Clear callbacks")
     PTX_END_METHODS
 
@@ -0,0 +1,174 @@
+/**
+ * @file contactcache.hpp
+ * @brief Persistent storage for contact manifolds between collider pairs.
+ *
+ * Manifolds live in a dense pool addressed by stable indices and are found
+ * through an open-addressing table keyed by the pair's collider IDs. Removed
+ * slots are recycled, so once the cache has grown to the scene's peak contact
+ * count it stops allocating.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "collisioninfo.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @struct ContactManifold
+ * @brief Cached contact state for one collider pair.
+ */
+struct ContactManifold {
+    uint64_t key;              ///< Pair key (see ContactCache::MakeKey)
+    CollisionInfo info;        ///< Most recent contact data
+    uint32_t touchingFrame;    ///< Last frame the pair was touching
+    bool active;               ///< True while the pool slot is in use
+
+    // Accumulated solver impulses, carried across frames for warm starting.
+    float normalImpulse;       ///< Impulse along info.normal
+    float tangentImpulse1;     ///< Friction impulse along the first tangent
+    float tangentImpulse2;     ///< Friction impulse along the second tangent
+
+    /**
+     * @brief Default constructor.
+     */
+    ContactManifold()
+        : key(0), info(), touchingFrame(0), active(false),
+          normalImpulse(0.0f), tangentImpulse1(0.0f), tangentImpulse2(0.0f) {}
+
+    PTX_BEGIN_FIELDS(ContactManifold)
+        PTX_FIELD(ContactManifold, info, "Info", 0, 0),
+        PTX_FIELD(ContactManifold, touchingFrame, "Touching frame", 0, 0),
+        PTX_FIELD(ContactManifold, active, "Active", 0, 1),
+        PTX_FIELD(ContactManifold, normalImpulse, "Normal impulse", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(ContactManifold)
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(ContactManifold)
+        PTX_CTOR0(ContactManifold)
+    PTX_END_DESCRIBE(ContactManifold)
+};
+
+/**
+ * @class ContactCache
+ * @brief Hash-indexed pool of contact manifolds keyed by collider ID pairs.
+ */
+class ContactCache {
+public:
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu; ///< Returned when a key is not cached
+
+    /**
+     * @brief Constructor.
+     * @param initialCapacity Number of manifolds to reserve up front.
+     */
+    explicit ContactCache(size_t initialCapacity = 64);
+
+    /**
+     * @brief Builds an order-independent key from two collider IDs.
+     */
+    static uint64_t MakeKey(uint32_t idA, uint32_t idB) {
+        if (idA > idB) {
+            const uint32_t t = idA;
+            idA = idB;
+            idB = t;
+        }
+        return (static_cast<uint64_t>(idA) << 32) | static_cast<uint64_t>(idB);
+    }
+
+    /**
+     * @brief Finds a manifold index by key.
+     * @return Index, or kInvalidIndex if the pair is not cached.
+     */
+    uint32_t Find(uint64_t key) const;
+
+    /**
+     * @brief Finds a manifold or creates an empty one.
+     * @param key Pair key.
+     * @param created Set to true if a new manifold was created.
+     * @return Stable manifold index.
+     */
+    uint32_t FindOrCreate(uint64_t key, bool& created);
+
+    /**
+     * @brief Removes the manifold at @p index and recycles its slot.
+     */
+    void Remove(uint32_t index);
+
+    /**
+     * @brief Removes every manifold that references @p collider.
+     * @return Number of manifolds removed.
+     */
+    size_t RemoveCollider(const Collider* collider);
+
+    /**
+     * @brief Removes every manifold without releasing memory.
+     */
+    void Clear();
+
+    /**
+     * @brief Reserves room for @p count manifolds.
+     */
+    void Reserve(size_t count);
+
+    /**
+     * @brief Accesses a manifold by index.
+     */
+    ContactManifold& Get(uint32_t index) { return manifolds[index]; }
+
+    /**
+     * @brief Accesses a manifold by index (const).
+     */
+    const ContactManifold& Get(uint32_t index) const { return manifolds[index]; }
+
+    /**
+     * @brief Number of cached manifolds.
+     */
+    size_t GetCount() const { return count; }
+
+    /**
+     * @brief Size of the manifold pool (valid indices are below this; check ContactManifold::active).
+     */
+    size_t GetPoolSize() const { return manifolds.size(); }
+
+private:
+    static constexpr int32_t kEmptySlot = -1;
+    static constexpr int32_t kDeletedSlot = -2;
+
+    std::vector<ContactManifold> manifolds;  ///< Dense manifold pool
+    std::vector<uint32_t> freeIndices;       ///< Recycled pool indices
+    std::vector<int32_t> slots;              ///< Open-addressing table of pool indices
+    std::vector<uint32_t> slotOfManifold;    ///< Table slot for each pool index
+    size_t count;                            ///< Live manifolds
+    size_t usedSlots;                        ///< Live plus deleted table slots
+
+    static uint64_t Hash(uint64_t key);
+    size_t FindSlot(uint64_t key) const;
+    void Rehash(size_t newSlotCount);
+
+    PTX_BEGIN_FIELDS(ContactCache)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(ContactCache)
+        PTX_METHOD_AUTO(ContactCache, Remove, "Remove"),
+        PTX_METHOD_AUTO(ContactCache, Clear, "Clear"),
+        PTX_METHOD_AUTO(ContactCache, Reserve, "Reserve"),
+        PTX_METHOD_AUTO(ContactCache, GetCount, "Get count"),
+        PTX_METHOD_AUTO(ContactCache, GetPoolSize, "Get pool size")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(ContactCache)
+        PTX_CTOR(ContactCache, size_t)
+    PTX_END_DESCRIBE(ContactCache)
+};
+
+} // namespace ptx
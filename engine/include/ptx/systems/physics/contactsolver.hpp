@@ -0,0 +1,133 @@
+/**
+ * @file contactsolver.hpp
+ * @brief Sequential impulse solver for single-point contact constraints.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "contactcache.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @struct SolverBodies
+ * @brief Views into the PhysicsWorld body arrays used by the solver.
+ *
+ * Only bodies with a non-zero inverse mass are written, so constraints that
+ * share a static or kinematic body can be solved on different threads.
+ */
+struct SolverBodies {
+    const Vector3D* positions;         ///< Body centers
+    Vector3D* linearVelocities;        ///< Linear velocities (read/write)
+    Vector3D* angularVelocities;       ///< Angular velocities (read/write)
+    const float* inverseMasses;        ///< Inverse masses (0 = immovable)
+    const Vector3D* inverseInertias;   ///< Diagonal world-space inverse inertia
+};
+
+/**
+ * @struct ContactConstraint
+ * @brief Solver state for one contact point.
+ */
+struct ContactConstraint {
+    int32_t bodyA;              ///< Dense body index, or -1 for a collider without a body
+    int32_t bodyB;              ///< Dense body index, or -1 for a collider without a body
+    uint32_t manifold;          ///< Index into the ContactCache
+    Vector3D normal;            ///< Contact normal (A to B)
+    Vector3D tangent1;          ///< First friction direction
+    Vector3D tangent2;          ///< Second friction direction
+    Vector3D rA;                ///< Contact point relative to body A
+    Vector3D rB;                ///< Contact point relative to body B
+    float normalMass;           ///< Effective mass along the normal
+    float tangentMass1;         ///< Effective mass along tangent1
+    float tangentMass2;         ///< Effective mass along tangent2
+    float friction;             ///< Combined friction coefficient
+    float velocityBias;         ///< Target separating velocity (restitution + penetration recovery)
+    float normalImpulse;        ///< Accumulated normal impulse
+    float tangentImpulse1;      ///< Accumulated friction impulse along tangent1
+    float tangentImpulse2;      ///< Accumulated friction impulse along tangent2
+};
+
+/**
+ * @struct ContactSolverSettings
+ * @brief Tuning shared by every constraint in a step.
+ */
+struct ContactSolverSettings {
+    float baumgarte;             ///< Fraction of penetration removed per step
+    float linearSlop;            ///< Penetration allowed without correction
+    float maxCorrectionSpeed;    ///< Clamp on the penetration recovery velocity
+    float restitutionThreshold;  ///< Approach speed below which contacts do not bounce
+    bool warmStarting;           ///< Seed impulses from the previous frame
+
+    /**
+     * @brief Default constructor.
+     */
+    ContactSolverSettings()
+        : baumgarte(0.2f), linearSlop(0.005f), maxCorrectionSpeed(5.0f),
+          restitutionThreshold(1.0f), warmStarting(true) {}
+
+    PTX_BEGIN_FIELDS(ContactSolverSettings)
+        PTX_FIELD(ContactSolverSettings, baumgarte, "Baumgarte", 0, 1),
+        PTX_FIELD(ContactSolverSettings, linearSlop, "Linear slop", 0, 0),
+        PTX_FIELD(ContactSolverSettings, maxCorrectionSpeed, "Max correction speed", 0, 0),
+        PTX_FIELD(ContactSolverSettings, restitutionThreshold, "Restitution threshold", 0, 0),
+        PTX_FIELD(ContactSolverSettings, warmStarting, "Warm starting", 0, 1)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(ContactSolverSettings)
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(ContactSolverSettings)
+        PTX_CTOR0(ContactSolverSettings)
+    PTX_END_DESCRIBE(ContactSolverSettings)
+};
+
+/**
+ * @class ContactSolver
+ * @brief Stateless sequential impulse routines over spans of constraints.
+ */
+class ContactSolver {
+public:
+    /**
+     * @brief Builds a constraint from cached contact data.
+     * @param constraint Output constraint (bodyA, bodyB and manifold must already be set).
+     * @param manifold Cached manifold providing contact data and previous impulses.
+     * @param bodies Body views.
+     * @param settings Solver tuning.
+     * @param deltaTime Step length in seconds.
+     */
+    static void Prepare(ContactConstraint& constraint, const ContactManifold& manifold,
+                        const SolverBodies& bodies, const ContactSolverSettings& settings, float deltaTime);
+
+    /**
+     * @brief Applies the accumulated impulses from the previous frame.
+     */
+    static void WarmStart(const ContactConstraint* constraints, size_t count, SolverBodies& bodies);
+
+    /**
+     * @brief Runs one Gauss-Seidel pass over the constraints.
+     */
+    static void SolveVelocity(ContactConstraint* constraints, size_t count, SolverBodies& bodies);
+
+    /**
+     * @brief Writes accumulated impulses back to the manifolds for the next frame.
+     */
+    static void StoreImpulses(const ContactConstraint* constraints, size_t count, ContactCache& cache);
+
+    PTX_BEGIN_FIELDS(ContactSolver)
+        /* No reflected fields. */
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(ContactSolver)
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(ContactSolver)
+    PTX_END_DESCRIBE(ContactSolver)
+};
+
+} // namespace ptx
@@ -0,0 +1,323 @@
+/**
+ * @file physicsworld.hpp
+ * @brief Rigid body world: integration, contact solving, islands and sleeping.
+ *
+ * Bodies are stored as parallel arrays (SoA) indexed densely, so the
+ * integration and solver loops stream through contiguous memory. Every step
+ * the world groups touching dynamic bodies into islands; islands are solved
+ * independently on the shared ThreadPool, and islands that stay at rest long
+ * enough fall asleep and are skipped until something wakes them.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "collisionmanager.hpp"
+#include "contactsolver.hpp"
+#include "rigidbody.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @class PhysicsWorld
+ * @brief Owns rigid bodies and the CollisionManager that feeds them contacts.
+ *
+ * Colliders registered with GetCollisionManager() but without a body act as
+ * static geometry. Colliders are axis-aligned, so angular velocity only affects
+ * contact response (friction and rolling); orientation is not integrated.
+ */
+class PhysicsWorld {
+public:
+    static constexpr int32_t kInvalidBody = -1;  ///< Returned when no body exists
+
+    /**
+     * @brief Constructor.
+     */
+    PhysicsWorld();
+
+    // === Bodies ===
+
+    /**
+     * @brief Creates a body for a collider and registers the collider for collisions.
+     * @param collider Collider driven by the body (not owned).
+     * @param body Initial body state.
+     * @return Body handle, or kInvalidBody if the collider is null or already has a body.
+     */
+    int32_t CreateBody(Collider* collider, const RigidBody& body = RigidBody());
+
+    /**
+     * @brief Destroys a body and unregisters its collider.
+     */
+    void DestroyBody(int32_t body);
+
+    /**
+     * @brief Destroys every body.
+     */
+    void Clear();
+
+    /**
+     * @brief Checks if a handle refers to a live body.
+     */
+    bool IsValid(int32_t body) const;
+
+    /**
+     * @brief Finds the body attached to a collider.
+     * @return Body handle, or kInvalidBody.
+     */
+    int32_t GetBody(const Collider* collider) const;
+
+    /**
+     * @brief Gets the collider driven by a body.
+     */
+    Collider* GetCollider(int32_t body) const;
+
+    /**
+     * @brief Gets the body type.
+     */
+    RigidBodyType GetType(int32_t body) const;
+
+    /**
+     * @brief Gets the body mass (0 for static and kinematic bodies).
+     */
+    float GetMass(int32_t body) const;
+
+    /**
+     * @brief Gets the body position.
+     */
+    Vector3D GetPosition(int32_t body) const;
+
+    /**
+     * @brief Teleports a body (wakes it).
+     */
+    void SetPosition(int32_t body, const Vector3D& position);
+
+    /**
+     * @brief Gets the linear velocity.
+     */
+    Vector3D GetLinearVelocity(int32_t body) const;
+
+    /**
+     * @brief Sets the linear velocity (wakes the body).
+     */
+    void SetLinearVelocity(int32_t body, const Vector3D& velocity);
+
+    /**
+     * @brief Gets the angular velocity.
+     */
+    Vector3D GetAngularVelocity(int32_t body) const;
+
+    /**
+     * @brief Sets the angular velocity (wakes the body).
+     */
+    void SetAngularVelocity(int32_t body, const Vector3D& velocity);
+
+    /**
+     * @brief Adds a force at the center of mass for the next step (wakes the body).
+     */
+    void ApplyForce(int32_t body, const Vector3D& force);
+
+    /**
+     * @brief Applies an impulse at a world-space point (wakes the body).
+     */
+    void ApplyImpulse(int32_t body, const Vector3D& impulse, const Vector3D& point);
+
+    /**
+     * @brief Checks if a body is awake.
+     */
+    bool IsAwake(int32_t body) const;
+
+    /**
+     * @brief Wakes a body or puts it to sleep.
+     */
+    void SetAwake(int32_t body, bool awake);
+
+    // === Simulation ===
+
+    /**
+     * @brief Advances the simulation.
+     * @param deltaTime Step length in seconds.
+     */
+    void Step(float deltaTime);
+
+    /**
+     * @brief Gets the collision manager used for contact generation.
+     */
+    CollisionManager& GetCollisionManager() { return collisionManager; }
+
+    // === Settings ===
+
+    /**
+     * @brief Gets world gravity (m/s^2).
+     */
+    Vector3D GetGravity() const { return gravity; }
+
+    /**
+     * @brief Sets world gravity (m/s^2).
+     */
+    void SetGravity(const Vector3D& value) { gravity = value; }
+
+    /**
+     * @brief Gets the number of solver passes per step.
+     */
+    int GetVelocityIterations() const { return velocityIterations; }
+
+    /**
+     * @brief Sets the number of solver passes per step (at least 1).
+     */
+    void SetVelocityIterations(int value) { velocityIterations = value < 1 ? 1 : value; }
+
+    /**
+     * @brief Checks if resting islands may fall asleep.
+     */
+    bool IsSleepingEnabled() const { return sleepingEnabled; }
+
+    /**
+     * @brief Enables or disables sleeping (disabling wakes every body).
+     */
+    void SetSleepingEnabled(bool enabled);
+
+    /**
+     * @brief Gets how long an island must rest before sleeping (seconds).
+     */
+    float GetTimeToSleep() const { return timeToSleep; }
+
+    /**
+     * @brief Sets how long an island must rest before sleeping (seconds).
+     */
+    void SetTimeToSleep(float seconds) { timeToSleep = seconds; }
+
+    /**
+     * @brief Sets the speeds below which a body counts as resting.
+     * @param linear Linear speed tolerance (m/s).
+     * @param angular Angular speed tolerance (rad/s).
+     */
+    void SetSleepTolerances(float linear, float angular) {
+        linearSleepTolerance = linear;
+        angularSleepTolerance = angular;
+    }
+
+    /**
+     * @brief Gets the contact solver tuning.
+     */
+    ContactSolverSettings& GetSolverSettings() { return solverSettings; }
+
+    // === Statistics ===
+
+    /**
+     * @brief Number of live bodies.
+     */
+    size_t GetBodyCount() const { return colliders.size(); }
+
+    /**
+     * @brief Number of awake dynamic bodies after the last step.
+     */
+    size_t GetAwakeBodyCount() const;
+
+    /**
+     * @brief Number of islands built in the last step (awake and asleep).
+     */
+    size_t GetIslandCount() const { return islandCount; }
+
+    /**
+     * @brief Number of islands solved in the last step.
+     */
+    size_t GetAwakeIslandCount() const { return awakeIslandCount; }
+
+    /**
+     * @brief Number of contact constraints built in the last step.
+     */
+    size_t GetContactConstraintCount() const { return constraints.size(); }
+
+private:
+    CollisionManager collisionManager;    ///< Contact source
+
+    // === Body storage (SoA, dense, swap-removed) ===
+    std::vector<Collider*> colliders;
+    std::vector<RigidBodyType> types;
+    std::vector<Vector3D> positions;
+    std::vector<Vector3D> linearVelocities;
+    std::vector<Vector3D> angularVelocities;
+    std::vector<Vector3D> forces;
+    std::vector<float> inverseMasses;
+    std::vector<Vector3D> inverseInertias;
+    std::vector<float> linearDampings;
+    std::vector<float> angularDampings;
+    std::vector<float> gravityScales;
+    std::vector<float> sleepTimers;
+    std::vector<uint8_t> awakeFlags;
+    std::vector<uint8_t> canSleepFlags;
+
+    // === Handles ===
+    std::vector<int32_t> handleToDense;   ///< Handle -> dense index (-1 when free)
+    std::vector<int32_t> denseToHandle;   ///< Dense index -> handle
+    std::vector<int32_t> freeHandles;     ///< Recycled handles
+    std::unordered_map<const Collider*, int32_t> colliderToHandle;
+
+    // === Per-step scratch (capacity reused across steps) ===
+    std::vector<ContactConstraint> constraints;       ///< Unsorted constraints
+    std::vector<ContactConstraint> sortedConstraints; ///< Constraints grouped by island
+    std::vector<int32_t> constraintIslands;           ///< Island of each unsorted constraint
+    std::vector<int32_t> unionParents;                ///< Union-find over dense bodies
+    std::vector<int32_t> bodyIslands;                 ///< Island of each dense body (-1 if not dynamic)
+    std::vector<uint32_t> islandBodyStarts;           ///< Prefix offsets into islandBodies
+    std::vector<uint32_t> islandCursors;              ///< Counting-sort write cursors
+    std::vector<int32_t> islandBodies;                ///< Dense body indices grouped by island
+    std::vector<uint32_t> islandConstraintStarts;     ///< Prefix offsets into sortedConstraints
+    std::vector<uint8_t> islandAwake;                 ///< Island should be solved this step
+    size_t islandCount;
+    size_t awakeIslandCount;
+
+    // === Settings ===
+    Vector3D gravity;
+    int velocityIterations;
+    bool sleepingEnabled;
+    float timeToSleep;
+    float linearSleepTolerance;
+    float angularSleepTolerance;
+    ContactSolverSettings solverSettings;
+
+    int32_t DenseIndex(int32_t body) const;
+    void Wake(int32_t dense);
+    void ComputeMass(int32_t dense, float mass);
+    void IntegrateVelocities(float deltaTime);
+    void BuildConstraints(float deltaTime);
+    void BuildIslands();
+    void SolveIsland(size_t island, float deltaTime);
+    int32_t FindRoot(int32_t dense);
+
+    PTX_BEGIN_FIELDS(PhysicsWorld)
+        PTX_FIELD(PhysicsWorld, gravity, "Gravity", 0, 0),
+        PTX_FIELD(PhysicsWorld, velocityIterations, "Velocity iterations", 1, 64),
+        PTX_FIELD(PhysicsWorld, sleepingEnabled, "Sleeping enabled", 0, 1),
+        PTX_FIELD(PhysicsWorld, timeToSleep, "Time to sleep", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(PhysicsWorld)
+        PTX_METHOD_AUTO(PhysicsWorld, Step, "Step"),
+        PTX_METHOD_AUTO(PhysicsWorld, DestroyBody, "Destroy body"),
+        PTX_METHOD_AUTO(PhysicsWorld, Clear, "Clear"),
+        PTX_METHOD_AUTO(PhysicsWorld, IsValid, "Is valid"),
+        PTX_METHOD_AUTO(PhysicsWorld, GetPosition, "Get position"),
+        PTX_METHOD_AUTO(PhysicsWorld, SetPosition, "Set position"),
+        PTX_METHOD_AUTO(PhysicsWorld, GetLinearVelocity, "Get linear velocity"),
+        PTX_METHOD_AUTO(PhysicsWorld, SetLinearVelocity, "Set linear velocity"),
+        PTX_METHOD_AUTO(PhysicsWorld, IsAwake, "Is awake"),
+        PTX_METHOD_AUTO(PhysicsWorld, SetAwake, "Set awake"),
+        PTX_METHOD_AUTO(PhysicsWorld, GetBodyCount, "Get body count"),
+        PTX_METHOD_AUTO(PhysicsWorld, GetAwakeBodyCount, "Get awake body count"),
+        PTX_METHOD_AUTO(PhysicsWorld, GetIslandCount, "Get island count")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(PhysicsWorld)
+        PTX_CTOR0(PhysicsWorld)
+    PTX_END_DESCRIBE(PhysicsWorld)
+};
+
+} // namespace ptx
@@ -0,0 +1,76 @@
+/**
+ * @file rigidbody.hpp
+ * @brief Rigid body component description used to create bodies in a PhysicsWorld.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include "../../core/math/vector3d.hpp"
+#include "../../registry/reflect_macros.hpp"
+
+namespace ptx {
+
+/**
+ * @enum RigidBodyType
+ * @brief How a body takes part in the simulation.
+ */
+enum class RigidBodyType {
+    Static,     ///< Never moves, infinite mass
+    Kinematic,  ///< Moved by its velocity only, pushes dynamic bodies, infinite mass
+    Dynamic     ///< Fully simulated
+};
+
+/**
+ * @struct RigidBody
+ * @brief Initial state and tuning for a body attached to a collider.
+ *
+ * The PhysicsWorld copies these values into its own storage when the body is
+ * created; change a live body through the PhysicsWorld accessors.
+ */
+struct RigidBody {
+    RigidBodyType type;       ///< Body type
+    float mass;               ///< Mass in kg (<= 0 derives it from collider volume and material density)
+    Vector3D linearVelocity;  ///< Initial linear velocity (m/s)
+    Vector3D angularVelocity; ///< Initial angular velocity (rad/s)
+    float linearDamping;      ///< Linear velocity damping (1/s)
+    float angularDamping;     ///< Angular velocity damping (1/s)
+    float gravityScale;       ///< Multiplier applied to world gravity
+    bool canSleep;            ///< If false the body never falls asleep
+
+    /**
+     * @brief Default constructor (dynamic body with derived mass).
+     */
+    RigidBody()
+        : type(RigidBodyType::Dynamic), mass(0.0f), linearVelocity(0, 0, 0), angularVelocity(0, 0, 0),
+          linearDamping(0.0f), angularDamping(0.05f), gravityScale(1.0f), canSleep(true) {}
+
+    /**
+     * @brief Constructor with type and mass.
+     */
+    RigidBody(RigidBodyType type, float mass)
+        : type(type), mass(mass), linearVelocity(0, 0, 0), angularVelocity(0, 0, 0),
+          linearDamping(0.0f), angularDamping(0.05f), gravityScale(1.0f), canSleep(true) {}
+
+    PTX_BEGIN_FIELDS(RigidBody)
+        PTX_FIELD(RigidBody, mass, "Mass", 0, 0),
+        PTX_FIELD(RigidBody, linearVelocity, "Linear velocity", 0, 0),
+        PTX_FIELD(RigidBody, angularVelocity, "Angular velocity", 0, 0),
+        PTX_FIELD(RigidBody, linearDamping, "Linear damping", 0, 0),
+        PTX_FIELD(RigidBody, angularDamping, "Angular damping", 0, 0),
+        PTX_FIELD(RigidBody, gravityScale, "Gravity scale", 0, 0),
+        PTX_FIELD(RigidBody, canSleep, "Can sleep", 0, 1)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(RigidBody)
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(RigidBody)
+        PTX_CTOR0(RigidBody),
+        PTX_CTOR(RigidBody, RigidBodyType, float)
+    PTX_END_DESCRIBE(RigidBody)
+};
+
+} // namespace ptx
@@ -66,6 +66,11 @@ public:
      */
     virtual void SetPosition(const Vector3D& pos) override;
 
+    /**
+     * @brief Gets sphere bounds.
+     */
+    virtual AABB GetBounds() override;
+
     PTX_BEGIN_FIELDS(SphereCollider)
         // Inherits fields from Collider and Sphere
     PTX_END_FIELDS
@@ -3,7 +3,12 @@
  * @brief Represents a 2D vector field with various dynamic field effects and rendering capabilities.
  *
  * The `VectorField2D` class provides methods to manipulate and visualize a 2D vector field,
- * including operations for boundary conditions, diffusion, advection, and specialized effects.
+ * including a stable-fluids solver (diffusion, semi-Lagrangian advection and pressure
+ * projection with reflective walls) and several authoring effects.
+ *
+ * The solver iterates in float over row-contiguous grids. Linear systems are relaxed with
+ * red-black Gauss-Seidel: cells of one color only read cells of the other, so every sweep
+ * is split into row bands that run on the shared ThreadPool without synchronization.
  *
  * @date 22/12/2024
  * @author Coela Can't
@@ -21,54 +26,151 @@
 /**
  * @class VectorField2D
  * @brief A class for managing and rendering 2D vector fields.
+ *
+ * Grid coordinates include a one-cell boundary ring; interior cells are [1, count - 2].
+ * Velocities are in field widths per second and densities are nominally in [0, 1].
  */
 class VectorField2D {
+public:
+    /**
+     * @brief Storage format of the field between steps.
+     */
+    enum class Storage : uint8_t {
+        Float,  ///< Field kept in float; no conversion around solver passes.
+        Fixed8  ///< Field kept in int8 (value * 127), the legacy layout; converted around solver passes.
+    };
+
 private:
-    std::vector<int8_t> vecXP; ///< X-component of previous vectors.
-    std::vector<int8_t> vecYP; ///< Y-component of previous vectors.
-    std::vector<int8_t> vecDP; ///< Density of previous vectors.
+    enum BoundaryKind : uint8_t {
+        Scalar,    ///< Copy the neighboring interior value.
+        VelocityX, ///< Negate on the left/right walls.
+        VelocityY  ///< Negate on the top/bottom walls.
+    };
+
+    // Fixed8 storage (empty for Storage::Float)
     std::vector<int8_t> vecX; ///< X-component of current vectors.
     std::vector<int8_t> vecY; ///< Y-component of current vectors.
     std::vector<int8_t> vecD; ///< Density of current vectors.
 
+    // Solver state (the field itself for Storage::Float, scratch for Storage::Fixed8)
+    std::vector<float> velocityX; ///< X-component of current vectors.
+    std::vector<float> velocityY; ///< Y-component of current vectors.
+    std::vector<float> densities; ///< Density of current vectors.
+    std::vector<float> velocityXP; ///< X-component of previous vectors.
+    std::vector<float> velocityYP; ///< Y-component of previous vectors.
+    std::vector<float> densitiesP; ///< Density of previous vectors.
+    std::vector<float> pressure; ///< Pressure, kept to warm-start the next projection.
+    std::vector<float> divergence; ///< Velocity divergence scratch.
+
     Vector2D size; ///< Size of the vector field.
     Vector2D position; ///< Position of the vector field.
     const uint16_t countX; ///< Number of vectors along the X-axis.
     const uint16_t countY; ///< Number of vectors along the Y-axis.
+    const Storage storage; ///< Storage format.
     float rotation = 0.0f; ///< Rotation of the field in degrees.
     bool density = false; ///< Indicates if the field should render density values.
+    uint8_t iterations = 20; ///< Gauss-Seidel iterations per linear solve.
 
     [[nodiscard]] size_t SampleCount() const noexcept { return static_cast<size_t>(countX) * countY; }
+    [[nodiscard]] float CellScale() const noexcept;
+
+    void Load();
+    void Store();
+    float ReadDensity(uint32_t index) const;
+    void WriteDensity(uint32_t index, float value);
+    void WriteVelocity(uint32_t index, float x, float y);
+
+    void SetBoundary(BoundaryKind kind, float* field) const;
+    void LinearSolve(BoundaryKind kind, float* field, const float* source, float a, float c) const;
+    void DiffuseField(BoundaryKind kind, float* field, const float* source, float rate, float dt) const;
+    void AdvectField(BoundaryKind kind, float* field, const float* source, const float* u, const float* v, float dt) const;
+    void ProjectVelocity();
+    bool ToCellCoordinates(float x, float y, float& cellX, float& cellY) const;
 
 public:
     /**
      * @brief Constructs a 2D vector field with specified dimensions.
      * 
-     * @param x Number of vectors along the X-axis.
-     * @param y Number of vectors along the Y-axis.
+     * @param x Number of vectors along the X-axis (at least 3).
+     * @param y Number of vectors along the Y-axis (at least 3).
+     * @param storage Storage format of the field.
      */
-    VectorField2D(uint16_t x, uint16_t y);
+    VectorField2D(uint16_t x, uint16_t y, Storage storage = Storage::Fixed8);
 
     /**
      * @brief Applies boundary conditions to the vector field.
+     *
+     * Walls reflect the normal velocity component and copy density from the interior.
      */
     void Boundary();
 
     /**
-     * @brief Performs diffusion on the vector field.
+     * @brief Performs diffusion on the density field.
      * 
-     * @param viscosity The viscosity of the field.
+     * @param viscosity The diffusion rate of the density.
      * @param dt The time step for diffusion.
      */
     void Diffuse(float viscosity, float dt);
 
     /**
-     * @brief Advances the vector field using advection.
+     * @brief Advects the density field along the velocity field.
      * 
      * @param dt The time step for advection.
      */
     void Advect(float dt);
 
+    /**
+     * @brief Removes the divergent part of the velocity field (pressure projection).
+     */
+    void Project();
+
+    /**
+     * @brief Advances the fluid by one stable-fluids step.
+     *
+     * Diffuses and projects the velocity, self-advects and projects it again, then
+     * diffuses and advects the density through the result.
+     *
+     * @param dt The time step in seconds.
+     * @param viscosity Velocity diffusion rate (0 skips velocity diffusion).
+     * @param diffusion Density diffusion rate (0 skips density diffusion).
+     */
+    void Step(float dt, float viscosity, float diffusion);
+
+    /**
+     * @brief Adds density to a cell.
+     */
+    void AddDensity(uint16_t x, uint16_t y, float amount);
+
+    /**
+     * @brief Adds velocity to a cell.
+     */
+    void AddVelocity(uint16_t x, uint16_t y, float velocityX, float velocityY);
+
+    /**
+     * @brief Gets the density of a cell.
+     */
+    float GetDensity(uint16_t x, uint16_t y) const;
+
+    /**
+     * @brief Gets the velocity of a cell.
+     */
+    Vector2D GetVelocity(uint16_t x, uint16_t y) const;
+
+    /**
+     * @brief Gets the storage format.
+     */
+    Storage GetStorage() const { return storage; }
+
+    /**
+     * @brief Gets the Gauss-Seidel iterations per linear solve.
+     */
+    uint8_t GetIterations() const { return iterations; }
+
+    /**
+     * @brief Sets the Gauss-Seidel iterations per linear solve (at least 1).
+     */
+    void SetIterations(uint8_t count) { iterations = count < 1 ? 1 : count; }
+
     /**
      * @brief Creates a sine wave effect in the vector field.
      * 
@@ -162,14 +264,30 @@ public:
      */
     uint32_t GetVectorAtPosition(float x, float y, bool& inBounds);
 
+    /**
+     * @brief Bilinearly samples the velocity at a world position.
+     *
+     * @param x The X-coordinate of the position.
+     * @param y The Y-coordinate of the position.
+     * @param inBounds Output parameter indicating if the position is within bounds.
+     * @return Velocity in world units per second (rotated with the field), or zero when out of bounds.
+     */
+    Vector2D SampleVelocity(float x, float y, bool& inBounds) const;
+
     PTX_BEGIN_FIELDS(VectorField2D)
-        /* No reflected fields. */
+        PTX_FIELD(VectorField2D, iterations, "Iterations", 1, 255)
     PTX_END_FIELDS
 
     PTX_BEGIN_METHODS(VectorField2D)
         PTX_METHOD_AUTO(VectorField2D, Boundary, "Boundary"),
         PTX_METHOD_AUTO(VectorField2D, Diffuse, "Diffuse"),
         PTX_METHOD_AUTO(VectorField2D, Advect, "Advect"),
+        PTX_METHOD_AUTO(VectorField2D, Project, "Project"),
+        PTX_METHOD_AUTO(VectorField2D, Step, "Step"),
+        PTX_METHOD_AUTO(VectorField2D, AddDensity, "Add density"),
+        PTX_METHOD_AUTO(VectorField2D, AddVelocity, "Add velocity"),
+        PTX_METHOD_AUTO(VectorField2D, GetDensity, "Get density"),
+        PTX_METHOD_AUTO(VectorField2D, GetVelocity, "Get velocity"),
         PTX_METHOD_AUTO(VectorField2D, SineField, "Sine field"),
         PTX_METHOD_AUTO(VectorField2D, StepField, "Step field"),
         PTX_METHOD_AUTO(VectorField2D, MovingSquareField, "Moving square field"),
@@ -181,7 +299,8 @@ public:
         PTX_METHOD_AUTO(VectorField2D, SetSize, "Set size"),
         PTX_METHOD_AUTO(VectorField2D, SetPosition, "Set position"),
         PTX_METHOD_AUTO(VectorField2D, SetRotation, "Set rotation"),
-        PTX_METHOD_AUTO(VectorField2D, GetVectorAtPosition, "Get vector at position")
+        PTX_METHOD_AUTO(VectorField2D, GetVectorAtPosition, "Get vector at position"),
+        PTX_METHOD_AUTO(VectorField2D, SampleVelocity, "Sample velocity")
     PTX_END_METHODS
 
     PTX_BEGIN_DESCRIBE(VectorField2D)
@@ -14,7 +14,9 @@
 #include "../core/cameramanager.hpp" // Include for camera management.
 #include "../../scene/scene.hpp" // Include for scene management.
 #include "../raster/rasterizer.hpp" // Include for rasterization operations.
+#include "../raster/particlesplatter.hpp" // Include for particle rendering.
 #include "../ray/raytracer.hpp" // Include for display test utilities.
+#include "../../../core/platform/threadpool.hpp" // Include for parallel camera rendering.
 #include "../../../registry/reflect_macros.hpp"
 
 /**
@@ -38,6 +40,48 @@ public:
      */
     static void Rasterize(Scene* scene, CameraManager* cameraManager);
 
+    /**
+     * @brief Rasterizes the scene and splats particles over it for every camera.
+     *
+     * Meshes and particles are composed by depth in a single pass per camera, so
+     * particles behind a mesh surface stay hidden. Per-camera scratch buffers are kept
+     * between calls and shared with RasterizeParallel(), so only one render may run at a time.
+     *
+     * @param scene Pointer to the Scene to be rasterized.
+     * @param cameraManager Pointer to the CameraManager managing the cameras.
+     * @param particles Particle renderer (may be null to skip particles).
+     */
+    static void Rasterize(Scene* scene, CameraManager* cameraManager, ParticleSplatter* particles);
+
+    /**
+     * @brief Rasterizes every camera concurrently, then splats particles over each.
+     *
+     * Each camera renders on the worker pool into its own scratch buffers while the
+     * scene and cameras are only read; camera setup that writes shared state runs first
+     * on the calling thread. Cameras write disjoint pixel groups, so the output matches
+     * Rasterize() exactly regardless of scheduling. Falls back to Rasterize() for a single
+     * camera, a pool without workers, or cameras sharing a pixel group. Particles are
+     * splatted camera by camera after the meshes, since ParticleSplatter keeps per-call state.
+     *
+     * Scratch buffers are shared by all callers, so only one parallel render may run at a time.
+     *
+     * @param scene Pointer to the Scene to be rasterized.
+     * @param cameraManager Pointer to the CameraManager managing the cameras.
+     * @param particles Particle renderer (may be null to skip particles).
+     * @param pool Worker pool to render on (null uses ptx::ThreadPool::Shared()).
+     */
+    static void RasterizeParallel(Scene* scene, CameraManager* cameraManager, ParticleSplatter* particles = nullptr,
+                                  ptx::ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Gets the mesh counts of the last Rasterize() or RasterizeParallel() call.
+     *
+     * Counts are summed over cameras, so a mesh visible to two cameras is drawn twice.
+     *
+     * @return Drawn and culled mesh counts.
+     */
+    static Rasterizer::Stats GetRasterStats();
+
     /**
      * @brief RayTraces the given scene using the cameras managed by the CameraManager.
      * 
@@ -53,7 +97,8 @@ public:
     PTX_END_FIELDS
 
     PTX_BEGIN_METHODS(RenderingEngine)
-        PTX_SMETHOD_AUTO(RenderingEngine::Rasterize, "Rasterize"),
+        /* Rasterize */ PTX_SMETHOD_OVLD(RenderingEngine, Rasterize, void, Scene*, CameraManager*),
+        PTX_SMETHOD_AUTO(RenderingEngine::GetRasterStats, "Get raster stats"),
         PTX_SMETHOD_AUTO(RenderingEngine::RayTrace, "Ray trace")
     PTX_END_METHODS
 
@@ -17,6 +17,7 @@
 #include "../../../../core/color/rgbcolor.hpp"
 #include "../../../../core/math/vector2d.hpp"
 #include "../../../../core/control/bouncephysics.hpp"
+#include "../../../../core/signal/audioanalyzer.hpp"
 
 /**
  * @file audioreactivematerial.hpp
@@ -25,7 +26,7 @@
  * @details
  * - Owns @ref BouncePhysics instances when bounce is enabled; writes @c bounceData in @ref Update().
  * - Exposes setters/getters for size, position, rotation, hue, circular flag, radius, bounce, and spectrum keys.
- * - @c samples pointer is external and non-owning; bind via @ref BindSamples().
+ * - @c samples pointer is external and non-owning; bind via @ref BindSamples() or @ref BindAnalysis().
  */
 
 class AudioReactiveMaterial : public MaterialT<AudioReactiveParams, AudioReactiveShader> {
@@ -145,6 +146,17 @@ public:
         SetSampleCount(sampleCount);
     }
 
+    /**
+     * @brief Bind the bands of an @ref AudioAnalyzer snapshot, resizing to its band count.
+     * @param analysis Snapshot from AudioAnalyzer::Acquire(); valid until the next Acquire().
+     */
+    void BindAnalysis(const AudioAnalysis& analysis) {
+        if (analysis.bands.size() != this->SampleCount()) {
+            SetSampleCount(analysis.bands.size());
+        }
+        BindSamples(analysis.bands.empty() ? nullptr : analysis.bands.data());
+    }
+
     /**
      * @brief Per-frame update; optionally supply fresh sample data via @ref BindSamples.
      */
@@ -198,6 +210,7 @@ public:
         PTX_METHOD_AUTO(AudioReactiveMaterial, SetSampleCount, "Set sample count"),
         PTX_METHOD_OVLD(AudioReactiveMaterial, BindSamples, void, const float *),
         PTX_METHOD_OVLD(AudioReactiveMaterial, BindSamples, void, const float *, std::size_t),
+        PTX_METHOD_AUTO(AudioReactiveMaterial, BindAnalysis, "Bind analysis"),
         PTX_METHOD_AUTO(AudioReactiveMaterial, Update, "Update")
     PTX_END_METHODS
 
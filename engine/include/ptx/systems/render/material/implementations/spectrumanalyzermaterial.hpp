@@ -14,6 +14,7 @@
 #include "../../../../core/math/vector2d.hpp"
 #include "../../../../core/color/rgbcolor.hpp"
 #include "../../../../core/control/bouncephysics.hpp"
+#include "../../../../core/signal/audioanalyzer.hpp"
 
 /**
  * @file spectrumanalyzermaterial.hpp
@@ -165,6 +166,17 @@ public:
     /** @brief Bind external pointer to floats (non-owning). */
     void BindSamples(const float* samplesPtr) { this->samples = samplesPtr; }
 
+    /**
+     * @brief Bind the bands of an @ref AudioAnalyzer snapshot, resizing to its band count.
+     * @param analysis Snapshot from AudioAnalyzer::Acquire(); valid until the next Acquire().
+     */
+    void BindAnalysis(const AudioAnalysis& analysis) {
+        if (analysis.bands.size() != this->BinCount()) {
+            SetBinCount(analysis.bands.size());
+        }
+        BindSamples(analysis.bands.empty() ? nullptr : analysis.bands.data());
+    }
+
     /** @brief Update via IMaterial interface (uses previously bound samples). */
     void Update(float /*deltaTime*/) override { ProcessSamples(nullptr); }
 
@@ -63,6 +63,23 @@ public:
     RasterTriangle2D(const Transform& camTransform, const Quaternion& lookDirection,
                      const RasterTriangle3D& sourceTriangle, IMaterial* mat);
 
+    /**
+     * @brief Builds a 2D raster triangle from vertices that are already in camera space.
+     *
+     * Used by the rasterizer's per-camera vertex cache so that vertices shared between
+     * triangles are projected once per frame rather than once per triangle.
+     *
+     * @param sourceTriangle The source 3D triangle (positions and UVs).
+     * @param sourceNormal Normal storage that outlives this triangle.
+     * @param projectedP1 Camera-space first vertex (X/Y on screen, Z depth).
+     * @param projectedP2 Camera-space second vertex.
+     * @param projectedP3 Camera-space third vertex.
+     * @param mat The material to assign.
+     */
+    RasterTriangle2D(const RasterTriangle3D& sourceTriangle, const Vector3D* sourceNormal,
+                     const Vector3D& projectedP1, const Vector3D& projectedP2, const Vector3D& projectedP3,
+                     IMaterial* mat);
+
     /**
      * @brief Checks for intersection with a point using efficient barycentric coordinates.
      *
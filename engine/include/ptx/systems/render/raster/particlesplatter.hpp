@@ -0,0 +1,174 @@
+/**
+ * @file particlesplatter.hpp
+ * @brief Renders ParticleSystem particles into a camera's pixel group.
+ *
+ * Particles are projected with the same camera transform as the Rasterizer,
+ * binned into screen tiles over the camera bounds, and splatted as soft discs
+ * whose radius follows particle size and whose weight follows particle alpha.
+ * Every tile owns a disjoint set of pixels, so tiles are shaded in parallel on
+ * the shared ThreadPool without locks. When a depth buffer from
+ * Rasterizer::Rasterize is supplied, particles behind mesh surfaces are hidden,
+ * which composes particles and meshes in depth order within one frame.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "rasterizer.hpp"
+#include "../core/camerabase.hpp"
+#include "../../particles/particlesystem.hpp"
+#include "../../../registry/reflect_macros.hpp"
+
+/**
+ * @enum ParticleBlendMode
+ * @brief How splats combine with the pixels under them.
+ */
+enum class ParticleBlendMode : uint8_t {
+    Additive,   ///< color += particle * weight (sparks, glow)
+    Alpha       ///< color = lerp(color, particle, weight), back to front (smoke, dust)
+};
+
+/**
+ * @class ParticleSplatter
+ * @brief Tile-binned particle renderer for CameraBase pixel groups.
+ *
+ * Holds the tile and projection scratch so steady-state frames do not allocate.
+ * Pixel tiles are rebuilt only when the camera or its pixel count changes.
+ */
+class ParticleSplatter {
+public:
+    /**
+     * @brief Constructor.
+     * @param particleSystem Particles to draw (not owned, may be null).
+     * @param blendMode Blend mode for every emitter.
+     */
+    explicit ParticleSplatter(ptx::ParticleSystem* particleSystem = nullptr,
+                              ParticleBlendMode blendMode = ParticleBlendMode::Additive);
+
+    /**
+     * @brief Sets the particles to draw (not owned).
+     */
+    void SetParticleSystem(ptx::ParticleSystem* system) { particleSystem = system; }
+
+    /**
+     * @brief Gets the particles to draw.
+     */
+    ptx::ParticleSystem* GetParticleSystem() const { return particleSystem; }
+
+    /**
+     * @brief Sets the blend mode.
+     */
+    void SetBlendMode(ParticleBlendMode mode) { blendMode = mode; }
+
+    /**
+     * @brief Gets the blend mode.
+     */
+    ParticleBlendMode GetBlendMode() const { return blendMode; }
+
+    /**
+     * @brief Sets the smallest splat radius in camera units, so small particles still reach sparse pixels.
+     */
+    void SetMinimumRadius(float radius) { minimumRadius = radius > 0.0f ? radius : 0.0f; }
+
+    /**
+     * @brief Gets the smallest splat radius in camera units.
+     */
+    float GetMinimumRadius() const { return minimumRadius; }
+
+    /**
+     * @brief Sets a brightness multiplier applied to every splat.
+     */
+    void SetIntensity(float value) { intensity = value; }
+
+    /**
+     * @brief Rasterizes a scene and splats particles over it in one pass.
+     *
+     * Meshes are drawn by Rasterizer::Rasterize with a depth buffer, then particles
+     * are splatted only where they are in front of the mesh surface.
+     *
+     * @param scene Scene to rasterize (may be null to draw particles only).
+     * @param camera Target camera.
+     */
+    void Render(Scene* scene, CameraBase* camera);
+
+    /**
+     * @brief Splats particles over the camera's current pixel colors.
+     * @param camera Target camera.
+     * @param depthBuffer Per-pixel depth from Rasterizer::Rasterize, or null to ignore occlusion.
+     */
+    void Splat(CameraBase* camera, const float* depthBuffer = nullptr);
+
+    // === Statistics ===
+
+    /**
+     * @brief Number of particles that landed on at least one tile in the last splat.
+     */
+    size_t GetVisibleParticleCount() const { return visibleCount; }
+
+    /**
+     * @brief Number of screen tiles used for the last camera.
+     */
+    size_t GetTileCount() const { return static_cast<size_t>(tilesX) * tilesY; }
+
+private:
+    ptx::ParticleSystem* particleSystem;
+    ParticleBlendMode blendMode;
+    float minimumRadius;
+    float intensity;
+
+    // === Pixel tiles (rebuilt when the camera changes) ===
+    CameraBase* tiledCamera;
+    uint16_t tiledPixelCount;
+    uint16_t tilesX;
+    uint16_t tilesY;
+    Vector2D tileOrigin;
+    Vector2D inverseTileSize;
+    std::vector<uint32_t> tilePixelStarts;   ///< Prefix offsets into tilePixels
+    std::vector<uint16_t> tilePixels;        ///< Pixel indices grouped by tile
+    std::vector<float> pixelX;               ///< Cached pixel coordinates
+    std::vector<float> pixelY;
+
+    // === Projected particles (rebuilt every splat) ===
+    std::vector<float> screenX;
+    std::vector<float> screenY;
+    std::vector<float> depth;
+    std::vector<float> radius;
+    std::vector<float> colorR;
+    std::vector<float> colorG;
+    std::vector<float> colorB;
+    std::vector<float> alpha;
+    std::vector<uint32_t> tileParticleStarts;   ///< Prefix offsets into tileParticles
+    std::vector<uint32_t> tileParticleCursors;  ///< Counting-sort write cursors
+    std::vector<uint32_t> tileParticles;        ///< Particle indices grouped by tile
+    size_t visibleCount;
+
+    std::vector<float> depthScratch;            ///< Depth buffer used by Render
+
+    void BuildPixelTiles(CameraBase* camera);
+    size_t ProjectParticles(CameraBase* camera);
+    void BinParticles(size_t count);
+    void ShadeTile(size_t tile, IPixelGroup* pixelGroup, const float* depthBuffer);
+    bool TileRange(float x, float y, float r, int& x0, int& y0, int& x1, int& y1) const;
+
+    PTX_BEGIN_FIELDS(ParticleSplatter)
+        PTX_FIELD(ParticleSplatter, minimumRadius, "Minimum radius", 0, 0),
+        PTX_FIELD(ParticleSplatter, intensity, "Intensity", 0, 0)
+    PTX_END_FIELDS
+
+    PTX_BEGIN_METHODS(ParticleSplatter)
+        PTX_METHOD_AUTO(ParticleSplatter, SetMinimumRadius, "Set minimum radius"),
+        PTX_METHOD_AUTO(ParticleSplatter, GetMinimumRadius, "Get minimum radius"),
+        PTX_METHOD_AUTO(ParticleSplatter, SetIntensity, "Set intensity"),
+        PTX_METHOD_AUTO(ParticleSplatter, Render, "Render"),
+        PTX_METHOD_AUTO(ParticleSplatter, GetVisibleParticleCount, "Get visible particle count"),
+        PTX_METHOD_AUTO(ParticleSplatter, GetTileCount, "Get tile count")
+    PTX_END_METHODS
+
+    PTX_BEGIN_DESCRIBE(ParticleSplatter)
+        PTX_CTOR0(ParticleSplatter)
+    PTX_END_DESCRIBE(ParticleSplatter)
+};
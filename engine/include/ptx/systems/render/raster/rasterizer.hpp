@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <vector>
 #include "../../scene/scene.hpp"
 #include "../../../core/geometry/spatial/quadtree.hpp"
 #include "../core/camerabase.hpp"
@@ -31,11 +32,54 @@ private:
      * @param candidate_triangles A C-style array of pointers to candidate 2D raster triangles.
      * @param count The number of triangles in the candidates array.
      * @param pixel_coord The 2D coordinate of the pixel being rendered.
+     * @param depth [out] Camera-space depth of the visible triangle, or FLT_MAX if none.
      * @return The calculated RGBColor for the pixel. Returns black if no intersection.
      */
-    static RGBColor RasterizePixel(RasterTriangle2D** candidate_triangles, unsigned short count, const Vector2D& pixel_coord);
+    static RGBColor RasterizePixel(RasterTriangle2D** candidate_triangles, unsigned short count, const Vector2D& pixel_coord, float& depth);
 
 public:
+    /**
+     * @brief Mesh counts from one Rasterize() call.
+     *
+     * Only enabled meshes with geometry are counted. A mesh is culled when its world-space
+     * bounds project entirely outside the camera's pixel extent.
+     */
+    struct Stats {
+        uint32_t meshesDrawn = 0;  ///< Meshes whose triangles were set up and binned.
+        uint32_t meshesCulled = 0; ///< Meshes rejected before any triangle work.
+    };
+
+    /**
+     * @brief Reusable per-camera working memory for Rasterize().
+     *
+     * Keeping one Scratch per camera lets repeated renders reuse their triangle storage,
+     * and lets different cameras render concurrently without sharing buffers.
+     *
+     * The screen arrays are a post-transform vertex cache: every mesh vertex is projected
+     * once per render into these flat arrays, meshes laid out back to back, and triangle
+     * setup reads its corners from them by index.
+     */
+    struct Scratch {
+        std::vector<RasterTriangle2D> triangles; ///< Projected triangles for the current render.
+        std::vector<Vector3D> normals;           ///< Triangle normals referenced by `triangles`.
+        std::vector<float> screenX;              ///< Projected X per cached vertex.
+        std::vector<float> screenY;              ///< Projected Y per cached vertex.
+        std::vector<float> screenDepth;          ///< Camera-space depth per cached vertex.
+        std::vector<uint8_t> meshVisible;        ///< Per scene mesh, non-zero if it survived culling.
+        Stats stats;                             ///< Mesh counts from the last render.
+    };
+
+    /**
+     * @brief Applies per-frame camera setup that writes camera state.
+     *
+     * Sets the camera transform's base rotation from its layout and fills the camera's
+     * cached coordinate bounds. Rasterize() with a Scratch never writes the camera, so
+     * parallel renders call this for every camera first, on one thread.
+     *
+     * @param camera The camera to prepare (may be null).
+     */
+    static void PrepareCamera(CameraBase* camera);
+
     /**
      * @brief Renders an entire scene from the perspective of a given camera.
      * @param scene The scene containing meshes and materials.
@@ -43,12 +87,40 @@ public:
      */
     static void Rasterize(Scene* scene, CameraBase* camera);
 
+    /**
+     * @brief Renders a scene and records the depth of the visible surface per pixel.
+     *
+     * Depth is the camera-space Z used for visibility (smaller is closer); pixels
+     * with no surface get FLT_MAX. Used to composite particles over meshes.
+     *
+     * @param scene The scene containing meshes and materials.
+     * @param camera The camera defining the viewpoint and projection.
+     * @param depthBuffer Output with one float per camera pixel (may be null).
+     */
+    static void Rasterize(Scene* scene, CameraBase* camera, float* depthBuffer);
+
+    /**
+     * @brief Renders a scene into a camera using caller-owned scratch memory.
+     *
+     * Reads the scene and camera without modifying them and writes only the camera's
+     * pixel colors and @p depthBuffer, so distinct cameras with distinct pixel groups
+     * may render concurrently. Call PrepareCamera() beforehand to apply layout changes.
+     * Meshes whose Mesh::GetWorldBounds() fall outside the camera are skipped; the
+     * counts are left in the scratch's stats.
+     *
+     * @param scene The scene containing meshes and materials.
+     * @param camera The camera defining the viewpoint and projection.
+     * @param depthBuffer Output with one float per camera pixel (may be null).
+     * @param scratch Working memory reused across calls (may be null for a temporary).
+     */
+    static void Rasterize(Scene* scene, CameraBase* camera, float* depthBuffer, Scratch* scratch);
+
     PTX_BEGIN_FIELDS(Rasterizer)
         /* No reflected fields. */
     PTX_END_FIELDS
 
     PTX_BEGIN_METHODS(Rasterizer)
-        PTX_SMETHOD_AUTO(Rasterizer::Rasterize, "Rasterize")
+        /* Rasterize */ PTX_SMETHOD_OVLD(Rasterizer, Rasterize, void, Scene*, CameraBase*)
     PTX_END_METHODS
 
     PTX_BEGIN_DESCRIBE(Rasterizer)
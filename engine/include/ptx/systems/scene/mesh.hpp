@@ -33,6 +33,10 @@ private:
     ITriangleGroup* modifiedTriangles;       ///< Pointer to the modifiable representation of the object's geometry.
     IMaterial* material;                      ///< Pointer to the material assigned to the object.
     bool enabled = true;                     ///< Indicates whether the object is currently enabled.
+    Vector3D boundsMinimum;                  ///< World-space minimum of the vertices after the last UpdateTransform().
+    Vector3D boundsMaximum;                  ///< World-space maximum of the vertices after the last UpdateTransform().
+    bool boundsValid = false;                ///< True once bounds were computed for boundsVersion.
+    uint32_t boundsVersion = 0;              ///< Vertex version of modifiedTriangles the bounds were computed from.
 
 public:
     /**
@@ -123,9 +127,32 @@ public:
 
     /**
      * @brief Updates the object's geometry based on its transformation data.
+     *
+     * Also refreshes the world-space bounds in the same pass over the vertices.
      */
     void UpdateTransform();
 
+    /**
+     * @brief Recomputes the world-space bounds from the current vertices.
+     *
+     * Vertices edited in place invalidate the bounds through ITriangleGroup::MarkVerticesChanged();
+     * call this afterwards to make them usable for culling again.
+     */
+    void UpdateBounds();
+
+    /**
+     * @brief Retrieves the world-space bounding box of the vertices.
+     *
+     * Bounds are set by UpdateTransform() or UpdateBounds() and become unknown as soon as the
+     * vertices change again (ResetVertices(), deformers, blendshapes, MeshAlign), so stale
+     * bounds are never reported.
+     *
+     * @param minimum Receives the minimum corner.
+     * @param maximum Receives the maximum corner.
+     * @return True if the bounds are known, false if they must be treated as unbounded.
+     */
+    bool GetWorldBounds(Vector3D& minimum, Vector3D& maximum) const;
+
     /**
      * @brief Retrieves the modifiable geometry of the object.
      * @return Pointer to the `ITriangleGroup` representing the object's modifiable geometry.
@@ -163,6 +190,8 @@ public:
         PTX_METHOD_AUTO(Mesh, SetTransform, "Set transform"),
         PTX_METHOD_AUTO(Mesh, ResetVertices, "Reset vertices"),
         PTX_METHOD_AUTO(Mesh, UpdateTransform, "Update transform"),
+        PTX_METHOD_AUTO(Mesh, UpdateBounds, "Update bounds"),
+        PTX_METHOD_AUTO(Mesh, GetWorldBounds, "Get world bounds"),
         PTX_METHOD_AUTO(Mesh, GetTriangleGroup, "Get triangle group"),
         PTX_METHOD_AUTO(Mesh, GetMaterial, "Get material"),
         PTX_METHOD_AUTO(Mesh, SetMaterial, "Set material")
@@ -1,7 +1,7 @@
 #include <ptx/assets/model/statictrianglegroup.hpp>
 
 StaticTriangleGroup::StaticTriangleGroup(Vector3D* vertices, const IndexGroup* indexGroup, int vertexCount, int triangleCount)
-    : triangles(nullptr), vertices(vertices), indexGroup(indexGroup), uvIndexGroup(nullptr), uvVertices(nullptr), hasUV(false), vertexCount(vertexCount), triangleCount(triangleCount) {
+    : triangles(triangleCount > 0 ? triangleCount : 0), vertices(vertices), indexGroup(indexGroup), uvIndexGroup(nullptr), uvVertices(nullptr), hasUV(false), vertexCount(vertexCount), triangleCount(triangleCount) {
 
     for (int i = 0; i < triangleCount; i++) {
         triangles[i].p1 = &vertices[indexGroup[i].A];
@@ -11,7 +11,7 @@ StaticTriangleGroup::StaticTriangleGroup(Vector3D* vertices, const IndexGroup* i
 }
 
 StaticTriangleGroup::StaticTriangleGroup(Vector3D* vertices, const IndexGroup* indexGroup, const IndexGroup* uvIndexGroup, const Vector2D* uvVertices, int vertexCount, int triangleCount)
-    : triangles(nullptr), vertices(vertices), indexGroup(indexGroup), uvIndexGroup(uvIndexGroup), uvVertices(uvVertices), hasUV(true), vertexCount(vertexCount), triangleCount(triangleCount) {
+    : triangles(triangleCount > 0 ? triangleCount : 0), vertices(vertices), indexGroup(indexGroup), uvIndexGroup(uvIndexGroup), uvVertices(uvVertices), hasUV(true), vertexCount(vertexCount), triangleCount(triangleCount) {
 
     for (int i = 0; i < triangleCount; i++) {
         triangles[i].p1 = &vertices[indexGroup[i].A];
@@ -41,7 +41,7 @@ int StaticTriangleGroup::GetVertexCount() {
 }
 
 Triangle3D* StaticTriangleGroup::GetTriangles() {
-    return triangles;
+    return triangles.empty() ? nullptr : triangles.data();
 }
 
 const Vector2D* StaticTriangleGroup::GetUVVertices() {
@@ -29,16 +29,16 @@ void QuadTree::Node::CreateChildren() {
     const Vector2D min = bounds.GetMinimum();
     const Vector2D max = bounds.GetMaximum();
 
-    children[0] = std::make_unique<Node>(Rectangle2D(min, center), overlaps, static_cast<unsigned char>(depth + 1));
+    children[0] = std::make_unique<Node>(Rectangle2D(Shape::Bounds{min, center}), overlaps, static_cast<unsigned char>(depth + 1));
     children[1] = std::make_unique<Node>(
-        Rectangle2D(Vector2D(center.X, min.Y), Vector2D(max.X, center.Y)),
+        Rectangle2D(Shape::Bounds{Vector2D(center.X, min.Y), Vector2D(max.X, center.Y)}),
         overlaps,
         static_cast<unsigned char>(depth + 1));
     children[2] = std::make_unique<Node>(
-        Rectangle2D(Vector2D(min.X, center.Y), Vector2D(center.X, max.Y)),
+        Rectangle2D(Shape::Bounds{Vector2D(min.X, center.Y), Vector2D(center.X, max.Y)}),
         overlaps,
         static_cast<unsigned char>(depth + 1));
-    children[3] = std::make_unique<Node>(Rectangle2D(center, max), overlaps, static_cast<unsigned char>(depth + 1));
+    children[3] = std::make_unique<Node>(Rectangle2D(Shape::Bounds{center, max}), overlaps, static_cast<unsigned char>(depth + 1));
 }
 
 unsigned short QuadTree::Node::Distribute() {
@@ -0,0 +1,201 @@
+#include <ptx/core/platform/threadpool.hpp>
+
+#include <algorithm>
+
+#if !defined(ARDUINO)
+    #include <atomic>
+    #include <exception>
+    #include <memory>
+#endif
+
+namespace ptx {
+
+#if defined(ARDUINO)
+
+ThreadPool::ThreadPool(size_t workerCount) {
+    (void)workerCount;
+}
+
+ThreadPool::~ThreadPool() = default;
+
+ThreadPool& ThreadPool::Shared() {
+    static ThreadPool pool(0);
+    return pool;
+}
+
+size_t ThreadPool::GetWorkerCount() const {
+    return 0;
+}
+
+void ThreadPool::Submit(Task task) {
+    if (task) {
+        task();
+    }
+}
+
+void ThreadPool::ParallelFor(size_t count, size_t grainSize, const RangeFunction& body) {
+    const size_t grain = std::max<size_t>(1, grainSize);
+    for (size_t begin = 0; begin < count; begin += grain) {
+        body(begin, std::min(count, begin + grain));
+    }
+}
+
+void ThreadPool::WaitIdle() {}
+
+#else
+
+ThreadPool::ThreadPool(size_t workerCount) {
+    if (workerCount == 0) {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? static_cast<size_t>(hardware - 1) : 0;
+    }
+
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+ThreadPool& ThreadPool::Shared() {
+    static ThreadPool pool(0);
+    return pool;
+}
+
+size_t ThreadPool::GetWorkerCount() const {
+    return workers.size();
+}
+
+void ThreadPool::Submit(Task task) {
+    if (!task) return;
+
+    if (workers.empty()) {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+void ThreadPool::WorkerLoop() {
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskAvailable.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+            if (tasks.empty()) {
+                return; // stopping and drained
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            ++activeTasks;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --activeTasks;
+            if (activeTasks == 0 && tasks.empty()) {
+                idle.notify_all();
+            }
+        }
+    }
+}
+
+void ThreadPool::WaitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return activeTasks == 0 && tasks.empty(); });
+}
+
+void ThreadPool::ParallelFor(size_t count, size_t grainSize, const RangeFunction& body) {
+    if (count == 0) return;
+
+    const size_t grain = std::max<size_t>(1, grainSize);
+    const size_t chunkCount = (count + grain - 1) / grain;
+
+    if (workers.empty() || chunkCount == 1) {
+        for (size_t begin = 0; begin < count; begin += grain) {
+            body(begin, std::min(count, begin + grain));
+        }
+        return;
+    }
+
+    // Shared state outlives this call so helpers that start late can exit safely.
+    struct Batch {
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> doneChunks{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr error;
+        RangeFunction body;
+        size_t count = 0;
+        size_t grain = 1;
+        size_t chunkCount = 0;
+    };
+
+    auto batch = std::make_shared<Batch>();
+    batch->body = body;
+    batch->count = count;
+    batch->grain = grain;
+    batch->chunkCount = chunkCount;
+
+    auto drain = [](const std::shared_ptr<Batch>& b) {
+        for (;;) {
+            const size_t chunk = b->nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= b->chunkCount) return;
+
+            const size_t begin = chunk * b->grain;
+            try {
+                b->body(begin, std::min(b->count, begin + b->grain));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(b->mutex);
+                if (!b->error) b->error = std::current_exception();
+            }
+
+            if (b->doneChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == b->chunkCount) {
+                std::lock_guard<std::mutex> lock(b->mutex);
+                b->finished.notify_all();
+            }
+        }
+    };
+
+    const size_t helpers = std::min(workers.size(), chunkCount - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        Submit([batch, drain]() { drain(batch); });
+    }
+
+    drain(batch);
+
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->finished.wait(lock, [&]() {
+        return batch->doneChunks.load(std::memory_order_acquire) == batch->chunkCount;
+    });
+
+    if (batch->error) {
+        std::rethrow_exception(batch->error);
+    }
+}
+
+#endif
+
+} // namespace ptx
@@ -0,0 +1,177 @@
+#include <ptx/core/signal/audioanalyzer.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#if !defined(ARDUINO)
+    #include <chrono>
+#endif
+
+namespace {
+
+/** @brief Snapshot with every vector sized, so publishing never allocates. */
+AudioAnalysis MakeSnapshot(size_t bandCount) {
+    AudioAnalysis analysis;
+    analysis.bands.assign(bandCount, 0.0f);
+    analysis.peaks.assign(bandCount, 0);
+    return analysis;
+}
+
+}  // namespace
+
+AudioAnalyzer::AudioAnalyzer(float sampleRate, int frameSize, int hopSize, size_t bandCount, float minFrequency)
+    : sampleRate(sampleRate > 0.0f ? sampleRate : 48000.0f),
+      bandCount(std::max<size_t>(1, bandCount)),
+      stft(frameSize, hopSize, STFT::Window::Hann),
+      peakDetection(this->bandCount, 16, 2.5f, 0.25f),
+      ring(static_cast<size_t>(frameSize) * 8),
+      snapshots(MakeSnapshot(this->bandCount)),
+      bandEdges(this->bandCount + 1),
+      rawBands(this->bandCount, 0.0f),
+      smoothedBands(this->bandCount, 0.0f),
+      bandPeaks(this->bandCount, 0),
+      scratch(static_cast<size_t>(hopSize)) {
+    const size_t binCount = static_cast<size_t>(stft.GetBinCount());
+    const float binWidth = this->sampleRate / static_cast<float>(frameSize);
+    const float nyquist = this->sampleRate * 0.5f;
+    const float lowest = std::min(std::max(minFrequency, binWidth), nyquist);
+
+    // Log-spaced band edges, each band at least one bin wide until the bins run out.
+    for (size_t b = 0; b <= this->bandCount; ++b) {
+        const float t = static_cast<float>(b) / static_cast<float>(this->bandCount);
+        const float frequency = lowest * std::pow(nyquist / lowest, t);
+        size_t edge = static_cast<size_t>(std::lround(frequency / binWidth));
+        if (b > 0) edge = std::max(edge, bandEdges[b - 1] + 1);
+        bandEdges[b] = std::min(edge, binCount);
+    }
+
+    float windowSum = 0.0f;
+    for (int n = 0; n < frameSize; ++n) {
+        windowSum += stft.GetWindow()[n];
+    }
+    magnitudeScale = windowSum > 0.0f ? 2.0f / windowSum : 0.0f;
+}
+
+AudioAnalyzer::~AudioAnalyzer() {
+    Stop();
+}
+
+size_t AudioAnalyzer::PushSamples(const float* samples, size_t count) {
+    if (!samples || count == 0) return 0;
+
+    const size_t written = ring.Write(samples, count);
+    if (written < count) {
+        dropped.fetch_add(count - written, std::memory_order_relaxed);
+    }
+    return written;
+}
+
+size_t AudioAnalyzer::ProcessPending() {
+    size_t frames = 0;
+
+    for (;;) {
+        const size_t count = ring.Read(scratch.data(), scratch.size());
+        if (count == 0) break;
+
+        size_t position = 0;
+        while (position < count) {
+            position += stft.Push(scratch.data() + position, count - position);
+            if (stft.HasFrame()) {
+                AnalyzeFrame();
+                ++frames;
+            }
+        }
+    }
+
+    return frames;
+}
+
+void AudioAnalyzer::AnalyzeFrame() {
+    const float* magnitudes = stft.GetMagnitudes();
+    const size_t binCount = static_cast<size_t>(stft.GetBinCount());
+    const float range = std::max(dynamicRange.load(std::memory_order_relaxed), 1.0f);
+    const float rise = attack.load(std::memory_order_relaxed);
+    const float fall = release.load(std::memory_order_relaxed);
+
+    for (size_t b = 0; b < bandCount; ++b) {
+        const size_t lo = std::min(bandEdges[b], binCount - 1);
+        const size_t hi = std::min(std::max(bandEdges[b + 1], lo + 1), binCount);
+
+        float peak = 0.0f;
+        for (size_t k = lo; k < hi; ++k) {
+            peak = std::max(peak, magnitudes[k]);
+        }
+
+        // Full-scale sine reads 0 dB; the dynamic range below that maps onto [0, 1].
+        const float amplitude = peak * magnitudeScale;
+        const float decibels = 20.0f * std::log10(std::max(amplitude, 1e-9f));
+        rawBands[b] = std::min(std::max(1.0f + decibels / range, 0.0f), 1.0f);
+
+        const float delta = rawBands[b] - smoothedBands[b];
+        smoothedBands[b] += delta * (delta > 0.0f ? rise : fall);
+    }
+
+    peakDetection.CalculateChannels(rawBands.data(), bandPeaks);
+    ++frameCount;
+
+    AudioAnalysis& out = snapshots.GetWriteBuffer();
+    out.bands.assign(smoothedBands.begin(), smoothedBands.end());
+    out.peaks.assign(bandPeaks.begin(), bandPeaks.end());
+    out.frame = frameCount;
+    snapshots.Publish();
+}
+
+const AudioAnalysis& AudioAnalyzer::Acquire() {
+    snapshots.Acquire();
+    return snapshots.GetReadBuffer();
+}
+
+void AudioAnalyzer::SetSmoothing(float attackValue, float releaseValue) {
+    attack.store(std::min(std::max(attackValue, 0.001f), 1.0f), std::memory_order_relaxed);
+    release.store(std::min(std::max(releaseValue, 0.001f), 1.0f), std::memory_order_relaxed);
+}
+
+void AudioAnalyzer::SetDynamicRange(float decibels) {
+    dynamicRange.store(std::max(decibels, 1.0f), std::memory_order_relaxed);
+}
+
+#if defined(ARDUINO)
+
+bool AudioAnalyzer::Start() {
+    return false;
+}
+
+void AudioAnalyzer::Stop() {}
+
+#else
+
+bool AudioAnalyzer::Start() {
+    if (running.exchange(true, std::memory_order_acq_rel)) {
+        return true;
+    }
+    worker = std::thread([this]() { Run(); });
+    return true;
+}
+
+void AudioAnalyzer::Stop() {
+    running.store(false, std::memory_order_release);
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void AudioAnalyzer::Run() {
+    // Poll at a quarter hop so a new frame waits at most that long; the capture side
+    // never signals, which keeps PushSamples() free of locks and syscalls.
+    const double hopSeconds = static_cast<double>(stft.GetHopSize()) / static_cast<double>(sampleRate);
+    const auto idle = std::chrono::microseconds(
+        std::min<long long>(5000, std::max<long long>(100, static_cast<long long>(hopSeconds * 250000.0))));
+
+    while (running.load(std::memory_order_acquire)) {
+        if (ProcessPending() == 0) {
+            std::this_thread::sleep_for(idle);
+        }
+    }
+}
+
+#endif
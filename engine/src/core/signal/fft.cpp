@@ -7,10 +7,195 @@
 #include <stdexcept>
 #include <unordered_map>
 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
 namespace {
 
 constexpr float kTwoPi = 6.28318530717958647692f;
 
+// First stage on its own (log2(size) odd): adjacent pairs, unit twiddle.
+void Radix2Pass(float* data, int size) {
+    for (int i = 0; i < 2 * size; i += 4) {
+        const float r0 = data[i];
+        const float i0 = data[i + 1];
+        const float r1 = data[i + 2];
+        const float i1 = data[i + 3];
+
+        data[i]     = r0 + r1;
+        data[i + 1] = i0 + i1;
+        data[i + 2] = r0 - r1;
+        data[i + 3] = i0 - i1;
+    }
+}
+
+// Two radix-2 stages (half-widths h and 2h) on the four points p[0], p[s], p[2s], p[3s].
+// direction is -1 for the forward transform and +1 for the inverse.
+inline void Butterfly4(float* p, int s, float w1r, float w1i, float w2r, float w2i, float direction) {
+    float* p0 = p;
+    float* p1 = p + s;
+    float* p2 = p + 2 * s;
+    float* p3 = p + 3 * s;
+
+    const float t1r = w1r * p1[0] - w1i * p1[1];
+    const float t1i = w1r * p1[1] + w1i * p1[0];
+    const float t3r = w1r * p3[0] - w1i * p3[1];
+    const float t3i = w1r * p3[1] + w1i * p3[0];
+
+    const float b0r = p0[0] + t1r, b0i = p0[1] + t1i;
+    const float b1r = p0[0] - t1r, b1i = p0[1] - t1i;
+    const float b2r = p2[0] + t3r, b2i = p2[1] + t3i;
+    const float b3r = p2[0] - t3r, b3i = p2[1] - t3i;
+
+    const float u2r = w2r * b2r - w2i * b2i;
+    const float u2i = w2r * b2i + w2i * b2r;
+
+    // The second stage's odd half carries an extra quarter turn (-i forward, +i inverse).
+    const float vr = w2r * b3r - w2i * b3i;
+    const float vi = w2r * b3i + w2i * b3r;
+    const float u3r = -direction * vi;
+    const float u3i = direction * vr;
+
+    p0[0] = b0r + u2r; p0[1] = b0i + u2i;
+    p2[0] = b0r - u2r; p2[1] = b0i - u2i;
+    p1[0] = b1r + u3r; p1[1] = b1i + u3i;
+    p3[0] = b1r - u3r; p3[1] = b1i - u3i;
+}
+
+#if defined(__SSE2__)
+    #define FFT_SIMD 1
+using Lane = __m128;
+
+inline Lane Splat(float v) { return _mm_set1_ps(v); }
+inline Lane Load(const float* p) { return _mm_loadu_ps(p); }
+inline Lane Add(Lane a, Lane b) { return _mm_add_ps(a, b); }
+inline Lane Sub(Lane a, Lane b) { return _mm_sub_ps(a, b); }
+inline Lane Mul(Lane a, Lane b) { return _mm_mul_ps(a, b); }
+
+// Four interleaved complex values -> separate re and im lanes, and back.
+inline void LoadComplex(const float* p, Lane& re, Lane& im) {
+    const Lane lo = _mm_loadu_ps(p);
+    const Lane hi = _mm_loadu_ps(p + 4);
+    re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+    im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+inline void StoreComplex(float* p, Lane re, Lane im) {
+    _mm_storeu_ps(p, _mm_unpacklo_ps(re, im));
+    _mm_storeu_ps(p + 4, _mm_unpackhi_ps(re, im));
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define FFT_SIMD 1
+using Lane = float32x4_t;
+
+inline Lane Splat(float v) { return vdupq_n_f32(v); }
+inline Lane Load(const float* p) { return vld1q_f32(p); }
+inline Lane Add(Lane a, Lane b) { return vaddq_f32(a, b); }
+inline Lane Sub(Lane a, Lane b) { return vsubq_f32(a, b); }
+inline Lane Mul(Lane a, Lane b) { return vmulq_f32(a, b); }
+
+inline void LoadComplex(const float* p, Lane& re, Lane& im) {
+    const float32x4x2_t v = vld2q_f32(p);
+    re = v.val[0];
+    im = v.val[1];
+}
+
+inline void StoreComplex(float* p, Lane re, Lane im) {
+    float32x4x2_t v;
+    v.val[0] = re;
+    v.val[1] = im;
+    vst2q_f32(p, v);
+}
+#endif
+
+#if defined(FFT_SIMD)
+// Butterfly4 for four consecutive j at once; twiddles are read from the split re/im runs.
+inline void Butterfly4x4(float* p, int s, const float* w1r, const float* w1i, const float* w2r,
+                         const float* w2i, Lane direction) {
+    const Lane c1 = Load(w1r), s1 = Mul(direction, Load(w1i));
+    const Lane c2 = Load(w2r), s2 = Mul(direction, Load(w2i));
+
+    Lane a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+    LoadComplex(p, a0r, a0i);
+    LoadComplex(p + s, a1r, a1i);
+    LoadComplex(p + 2 * s, a2r, a2i);
+    LoadComplex(p + 3 * s, a3r, a3i);
+
+    const Lane t1r = Sub(Mul(c1, a1r), Mul(s1, a1i));
+    const Lane t1i = Add(Mul(c1, a1i), Mul(s1, a1r));
+    const Lane t3r = Sub(Mul(c1, a3r), Mul(s1, a3i));
+    const Lane t3i = Add(Mul(c1, a3i), Mul(s1, a3r));
+
+    const Lane b0r = Add(a0r, t1r), b0i = Add(a0i, t1i);
+    const Lane b1r = Sub(a0r, t1r), b1i = Sub(a0i, t1i);
+    const Lane b2r = Add(a2r, t3r), b2i = Add(a2i, t3i);
+    const Lane b3r = Sub(a2r, t3r), b3i = Sub(a2i, t3i);
+
+    const Lane u2r = Sub(Mul(c2, b2r), Mul(s2, b2i));
+    const Lane u2i = Add(Mul(c2, b2i), Mul(s2, b2r));
+
+    const Lane vr = Sub(Mul(c2, b3r), Mul(s2, b3i));
+    const Lane vi = Add(Mul(c2, b3i), Mul(s2, b3r));
+    const Lane u3r = Mul(Sub(Splat(0.0f), direction), vi);
+    const Lane u3i = Mul(direction, vr);
+
+    StoreComplex(p, Add(b0r, u2r), Add(b0i, u2i));
+    StoreComplex(p + 2 * s, Sub(b0r, u2r), Sub(b0i, u2i));
+    StoreComplex(p + s, Add(b1r, u3r), Add(b1i, u3i));
+    StoreComplex(p + 3 * s, Sub(b1r, u3r), Sub(b1i, u3i));
+}
+#endif
+
+// One radix-4 pass over blocks of 4h points. Twiddle layout: W_2h re/im, then W_4h re/im, h each.
+void Radix4Pass(float* data, int size, int h, const float* twiddles, float direction) {
+    const float* w1r = twiddles;
+    const float* w1i = twiddles + h;
+    const float* w2r = twiddles + 2 * h;
+    const float* w2i = twiddles + 3 * h;
+    const int stride = 2 * h;
+
+    for (int k = 0; k < size; k += 4 * h) {
+        int j = 0;
+#if defined(FFT_SIMD)
+        const Lane directionLane = Splat(direction);
+        for (; j + 4 <= h; j += 4) {
+            Butterfly4x4(data + 2 * (k + j), stride, w1r + j, w1i + j, w2r + j, w2i + j, directionLane);
+        }
+#endif
+        for (; j < h; ++j) {
+            Butterfly4(data + 2 * (k + j), stride, w1r[j], direction * w1i[j], w2r[j], direction * w2i[j],
+                       direction);
+        }
+    }
+}
+
+// Bin k of a real transform from packed bins Z[k] = (a, b) and Z[half - k] = (c, d).
+inline void Untangle(float a, float b, float c, float d, float cs, float sn, float* out) {
+    const float evenR = 0.5f * (a + c);
+    const float evenI = 0.5f * (b - d);
+    const float oddR = 0.5f * (b + d);
+    const float oddI = 0.5f * (c - a);
+
+    out[0] = evenR + cs * oddR + sn * oddI;
+    out[1] = evenI + cs * oddI - sn * oddR;
+}
+
+// Inverse of Untangle: packed bin Z[k] from real-spectrum bins X[k] = (a, b) and X[half - k] = (c, d).
+inline void Retangle(float a, float b, float c, float d, float cs, float sn, float gain, float* out) {
+    const float evenR = a + c;
+    const float evenI = b - d;
+    const float diffR = a - c;
+    const float diffI = b + d;
+    const float oddR = diffR * cs - diffI * sn;
+    const float oddI = diffR * sn + diffI * cs;
+
+    out[0] = gain * (evenR - oddI);
+    out[1] = gain * (evenI + oddR);
+}
+
 }  // namespace
 
 FFT& FFT::Instance(int fftSize) {
@@ -52,87 +237,96 @@ void FFT::Forward(float* data) const {
     }
 
     EnsureTables();
-    BitReverseOrder(data);
-
-    const float* cosTable = cosTable_.data();
-    const float* sinTable = sinTable_.data();
-
-    for (int m = 2; m <= size_; m <<= 1) {
-        const int m2 = m >> 1;
-        const int step = size_ / m;
-
-        for (int k = 0; k < size_; k += m) {
-            for (int j = 0; j < m2; ++j) {
-                const int tw = j * step;
-                const float wr = cosTable[tw];
-                const float wi = -sinTable[tw];
-
-                const int i0 = k + j;
-                const int i1 = i0 + m2;
+    Transform(data, -1.0f);
+}
 
-                const float r0 = data[2 * i0];
-                const float i0i = data[2 * i0 + 1];
-                const float r1 = data[2 * i1];
-                const float i1i = data[2 * i1 + 1];
+void FFT::Inverse(float* data, bool scale) const {
+    if (!data) {
+        return;
+    }
 
-                const float tr = wr * r1 - wi * i1i;
-                const float ti = wr * i1i + wi * r1;
+    EnsureTables();
+    Transform(data, 1.0f);
 
-                data[2 * i1]     = r0 - tr;
-                data[2 * i1 + 1] = i0i - ti;
-                data[2 * i0]     = r0 + tr;
-                data[2 * i0 + 1] = i0i + ti;
-            }
+    if (scale) {
+        const float invN = 1.0f / static_cast<float>(size_);
+        for (int i = 0; i < size_; ++i) {
+            data[2 * i]     *= invN;
+            data[2 * i + 1] *= invN;
         }
     }
 }
 
-void FFT::Inverse(float* data, bool scale) const {
-    if (!data) {
+void FFT::ForwardReal(const float* input, float* spectrum) const {
+    if (!input || !spectrum) {
         return;
     }
 
     EnsureTables();
-    BitReverseOrder(data);
+
+    // Even samples become the real parts and odd samples the imaginary parts of a half-size signal.
+    const int half = size_ / 2;
+    std::copy(input, input + size_, spectrum);
+    if (half_) {
+        half_->Forward(spectrum);
+    }
 
     const float* cosTable = cosTable_.data();
     const float* sinTable = sinTable_.data();
 
-    for (int m = 2; m <= size_; m <<= 1) {
-        const int m2 = m >> 1;
-        const int step = size_ / m;
+    // Bins k and half - k are built from the same pair of packed bins, so both are done together.
+    for (int k = 1; k <= half / 2; ++k) {
+        const int mirror = half - k;
+        const float a = spectrum[2 * k];
+        const float b = spectrum[2 * k + 1];
+        const float c = spectrum[2 * mirror];
+        const float d = spectrum[2 * mirror + 1];
 
-        for (int k = 0; k < size_; k += m) {
-            for (int j = 0; j < m2; ++j) {
-                const int tw = j * step;
-                const float wr = cosTable[tw];
-                const float wi = sinTable[tw];
+        Untangle(a, b, c, d, cosTable[k], sinTable[k], spectrum + 2 * k);
+        Untangle(c, d, a, b, cosTable[mirror], sinTable[mirror], spectrum + 2 * mirror);
+    }
 
-                const int i0 = k + j;
-                const int i1 = i0 + m2;
+    const float z0r = spectrum[0];
+    const float z0i = spectrum[1];
+    spectrum[0] = z0r + z0i;
+    spectrum[1] = 0.0f;
+    spectrum[2 * half] = z0r - z0i;
+    spectrum[2 * half + 1] = 0.0f;
+}
 
-                const float r0 = data[2 * i0];
-                const float i0i = data[2 * i0 + 1];
-                const float r1 = data[2 * i1];
-                const float i1i = data[2 * i1 + 1];
+void FFT::InverseReal(const float* spectrum, float* output, bool scale) const {
+    if (!spectrum || !output) {
+        return;
+    }
 
-                const float tr = wr * r1 - wi * i1i;
-                const float ti = wr * i1i + wi * r1;
+    EnsureTables();
 
-                data[2 * i1]     = r0 - tr;
-                data[2 * i1 + 1] = i0i - ti;
-                data[2 * i0]     = r0 + tr;
-                data[2 * i0 + 1] = i0i + ti;
-            }
-        }
+    // The half-size inverse runs unscaled; the factor is folded into the repacking instead.
+    const int half = size_ / 2;
+    const float gain = 0.5f * (scale ? 1.0f / static_cast<float>(half) : 2.0f);
+
+    const float* cosTable = cosTable_.data();
+    const float* sinTable = sinTable_.data();
+
+    const float first = spectrum[0];
+    const float last = spectrum[2 * half];
+
+    for (int k = 1; k <= half / 2; ++k) {
+        const int mirror = half - k;
+        const float a = spectrum[2 * k];
+        const float b = spectrum[2 * k + 1];
+        const float c = spectrum[2 * mirror];
+        const float d = spectrum[2 * mirror + 1];
+
+        Retangle(a, b, c, d, cosTable[k], sinTable[k], gain, output + 2 * k);
+        Retangle(c, d, a, b, cosTable[mirror], sinTable[mirror], gain, output + 2 * mirror);
     }
 
-    if (scale) {
-        const float invN = 1.0f / static_cast<float>(size_);
-        for (int i = 0; i < size_; ++i) {
-            data[2 * i]     *= invN;
-            data[2 * i + 1] *= invN;
-        }
+    output[0] = gain * (first + last);
+    output[1] = gain * (first - last);
+
+    if (half_) {
+        half_->Inverse(output, false);
     }
 }
 
@@ -148,6 +342,18 @@ void FFT::ComplexMagnitude(const float* complexData, float* magnitude) const {
     }
 }
 
+void FFT::RealMagnitude(const float* spectrum, float* magnitude) const {
+    if (!spectrum || !magnitude) {
+        return;
+    }
+
+    for (int i = 0; i <= size_ / 2; ++i) {
+        const float re = spectrum[2 * i];
+        const float im = spectrum[2 * i + 1];
+        magnitude[i] = std::sqrt(re * re + im * im);
+    }
+}
+
 void FFT::EnsureTables() const {
     std::call_once(tablesInitFlag_, [this]() { InitializeTables(); });
 }
@@ -168,6 +374,36 @@ void FFT::InitializeTables() const {
         }
         bitrevLUT_[static_cast<std::size_t>(i)] = reversed;
     }
+
+    // Radix-4 passes cover stage pairs (2h, 4h); each stores its twiddles split into re/im runs.
+    radix4Twiddles_.clear();
+    for (int h = (bitCount_ & 1) ? 2 : 1; h < size_; h *= 4) {
+        for (int stage = 2; stage <= 4; stage += 2) {
+            const double step = 2.0 * 3.14159265358979323846 / static_cast<double>(stage * h);
+            for (int j = 0; j < h; ++j) radix4Twiddles_.push_back(static_cast<float>(std::cos(step * j)));
+            for (int j = 0; j < h; ++j) radix4Twiddles_.push_back(static_cast<float>(std::sin(step * j)));
+        }
+    }
+
+    if (size_ >= 4) {
+        half_ = &Instance(size_ / 2);
+    }
+}
+
+void FFT::Transform(float* data, float direction) const {
+    BitReverseOrder(data);
+
+    int h = 1;
+    if (bitCount_ & 1) {
+        Radix2Pass(data, size_);
+        h = 2;
+    }
+
+    const float* twiddles = radix4Twiddles_.data();
+    for (; h < size_; h *= 4) {
+        Radix4Pass(data, size_, h, twiddles, direction);
+        twiddles += 4 * h;
+    }
 }
 
 void FFT::BitReverseOrder(float* data) const {
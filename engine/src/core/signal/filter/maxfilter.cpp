@@ -18,52 +18,42 @@ size_t ComputeBlockCount(size_t capacity) {
 MaxFilter::MaxFilter(size_t memory)
     : capacity(std::max<size_t>(1, memory)),
       blockCount(ComputeBlockCount(std::max<size_t>(1, memory))),
-      values(capacity, 0.0f),
+      window(capacity),
       maxValues(blockCount, 0.0f) {
 }
 
 void MaxFilter::Reset() {
-    std::fill(values.begin(), values.end(), 0.0f);
+    window.Reset();
     std::fill(maxValues.begin(), maxValues.end(), 0.0f);
-    currentAmount = 0;
-}
-
-void MaxFilter::ShiftArray(std::vector<float>& arr) {
-    if (arr.empty()) {
-        return;
-    }
-    for (size_t i = 0; i + 1 < arr.size(); ++i) {
-        arr[i] = arr[i + 1];
-    }
-    arr.back() = 0.0f;
+    maxHead = 0;
+    maxSum = 0.0;
 }
 
 float MaxFilter::Filter(float value) {
-    if (capacity == 0) {
-        return value;
-    }
+    const float currentMax = window.Push(value);
 
-    if (currentAmount < capacity) {
-        values[currentAmount++] = value;
-    } else {
-        ShiftArray(values);
-        values.back() = value;
-    }
+    const size_t newest = maxHead == 0 ? blockCount - 1 : maxHead - 1;
+    if (maxValues[newest] != currentMax) {
+        // Overwrite the oldest entry; the ring order matches the old shift-left history.
+        maxSum += static_cast<double>(currentMax) - maxValues[maxHead];
+        maxValues[maxHead] = currentMax;
+        maxHead = maxHead + 1 == blockCount ? 0 : maxHead + 1;
 
-    float currentMax = values[0];
-    for (size_t i = 1; i < currentAmount; ++i) {
-        currentMax = std::max(currentMax, values[i]);
+        // Re-sum once per lap so rounding in the running sum cannot accumulate.
+        if (maxHead == 0) {
+            maxSum = std::accumulate(maxValues.begin(), maxValues.end(), 0.0);
+        }
     }
 
-    if (maxValues.empty()) {
-        return currentMax;
-    }
+    return static_cast<float>(maxSum / static_cast<double>(blockCount));
+}
 
-    if (maxValues.back() != currentMax) {
-        ShiftArray(maxValues);
-        maxValues.back() = currentMax;
+void MaxFilter::FilterBlock(const float* input, float* output, size_t count) {
+    if (!input || !output) {
+        return;
     }
 
-    const float sum = std::accumulate(maxValues.begin(), maxValues.end(), 0.0f);
-    return sum / static_cast<float>(blockCount);
+    for (size_t i = 0; i < count; ++i) {
+        output[i] = Filter(input[i]);
+    }
 }
@@ -18,54 +18,44 @@ size_t ComputeBlockCount(size_t capacity) {
 MinFilter::MinFilter(size_t memory, bool ignoreSameValue)
     : capacity(std::max<size_t>(1, memory)),
       blockCount(ComputeBlockCount(std::max<size_t>(1, memory))),
-      values(capacity, 0.0f),
+      window(capacity),
       minValues(blockCount, 0.0f),
       ignoreSame(ignoreSameValue) {
 }
 
 void MinFilter::Reset() {
-    std::fill(values.begin(), values.end(), 0.0f);
+    window.Reset();
     std::fill(minValues.begin(), minValues.end(), 0.0f);
-    currentAmount = 0;
-}
-
-void MinFilter::ShiftArray(std::vector<float>& arr) {
-    if (arr.empty()) {
-        return;
-    }
-    for (size_t i = 0; i + 1 < arr.size(); ++i) {
-        arr[i] = arr[i + 1];
-    }
-    arr.back() = 0.0f;
+    minHead = 0;
+    minSum = 0.0;
 }
 
 float MinFilter::Filter(float value) {
-    if (capacity == 0) {
-        return value;
-    }
+    const float currentMin = window.Push(value);
 
-    if (currentAmount < capacity) {
-        values[currentAmount++] = value;
-    } else {
-        ShiftArray(values);
-        values.back() = value;
-    }
+    const size_t newest = minHead == 0 ? blockCount - 1 : minHead - 1;
+    const bool valueChanged = minValues[newest] != currentMin;
+    if (valueChanged || !ignoreSame) {
+        // Overwrite the oldest entry; the ring order matches the old shift-left history.
+        minSum += static_cast<double>(currentMin) - minValues[minHead];
+        minValues[minHead] = currentMin;
+        minHead = minHead + 1 == blockCount ? 0 : minHead + 1;
 
-    float currentMin = values[0];
-    for (size_t i = 1; i < currentAmount; ++i) {
-        currentMin = std::min(currentMin, values[i]);
+        // Re-sum once per lap so rounding in the running sum cannot accumulate.
+        if (minHead == 0) {
+            minSum = std::accumulate(minValues.begin(), minValues.end(), 0.0);
+        }
     }
 
-    if (minValues.empty()) {
-        return currentMin;
-    }
+    return static_cast<float>(minSum / static_cast<double>(blockCount));
+}
 
-    const bool valueChanged = minValues.back() != currentMin;
-    if (valueChanged || !ignoreSame) {
-        ShiftArray(minValues);
-        minValues.back() = currentMin;
+void MinFilter::FilterBlock(const float* input, float* output, size_t count) {
+    if (!input || !output) {
+        return;
     }
 
-    const float sum = std::accumulate(minValues.begin(), minValues.end(), 0.0f);
-    return sum / static_cast<float>(blockCount);
+    for (size_t i = 0; i < count; ++i) {
+        output[i] = Filter(input[i]);
+    }
 }
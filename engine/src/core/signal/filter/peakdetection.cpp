@@ -3,53 +3,60 @@
 #include <algorithm>
 #include <cmath>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+/** @brief Sliding updates between exact recomputations of the channel statistics. */
+constexpr size_t kChannelRecomputeInterval = 256;
+
+/**
+ * @brief One channel time step: z-score test, influence filtering and a sliding Welford update.
+ *
+ * Replacing the oldest window value `removed` with `added` moves the mean by their difference
+ * over the window length and the squared-deviation sum by delta * (added - newMean + removed - mean).
+ */
+inline uint8_t ChannelStep(float sample, float removed, float threshold, float influence, float invLag,
+                           float& mean, float& m2, float& filtered) {
+    const float stdDev = std::sqrt(std::max(m2, 0.0f) * invLag);
+    const float diff = sample - mean;
+    const bool signal = std::fabs(diff) > threshold * stdDev;
+    const float added = signal ? influence * sample + (1.0f - influence) * filtered : sample;
+
+    const float delta = added - removed;
+    const float newMean = mean + delta * invLag;
+    m2 = m2 + delta * ((added - newMean) + (removed - mean));
+    mean = newMean;
+    filtered = added;
+
+    return (signal && diff > 0.0f) ? 1 : 0;
+}
+
+}  // namespace
+
 PeakDetection::PeakDetection(size_t sampleSizeValue, uint8_t lagValue, float thresholdValue, float influenceValue)
     : sampleSize(sampleSizeValue > 0 ? sampleSizeValue : 1),
       lag(std::max<uint8_t>(lagValue, static_cast<uint8_t>(1))),
       threshold(thresholdValue),
       influence(influenceValue),
       filteredData(sampleSize, 0.0f),
-      averages(sampleSize, 0.0f),
-      deviations(sampleSize, 0.0f) {}
+      channelHead(0),
+      channelFrames(0),
+      channelUpdates(0) {}
 
 void PeakDetection::Reset() {
     std::fill(filteredData.begin(), filteredData.end(), 0.0f);
-    std::fill(averages.begin(), averages.end(), 0.0f);
-    std::fill(deviations.begin(), deviations.end(), 0.0f);
-}
-
-void PeakDetection::GetStdDev(size_t start, size_t length, const float* data, float& avgRet, float& stdRet) const {
-    if (data == nullptr || length == 0 || sampleSize == 0) {
-        avgRet = 0.0f;
-        stdRet = 0.0f;
-        return;
-    }
-
-    const size_t clampedStart = std::min(start, sampleSize - 1);
-    const size_t endIndex = std::min(clampedStart + length, sampleSize);
-    const size_t count = (endIndex > clampedStart) ? (endIndex - clampedStart) : 0;
-
-    if (count == 0) {
-        avgRet = 0.0f;
-        stdRet = 0.0f;
-        return;
-    }
-
-    float sum = 0.0f;
-    for (size_t i = clampedStart; i < endIndex; ++i) {
-        sum += data[i];
-    }
-
-    const float average = sum / static_cast<float>(count);
-
-    float variance = 0.0f;
-    for (size_t i = clampedStart; i < endIndex; ++i) {
-        const float diff = data[i] - average;
-        variance += diff * diff;
-    }
-
-    avgRet = average;
-    stdRet = std::sqrt(variance / static_cast<float>(count));
+    std::fill(channelHistory.begin(), channelHistory.end(), 0.0f);
+    std::fill(channelMeans.begin(), channelMeans.end(), 0.0f);
+    std::fill(channelM2.begin(), channelM2.end(), 0.0f);
+    std::fill(channelFiltered.begin(), channelFiltered.end(), 0.0f);
+    channelHead = 0;
+    channelFrames = 0;
+    channelUpdates = 0;
 }
 
 void PeakDetection::Calculate(const float* data, std::vector<bool>& peaks) {
@@ -64,7 +71,7 @@ void PeakDetection::Calculate(const float* data, std::vector<bool>& peaks) {
         std::fill(peaks.begin(), peaks.end(), false);
     }
 
-    Reset();
+    std::fill(filteredData.begin(), filteredData.end(), 0.0f);
 
     float maxData = 0.0f;
     for (size_t i = 0; i < sampleSize; ++i) {
@@ -75,26 +82,192 @@ void PeakDetection::Calculate(const float* data, std::vector<bool>& peaks) {
         return;
     }
 
-    float average = 0.0f;
-    float stdDev = 0.0f;
+    // Seed the window with the first lag samples, then slide it one filtered sample at a time.
+    double mean = 0.0;
+    double m2 = 0.0;
 
-    GetStdDev(0, lag, data, average, stdDev);
+    for (size_t i = 0; i < lag; ++i) {
+        filteredData[i] = data[i];
 
-    averages[lag - 1] = average;
-    deviations[lag - 1] = stdDev;
+        const double delta = data[i] - mean;
+        mean += delta / static_cast<double>(i + 1);
+        m2 += delta * (data[i] - mean);
+    }
+
+    const double window = static_cast<double>(lag);
 
     for (size_t i = lag; i < sampleSize - lag; ++i) {
-        if (std::fabs(data[i] - averages[i - 1]) > threshold * deviations[i - 1]) {
-            peaks[i] = data[i] > averages[i - 1];
+        const float average = static_cast<float>(mean);
+        const float stdDev = static_cast<float>(std::sqrt(std::max(m2, 0.0) / window));
+
+        if (std::fabs(data[i] - average) > threshold * stdDev) {
+            peaks[i] = data[i] > average;
             filteredData[i] = influence * data[i] + (1.0f - influence) * filteredData[i - 1];
         } else {
             peaks[i] = false;
             filteredData[i] = data[i];
         }
 
-        GetStdDev(i - lag + 1, lag, data, average, stdDev);
+        const double added = filteredData[i];
+        const double removed = filteredData[i - lag];
+        const double delta = added - removed;
+        const double newMean = mean + delta / window;
+
+        m2 += delta * ((added - newMean) + (removed - mean));
+        mean = newMean;
+    }
+}
+
+void PeakDetection::CalculateChannels(const float* frame, std::vector<uint8_t>& peaks) {
+    if (frame == nullptr) {
+        peaks.clear();
+        return;
+    }
+
+    peaks.resize(sampleSize);
+
+    // Allocated on first use so detectors that only call Calculate() stay at one buffer.
+    if (channelHistory.empty()) {
+        channelHistory.assign(sampleSize * lag, 0.0f);
+        channelMeans.assign(sampleSize, 0.0f);
+        channelM2.assign(sampleSize, 0.0f);
+        channelFiltered.assign(sampleSize, 0.0f);
+    }
 
-        averages[i] = average;
-        deviations[i] = stdDev;
+    float* row = channelHistory.data() + channelHead * sampleSize;
+
+    if (channelFrames < lag) {
+        // Still filling the history: keep the raw samples and report nothing.
+        std::copy(frame, frame + sampleSize, row);
+        std::copy(frame, frame + sampleSize, channelFiltered.begin());
+        std::fill(peaks.begin(), peaks.end(), 0);
+        ++channelFrames;
+        channelHead = (channelHead + 1) % lag;
+
+        if (channelFrames == lag) {
+            RecomputeChannelStatistics();
+        }
+    } else {
+        const float invLag = 1.0f / static_cast<float>(lag);
+        float* means = channelMeans.data();
+        float* m2 = channelM2.data();
+        float* filtered = channelFiltered.data();
+        uint8_t* flags = peaks.data();
+        size_t i = 0;
+
+#if defined(__SSE2__)
+        const __m128 thresholdV = _mm_set1_ps(threshold);
+        const __m128 influenceV = _mm_set1_ps(influence);
+        const __m128 keepV = _mm_set1_ps(1.0f - influence);
+        const __m128 invLagV = _mm_set1_ps(invLag);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+
+        for (; i + 4 <= sampleSize; i += 4) {
+            const __m128 x = _mm_loadu_ps(frame + i);
+            const __m128 removed = _mm_loadu_ps(row + i);
+            const __m128 mean = _mm_loadu_ps(means + i);
+            const __m128 dev = _mm_loadu_ps(m2 + i);
+            const __m128 previous = _mm_loadu_ps(filtered + i);
+
+            const __m128 stdDev = _mm_sqrt_ps(_mm_mul_ps(_mm_max_ps(dev, zero), invLagV));
+            const __m128 diff = _mm_sub_ps(x, mean);
+            const __m128 signal = _mm_cmpgt_ps(_mm_andnot_ps(signMask, diff), _mm_mul_ps(thresholdV, stdDev));
+            const __m128 blended = _mm_add_ps(_mm_mul_ps(influenceV, x), _mm_mul_ps(keepV, previous));
+            const __m128 added = _mm_or_ps(_mm_and_ps(signal, blended), _mm_andnot_ps(signal, x));
+
+            const __m128 delta = _mm_sub_ps(added, removed);
+            const __m128 newMean = _mm_add_ps(mean, _mm_mul_ps(delta, invLagV));
+            const __m128 spread = _mm_add_ps(_mm_sub_ps(added, newMean), _mm_sub_ps(removed, mean));
+
+            _mm_storeu_ps(m2 + i, _mm_add_ps(dev, _mm_mul_ps(delta, spread)));
+            _mm_storeu_ps(means + i, newMean);
+            _mm_storeu_ps(filtered + i, added);
+            _mm_storeu_ps(row + i, added);
+
+            const int mask = _mm_movemask_ps(_mm_and_ps(signal, _mm_cmpgt_ps(diff, zero)));
+            flags[i] = static_cast<uint8_t>(mask & 1);
+            flags[i + 1] = static_cast<uint8_t>((mask >> 1) & 1);
+            flags[i + 2] = static_cast<uint8_t>((mask >> 2) & 1);
+            flags[i + 3] = static_cast<uint8_t>((mask >> 3) & 1);
+        }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        const float32x4_t thresholdV = vdupq_n_f32(threshold);
+        const float32x4_t influenceV = vdupq_n_f32(influence);
+        const float32x4_t keepV = vdupq_n_f32(1.0f - influence);
+        const float32x4_t invLagV = vdupq_n_f32(invLag);
+        const float32x4_t zero = vdupq_n_f32(0.0f);
+
+        for (; i + 4 <= sampleSize; i += 4) {
+            const float32x4_t x = vld1q_f32(frame + i);
+            const float32x4_t removed = vld1q_f32(row + i);
+            const float32x4_t mean = vld1q_f32(means + i);
+            const float32x4_t dev = vld1q_f32(m2 + i);
+            const float32x4_t previous = vld1q_f32(filtered + i);
+
+            const float32x4_t stdDev = vsqrtq_f32(vmulq_f32(vmaxq_f32(dev, zero), invLagV));
+            const float32x4_t diff = vsubq_f32(x, mean);
+            const uint32x4_t signal = vcgtq_f32(vabsq_f32(diff), vmulq_f32(thresholdV, stdDev));
+            const float32x4_t blended = vaddq_f32(vmulq_f32(influenceV, x), vmulq_f32(keepV, previous));
+            const float32x4_t added = vbslq_f32(signal, blended, x);
+
+            const float32x4_t delta = vsubq_f32(added, removed);
+            const float32x4_t newMean = vaddq_f32(mean, vmulq_f32(delta, invLagV));
+            const float32x4_t spread = vaddq_f32(vsubq_f32(added, newMean), vsubq_f32(removed, mean));
+
+            vst1q_f32(m2 + i, vaddq_f32(dev, vmulq_f32(delta, spread)));
+            vst1q_f32(means + i, newMean);
+            vst1q_f32(filtered + i, added);
+            vst1q_f32(row + i, added);
+
+            const uint32x4_t peak = vandq_u32(signal, vcgtq_f32(diff, zero));
+            flags[i] = static_cast<uint8_t>(vgetq_lane_u32(peak, 0) & 1);
+            flags[i + 1] = static_cast<uint8_t>(vgetq_lane_u32(peak, 1) & 1);
+            flags[i + 2] = static_cast<uint8_t>(vgetq_lane_u32(peak, 2) & 1);
+            flags[i + 3] = static_cast<uint8_t>(vgetq_lane_u32(peak, 3) & 1);
+        }
+#endif
+
+        for (; i < sampleSize; ++i) {
+            const float removed = row[i];
+            flags[i] = ChannelStep(frame[i], removed, threshold, influence, invLag, means[i], m2[i], filtered[i]);
+            row[i] = filtered[i];
+        }
+
+        channelHead = (channelHead + 1) % lag;
+
+        // Re-derive the statistics from the history now and then so float drift from the
+        // sliding updates cannot accumulate.
+        if (++channelUpdates == kChannelRecomputeInterval) {
+            RecomputeChannelStatistics();
+        }
+    }
+}
+
+void PeakDetection::RecomputeChannelStatistics() {
+    channelUpdates = 0;
+
+    const float invLag = 1.0f / static_cast<float>(lag);
+
+    std::fill(channelMeans.begin(), channelMeans.end(), 0.0f);
+    std::fill(channelM2.begin(), channelM2.end(), 0.0f);
+
+    for (size_t r = 0; r < lag; ++r) {
+        const float* row = channelHistory.data() + r * sampleSize;
+        for (size_t i = 0; i < sampleSize; ++i) {
+            channelMeans[i] += row[i];
+        }
+    }
+
+    for (size_t i = 0; i < sampleSize; ++i) {
+        channelMeans[i] *= invLag;
+    }
+
+    for (size_t r = 0; r < lag; ++r) {
+        const float* row = channelHistory.data() + r * sampleSize;
+        for (size_t i = 0; i < sampleSize; ++i) {
+            const float diff = row[i] - channelMeans[i];
+            channelM2[i] += diff * diff;
+        }
     }
 }
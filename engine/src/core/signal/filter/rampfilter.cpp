@@ -8,6 +8,7 @@ RampFilter::RampFilter() {
 
 RampFilter::RampFilter(int frames, float epsilon) {
     increment = 1.0f / float(frames);
+    filter = 0.0f;
     this->epsilon = epsilon;
 }
 
@@ -0,0 +1,122 @@
+#include <ptx/core/signal/stft.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+constexpr double kTwoPi = 6.28318530717958647692;
+
+const FFT& CheckedInstance(int frameSize, int hopSize) {
+    if (hopSize < 1 || hopSize > frameSize) {
+        throw std::invalid_argument("STFT::STFT: hop size must be in [1, frame size]");
+    }
+    return FFT::Instance(frameSize);
+}
+
+float WindowValue(STFT::Window shape, int n, int size) {
+    const double phase = kTwoPi * static_cast<double>(n) / static_cast<double>(size);
+    switch (shape) {
+        case STFT::Window::Hann:
+            return static_cast<float>(0.5 - 0.5 * std::cos(phase));
+        case STFT::Window::Hamming:
+            return static_cast<float>(0.54 - 0.46 * std::cos(phase));
+        case STFT::Window::Blackman:
+            return static_cast<float>(0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase));
+        case STFT::Window::Rectangular:
+        default:
+            return 1.0f;
+    }
+}
+
+}  // namespace
+
+STFT::STFT(int frameSize, int hopSize, Window shape)
+    : frameSize(frameSize),
+      hopSize(hopSize),
+      fft(CheckedInstance(frameSize, hopSize)),
+      window(static_cast<size_t>(frameSize)),
+      normalization(static_cast<size_t>(hopSize)),
+      input(static_cast<size_t>(frameSize), 0.0f),
+      frame(static_cast<size_t>(frameSize), 0.0f),
+      spectrum(static_cast<size_t>(frameSize) + 2, 0.0f),
+      magnitudes(static_cast<size_t>(frameSize / 2 + 1), 0.0f),
+      accumulator(static_cast<size_t>(frameSize), 0.0f),
+      output(static_cast<size_t>(hopSize), 0.0f) {
+    for (int n = 0; n < frameSize; ++n) {
+        window[static_cast<size_t>(n)] = WindowValue(shape, n, frameSize);
+    }
+
+    // Once the stream is running, output sample n of each hop has received one windowed
+    // contribution from every frame overlapping it; dividing by their squared-window sum
+    // makes analysis followed by resynthesis an identity for any window and hop.
+    for (int n = 0; n < hopSize; ++n) {
+        float sum = 0.0f;
+        for (int i = n; i < frameSize; i += hopSize) {
+            sum += window[static_cast<size_t>(i)] * window[static_cast<size_t>(i)];
+        }
+        normalization[static_cast<size_t>(n)] = sum > 1e-6f ? 1.0f / sum : 0.0f;
+    }
+}
+
+size_t STFT::Push(const float* samples, size_t count) {
+    hasFrame = false;
+    if (!samples || count == 0) {
+        return 0;
+    }
+
+    const size_t used = std::min(count, static_cast<size_t>(frameSize) - filled);
+    std::copy(samples, samples + used, input.begin() + static_cast<std::ptrdiff_t>(filled));
+    filled += used;
+
+    if (filled == static_cast<size_t>(frameSize)) {
+        Analyze();
+
+        // Keep the overlap so the next frame only waits for one hop of new samples.
+        std::copy(input.begin() + hopSize, input.end(), input.begin());
+        filled = static_cast<size_t>(frameSize - hopSize);
+        hasFrame = true;
+    }
+
+    return used;
+}
+
+void STFT::Analyze() {
+    for (int n = 0; n < frameSize; ++n) {
+        frame[static_cast<size_t>(n)] = input[static_cast<size_t>(n)] * window[static_cast<size_t>(n)];
+    }
+
+    fft.ForwardReal(frame.data(), spectrum.data());
+    fft.RealMagnitude(spectrum.data(), magnitudes.data());
+}
+
+void STFT::Synthesize(const float* frameSpectrum) {
+    if (!frameSpectrum) {
+        return;
+    }
+
+    fft.InverseReal(frameSpectrum, frame.data(), true);
+
+    for (int n = 0; n < frameSize; ++n) {
+        accumulator[static_cast<size_t>(n)] += frame[static_cast<size_t>(n)] * window[static_cast<size_t>(n)];
+    }
+
+    // The first hop has now received every frame that overlaps it.
+    for (int n = 0; n < hopSize; ++n) {
+        output[static_cast<size_t>(n)] = accumulator[static_cast<size_t>(n)] * normalization[static_cast<size_t>(n)];
+    }
+
+    std::copy(accumulator.begin() + hopSize, accumulator.end(), accumulator.begin());
+    std::fill(accumulator.end() - hopSize, accumulator.end(), 0.0f);
+}
+
+void STFT::Reset() {
+    std::fill(input.begin(), input.end(), 0.0f);
+    std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+    std::fill(magnitudes.begin(), magnitudes.end(), 0.0f);
+    std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+    std::fill(output.begin(), output.end(), 0.0f);
+    filled = 0;
+    hasFrame = false;
+}
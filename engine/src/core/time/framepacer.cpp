@@ -0,0 +1,291 @@
+#include <ptx/core/time/framepacer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+
+#if !defined(ARDUINO)
+#include <chrono>
+#include <thread>
+#endif
+
+namespace {
+
+constexpr uint32_t kDefaultSpinMicros = 1000;
+
+// Frame times up to 40 ms at 0.1 ms resolution, lateness up to 2 ms at 10 us.
+constexpr uint32_t kFrameBucketMicros = 100;
+constexpr uint16_t kFrameBucketCount = 400;
+constexpr uint32_t kLatenessBucketMicros = 10;
+constexpr uint16_t kLatenessBucketCount = 200;
+constexpr uint16_t kMissedBucketCount = 16;
+
+uint32_t ToMicros(uint64_t nanos) {
+    const uint64_t micros = nanos / 1000ull;
+    return micros > 0xFFFFFFFFull ? 0xFFFFFFFFu : static_cast<uint32_t>(micros);
+}
+
+}  // namespace
+
+// === FrameHistogram ===
+
+FrameHistogram::FrameHistogram(uint32_t bucketWidth, uint16_t bucketCount)
+    : buckets(std::max<uint16_t>(bucketCount, 1), 0u), bucketWidth(std::max<uint32_t>(bucketWidth, 1u)) {}
+
+void FrameHistogram::Record(uint32_t value) {
+    const uint32_t index = value / bucketWidth;
+    if (index < buckets.size()) {
+        ++buckets[index];
+    } else {
+        ++overflow;
+    }
+
+    minValue = count == 0 ? value : std::min(minValue, value);
+    maxValue = count == 0 ? value : std::max(maxValue, value);
+    sum += value;
+    ++count;
+}
+
+void FrameHistogram::Reset() {
+    std::fill(buckets.begin(), buckets.end(), 0u);
+    overflow = 0;
+    count = 0;
+    sum = 0;
+    minValue = 0;
+    maxValue = 0;
+}
+
+uint16_t FrameHistogram::GetBucketCount() const {
+    return static_cast<uint16_t>(buckets.size());
+}
+
+uint32_t FrameHistogram::GetBucketWidth() const {
+    return bucketWidth;
+}
+
+uint32_t FrameHistogram::GetBucket(uint16_t index) const {
+    return index < buckets.size() ? buckets[index] : 0u;
+}
+
+uint32_t FrameHistogram::GetOverflow() const {
+    return overflow;
+}
+
+uint32_t FrameHistogram::GetCount() const {
+    return count;
+}
+
+uint32_t FrameHistogram::GetMin() const {
+    return minValue;
+}
+
+uint32_t FrameHistogram::GetMax() const {
+    return maxValue;
+}
+
+float FrameHistogram::GetMean() const {
+    return count > 0 ? static_cast<float>(static_cast<double>(sum) / count) : 0.0f;
+}
+
+uint32_t FrameHistogram::GetPercentile(float fraction) const {
+    if (count == 0) return 0;
+
+    fraction = std::min(std::max(fraction, 0.0f), 1.0f);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * count + 0.5f));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) return std::min(static_cast<uint32_t>((i + 1) * bucketWidth), maxValue);
+    }
+
+    return maxValue;
+}
+
+std::string FrameHistogram::ToJson() const {
+    char head[256];
+    std::snprintf(head, sizeof(head),
+                  "{\"width\":%u,\"count\":%u,\"overflow\":%u,\"min\":%u,\"max\":%u,\"mean\":%.2f,"
+                  "\"p50\":%u,\"p90\":%u,\"p99\":%u,\"buckets\":[",
+                  static_cast<unsigned>(bucketWidth), static_cast<unsigned>(count),
+                  static_cast<unsigned>(overflow), static_cast<unsigned>(minValue),
+                  static_cast<unsigned>(maxValue), static_cast<double>(GetMean()),
+                  static_cast<unsigned>(GetPercentile(0.5f)), static_cast<unsigned>(GetPercentile(0.9f)),
+                  static_cast<unsigned>(GetPercentile(0.99f)));
+
+    std::string json(head);
+    json.reserve(json.size() + buckets.size() * 3 + 2);
+
+    // Trailing empty buckets are omitted; the width and overflow keep the layout recoverable.
+    size_t used = buckets.size();
+    while (used > 0 && buckets[used - 1] == 0) --used;
+
+    char number[16];
+    for (size_t i = 0; i < used; ++i) {
+        std::snprintf(number, sizeof(number), i == 0 ? "%u" : ",%u", static_cast<unsigned>(buckets[i]));
+        json += number;
+    }
+
+    json += "]}";
+    return json;
+}
+
+// === FramePacer ===
+
+FramePacer::FramePacer(float frequency)
+    : frequency(60.0f),
+      periodNanos(1000000000ull / 60),
+      spinNanos(kDefaultSpinMicros * 1000ull),
+      frameTimes(kFrameBucketMicros, kFrameBucketCount),
+      lateness(kLatenessBucketMicros, kLatenessBucketCount),
+      missed(1, kMissedBucketCount) {
+    // A non-positive frequency keeps the 60 Hz default.
+    SetFrequency(frequency);
+}
+
+void FramePacer::SetFrequency(float frequency) {
+    if (!(frequency > 0.0f)) return;
+
+    this->frequency = frequency;
+    periodNanos = std::max<uint64_t>(1, static_cast<uint64_t>(1000000000.0 / frequency));
+}
+
+float FramePacer::GetFrequency() const {
+    return frequency;
+}
+
+uint64_t FramePacer::GetPeriodNanos() const {
+    return periodNanos;
+}
+
+void FramePacer::SetSpinMicros(uint32_t micros) {
+    spinNanos = static_cast<uint64_t>(micros) * 1000ull;
+}
+
+uint32_t FramePacer::GetSpinMicros() const {
+    return static_cast<uint32_t>(spinNanos / 1000ull);
+}
+
+void FramePacer::SetFixedStep(TimeStep* timeStep) {
+    fixedStep = timeStep;
+}
+
+// === Pacing ===
+
+float FramePacer::WaitForNextFrame() {
+    uint64_t now = Now();
+
+    if (!started) {
+        started = true;
+        deadline = now + periodNanos;
+        lastWake = now;
+        deltaSeconds = 0.0f;
+        return deltaSeconds;
+    }
+
+    if (now < deadline) {
+        const uint64_t remaining = deadline - now;
+        if (remaining > spinNanos) {
+            Sleep(remaining - spinNanos);
+            now = Now();
+        }
+
+        // Spin out the rest; also covers a sleep that overshot into the spin window.
+        while (now < deadline) now = Now();
+    }
+
+    const uint64_t late = now - deadline;
+    const uint64_t skipped = late / periodNanos;
+    if (skipped > 0) {
+        // Overran by whole periods: drop them and restart the schedule from now.
+        missedFrames += static_cast<uint32_t>(skipped);
+        missed.Record(static_cast<uint32_t>(std::min<uint64_t>(skipped, 0xFFFFFFFFull)));
+        deadline = now + periodNanos;
+    } else {
+        deadline += periodNanos;
+    }
+
+    const uint64_t frameNanos = now - lastWake;
+    lastWake = now;
+
+    lateness.Record(ToMicros(late));
+    frameTimes.Record(ToMicros(frameNanos));
+    ++frameCount;
+
+    deltaSeconds = static_cast<float>(static_cast<double>(frameNanos) / 1000000000.0);
+    if (fixedStep) fixedStep->Accumulate(deltaSeconds);
+
+    return deltaSeconds;
+}
+
+void FramePacer::Restart() {
+    started = false;
+}
+
+float FramePacer::GetDeltaSeconds() const {
+    return deltaSeconds;
+}
+
+// === Telemetry ===
+
+uint32_t FramePacer::GetFrameCount() const {
+    return frameCount;
+}
+
+uint32_t FramePacer::GetMissedFrames() const {
+    return missedFrames;
+}
+
+const FrameHistogram& FramePacer::GetFrameTimeHistogram() const {
+    return frameTimes;
+}
+
+const FrameHistogram& FramePacer::GetLatenessHistogram() const {
+    return lateness;
+}
+
+const FrameHistogram& FramePacer::GetMissedHistogram() const {
+    return missed;
+}
+
+void FramePacer::ResetStats() {
+    frameCount = 0;
+    missedFrames = 0;
+    frameTimes.Reset();
+    lateness.Reset();
+    missed.Reset();
+}
+
+std::string FramePacer::ExportJson() const {
+    char head[160];
+    std::snprintf(head, sizeof(head),
+                  "{\"frequency\":%.3f,\"period_ns\":%llu,\"spin_us\":%u,\"frames\":%u,\"missed\":%u,",
+                  static_cast<double>(frequency), static_cast<unsigned long long>(periodNanos),
+                  static_cast<unsigned>(GetSpinMicros()), static_cast<unsigned>(frameCount),
+                  static_cast<unsigned>(missedFrames));
+
+    std::string json(head);
+    json += "\"frame_time_us\":";
+    json += frameTimes.ToJson();
+    json += ",\"lateness_us\":";
+    json += lateness.ToJson();
+    json += ",\"missed_per_overrun\":";
+    json += missed.ToJson();
+    json += "}";
+    return json;
+}
+
+// === Clock ===
+
+uint64_t FramePacer::Now() {
+    return ptx::Time::Nanos();
+}
+
+void FramePacer::Sleep(uint64_t nanos) {
+#if defined(ARDUINO)
+    const uint32_t micros = ToMicros(nanos);
+    if (micros >= 1000) delay(micros / 1000);
+    delayMicroseconds(micros % 1000);
+#else
+    std::this_thread::sleep_for(std::chrono::nanoseconds(nanos));
+#endif
+}
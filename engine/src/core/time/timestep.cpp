@@ -6,6 +6,7 @@ TimeStep::TimeStep(float frequency) {
 
 void TimeStep::SetFrequency(float frequency) {
     this->updateInterval = uint16_t((1.0f / frequency) * 1000.0f);
+    this->stepSeconds = 1.0f / frequency;
 }
 
 bool TimeStep::IsReady() {
@@ -17,3 +18,35 @@ bool TimeStep::IsReady() {
         return false;
     }
 }
+
+void TimeStep::Accumulate(float seconds) {
+    if (seconds > 0.0f) accumulated += seconds;
+
+    if (maxSteps > 0) {
+        const float limit = stepSeconds * static_cast<float>(maxSteps);
+        if (accumulated > limit) accumulated = limit;
+    }
+}
+
+void TimeStep::SetMaxSteps(uint16_t steps) {
+    maxSteps = steps;
+}
+
+uint16_t TimeStep::GetMaxSteps() const {
+    return maxSteps;
+}
+
+bool TimeStep::ConsumeStep() {
+    if (stepSeconds <= 0.0f || accumulated < stepSeconds) return false;
+
+    accumulated -= stepSeconds;
+    return true;
+}
+
+float TimeStep::GetAlpha() const {
+    return stepSeconds > 0.0f ? accumulated / stepSeconds : 0.0f;
+}
+
+float TimeStep::GetStepSeconds() const {
+    return stepSeconds;
+}
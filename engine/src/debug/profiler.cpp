@@ -12,17 +12,42 @@ Profiler* Profiler::instance = nullptr;
 
 // === Profiler Implementation ===
 
+namespace {
+
+// Ring size per thread; 16384 events of 24 bytes each.
+constexpr size_t kDefaultTraceBufferSize = 16384;
+
+// Events moved from a ring per read.
+constexpr size_t kCollectChunk = 1024;
+
+void WriteJSONString(std::ostream& out, const std::string& value) {
+    out << '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
 Profiler::Profiler()
-    : enabled(false), currentDepth(0), frameStartTime(0.0), lastFrameTime(0.0),
-      fps(0.0), frameCount(0) {
+    : enabled(false), mode(ProfilerMode::Detailed), recording(false), currentDepth(0),
+      frameStartTime(0.0), lastFrameTime(0.0), fps(0.0), frameCount(0),
+      nextLane(1), traceBufferSize(kDefaultTraceBufferSize), retiredDropped(0),
+      traceHasEvents(false), traceOrigin(Now()), tracing(false), collectorRunning(false) {
     startTime = std::chrono::high_resolution_clock::now();
 }
 
 Profiler& Profiler::GetInstance() {
-    if (instance == nullptr) {
-        instance = new Profiler();
-    }
-    return *instance;
+    // Scopes may open on any thread, so creation goes through a thread-safe static.
+    static Profiler* created = (instance = new Profiler());
+    return *created;
 }
 
 void Profiler::BeginFrame() {
@@ -276,6 +301,282 @@ void Profiler::PrintStats() {
     std::cout << "\n";
 }
 
+// === Low-overhead mode ===
+
+uint32_t Profiler::InternName(const char* name) {
+    return InternName(std::string(name != nullptr ? name : ""));
+}
+
+uint32_t Profiler::InternName(const std::string& name) {
+    Profiler& profiler = GetInstance();
+    std::lock_guard<std::mutex> lock(profiler.internMutex);
+
+    auto it = profiler.nameIds.find(name);
+    if (it != profiler.nameIds.end()) {
+        return it->second;
+    }
+
+    const uint32_t id = static_cast<uint32_t>(profiler.names.size());
+    profiler.names.push_back(name);
+    profiler.nameIds.emplace(name, id);
+    return id;
+}
+
+std::string Profiler::GetName(uint32_t nameId) {
+    std::lock_guard<std::mutex> lock(internMutex);
+    return nameId < names.size() ? names[nameId] : std::string();
+}
+
+Profiler::ThreadTrace* Profiler::GetThreadTrace() {
+    // Holds the thread's ring and marks it retired on thread exit, so the collector
+    // can release it once drained.
+    struct LocalTrace {
+        std::shared_ptr<ThreadTrace> trace;
+
+        ~LocalTrace() {
+            if (trace) trace->retired.store(true, std::memory_order_release);
+        }
+    };
+    static thread_local LocalTrace local;
+
+    if (!local.trace) {
+        local.trace = RegisterThread();
+    }
+    return local.trace.get();
+}
+
+std::shared_ptr<Profiler::ThreadTrace> Profiler::RegisterThread() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    auto trace = std::make_shared<ThreadTrace>(traceBufferSize, nextLane++);
+    trace->name = "Thread " + std::to_string(trace->lane);
+    threads.push_back(trace);
+    return trace;
+}
+
+void Profiler::RecordEvent(uint32_t nameId, uint64_t start, uint64_t end) {
+    ThreadTrace* trace = GetThreadTrace();
+    const TraceEvent event{start, end, nameId};
+
+    if (trace->events.Write(&event, 1) == 0) {
+        trace->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+    ThreadTrace* trace = GetThreadTrace();
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    trace->name = name;
+    trace->namePublished = false;
+}
+
+void Profiler::SetTraceBufferSize(size_t events) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    traceBufferSize = std::max<size_t>(events, 16);
+}
+
+uint64_t Profiler::GetDroppedTraceEvents() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    uint64_t total = retiredDropped;
+    for (const auto& trace : threads) {
+        total += trace->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+size_t Profiler::GetTraceThreadCount() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return threads.size();
+}
+
+size_t Profiler::CollectTraceEvents() {
+    std::lock_guard<std::mutex> collectLock(collectMutex);
+
+    // Snapshot the rings and any lane labels the open trace has not seen yet.
+    std::vector<std::shared_ptr<ThreadTrace>> snapshot;
+    std::vector<std::pair<uint32_t, std::string>> labels;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        snapshot = threads;
+        if (traceFile.is_open()) {
+            for (const auto& trace : threads) {
+                if (!trace->namePublished) {
+                    labels.emplace_back(trace->lane, trace->name);
+                    trace->namePublished = true;
+                }
+            }
+        }
+    }
+
+    for (const auto& label : labels) {
+        WriteThreadName(label.first, label.second);
+    }
+
+    for (ProfileStats& stat : collectStats) {
+        stat.callCount = 0;
+    }
+
+    collectScratch.resize(kCollectChunk);
+    size_t drained = 0;
+
+    for (const auto& trace : snapshot) {
+        for (;;) {
+            const size_t count = trace->events.Read(collectScratch.data(), collectScratch.size());
+            if (count == 0) break;
+
+            for (size_t i = 0; i < count; ++i) {
+                const TraceEvent& event = collectScratch[i];
+
+                // Names interned after the last refresh; the intern lock is rarely taken here.
+                if (event.nameId >= collectedNames.size()) {
+                    std::lock_guard<std::mutex> lock(internMutex);
+                    collectedNames.insert(collectedNames.end(),
+                        names.begin() + static_cast<std::ptrdiff_t>(collectedNames.size()), names.end());
+                    collectStats.resize(collectedNames.size());
+                }
+                if (event.nameId >= collectedNames.size()) continue;
+
+                if (traceFile.is_open()) {
+                    WriteTraceEvent(event, trace->lane);
+                }
+
+                ProfileStats& stat = collectStats[event.nameId];
+                const double duration = static_cast<double>(event.end - event.start) / 1000.0;
+                if (stat.callCount == 0) {
+                    stat.totalTime = 0.0;
+                    stat.minTime = duration;
+                    stat.maxTime = duration;
+                }
+                stat.callCount++;
+                stat.totalTime += duration;
+                stat.minTime = std::min(stat.minTime, duration);
+                stat.maxTime = std::max(stat.maxTime, duration);
+            }
+            drained += count;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t id = 0; id < collectStats.size(); ++id) {
+            const ProfileStats& batch = collectStats[id];
+            if (batch.callCount == 0) continue;
+
+            auto& stat = stats[collectedNames[id]];
+            stat.name = collectedNames[id];
+            stat.callCount += batch.callCount;
+            stat.totalTime += batch.totalTime;
+            stat.minTime = std::min(stat.minTime, batch.minTime);
+            stat.maxTime = std::max(stat.maxTime, batch.maxTime);
+            stat.avgTime = stat.totalTime / stat.callCount;
+        }
+    }
+
+    // Release rings whose thread has exited once their events and label are written.
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (auto it = threads.begin(); it != threads.end();) {
+            ThreadTrace& trace = **it;
+            if (trace.retired.load(std::memory_order_acquire) && trace.events.Size() == 0 &&
+                (trace.namePublished || !traceFile.is_open())) {
+                retiredDropped += trace.dropped.load(std::memory_order_relaxed);
+                it = threads.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    return drained;
+}
+
+void Profiler::WriteTraceEvent(const TraceEvent& event, uint32_t lane) {
+    const double ts = static_cast<double>(static_cast<int64_t>(event.start - traceOrigin)) / 1000.0;
+    const double dur = static_cast<double>(event.end - event.start) / 1000.0;
+
+    traceFile << (traceHasEvents ? ",\n" : "") << "  {\"name\": ";
+    WriteJSONString(traceFile, collectedNames[event.nameId]);
+    traceFile << ", \"cat\": \"function\", \"ph\": \"X\", \"ts\": " << ts
+              << ", \"dur\": " << dur << ", \"pid\": 1, \"tid\": " << lane << "}";
+    traceHasEvents = true;
+}
+
+void Profiler::WriteThreadName(uint32_t lane, const std::string& name) {
+    traceFile << (traceHasEvents ? ",\n" : "")
+              << "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << lane
+              << ", \"args\": {\"name\": ";
+    WriteJSONString(traceFile, name);
+    traceFile << "}}";
+    traceHasEvents = true;
+}
+
+bool Profiler::StartTrace(const std::string& filepath, int flushIntervalMs) {
+    {
+        std::lock_guard<std::mutex> collectLock(collectMutex);
+        if (traceFile.is_open()) {
+            return false;
+        }
+
+        traceFile.open(filepath);
+        if (!traceFile.is_open()) {
+            return false;
+        }
+
+        traceFile << std::fixed << std::setprecision(3) << "[\n";
+        traceHasEvents = false;
+
+        // Label every lane in the new file, including threads that registered earlier.
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const auto& trace : threads) {
+            trace->namePublished = false;
+        }
+    }
+
+    tracing.store(true, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(collectorMutex);
+    collectorRunning = true;
+    const auto interval = std::chrono::milliseconds(std::max(flushIntervalMs, 1));
+    collectorThread = std::thread([this, interval]() { RunCollector(interval); });
+    return true;
+}
+
+void Profiler::StopTrace() {
+    {
+        std::lock_guard<std::mutex> lock(collectorMutex);
+        collectorRunning = false;
+    }
+    collectorWake.notify_all();
+    if (collectorThread.joinable()) {
+        collectorThread.join();
+    }
+
+    // Final pass so events recorded before the stop reach the file.
+    CollectTraceEvents();
+
+    std::lock_guard<std::mutex> collectLock(collectMutex);
+    if (traceFile.is_open()) {
+        traceFile << "\n]\n";
+        traceFile.close();
+    }
+    tracing.store(false, std::memory_order_release);
+}
+
+void Profiler::RunCollector(std::chrono::milliseconds interval) {
+    std::unique_lock<std::mutex> lock(collectorMutex);
+
+    while (collectorRunning) {
+        collectorWake.wait_for(lock, interval, [this]() { return !collectorRunning; });
+        if (!collectorRunning) break;
+
+        lock.unlock();
+        CollectTraceEvents();
+        lock.lock();
+    }
+}
+
 // === ProfileScope Implementation ===
 
 ProfileScope::ProfileScope(const std::string& name)
@@ -1,62 +1,242 @@
 #include <ptx/project/project.hpp>
 
-Project::Project(CameraManager* cameras, Controller* controller, uint8_t numObjects) 
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr float kStageAverageWeight = 0.05f;
+
+float SecondsSince(uint32_t startMicros) {
+    return static_cast<float>(ptx::Time::Micros() - startMicros) / 1000000.0f;
+}
+
+}  // namespace
+
+Project::Project(CameraManager* cameras, Controller* controller, uint8_t numObjects)
     : cameras(cameras), controller(controller), scene(numObjects) {
-        
-    previousAnimationTime = ptx::Time::Micros();
-    previousRenderTime = ptx::Time::Micros();
-    previousDisplayTime = ptx::Time::Micros();
+
+    renderStart = ptx::Time::Micros();
+}
+
+Project::~Project() {
+#if !defined(ARDUINO)
+    StopDisplayThread();
+#endif
 }
 
 void Project::RenderStartTimer() {
-    previousRenderTime = ptx::Time::Micros();
+    renderStart = ptx::Time::Micros();
 }
 
 void Project::RenderEndTimer() {
-    renderTime = ((float)(ptx::Time::Micros() - previousRenderTime)) / 1000000.0f;
+    RecordStage(FrameStage::Render, SecondsSince(renderStart));
+}
+
+// === Timings ===
+
+void Project::RecordStage(FrameStage stage, float seconds) {
+    StageTiming& timing = stageTimings[static_cast<uint8_t>(stage)];
+
+    timing.last = seconds;
+    timing.average = timing.samples == 0 ? seconds : timing.average + (seconds - timing.average) * kStageAverageWeight;
+    timing.max = std::max(timing.max, seconds);
+    ++timing.samples;
+}
+
+Project::StageTiming Project::GetStageTiming(FrameStage stage) const {
+    return stage < FrameStage::Count ? stageTimings[static_cast<uint8_t>(stage)] : StageTiming{};
+}
+
+void Project::ResetStageTimings() {
+    for (StageTiming& timing : stageTimings) timing = StageTiming{};
 }
 
 float Project::GetAnimationTime() {
-    return animationTime;
+    return GetStageTiming(FrameStage::Animate).last;
 }
 
 float Project::GetRenderTime() {
-    return renderTime;
+    return GetStageTiming(FrameStage::Render).last;
 }
 
 float Project::GetDisplayTime() {
-    return displayTime;
+    return GetStageTiming(FrameStage::Display).last;
 }
 
 float Project::GetFrameRate() {
-    return avgFPS.Filter(1.0f / (renderTime + animationTime + displayTime));
+    const StageTiming& frame = stageTimings[static_cast<uint8_t>(FrameStage::Frame)];
+    const float seconds = frame.samples > 0 ? frame.last
+                                            : GetAnimationTime() + GetRenderTime() + GetDisplayTime();
+    return seconds > 0.0f ? avgFPS.Filter(1.0f / seconds) : 0.0f;
 }
 
+// === Frame loop ===
+
 void Project::Animate(float ratio) {
-    previousAnimationTime = ptx::Time::Micros();
+    const uint32_t start = ptx::Time::Micros();
 
     Update(ratio);
 
-    animationTime = ((float)(ptx::Time::Micros() - previousAnimationTime)) / 1000000.0f;
+    RecordStage(FrameStage::Animate, SecondsSince(start));
 }
 
 void Project::Render() {
-    previousRenderTime = ptx::Time::Micros();
+    RenderStartTimer();
 
-    RenderingEngine::Rasterize(&scene, cameras);
+    if (parallelRender) {
+        RenderingEngine::RasterizeParallel(&scene, cameras, particles);
+    } else {
+        RenderingEngine::Rasterize(&scene, cameras, particles);
+    }
     //RenderingEngine::DisplayWhite(cameras);
 
-    renderTime = ((float)(ptx::Time::Micros() - previousRenderTime)) / 1000000.0f;
+    RenderEndTimer();
 }
 
 void Project::Display() {
-    previousDisplayTime = ptx::Time::Micros();
+    if (!controller) return;
+
+    if (pipelined) {
+        Present();
+        return;
+    }
+
+    const uint32_t start = ptx::Time::Micros();
+
+    controller->Display();
+
+    RecordStage(FrameStage::Display, SecondsSince(start));
+}
+
+void Project::Frame(float ratio) {
+    const uint32_t start = ptx::Time::Micros();
+
+    Animate(ratio);
+    Render();
+    Display();
+
+    RecordStage(FrameStage::Frame, SecondsSince(start));
+}
+
+// === Pipelining ===
+
+void Project::SetPipelined(bool enabled) {
+    if (enabled == pipelined) return;
+
+    if (!enabled) {
+#if !defined(ARDUINO)
+        StopDisplayThread();
+#endif
+        if (controller) controller->SetDisplayBuffers(nullptr, 0);
+    }
+
+    pipelined = enabled;
+}
+
+void Project::Flush() {
+    if (pipelined) WaitForDisplay();
+}
+
+void Project::WaitForDisplay() {
+#if !defined(ARDUINO)
+    std::unique_lock<std::mutex> lock(displayMutex);
+    displayCondition.wait(lock, [this]() { return !displayPending; });
+
+    if (displaySeconds >= 0.0f) {
+        RecordStage(FrameStage::Display, displaySeconds);
+        displaySeconds = -1.0f;
+    }
+#endif
+}
+
+void Project::Present() {
+    const uint32_t start = ptx::Time::Micros();
+    const uint8_t cameraCount = cameras ? cameras->GetCameraCount() : 0;
+    const uint8_t backIndex = frontIndex ^ 1u;
+
+    // Copy into the back buffers while the display thread may still be reading the front ones.
+    std::vector<std::vector<RGBColor>>& back = colorBuffers[backIndex];
+    back.resize(cameraCount);
+    for (uint8_t i = 0; i < cameraCount; ++i) {
+        CameraBase* camera = cameras->GetCameras()[i];
+        IPixelGroup* pixelGroup = camera ? camera->GetPixelGroup() : nullptr;
+        RGBColor* colors = pixelGroup ? pixelGroup->GetColors() : nullptr;
+        if (!colors) {
+            back[i].clear();
+            continue;
+        }
+
+        back[i].resize(pixelGroup->GetPixelCount());
+        std::memcpy(static_cast<void*>(back[i].data()), colors, back[i].size() * sizeof(RGBColor));
+    }
 
+    WaitForDisplay();
+
+    // The display thread is idle: swap and point the controller at the new front buffers.
+    frontIndex = backIndex;
+    displayPointers.resize(cameraCount);
+    for (uint8_t i = 0; i < cameraCount; ++i) {
+        displayPointers[i] = back[i].empty() ? nullptr : back[i].data();
+    }
+    controller->SetDisplayBuffers(displayPointers.data(), cameraCount);
+
+#if defined(ARDUINO)
+    RecordStage(FrameStage::Present, SecondsSince(start));
+
+    const uint32_t displayStart = ptx::Time::Micros();
     controller->Display();
+    RecordStage(FrameStage::Display, SecondsSince(displayStart));
+#else
+    if (!displayThread.joinable()) {
+        displayStop = false;
+        displayThread = std::thread(&Project::DisplayLoop, this);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(displayMutex);
+        displayPending = true;
+    }
+    displayCondition.notify_all();
 
-    displayTime = ((float)(ptx::Time::Micros() - previousDisplayTime)) / 1000000.0f;
+    RecordStage(FrameStage::Present, SecondsSince(start));
+#endif
 }
 
+#if !defined(ARDUINO)
+void Project::DisplayLoop() {
+    std::unique_lock<std::mutex> lock(displayMutex);
+    for (;;) {
+        displayCondition.wait(lock, [this]() { return displayPending || displayStop; });
+        if (!displayPending) return;
+
+        lock.unlock();
+        const uint32_t start = ptx::Time::Micros();
+        controller->Display();
+        const float seconds = SecondsSince(start);
+        lock.lock();
+
+        displaySeconds = seconds;
+        displayPending = false;
+        displayCondition.notify_all();
+    }
+}
+
+void Project::StopDisplayThread() {
+    if (!displayThread.joinable()) return;
+
+    // The loop displays a pending frame before it sees the stop request.
+    {
+        std::lock_guard<std::mutex> lock(displayMutex);
+        displayStop = true;
+    }
+    displayCondition.notify_all();
+    displayThread.join();
+    displayPending = false;
+    displaySeconds = -1.0f;
+}
+#endif
+
 void Project::PrintStats(){
     ptx::Console::Print("FPS: ");
     ptx::Console::Print(GetFrameRate(), 0);
@@ -66,7 +246,17 @@ void Project::PrintStats(){
     ptx::Console::Print("s, Rendered in ");
     ptx::Console::Print(GetRenderTime(), 4);
 
+    if (pipelined) {
+        ptx::Console::Print("s, Presented in ");
+        ptx::Console::Print(GetStageTiming(FrameStage::Present).last, 4);
+    }
+
     ptx::Console::Print("s, Displayed in ");
     ptx::Console::Print(GetDisplayTime(), 4);
-    ptx::Console::Println("s");
+
+    const Rasterizer::Stats raster = RenderingEngine::GetRasterStats();
+    ptx::Console::Print("s, Meshes drawn ");
+    ptx::Console::Print(static_cast<int>(raster.meshesDrawn));
+    ptx::Console::Print(", culled ");
+    ptx::Console::Println(static_cast<int>(raster.meshesCulled));
 }
@@ -1,4 +1,5 @@
 #include <ptx/resources/resourcemanager.hpp>
+#include <algorithm>
 #include <iostream>
 #include <sys/stat.h>
 
@@ -9,12 +10,13 @@ ResourceManager* ResourceManager::instance = nullptr;
 
 // Constructor
 ResourceManager::ResourceManager()
-    : nextID(0), generation(0), hotReloadEnabled(false),
-      totalMemoryUsed(0), memoryLimit(0) {
+    : nextID(0), generation(0), loaderThreadCount(0), streamingActive(0), stoppingLoaders(false),
+      hotReloadEnabled(false), totalMemoryUsed(0), memoryLimit(0) {
 }
 
 // Destructor
 ResourceManager::~ResourceManager() {
+    StopLoaderThreads();
     UnloadAllResources();
 }
 
@@ -50,48 +52,250 @@ void ResourceManager::UnloadAllResources() {
     generation++;
 }
 
+// === Pending Loads ===
+
+void ResourceManager::RunPending(const PendingPtr& entry) {
+    // Exactly one thread runs the loader; the rest wait on the shared future
+    if (entry->claimed.exchange(true)) return;
+
+    std::shared_ptr<Resource> resource;
+    std::exception_ptr error;
+
+    try {
+        resource = entry->load();
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    FinishPending(entry, std::move(resource), error);
+}
+
+void ResourceManager::FinishPending(const PendingPtr& entry, std::shared_ptr<Resource> resource, std::exception_ptr error) {
+    std::vector<std::function<void(const std::shared_ptr<Resource>&, uint32_t)>> callbacks;
+    uint32_t currentGeneration = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+
+        if (resource) {
+            resource->SetPath(entry->path);
+            resource->SetID(GenerateID());
+
+            auto& slot = cache[entry->type][entry->path];
+            if (slot) {
+                totalMemoryUsed -= slot->GetMemorySize();
+            }
+            slot = resource;
+            totalMemoryUsed += resource->GetMemorySize();
+        }
+
+        callbacks.swap(entry->callbacks);
+        currentGeneration = generation;
+        entry->generation = currentGeneration;
+    }
+
+    // New requests already hit the cache; the entry stays pending until its callbacks
+    // have run so WaitForPendingLoads() covers them
+    for (auto& callback : callbacks) {
+        callback(resource, currentGeneration);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+
+        // Only remove our own entry; UnloadAllResources() may have let a newer one start
+        auto typeIt = pending.find(entry->type);
+        if (typeIt != pending.end()) {
+            auto it = typeIt->second.find(entry->path);
+            if (it != typeIt->second.end() && it->second == entry) {
+                typeIt->second.erase(it);
+            }
+        }
+    }
+
+    if (error) {
+        entry->promise.set_exception(error);
+    } else {
+        entry->promise.set_value(resource);
+    }
+}
+
+void ResourceManager::EnqueuePending(const PendingPtr& entry, LoadPriority priority) {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+
+        if (loaderThreads.empty()) {
+            size_t count = loaderThreadCount;
+            if (count == 0) {
+                const unsigned hardware = std::thread::hardware_concurrency();
+                count = std::min<size_t>(4, hardware > 1 ? hardware - 1 : 1);
+            }
+
+            loaderThreads.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                loaderThreads.emplace_back([this]() { LoaderLoop(); });
+            }
+        }
+
+        loadQueues[static_cast<size_t>(priority)].push_back(entry);
+    }
+
+    queueChanged.notify_all();
+}
+
+void ResourceManager::LoaderLoop() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+
+    // Streaming loads may use every thread but one, so a critical or normal load always
+    // finds a free thread even while large streaming decodes are running
+    const size_t streamingLimit = loaderThreads.size() > 1 ? loaderThreads.size() - 1 : 1;
+
+    for (;;) {
+        queueChanged.wait(lock, [this, streamingLimit]() {
+            const bool urgent = !loadQueues[0].empty() || !loadQueues[1].empty();
+            const bool streaming = !loadQueues[2].empty() && streamingActive < streamingLimit;
+            return urgent || streaming || (stoppingLoaders && loadQueues[2].empty());
+        });
+
+        PendingPtr entry;
+        bool streaming = false;
+
+        if (!loadQueues[0].empty()) {
+            entry = std::move(loadQueues[0].front());
+            loadQueues[0].pop_front();
+        } else if (!loadQueues[1].empty()) {
+            entry = std::move(loadQueues[1].front());
+            loadQueues[1].pop_front();
+        } else if (!loadQueues[2].empty() && streamingActive < streamingLimit) {
+            entry = std::move(loadQueues[2].front());
+            loadQueues[2].pop_front();
+            streaming = true;
+            ++streamingActive;
+        } else {
+            return;  // Stopping and drained
+        }
+
+        lock.unlock();
+        RunPending(entry);
+        entry.reset();
+        lock.lock();
+
+        if (streaming) {
+            --streamingActive;
+            queueChanged.notify_all();
+        }
+    }
+}
+
+void ResourceManager::StopLoaderThreads() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stoppingLoaders = true;
+    }
+    queueChanged.notify_all();
+
+    // Threads exit once the queues are drained; new work queued meanwhile is still served
+    for (auto& thread : loaderThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+    loaderThreads.clear();
+    stoppingLoaders = false;
+}
+
+void ResourceManager::SetLoaderThreadCount(size_t count) {
+    StopLoaderThreads();
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+    loaderThreadCount = count;
+}
+
+void ResourceManager::WaitForPendingLoads() {
+    for (;;) {
+        std::vector<std::shared_future<std::shared_ptr<Resource>>> futures;
+
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            for (const auto& typePair : pending) {
+                for (const auto& entryPair : typePair.second) {
+                    futures.push_back(entryPair.second->future);
+                }
+            }
+        }
+
+        if (futures.empty()) return;
+
+        for (auto& future : futures) {
+            future.wait();
+        }
+    }
+}
+
+size_t ResourceManager::GetPendingLoadCount() const {
+    std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(cacheMutex));
+
+    size_t count = 0;
+    for (const auto& typePair : pending) {
+        count += typePair.second.size();
+    }
+    return count;
+}
+
 // === Hot Reload ===
 
 void ResourceManager::CheckHotReload() {
     if (!hotReloadEnabled) return;
 
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
-    // Iterate through all cached resources
-    for (auto& typePair : cache) {
-        for (auto& resourcePair : typePair.second) {
-            const std::string& path = resourcePair.first;
-            auto resource = resourcePair.second;
+    // Snapshot the cache so stat() and reloads run without holding the lock
+    std::vector<std::pair<std::string, std::shared_ptr<Resource>>> resources;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for (auto& typePair : cache) {
+            for (auto& resourcePair : typePair.second) {
+                resources.emplace_back(resourcePair.first, resourcePair.second);
+            }
+        }
+    }
 
-            // Check file modification time
-            struct stat fileStat;
-            if (stat(path.c_str(), &fileStat) == 0) {
-                time_t currentMTime = fileStat.st_mtime;
-
-                // Check if file has been modified
-                auto it = fileTimestamps.find(path);
-                if (it != fileTimestamps.end()) {
-                    if (currentMTime > it->second) {
-                        // File modified, reload
-                        std::cout << "[ResourceManager] Hot-reloading: " << path << std::endl;
-
-                        size_t oldSize = resource->GetMemorySize();
-                        bool success = resource->Reload();
-
-                        if (success) {
-                            size_t newSize = resource->GetMemorySize();
-                            totalMemoryUsed = totalMemoryUsed - oldSize + newSize;
-                            fileTimestamps[path] = currentMTime;
-                            std::cout << "[ResourceManager] Hot-reload successful: " << path << std::endl;
-                        } else {
-                            std::cout << "[ResourceManager] Hot-reload failed: " << path << std::endl;
-                        }
-                    }
-                } else {
-                    // First time tracking this file
-                    fileTimestamps[path] = currentMTime;
-                }
+    for (auto& entry : resources) {
+        const std::string& path = entry.first;
+        auto& resource = entry.second;
+
+        // Check file modification time
+        struct stat fileStat;
+        if (stat(path.c_str(), &fileStat) != 0) continue;
+        time_t currentMTime = fileStat.st_mtime;
+
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            auto it = fileTimestamps.find(path);
+            if (it == fileTimestamps.end()) {
+                // First time tracking this file
+                fileTimestamps[path] = currentMTime;
+                continue;
             }
+            if (currentMTime <= it->second) continue;
+        }
+
+        // File modified, reload
+        std::cout << "[ResourceManager] Hot-reloading: " << path << std::endl;
+
+        size_t oldSize = resource->GetMemorySize();
+        bool success = resource->Reload();
+
+        if (success) {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            totalMemoryUsed = totalMemoryUsed - oldSize + resource->GetMemorySize();
+            fileTimestamps[path] = currentMTime;
+        }
+
+        if (success) {
+            std::cout << "[ResourceManager] Hot-reload successful: " << path << std::endl;
+        } else {
+            std::cout << "[ResourceManager] Hot-reload failed: " << path << std::endl;
         }
     }
 }
@@ -159,8 +363,13 @@ size_t ResourceManager::GetCachedResourceCount() const {
 void ResourceManager::PrintStatistics() {
     std::lock_guard<std::mutex> lock(cacheMutex);
 
+    size_t cachedCount = 0;
+    for (const auto& typePair : cache) {
+        cachedCount += typePair.second.size();
+    }
+
     std::cout << "\n=== Resource Manager Statistics ===" << std::endl;
-    std::cout << "Total cached resources: " << GetCachedResourceCount() << std::endl;
+    std::cout << "Total cached resources: " << cachedCount << std::endl;
     std::cout << "Total memory used: " << totalMemoryUsed << " bytes";
 
     // Convert to MB if large
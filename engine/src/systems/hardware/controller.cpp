@@ -3,3 +3,13 @@
 Controller::Controller(CameraManager* cameras) {
     this->cameras = cameras;
 }
+
+RGBColor* Controller::GetDisplayColors(uint8_t index, IPixelGroup* pixelGroup) const {
+    if (displayBuffers && index < displayBufferCount && displayBuffers[index]) return displayBuffers[index];
+    return pixelGroup ? pixelGroup->GetColors() : nullptr;
+}
+
+void Controller::SetDisplayBuffers(RGBColor* const* buffers, uint8_t count) {
+    displayBuffers = buffers;
+    displayBufferCount = buffers ? count : 0;
+}
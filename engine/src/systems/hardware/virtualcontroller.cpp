@@ -1,5 +1,6 @@
 #include <ptx/systems/hardware/virtualcontroller.hpp>
 #include <cstdio>
+#include <cstring>
 
 /**
  * @file virtualcontroller.cpp
@@ -9,18 +10,20 @@
 
 VirtualController::VirtualController(CameraManager* cams,
                                      const char* ctrl_name,
-                                     const char* reg_name)
+                                     const char* reg_name,
+                                     const char* stream_prefix)
 : Controller(cams),
   ctrl_name_(ctrl_name ? ctrl_name : "/ptx_ctrl"),
-  reg_name_(reg_name ? reg_name : "/ptx_reg") {}
+  reg_name_(reg_name ? reg_name : "/ptx_reg"),
+  stream_prefix_(stream_prefix ? stream_prefix : "/ptx_") {}
 
 void VirtualController::Initialize() {
     const uint32_t camCount = (cameras ? cameras->GetCameraCount() : 0);
     cams_.clear();
     cams_.reserve(camCount);
 
-    // Create the registry once with enough capacity
-    (void)ptx_registry_init(reg_, reg_name_.c_str(), camCount);
+    // Create the registry once with enough capacity; it records the prefix for readers
+    (void)ptx_registry_init(reg_, reg_name_.c_str(), camCount, stream_prefix_.c_str());
 
     // Build per-camera streams
     for (uint32_t i = 0; i < camCount; ++i) {
@@ -44,8 +47,9 @@ void VirtualController::Initialize() {
         char namebuf[32];
         std::snprintf(namebuf, sizeof(namebuf), "Camera%u", i);
         pc.ui_name  = namebuf;
-        pc.fb_name  = std::string("/ptx_fb")   + std::to_string(i);
-        pc.geom_name= std::string("/ptx_geom") + std::to_string(i);
+        pc.fb_name  = stream_prefix_ + "fb"   + std::to_string(i);
+        pc.geom_name= stream_prefix_ + "geom" + std::to_string(i);
+        pc.delta_name = stream_prefix_ + "delta" + std::to_string(i);
 
         // Init FB (1xN) + shared control
         (void)ptx_shm_init(pc.shm, pc.fb_name.c_str(), pc.W, pc.H, ctrl_name_.c_str());
@@ -55,8 +59,8 @@ void VirtualController::Initialize() {
         pc.geom.height = logicalH;
         (void)ptx_geom_init(pc.geom, pc.geom_name.c_str(), pc.count);
 
-        pc.rgb.resize(size_t(pc.count) * 3u, 0);
-        pc.xy .resize(size_t(pc.count) * 2u, 0.f);
+        // Pixel positions are static; publish them once here rather than every frame.
+        PublishGeometry(pc, pg);
 
         // Record in registry
         ptx_registry_set(reg_, i, pc.ui_name.c_str(), i, pc.count, logicalW, logicalH);
@@ -81,21 +85,66 @@ void VirtualController::Display() {
         PerCam& pc = cams_[i];
         if (pg->GetPixelCount() != pc.count) continue;
 
-        // Fill staging (XY, RGB)
-        for (uint32_t j = 0; j < pc.count; ++j) {
-            const Vector2D coord = pg->GetCoordinate(j);
-            const RGBColor* col  = pg->GetColor(j);
+        if (pc.geom_dirty || pg != pc.pixels) PublishGeometry(pc, pg);
+
+        // Convert colors straight into the next ring slot; no staging copy.
+        PTXFbSlot slot;
+        uint8_t* out = ptx_fb_acquire(pc.shm, slot);
+        if (!out) continue;
+
+        const RGBColor* colors = GetDisplayColors(static_cast<uint8_t>(i), pg);
+        if (!colors) {
+            std::memset(out, 0, size_t(pc.count) * 3u);
+        } else {
+            for (uint32_t j = 0; j < pc.count; ++j) {
+                out[3*j + 0] = colors[j].R;
+                out[3*j + 1] = colors[j].G;
+                out[3*j + 2] = colors[j].B;
+            }
+        }
 
-            pc.xy[2*j + 0] = coord.X;
-            pc.xy[2*j + 1] = coord.Y;
+        if (delta_output_) PublishDelta(pc, slot);
 
-            pc.rgb[3*j + 0] = col ? col->R : 0;
-            pc.rgb[3*j + 1] = col ? col->G : 0;
-            pc.rgb[3*j + 2] = col ? col->B : 0;
-        }
+        ptx_fb_commit(pc.shm, slot);
+    }
+}
 
-        // Publish this camera
-        ptx_geom_publish(pc.geom, pc.xy.data(), pc.count);
-        ptx_publish_rgb888(pc.shm, pc.W, pc.H, pc.rgb.data());
+void VirtualController::InvalidateGeometry() {
+    for (PerCam& pc : cams_) pc.geom_dirty = true;
+}
+
+uint64_t VirtualController::GetGeometryGeneration(uint32_t index) const {
+    return index < cams_.size() ? ptx_geom_generation(cams_[index].geom) : 0;
+}
+
+void VirtualController::SetDeltaOutput(bool enabled) {
+    delta_output_ = enabled;
+}
+
+uint32_t VirtualController::GetDeltaBytes(uint32_t index) const {
+    return index < cams_.size() ? cams_[index].delta_bytes : 0;
+}
+
+void VirtualController::PublishDelta(PerCam& pc, const PTXFbSlot& slot) {
+    if (!pc.delta.hdr && !ptx_delta_init(pc.delta, pc.delta_name.c_str(), pc.count * 3u)) return;
+
+    // The previous frame is still in the ring slot committed last; diff against it in place.
+    const uint64_t frame = ptx_fb_frame(pc.shm);
+    const uint32_t previous = ptx_fb_active_index(pc.shm.fb_hdr).load(std::memory_order_relaxed);
+    const uint8_t* prev = frame > 0 ? ptx_payload_ptr(pc.shm, previous, pc.W, pc.H) : nullptr;
+
+    pc.delta_bytes = static_cast<uint32_t>(ptx_delta_publish(pc.delta, prev, slot.data, frame + 1));
+}
+
+void VirtualController::PublishGeometry(PerCam& pc, IPixelGroup* pg) {
+    xy_.resize(size_t(pc.count) * 2u);
+    for (uint32_t j = 0; j < pc.count; ++j) {
+        const Vector2D coord = pg->GetCoordinate(j);
+        xy_[2*j + 0] = coord.X;
+        xy_[2*j + 1] = coord.Y;
     }
+
+    (void)ptx_geom_publish_if_changed(pc.geom, xy_.data(), pc.count);
+    pc.pixels = pg;
+    pc.geom_dirty = false;
 }
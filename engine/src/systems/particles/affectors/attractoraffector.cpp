@@ -0,0 +1,38 @@
+#include <ptx/systems/particles/affectors/attractoraffector.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace ptx {
+
+AttractorAffector::AttractorAffector(const Vector3D& point, float strength, float radius)
+    : point(point), strength(strength), radius(radius > 1e-6f ? radius : 1e-6f) {
+}
+
+void AttractorAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    const float inverseRadius = 1.0f / radius;
+    const float scale = strength * deltaTime;
+
+    const float* __restrict px = span.positionX;
+    const float* __restrict py = span.positionY;
+    const float* __restrict pz = span.positionZ;
+    float* __restrict vx = span.velocityX;
+    float* __restrict vy = span.velocityY;
+    float* __restrict vz = span.velocityZ;
+
+    // Branch-free: particles outside the radius get a zero falloff.
+    for (size_t i = 0; i < span.count; ++i) {
+        const float dx = point.X - px[i];
+        const float dy = point.Y - py[i];
+        const float dz = point.Z - pz[i];
+        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        const float falloff = std::max(0.0f, 1.0f - distance * inverseRadius);
+        const float impulse = scale * falloff / std::max(distance, 1e-6f);
+
+        vx[i] += dx * impulse;
+        vy[i] += dy * impulse;
+        vz[i] += dz * impulse;
+    }
+}
+
+} // namespace ptx
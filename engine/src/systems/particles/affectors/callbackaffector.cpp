@@ -0,0 +1,16 @@
+#include <ptx/systems/particles/affectors/callbackaffector.hpp>
+#include <utility>
+
+namespace ptx {
+
+CallbackAffector::CallbackAffector(ParticleBatchCallback callback, ParticleAffectorStage stage)
+    : callback(std::move(callback)), stage(stage) {
+}
+
+void CallbackAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    if (callback && span.count > 0) {
+        callback(span, deltaTime);
+    }
+}
+
+} // namespace ptx
@@ -0,0 +1,25 @@
+#include <ptx/systems/particles/affectors/dragaffector.hpp>
+#include <algorithm>
+
+namespace ptx {
+
+DragAffector::DragAffector(float coefficient)
+    : coefficient(coefficient > 0.0f ? coefficient : 0.0f) {
+}
+
+void DragAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    // First-order damping; clamped so a long step stops the particle instead of reversing it.
+    const float scale = std::max(0.0f, 1.0f - coefficient * deltaTime);
+
+    float* __restrict vx = span.velocityX;
+    float* __restrict vy = span.velocityY;
+    float* __restrict vz = span.velocityZ;
+
+    for (size_t i = 0; i < span.count; ++i) {
+        vx[i] *= scale;
+        vy[i] *= scale;
+        vz[i] *= scale;
+    }
+}
+
+} // namespace ptx
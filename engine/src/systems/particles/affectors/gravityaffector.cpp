@@ -0,0 +1,25 @@
+#include <ptx/systems/particles/affectors/gravityaffector.hpp>
+
+namespace ptx {
+
+GravityAffector::GravityAffector(const Vector3D& acceleration)
+    : acceleration(acceleration) {
+}
+
+void GravityAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    const float ax = acceleration.X * deltaTime;
+    const float ay = acceleration.Y * deltaTime;
+    const float az = acceleration.Z * deltaTime;
+
+    float* __restrict vx = span.velocityX;
+    float* __restrict vy = span.velocityY;
+    float* __restrict vz = span.velocityZ;
+
+    for (size_t i = 0; i < span.count; ++i) {
+        vx[i] += ax;
+        vy[i] += ay;
+        vz[i] += az;
+    }
+}
+
+} // namespace ptx
@@ -0,0 +1,54 @@
+#include <ptx/systems/particles/affectors/planecollisionaffector.hpp>
+
+namespace ptx {
+
+PlaneCollisionAffector::PlaneCollisionAffector(const Vector3D& normal, float offset, float bounce, float friction)
+    : normal(0, 1, 0), offset(0.0f), bounce(bounce), friction(friction) {
+    SetPlane(normal, offset);
+}
+
+void PlaneCollisionAffector::SetPlane(const Vector3D& planeNormal, float planeOffset) {
+    const float length = planeNormal.Magnitude();
+    if (length > 1e-6f) normal = planeNormal / length;
+    offset = planeOffset;
+}
+
+void PlaneCollisionAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    (void)deltaTime;
+
+    const float nx = normal.X;
+    const float ny = normal.Y;
+    const float nz = normal.Z;
+    const float tangentScale = 1.0f - friction;
+
+    float* __restrict px = span.positionX;
+    float* __restrict py = span.positionY;
+    float* __restrict pz = span.positionZ;
+    float* __restrict vx = span.velocityX;
+    float* __restrict vy = span.velocityY;
+    float* __restrict vz = span.velocityZ;
+
+    for (size_t i = 0; i < span.count; ++i) {
+        const float depth = px[i] * nx + py[i] * ny + pz[i] * nz - offset;
+        if (depth >= 0.0f) continue;
+
+        px[i] -= nx * depth;
+        py[i] -= ny * depth;
+        pz[i] -= nz * depth;
+
+        const float normalSpeed = vx[i] * nx + vy[i] * ny + vz[i] * nz;
+        if (normalSpeed >= 0.0f) continue;
+
+        // Split into normal and tangent, reflect the normal part.
+        const float tx = vx[i] - nx * normalSpeed;
+        const float ty = vy[i] - ny * normalSpeed;
+        const float tz = vz[i] - nz * normalSpeed;
+        const float reflected = -normalSpeed * bounce;
+
+        vx[i] = tx * tangentScale + nx * reflected;
+        vy[i] = ty * tangentScale + ny * reflected;
+        vz[i] = tz * tangentScale + nz * reflected;
+    }
+}
+
+} // namespace ptx
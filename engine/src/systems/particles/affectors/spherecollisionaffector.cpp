@@ -0,0 +1,66 @@
+#include <ptx/systems/particles/affectors/spherecollisionaffector.hpp>
+#include <cmath>
+
+namespace ptx {
+
+SphereCollisionAffector::SphereCollisionAffector(const Vector3D& center, float radius, float bounce,
+                                                 float friction, bool contain)
+    : center(center), radius(radius > 0.0f ? radius : 0.0f), bounce(bounce), friction(friction), contain(contain) {
+}
+
+void SphereCollisionAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    (void)deltaTime;
+
+    const float radiusSquared = radius * radius;
+    const float tangentScale = 1.0f - friction;
+    // Outward normal for obstacles, inward for containers.
+    const float side = contain ? -1.0f : 1.0f;
+
+    float* __restrict px = span.positionX;
+    float* __restrict py = span.positionY;
+    float* __restrict pz = span.positionZ;
+    float* __restrict vx = span.velocityX;
+    float* __restrict vy = span.velocityY;
+    float* __restrict vz = span.velocityZ;
+
+    for (size_t i = 0; i < span.count; ++i) {
+        const float dx = px[i] - center.X;
+        const float dy = py[i] - center.Y;
+        const float dz = pz[i] - center.Z;
+        const float distanceSquared = dx * dx + dy * dy + dz * dz;
+
+        if (contain ? distanceSquared <= radiusSquared : distanceSquared >= radiusSquared) continue;
+
+        float nx, ny, nz;
+        const float distance = std::sqrt(distanceSquared);
+        if (distance > 1e-6f) {
+            const float inverse = side / distance;
+            nx = dx * inverse;
+            ny = dy * inverse;
+            nz = dz * inverse;
+        } else {
+            nx = 0.0f;
+            ny = side;
+            nz = 0.0f;
+        }
+
+        // Onto the surface (n * side points away from the center).
+        px[i] = center.X + nx * side * radius;
+        py[i] = center.Y + ny * side * radius;
+        pz[i] = center.Z + nz * side * radius;
+
+        const float normalSpeed = vx[i] * nx + vy[i] * ny + vz[i] * nz;
+        if (normalSpeed >= 0.0f) continue;
+
+        const float tx = vx[i] - nx * normalSpeed;
+        const float ty = vy[i] - ny * normalSpeed;
+        const float tz = vz[i] - nz * normalSpeed;
+        const float reflected = -normalSpeed * bounce;
+
+        vx[i] = tx * tangentScale + nx * reflected;
+        vy[i] = ty * tangentScale + ny * reflected;
+        vz[i] = tz * tangentScale + nz * reflected;
+    }
+}
+
+} // namespace ptx
@@ -0,0 +1,43 @@
+#include <ptx/systems/particles/affectors/turbulenceaffector.hpp>
+
+namespace ptx {
+
+namespace {
+
+// Per-axis lookups offset far apart in noise space so the components are decorrelated.
+constexpr float kOffsetY = 31.416f;
+constexpr float kOffsetZ = 47.853f;
+
+} // namespace
+
+TurbulenceAffector::TurbulenceAffector(const SimplexNoise* noise, float strength, float frequency, float speed)
+    : noise(noise), strength(strength), frequency(frequency), speed(speed), time(0.0f) {
+}
+
+void TurbulenceAffector::Prepare(float deltaTime) {
+    time += speed * deltaTime;
+}
+
+void TurbulenceAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    if (noise == nullptr) return;
+
+    const float scale = strength * deltaTime;
+    const float* __restrict px = span.positionX;
+    const float* __restrict py = span.positionY;
+    const float* __restrict pz = span.positionZ;
+    float* __restrict vx = span.velocityX;
+    float* __restrict vy = span.velocityY;
+    float* __restrict vz = span.velocityZ;
+
+    for (size_t i = 0; i < span.count; ++i) {
+        const float x = px[i] * frequency;
+        const float y = py[i] * frequency;
+        const float z = pz[i] * frequency + time;
+
+        vx[i] += noise->Noise(x, y, z) * scale;
+        vy[i] += noise->Noise(x + kOffsetY, y, z) * scale;
+        vz[i] += noise->Noise(x, y + kOffsetZ, z) * scale;
+    }
+}
+
+} // namespace ptx
@@ -0,0 +1,25 @@
+#include <ptx/systems/particles/affectors/vectorfieldaffector.hpp>
+#include <algorithm>
+
+namespace ptx {
+
+VectorFieldAffector::VectorFieldAffector(const VectorField2D* field, float strength)
+    : field(field), strength(strength) {
+}
+
+void VectorFieldAffector::Apply(const ParticleSpan& span, float deltaTime) {
+    if (field == nullptr) return;
+
+    const float blend = std::min(1.0f, std::max(0.0f, strength * deltaTime));
+
+    for (size_t i = 0; i < span.count; ++i) {
+        bool inBounds = false;
+        const Vector2D velocity = field->SampleVelocity(span.positionX[i], span.positionY[i], inBounds);
+        if (!inBounds) continue;
+
+        span.velocityX[i] += (velocity.X - span.velocityX[i]) * blend;
+        span.velocityY[i] += (velocity.Y - span.velocityY[i]) * blend;
+    }
+}
+
+} // namespace ptx
@@ -1,18 +1,25 @@
 #include <ptx/systems/particles/particleemitter.hpp>
 #include <cmath>
-#include <cstdlib>
 #include <algorithm>
+#include <utility>
 
 namespace ptx {
 
+namespace {
+
+constexpr uint64_t kDefaultSeed = 0x853c49e6748fea9bULL;
+
+} // namespace
+
 ParticleEmitter::ParticleEmitter()
-    : transform(), config(), emissionTimer(0.0f), durationTimer(0.0f), isPlaying(false) {
-    particles.resize(config.maxParticles);
+    : ParticleEmitter(ParticleEmitterConfig()) {
 }
 
 ParticleEmitter::ParticleEmitter(const ParticleEmitterConfig& cfg)
-    : transform(), config(cfg), emissionTimer(0.0f), durationTimer(0.0f), isPlaying(false) {
-    particles.resize(config.maxParticles);
+    : transform(), config(cfg), pool(static_cast<size_t>(std::max(config.maxParticles, 0))),
+      emissionTimer(0.0f), durationTimer(0.0f), isPlaying(false),
+      random(kDefaultSeed), seed(kDefaultSeed), updateCount(0), chunkSize(kDefaultChunkSize),
+      updating(false), updateDelta(0.0f), spawnBegin(0), spawnEnd(0), chunkCount(0), lastRetired(0) {
 }
 
 ParticleEmitter::~ParticleEmitter() {
@@ -37,7 +44,19 @@ void ParticleEmitter::Pause() {
 // === Update ===
 
 void ParticleEmitter::Update(float deltaTime) {
-    if (deltaTime <= 0.0f) return;
+    const size_t chunks = BeginUpdate(deltaTime);
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        UpdateChunk(chunk);
+    }
+    EndUpdate();
+}
+
+size_t ParticleEmitter::BeginUpdate(float deltaTime) {
+    updating = false;
+    chunkCount = 0;
+    spawnBegin = spawnEnd = pool.GetAliveCount();
+    lastRetired = 0;
+    if (deltaTime <= 0.0f) return 0;
 
     // Update duration timer
     if (isPlaying) {
@@ -48,53 +67,124 @@ void ParticleEmitter::Update(float deltaTime) {
             Pause();
         }
 
-        // Emit particles based on emission rate
+        // Claim slots at the emission rate; chunks initialize them
         if (isPlaying) {
             emissionTimer += deltaTime;
             float emissionInterval = 1.0f / config.emissionRate;
 
             while (emissionTimer >= emissionInterval) {
-                Emit();
+                if (pool.Spawn() == ParticlePool::kInvalidIndex) {
+                    emissionTimer = std::fmod(emissionTimer, emissionInterval);
+                    break;
+                }
                 emissionTimer -= emissionInterval;
             }
+            spawnEnd = pool.GetAliveCount();
         }
     }
 
-    // Update all active particles
-    for (Particle& particle : particles) {
-        if (!particle.active) continue;
+    for (auto& affector : affectors) {
+        if (affector->IsEnabled()) affector->Prepare(deltaTime);
+    }
 
-        // Update age
-        particle.age += deltaTime;
+    updating = true;
+    updateDelta = deltaTime;
+    gradient = GetGradient();
+    ++updateCount;
 
-        // Kill old particles
-        if (particle.age >= particle.lifetime) {
-            particle.active = false;
-            continue;
+    chunkCount = (pool.GetAliveCount() + chunkSize - 1) / chunkSize;
+    if (expired.size() < chunkCount) expired.resize(chunkCount);
+    return chunkCount;
+}
+
+void ParticleEmitter::UpdateChunk(size_t chunk) {
+    if (!updating || chunk >= chunkCount) return;
+
+    const size_t begin = chunk * chunkSize;
+    const size_t end = std::min(begin + chunkSize, pool.GetAliveCount());
+    const ParticleSpan span = pool.GetSpan().Slice(begin, end);
+
+    // New particles in this chunk draw from a stream unique to (seed, update, chunk).
+    const size_t initBegin = std::max(begin, spawnBegin);
+    const size_t initEnd = std::min(end, spawnEnd);
+    if (initBegin < initEnd) {
+        RandomStream stream(RandomStream::Mix(seed, updateCount), chunk);
+        for (size_t index = initBegin; index < initEnd; ++index) {
+            InitializeParticle(index, stream);
         }
+    }
 
-        // Update physics
-        particle.velocity = particle.velocity + particle.acceleration * deltaTime;
-        particle.position = particle.position + particle.velocity * deltaTime;
+    float* __restrict ages = span.age;
+    for (size_t i = 0; i < span.count; ++i) {
+        ages[i] += updateDelta;
+    }
+
+    RunAffectors(ParticleAffectorStage::Forces, span, updateDelta);
+    ParticlePool::Integrate(span, updateDelta, config.gravity, gradient);
+    RunAffectors(ParticleAffectorStage::Constraints, span, updateDelta);
+
+    // Affectors may expire particles too, so collect after they run.
+    std::vector<uint32_t>& dead = expired[chunk];
+    dead.clear();
+    for (size_t i = 0; i < span.count; ++i) {
+        if (span.age[i] * span.inverseLifetime[i] >= 1.0f) {
+            dead.push_back(static_cast<uint32_t>(begin + i));
+        }
+    }
+}
 
-        // Update rotation
-        particle.rotation += particle.rotationSpeed * deltaTime;
+void ParticleEmitter::EndUpdate() {
+    if (!updating) return;
+    updating = false;
 
-        // Update size, color, alpha based on lifetime progress
-        float t = particle.GetLifetimeProgress();
+    // Descending order: every particle swapped into a hole is one already known to be alive.
+    for (size_t chunk = chunkCount; chunk > 0; --chunk) {
+        const std::vector<uint32_t>& dead = expired[chunk - 1];
+        for (size_t i = dead.size(); i > 0; --i) {
+            pool.Kill(dead[i - 1]);
+        }
+        lastRetired += dead.size();
+    }
 
-        particle.size = particle.sizeStart + (particle.sizeEnd - particle.sizeStart) * t;
+    if (!updateCallbacks.empty()) {
+        const size_t before = pool.GetAliveCount();
+        RunUpdateCallbacks(updateDelta);
+        lastRetired += before - pool.GetAliveCount();
+    }
+}
 
-        particle.color.x = particle.colorStart.x + (particle.colorEnd.x - particle.colorStart.x) * t;
-        particle.color.y = particle.colorStart.y + (particle.colorEnd.y - particle.colorStart.y) * t;
-        particle.color.z = particle.colorStart.z + (particle.colorEnd.z - particle.colorStart.z) * t;
+void ParticleEmitter::RunAffectors(ParticleAffectorStage stage, const ParticleSpan& span, float deltaTime) {
+    for (auto& affector : affectors) {
+        if (affector->IsEnabled() && affector->GetStage() == stage) {
+            affector->Apply(span, deltaTime);
+        }
+    }
+}
 
-        particle.alpha = particle.alphaStart + (particle.alphaEnd - particle.alphaStart) * t;
+void ParticleEmitter::RunUpdateCallbacks(float deltaTime) {
+    // Backwards so a swap-removed slot is refilled by a particle that was already visited.
+    for (size_t i = pool.GetAliveCount(); i > 0; --i) {
+        const size_t index = i - 1;
+        Particle particle = GetParticle(index);
 
-        // Apply custom update callbacks
         for (auto& callback : updateCallbacks) {
             callback(particle, deltaTime);
         }
+
+        if (!particle.IsAlive()) {
+            pool.Kill(index);
+            continue;
+        }
+
+        pool.SetPosition(index, particle.position);
+        pool.SetVelocity(index, particle.velocity);
+        pool.SetAge(index, particle.age);
+        pool.SetLifetime(index, particle.lifetime);
+        pool.SetSize(index, particle.size);
+        pool.SetColor(index, particle.color);
+        pool.SetAlpha(index, particle.alpha);
+        pool.SetRotation(index, particle.rotation);
+        pool.SetRotationSpeed(index, particle.rotationSpeed);
     }
 }
 
@@ -104,29 +194,73 @@ void ParticleEmitter::SetConfig(const ParticleEmitterConfig& cfg) {
     config = cfg;
 
     // Resize particle pool if necessary
-    if (particles.size() != static_cast<size_t>(config.maxParticles)) {
-        particles.resize(config.maxParticles);
+    const size_t capacity = static_cast<size_t>(std::max(config.maxParticles, 0));
+    if (pool.GetCapacity() != capacity) {
+        pool.SetCapacity(capacity);
     }
 }
 
-int ParticleEmitter::GetActiveParticleCount() const {
-    int count = 0;
-    for (const Particle& particle : particles) {
-        if (particle.active) {
-            count++;
-        }
-    }
-    return count;
+Particle ParticleEmitter::GetParticle(size_t index) const {
+    Particle particle;
+    if (index >= pool.GetAliveCount()) return particle;
+
+    particle.position = pool.GetPosition(index);
+    particle.velocity = pool.GetVelocity(index);
+    particle.acceleration = config.gravity;
+    particle.lifetime = pool.GetLifetime(index);
+    particle.age = pool.GetAge(index);
+    particle.size = pool.GetSize(index);
+    particle.sizeStart = config.sizeStart;
+    particle.sizeEnd = config.sizeEnd;
+    particle.color = pool.GetColor(index);
+    particle.colorStart = config.colorStart;
+    particle.colorEnd = config.colorEnd;
+    particle.alpha = pool.GetAlpha(index);
+    particle.alphaStart = config.alphaStart;
+    particle.alphaEnd = config.alphaEnd;
+    particle.rotation = pool.GetRotation(index);
+    particle.rotationSpeed = pool.GetRotationSpeed(index);
+    particle.active = true;
+    return particle;
 }
 
 void ParticleEmitter::Clear() {
-    for (Particle& particle : particles) {
-        particle.active = false;
-    }
+    pool.Clear();
     emissionTimer = 0.0f;
     durationTimer = 0.0f;
 }
 
+// === Affectors ===
+
+void ParticleEmitter::SetSeed(uint64_t value) {
+    seed = value;
+    updateCount = 0;
+    random.Seed(value, 0);
+}
+
+void ParticleEmitter::AddAffector(std::shared_ptr<ParticleAffector> affector) {
+    if (affector) affectors.push_back(std::move(affector));
+}
+
+bool ParticleEmitter::RemoveAffector(const std::shared_ptr<ParticleAffector>& affector) {
+    auto it = std::find(affectors.begin(), affectors.end(), affector);
+    if (it == affectors.end()) return false;
+
+    affectors.erase(it);
+    return true;
+}
+
+void ParticleEmitter::ClearAffectors() {
+    affectors.clear();
+}
+
+std::shared_ptr<ParticleAffector> ParticleEmitter::AddBatchCallback(ParticleBatchCallback callback,
+                                                                    ParticleAffectorStage stage) {
+    auto affector = std::make_shared<CallbackAffector>(std::move(callback), stage);
+    affectors.push_back(affector);
+    return affector;
+}
+
 // === Custom Updates ===
 
 void ParticleEmitter::AddUpdateCallback(ParticleUpdateCallback callback) {
@@ -140,12 +274,12 @@ void ParticleEmitter::ClearUpdateCallbacks() {
 // === Emission ===
 
 void ParticleEmitter::Emit() {
-    Particle* particle = GetInactiveParticle();
-    if (particle == nullptr) {
+    const size_t index = pool.Spawn();
+    if (index == ParticlePool::kInvalidIndex) {
         return;  // No free particles
     }
 
-    InitializeParticle(*particle);
+    InitializeParticle(index, random);
 }
 
 void ParticleEmitter::EmitBurst(int count) {
@@ -156,20 +290,21 @@ void ParticleEmitter::EmitBurst(int count) {
 
 // === Private Methods ===
 
-void ParticleEmitter::InitializeParticle(Particle& particle) {
-    // Position based on emitter shape
+void ParticleEmitter::InitializeParticle(size_t index, RandomStream& stream) {
+    // Position based on emitter shape; shapes that imply a direction override the velocity
     Vector3D emitterPos = transform.GetPosition();
+    Vector3D position = emitterPos;
+    Vector3D velocity = RandomRange(stream, config.velocityMin, config.velocityMax);
 
     switch (config.shape) {
     case EmitterShape::Point:
-        particle.position = emitterPos;
         break;
 
     case EmitterShape::Sphere: {
         // Random point on sphere surface
-        float theta = RandomRange(0.0f, 2.0f * 3.14159f);
-        float phi = RandomRange(0.0f, 3.14159f);
-        float radius = config.shapeSize.x;
+        float theta = RandomRange(stream, 0.0f, 2.0f * 3.14159f);
+        float phi = RandomRange(stream, 0.0f, 3.14159f);
+        float radius = config.shapeSize.X;
 
         Vector3D offset(
             radius * std::sin(phi) * std::cos(theta),
@@ -177,22 +312,22 @@ void ParticleEmitter::InitializeParticle(Particle& particle) {
             radius * std::cos(phi)
         );
 
-        particle.position = emitterPos + offset;
+        position = emitterPos + offset;
         break;
     }
 
     case EmitterShape::Box: {
         // Random point in box volume
-        Vector3D offset = RandomRange(-config.shapeSize, config.shapeSize);
-        particle.position = emitterPos + offset;
+        Vector3D offset = RandomRange(stream, config.shapeSize * -1.0f, config.shapeSize);
+        position = emitterPos + offset;
         break;
     }
 
     case EmitterShape::Cone: {
         // Random direction in cone
-        float angle = config.shapeSize.x;  // Cone angle
-        float randomAngle = RandomRange(-angle, angle);
-        float randomRotation = RandomRange(0.0f, 2.0f * 3.14159f);
+        float angle = config.shapeSize.X;  // Cone angle
+        float randomAngle = RandomRange(stream, -angle, angle);
+        float randomRotation = RandomRange(stream, 0.0f, 2.0f * 3.14159f);
 
         Vector3D direction(
             std::sin(randomAngle) * std::cos(randomRotation),
@@ -200,15 +335,14 @@ void ParticleEmitter::InitializeParticle(Particle& particle) {
             std::sin(randomAngle) * std::sin(randomRotation)
         );
 
-        particle.position = emitterPos;
-        particle.velocity = direction * RandomRange(config.velocityMin.length(), config.velocityMax.length());
+        velocity = direction * RandomRange(stream, config.velocityMin.Magnitude(), config.velocityMax.Magnitude());
         break;
     }
 
     case EmitterShape::Circle: {
         // Random point on circle
-        float angle = RandomRange(0.0f, 2.0f * 3.14159f);
-        float radius = config.shapeSize.x;
+        float angle = RandomRange(stream, 0.0f, 2.0f * 3.14159f);
+        float radius = config.shapeSize.X;
 
         Vector3D offset(
             radius * std::cos(angle),
@@ -216,56 +350,44 @@ void ParticleEmitter::InitializeParticle(Particle& particle) {
             radius * std::sin(angle)
         );
 
-        particle.position = emitterPos + offset;
+        position = emitterPos + offset;
         break;
     }
     }
 
     // Initialize particle properties
-    particle.velocity = RandomRange(config.velocityMin, config.velocityMax);
-    particle.acceleration = config.gravity;
-
-    particle.lifetime = RandomRange(config.lifetimeMin, config.lifetimeMax);
-    particle.age = 0.0f;
-
-    particle.sizeStart = config.sizeStart;
-    particle.sizeEnd = config.sizeEnd;
-    particle.size = particle.sizeStart;
-
-    particle.colorStart = config.colorStart;
-    particle.colorEnd = config.colorEnd;
-    particle.color = particle.colorStart;
-
-    particle.alphaStart = config.alphaStart;
-    particle.alphaEnd = config.alphaEnd;
-    particle.alpha = particle.alphaStart;
-
-    particle.rotation = 0.0f;
-    particle.rotationSpeed = RandomRange(config.rotationSpeedMin, config.rotationSpeedMax);
+    pool.SetPosition(index, position);
+    pool.SetVelocity(index, velocity);
+    pool.SetLifetime(index, RandomRange(stream, config.lifetimeMin, config.lifetimeMax));
+    pool.SetAge(index, 0.0f);
+    pool.SetSize(index, config.sizeStart);
+    pool.SetColor(index, config.colorStart);
+    pool.SetAlpha(index, config.alphaStart);
+    pool.SetRotation(index, 0.0f);
+    pool.SetRotationSpeed(index, RandomRange(stream, config.rotationSpeedMin, config.rotationSpeedMax));
+}
 
-    particle.active = true;
+ParticleGradient ParticleEmitter::GetGradient() const {
+    ParticleGradient gradient;
+    gradient.sizeStart = config.sizeStart;
+    gradient.sizeEnd = config.sizeEnd;
+    gradient.colorStart = config.colorStart;
+    gradient.colorEnd = config.colorEnd;
+    gradient.alphaStart = config.alphaStart;
+    gradient.alphaEnd = config.alphaEnd;
+    return gradient;
 }
 
-float ParticleEmitter::RandomRange(float min, float max) {
-    float random = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-    return min + random * (max - min);
+float ParticleEmitter::RandomRange(RandomStream& stream, float min, float max) {
+    return stream.Float(min, max);
 }
 
-Vector3D ParticleEmitter::RandomRange(const Vector3D& min, const Vector3D& max) {
+Vector3D ParticleEmitter::RandomRange(RandomStream& stream, const Vector3D& min, const Vector3D& max) {
     return Vector3D(
-        RandomRange(min.x, max.x),
-        RandomRange(min.y, max.y),
-        RandomRange(min.z, max.z)
+        RandomRange(stream, min.X, max.X),
+        RandomRange(stream, min.Y, max.Y),
+        RandomRange(stream, min.Z, max.Z)
     );
 }
 
-Particle* ParticleEmitter::GetInactiveParticle() {
-    for (Particle& particle : particles) {
-        if (!particle.active) {
-            return &particle;
-        }
-    }
-    return nullptr;
-}
-
 } // namespace ptx
@@ -0,0 +1,226 @@
+#include <ptx/systems/particles/particlepool.hpp>
+#include <algorithm>
+
+namespace ptx {
+
+ParticleSpan ParticleSpan::Slice(size_t begin, size_t end) const {
+    ParticleSpan slice;
+    end = std::min(end, count);
+    begin = std::min(begin, end);
+
+    slice.count = end - begin;
+    slice.positionX = positionX + begin;
+    slice.positionY = positionY + begin;
+    slice.positionZ = positionZ + begin;
+    slice.velocityX = velocityX + begin;
+    slice.velocityY = velocityY + begin;
+    slice.velocityZ = velocityZ + begin;
+    slice.age = age + begin;
+    slice.inverseLifetime = inverseLifetime + begin;
+    slice.size = size + begin;
+    slice.colorR = colorR + begin;
+    slice.colorG = colorG + begin;
+    slice.colorB = colorB + begin;
+    slice.alpha = alpha + begin;
+    slice.rotation = rotation + begin;
+    slice.rotationSpeed = rotationSpeed + begin;
+    return slice;
+}
+
+ParticlePool::ParticlePool(size_t capacity)
+    : capacity(0), aliveCount(0) {
+    SetCapacity(capacity);
+}
+
+// === Capacity ===
+
+void ParticlePool::SetCapacity(size_t newCapacity) {
+    for (std::vector<float>* stream : { &positionX, &positionY, &positionZ,
+                                        &velocityX, &velocityY, &velocityZ,
+                                        &age, &inverseLifetime, &size,
+                                        &colorR, &colorG, &colorB, &alpha,
+                                        &rotation, &rotationSpeed }) {
+        stream->resize(newCapacity);
+    }
+
+    capacity = newCapacity;
+    aliveCount = std::min(aliveCount, capacity);
+}
+
+// === Lifecycle ===
+
+size_t ParticlePool::Spawn() {
+    if (aliveCount >= capacity) return kInvalidIndex;
+
+    const size_t index = aliveCount++;
+    positionX[index] = positionY[index] = positionZ[index] = 0.0f;
+    velocityX[index] = velocityY[index] = velocityZ[index] = 0.0f;
+    age[index] = 0.0f;
+    inverseLifetime[index] = 1.0f;
+    size[index] = 1.0f;
+    colorR[index] = colorG[index] = colorB[index] = 1.0f;
+    alpha[index] = 1.0f;
+    rotation[index] = 0.0f;
+    rotationSpeed[index] = 0.0f;
+    return index;
+}
+
+void ParticlePool::Kill(size_t index) {
+    if (index >= aliveCount) return;
+
+    const size_t last = --aliveCount;
+    if (index != last) Move(last, index);
+}
+
+void ParticlePool::Move(size_t from, size_t to) {
+    positionX[to] = positionX[from];
+    positionY[to] = positionY[from];
+    positionZ[to] = positionZ[from];
+    velocityX[to] = velocityX[from];
+    velocityY[to] = velocityY[from];
+    velocityZ[to] = velocityZ[from];
+    age[to] = age[from];
+    inverseLifetime[to] = inverseLifetime[from];
+    size[to] = size[from];
+    colorR[to] = colorR[from];
+    colorG[to] = colorG[from];
+    colorB[to] = colorB[from];
+    alpha[to] = alpha[from];
+    rotation[to] = rotation[from];
+    rotationSpeed[to] = rotationSpeed[from];
+}
+
+// === Simulation ===
+
+size_t ParticlePool::Age(float deltaTime) {
+    float* __restrict ages = age.data();
+    const float* __restrict inverse = inverseLifetime.data();
+    const size_t count = aliveCount;
+
+    for (size_t i = 0; i < count; ++i) {
+        ages[i] += deltaTime;
+    }
+
+    // Walk backwards so a particle swapped in from the end has already been checked.
+    size_t removed = 0;
+    for (size_t i = count; i > 0; --i) {
+        if (ages[i - 1] * inverse[i - 1] >= 1.0f) {
+            Kill(i - 1);
+            ++removed;
+        }
+    }
+
+    return removed;
+}
+
+void ParticlePool::Integrate(float deltaTime, const Vector3D& acceleration, const ParticleGradient& gradient) {
+    Integrate(GetSpan(), deltaTime, acceleration, gradient);
+}
+
+void ParticlePool::Integrate(const ParticleSpan& span, float deltaTime, const Vector3D& acceleration,
+                             const ParticleGradient& gradient) {
+    const size_t count = span.count;
+
+    // One attribute group per loop keeps every loop unit-stride over a few restrict streams.
+    {
+        float* __restrict px = span.positionX;
+        float* __restrict py = span.positionY;
+        float* __restrict pz = span.positionZ;
+        float* __restrict vx = span.velocityX;
+        float* __restrict vy = span.velocityY;
+        float* __restrict vz = span.velocityZ;
+        const float ax = acceleration.X * deltaTime;
+        const float ay = acceleration.Y * deltaTime;
+        const float az = acceleration.Z * deltaTime;
+
+        for (size_t i = 0; i < count; ++i) {
+            vx[i] += ax;
+            vy[i] += ay;
+            vz[i] += az;
+            px[i] += vx[i] * deltaTime;
+            py[i] += vy[i] * deltaTime;
+            pz[i] += vz[i] * deltaTime;
+        }
+    }
+
+    {
+        float* __restrict r = span.rotation;
+        const float* __restrict rs = span.rotationSpeed;
+
+        for (size_t i = 0; i < count; ++i) {
+            r[i] += rs[i] * deltaTime;
+        }
+    }
+
+    {
+        const float* __restrict ages = span.age;
+        const float* __restrict inverse = span.inverseLifetime;
+        float* __restrict s = span.size;
+        float* __restrict cr = span.colorR;
+        float* __restrict cg = span.colorG;
+        float* __restrict cb = span.colorB;
+        float* __restrict a = span.alpha;
+
+        const float s0 = gradient.sizeStart, sd = gradient.sizeEnd - gradient.sizeStart;
+        const float r0 = gradient.colorStart.X, rd = gradient.colorEnd.X - gradient.colorStart.X;
+        const float g0 = gradient.colorStart.Y, gd = gradient.colorEnd.Y - gradient.colorStart.Y;
+        const float b0 = gradient.colorStart.Z, bd = gradient.colorEnd.Z - gradient.colorStart.Z;
+        const float a0 = gradient.alphaStart, ad = gradient.alphaEnd - gradient.alphaStart;
+
+        for (size_t i = 0; i < count; ++i) {
+            const float t = std::min(ages[i] * inverse[i], 1.0f);
+            s[i] = s0 + sd * t;
+            cr[i] = r0 + rd * t;
+            cg[i] = g0 + gd * t;
+            cb[i] = b0 + bd * t;
+            a[i] = a0 + ad * t;
+        }
+    }
+}
+
+// === Access ===
+
+ParticleSpan ParticlePool::GetSpan() {
+    ParticleSpan span;
+    span.count = aliveCount;
+    span.positionX = positionX.data();
+    span.positionY = positionY.data();
+    span.positionZ = positionZ.data();
+    span.velocityX = velocityX.data();
+    span.velocityY = velocityY.data();
+    span.velocityZ = velocityZ.data();
+    span.age = age.data();
+    span.inverseLifetime = inverseLifetime.data();
+    span.size = size.data();
+    span.colorR = colorR.data();
+    span.colorG = colorG.data();
+    span.colorB = colorB.data();
+    span.alpha = alpha.data();
+    span.rotation = rotation.data();
+    span.rotationSpeed = rotationSpeed.data();
+    return span;
+}
+
+void ParticlePool::SetPosition(size_t index, const Vector3D& position) {
+    positionX[index] = position.X;
+    positionY[index] = position.Y;
+    positionZ[index] = position.Z;
+}
+
+void ParticlePool::SetVelocity(size_t index, const Vector3D& velocity) {
+    velocityX[index] = velocity.X;
+    velocityY[index] = velocity.Y;
+    velocityZ[index] = velocity.Z;
+}
+
+void ParticlePool::SetColor(size_t index, const Vector3D& color) {
+    colorR[index] = color.X;
+    colorG[index] = color.Y;
+    colorB[index] = color.Z;
+}
+
+void ParticlePool::SetLifetime(size_t index, float lifetime) {
+    inverseLifetime[index] = 1.0f / std::max(lifetime, 1e-6f);
+}
+
+} // namespace ptx
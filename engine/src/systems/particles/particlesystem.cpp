@@ -1,9 +1,12 @@
 #include <ptx/systems/particles/particlesystem.hpp>
+#include <ptx/core/platform/threadpool.hpp>
 #include <algorithm>
 
 namespace ptx {
 
-ParticleSystem::ParticleSystem() {
+ParticleSystem::ParticleSystem()
+    : parallel(true), chunkSize(ParticleEmitter::kDefaultChunkSize), seed(0),
+      emitterSerial(0) {
 }
 
 ParticleSystem::~ParticleSystem() {
@@ -12,16 +15,22 @@ ParticleSystem::~ParticleSystem() {
 
 std::shared_ptr<ParticleEmitter> ParticleSystem::CreateEmitter() {
     auto emitter = std::make_shared<ParticleEmitter>();
-    emitters.push_back(emitter);
+    AddEmitter(emitter);
     return emitter;
 }
 
 std::shared_ptr<ParticleEmitter> ParticleSystem::CreateEmitter(const ParticleEmitterConfig& config) {
     auto emitter = std::make_shared<ParticleEmitter>(config);
-    emitters.push_back(emitter);
+    AddEmitter(emitter);
     return emitter;
 }
 
+void ParticleSystem::AddEmitter(const std::shared_ptr<ParticleEmitter>& emitter) {
+    emitter->SetSeed(RandomStream::Mix(seed, emitterSerial++));
+    emitter->SetChunkSize(chunkSize);
+    emitters.push_back(emitter);
+}
+
 void ParticleSystem::RemoveEmitter(std::shared_ptr<ParticleEmitter> emitter) {
     emitters.erase(
         std::remove(emitters.begin(), emitters.end(), emitter),
@@ -33,18 +42,56 @@ void ParticleSystem::ClearEmitters() {
     emitters.clear();
 }
 
+void ParticleSystem::SetChunkSize(size_t size) {
+    chunkSize = size > 0 ? size : 1;
+    for (auto& emitter : emitters) {
+        emitter->SetChunkSize(chunkSize);
+    }
+}
+
+void ParticleSystem::SetSeed(uint64_t value) {
+    seed = value;
+    emitterSerial = 0;
+    for (auto& emitter : emitters) {
+        emitter->SetSeed(RandomStream::Mix(seed, emitterSerial++));
+    }
+}
+
 void ParticleSystem::Update(float deltaTime) {
+    if (!parallel) {
+        for (auto& emitter : emitters) {
+            emitter->Update(deltaTime);
+        }
+        return;
+    }
+
+    // Emission bookkeeping is cheap and serial; the per-particle work is chunked.
+    chunkTasks.clear();
+    for (auto& emitter : emitters) {
+        const size_t chunks = emitter->BeginUpdate(deltaTime);
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            chunkTasks.push_back({ emitter.get(), chunk });
+        }
+    }
+
+    ThreadPool::Shared().ParallelFor(chunkTasks.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            chunkTasks[i].emitter->UpdateChunk(chunkTasks[i].chunk);
+        }
+    });
+
     for (auto& emitter : emitters) {
-        emitter->Update(deltaTime);
+        emitter->EndUpdate();
     }
 }
 
 int ParticleSystem::GetTotalActiveParticles() const {
-    int total = 0;
+    // Each emitter keeps its own O(1) count, so this is one add per emitter.
+    size_t total = 0;
     for (const auto& emitter : emitters) {
-        total += emitter->GetActiveParticleCount();
+        total += emitter->GetPool().GetAliveCount();
     }
-    return total;
+    return static_cast<int>(total);
 }
 
 } // namespace ptx
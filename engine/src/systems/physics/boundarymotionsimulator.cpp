@@ -1,28 +1,72 @@
 #include <ptx/systems/physics/boundarymotionsimulator.hpp>
+#include <algorithm>
+#include <cmath>
 
 BoundaryMotionSimulator::BoundaryMotionSimulator(Mesh** objects, int objectCount, Cube* bC, float radius, float elasticity) {
-    (void)objects;
-    (void)radius;
     this->bC = bC;
     this->elasticity = elasticity;
-    sphereCount = objectCount;
 
-    spheres.reserve(objectCount);
-    for (int i = 0; i < objectCount; i++) {
-        spheres.push_back(nullptr); // Placeholder until Sphere construction is reinstated.
-        // spheres[i] = new Sphere(objects[i], radius);
+    const size_t count = objectCount > 0 ? static_cast<size_t>(objectCount) : 0;
+    positions.reserve(count);
+    velocities.reserve(count);
+    accelerationScales.reserve(count);
+    radii.reserve(count);
+    inverseMasses.reserve(count);
+    meshes.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        Mesh* mesh = objects != nullptr ? objects[i] : nullptr;
+        Vector3D position = mesh != nullptr ? mesh->GetTransform()->GetPosition() : Vector3D(0, 0, 0);
+        AddSphere(position, radius, mesh);
     }
 }
 
-void BoundaryMotionSimulator::Randomize(float range) {
-    for (int i = 0; i < sphereCount; i++) {
-        if (!spheres[i]) {
-            continue;
-        }
+BoundaryMotionSimulator::BoundaryMotionSimulator(Cube* bC, float elasticity) {
+    this->bC = bC;
+    this->elasticity = elasticity;
+}
+
+int BoundaryMotionSimulator::AddSphere(const Vector3D& position, float radius, Mesh* mesh) {
+    if (radius <= 0.0f) radius = 1.0f;
 
-        spheres[i]->velocity.X = ptx::Random::Float(0.0f, 1.0f) * range - range / 2.0f;
-        spheres[i]->velocity.Y = ptx::Random::Float(0.0f, 1.0f) * range - range / 2.0f;
-        spheres[i]->velocity.Z = ptx::Random::Float(0.0f, 1.0f) * range - range / 2.0f;
+    positions.push_back(position);
+    velocities.push_back(Vector3D(0, 0, 0));
+    accelerationScales.push_back(Vector3D(1, 1, 1));
+    radii.push_back(radius);
+    inverseMasses.push_back(1.0f / (radius * radius * radius));
+    meshes.push_back(mesh);
+
+    if (positions.size() == 1) {
+        maxRadius = radius;
+        minRadius = radius;
+    } else {
+        maxRadius = std::max(maxRadius, radius);
+        minRadius = std::min(minRadius, radius);
+    }
+
+    return static_cast<int>(positions.size() - 1);
+}
+
+void BoundaryMotionSimulator::Clear() {
+    positions.clear();
+    velocities.clear();
+    accelerationScales.clear();
+    radii.clear();
+    inverseMasses.clear();
+    meshes.clear();
+    maxRadius = 0.0f;
+    minRadius = 0.0f;
+    accumulator = 0.0f;
+    pairTests = 0;
+}
+
+void BoundaryMotionSimulator::Randomize(float range) {
+    // Acceleration ratios are drawn here once instead of every frame.
+    for (size_t i = 0; i < positions.size(); i++) {
+        velocities[i].X = ptx::Random::Float(0.0f, 1.0f) * range - range / 2.0f;
+        velocities[i].Y = ptx::Random::Float(0.0f, 1.0f) * range - range / 2.0f;
+        velocities[i].Z = ptx::Random::Float(0.0f, 1.0f) * range - range / 2.0f;
+        accelerationScales[i] = RandomRatio(2.0f);
     }
 }
 
@@ -35,23 +79,190 @@ Vector3D BoundaryMotionSimulator::RandomRatio(float range) {
 }
 
 void BoundaryMotionSimulator::Update(float dT, Vector3D acceleration, Quaternion rotation) {
-    for (int i = 0; i < sphereCount; i++) {
-        if (!spheres[i]) {
-            continue;
+    // Maintain momentum in the rotating frame of the boundary.
+    Quaternion rotationChange = rotation.Multiply(previousRotation.MultiplicativeInverse());
+    for (Vector3D& velocity : velocities) {
+        velocity = rotationChange.RotateVector(velocity);
+    }
+    previousRotation = rotation;
+
+    if (dT <= 0.0f || positions.empty()) return;
+
+    // Fixed timestep; drop time beyond maxSteps so a long stall cannot snowball.
+    accumulator = std::min(accumulator + dT, fixedTimeStep * static_cast<float>(maxSteps));
+    while (accumulator >= fixedTimeStep) {
+        Step(fixedTimeStep, acceleration);
+        accumulator -= fixedTimeStep;
+    }
+
+    for (size_t i = 0; i < meshes.size(); i++) {
+        if (meshes[i] != nullptr) {
+            meshes[i]->GetTransform()->SetPosition(positions[i]);
         }
+    }
+}
 
-        spheres[i]->Update(dT, acceleration * RandomRatio(2.0f), rotation);
+void BoundaryMotionSimulator::Step(float dT, const Vector3D& acceleration) {
+    // Substep so the fastest sphere moves at most half the smallest radius per substep.
+    float fastest = 0.0f;
+    for (const Vector3D& velocity : velocities) {
+        fastest = std::max(fastest, velocity.DotProduct(velocity));
+    }
+    fastest = std::sqrt(fastest);
+
+    int substeps = static_cast<int>(std::ceil(fastest * dT / (0.5f * minRadius)));
+    substeps = std::max(1, std::min(substeps, maxSubsteps));
+    const float h = dT / static_cast<float>(substeps);
+
+    for (int s = 0; s < substeps; s++) {
+        for (size_t i = 0; i < positions.size(); i++) {
+            velocities[i] = (velocities[i] + acceleration * accelerationScales[i] * h).Constrain(-maxSpeed, maxSpeed);
+            positions[i] = positions[i] + velocities[i] * h;
+        }
+
+        BuildGrid();
+        CollideSpheres();
+        CollideBoundary();
+    }
+
+    for (Vector3D& velocity : velocities) {
+        velocity = velocity * damping;
+    }
+}
+
+// === Uniform grid ===
+
+uint32_t BoundaryMotionSimulator::HashCell(int32_t x, int32_t y, int32_t z) const {
+    const uint32_t h = (static_cast<uint32_t>(x) * 73856093u) ^
+                       (static_cast<uint32_t>(y) * 19349663u) ^
+                       (static_cast<uint32_t>(z) * 83492791u);
+    return h & bucketMask;
+}
 
-        for (int j = i + 1; j < sphereCount; j++) {
-            if (!spheres[j]) {
-                continue;
+void BoundaryMotionSimulator::CellOf(const Vector3D& position, int32_t& x, int32_t& y, int32_t& z) const {
+    x = static_cast<int32_t>(std::floor(position.X * inverseCellSize));
+    y = static_cast<int32_t>(std::floor(position.Y * inverseCellSize));
+    z = static_cast<int32_t>(std::floor(position.Z * inverseCellSize));
+}
+
+void BoundaryMotionSimulator::BuildGrid() {
+    const size_t count = positions.size();
+
+    // Cells as wide as the largest sphere: any touching pair is in adjacent cells.
+    inverseCellSize = 1.0f / std::max(2.0f * maxRadius, 1e-6f);
+
+    uint32_t buckets = 16;
+    while (buckets < count * 2) buckets <<= 1;
+    bucketMask = buckets - 1;
+
+    cellKeys.resize(count);
+    cellStarts.assign(buckets + 1, 0);
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t x, y, z;
+        CellOf(positions[i], x, y, z);
+        cellKeys[i] = HashCell(x, y, z);
+        ++cellStarts[cellKeys[i]];
+    }
+
+    // Inclusive prefix sums give bucket ends; filling backwards turns them into starts.
+    uint32_t running = 0;
+    for (uint32_t b = 0; b < buckets; b++) {
+        running += cellStarts[b];
+        cellStarts[b] = running;
+    }
+    cellStarts[buckets] = running;
+
+    sortedSpheres.resize(count);
+    for (size_t i = count; i > 0; i--) {
+        sortedSpheres[--cellStarts[cellKeys[i - 1]]] = static_cast<uint32_t>(i - 1);
+    }
+}
+
+void BoundaryMotionSimulator::CollideSpheres() {
+    pairTests = 0;
+
+    for (uint32_t i = 0; i < positions.size(); i++) {
+        int32_t cx, cy, cz;
+        CellOf(positions[i], cx, cy, cz);
+
+        // Neighboring cells can share a bucket; visit each bucket once.
+        uint32_t buckets[27];
+        int bucketCount = 0;
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    const uint32_t key = HashCell(cx + dx, cy + dy, cz + dz);
+                    if (std::find(buckets, buckets + bucketCount, key) == buckets + bucketCount) {
+                        buckets[bucketCount++] = key;
+                    }
+                }
             }
-            spheres[i]->Collide(elasticity, spheres[j]);
         }
 
-        //bC->CollideSphere(elasticity, spheres[i]);
-        //spheres[i]->velocity = spheres[i]->velocity * RandomRatio(0.0005f);
-        //spheres[i]->GetObject3D()->ResetVertices();
-        //spheres[i]->GetObject3D()->GetTransform()->SetPosition(spheres[i]->position);
+        for (int b = 0; b < bucketCount; b++) {
+            for (uint32_t k = cellStarts[buckets[b]]; k < cellStarts[buckets[b] + 1]; k++) {
+                const uint32_t j = sortedSpheres[k];
+                if (j <= i) continue;
+
+                ++pairTests;
+                ResolvePair(i, j);
+            }
+        }
+    }
+}
+
+void BoundaryMotionSimulator::ResolvePair(uint32_t a, uint32_t b) {
+    Vector3D delta = positions[b] - positions[a];
+    const float distanceSquared = delta.DotProduct(delta);
+    const float radiusSum = radii[a] + radii[b];
+    if (distanceSquared >= radiusSum * radiusSum) return;
+
+    float distance = std::sqrt(distanceSquared);
+    Vector3D normal;
+    if (distance > 1e-6f) {
+        normal = delta / distance;
+    } else {
+        normal = Vector3D(1, 0, 0);
+        distance = 0.0f;
+    }
+
+    const float weightA = inverseMasses[a];
+    const float weightB = inverseMasses[b];
+    const float totalWeight = weightA + weightB;
+
+    // Separate the pair, heavier spheres moving less.
+    const float overlap = radiusSum - distance;
+    positions[a] = positions[a] - normal * (overlap * weightA / totalWeight);
+    positions[b] = positions[b] + normal * (overlap * weightB / totalWeight);
+
+    const float approach = (velocities[b] - velocities[a]).DotProduct(normal);
+    if (approach >= 0.0f) return;
+
+    const float impulse = -(1.0f + elasticity) * approach / totalWeight;
+    velocities[a] = velocities[a] - normal * (impulse * weightA);
+    velocities[b] = velocities[b] + normal * (impulse * weightB);
+}
+
+void BoundaryMotionSimulator::CollideBoundary() {
+    if (bC == nullptr) return;
+
+    const Vector3D minimum = bC->GetMinimum();
+    const Vector3D maximum = bC->GetMaximum();
+
+    auto reflect = [this](float& position, float& velocity, float low, float high, float radius) {
+        if (position - radius < low) {
+            position = low + radius;
+            if (velocity < 0.0f) velocity = -velocity * elasticity;
+        } else if (position + radius > high) {
+            position = high - radius;
+            if (velocity > 0.0f) velocity = -velocity * elasticity;
+        }
+    };
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        reflect(positions[i].X, velocities[i].X, minimum.X, maximum.X, radii[i]);
+        reflect(positions[i].Y, velocities[i].Y, minimum.Y, maximum.Y, radii[i]);
+        reflect(positions[i].Z, velocities[i].Z, minimum.Z, maximum.Z, radii[i]);
     }
 }
@@ -25,38 +25,38 @@ bool BoxCollider::Raycast(const Vector3D& origin, const Vector3D& direction,
     float tmax = std::numeric_limits<float>::infinity();
 
     // X-axis slab
-    if (std::abs(direction.x) > 1e-6f) {
-        float tx1 = (min.x - origin.x) / direction.x;
-        float tx2 = (max.x - origin.x) / direction.x;
+    if (std::abs(direction.X) > 1e-6f) {
+        float tx1 = (min.X - origin.X) / direction.X;
+        float tx2 = (max.X - origin.X) / direction.X;
         tmin = std::max(tmin, std::min(tx1, tx2));
         tmax = std::min(tmax, std::max(tx1, tx2));
     } else {
         // Ray parallel to slab, check if origin is within slab
-        if (origin.x < min.x || origin.x > max.x) {
+        if (origin.X < min.X || origin.X > max.X) {
             return false;
         }
     }
 
     // Y-axis slab
-    if (std::abs(direction.y) > 1e-6f) {
-        float ty1 = (min.y - origin.y) / direction.y;
-        float ty2 = (max.y - origin.y) / direction.y;
+    if (std::abs(direction.Y) > 1e-6f) {
+        float ty1 = (min.Y - origin.Y) / direction.Y;
+        float ty2 = (max.Y - origin.Y) / direction.Y;
         tmin = std::max(tmin, std::min(ty1, ty2));
         tmax = std::min(tmax, std::max(ty1, ty2));
     } else {
-        if (origin.y < min.y || origin.y > max.y) {
+        if (origin.Y < min.Y || origin.Y > max.Y) {
             return false;
         }
     }
 
     // Z-axis slab
-    if (std::abs(direction.z) > 1e-6f) {
-        float tz1 = (min.z - origin.z) / direction.z;
-        float tz2 = (max.z - origin.z) / direction.z;
+    if (std::abs(direction.Z) > 1e-6f) {
+        float tz1 = (min.Z - origin.Z) / direction.Z;
+        float tz2 = (max.Z - origin.Z) / direction.Z;
         tmin = std::max(tmin, std::min(tz1, tz2));
         tmax = std::min(tmax, std::max(tz1, tz2));
     } else {
-        if (origin.z < min.z || origin.z > max.z) {
+        if (origin.Z < min.Z || origin.Z > max.Z) {
             return false;
         }
     }
@@ -80,16 +80,16 @@ bool BoxCollider::Raycast(const Vector3D& origin, const Vector3D& direction,
     Vector3D halfSize = GetSize() * 0.5f;
 
     // Find which axis has the largest relative distance
-    Vector3D absLocal(std::abs(localHit.x / halfSize.x),
-                      std::abs(localHit.y / halfSize.y),
-                      std::abs(localHit.z / halfSize.z));
-
-    if (absLocal.x > absLocal.y && absLocal.x > absLocal.z) {
-        hit.normal = Vector3D(localHit.x > 0 ? 1.0f : -1.0f, 0, 0);
-    } else if (absLocal.y > absLocal.z) {
-        hit.normal = Vector3D(0, localHit.y > 0 ? 1.0f : -1.0f, 0);
+    Vector3D absLocal(std::abs(localHit.X / halfSize.X),
+                      std::abs(localHit.Y / halfSize.Y),
+                      std::abs(localHit.Z / halfSize.Z));
+
+    if (absLocal.X > absLocal.Y && absLocal.X > absLocal.Z) {
+        hit.normal = Vector3D(localHit.X > 0 ? 1.0f : -1.0f, 0, 0);
+    } else if (absLocal.Y > absLocal.Z) {
+        hit.normal = Vector3D(0, localHit.Y > 0 ? 1.0f : -1.0f, 0);
     } else {
-        hit.normal = Vector3D(0, 0, localHit.z > 0 ? 1.0f : -1.0f);
+        hit.normal = Vector3D(0, 0, localHit.Z > 0 ? 1.0f : -1.0f);
     }
 
     return true;
@@ -99,9 +99,9 @@ bool BoxCollider::ContainsPoint(const Vector3D& point) {
     Vector3D min = GetMinimum();
     Vector3D max = GetMaximum();
 
-    return (point.x >= min.x && point.x <= max.x &&
-            point.y >= min.y && point.y <= max.y &&
-            point.z >= min.z && point.z <= max.z);
+    return (point.X >= min.X && point.X <= max.X &&
+            point.Y >= min.Y && point.Y <= max.Y &&
+            point.Z >= min.Z && point.Z <= max.Z);
 }
 
 Vector3D BoxCollider::ClosestPoint(const Vector3D& point) {
@@ -109,18 +109,27 @@ Vector3D BoxCollider::ClosestPoint(const Vector3D& point) {
     Vector3D max = GetMaximum();
 
     return Vector3D(
-        std::clamp(point.x, min.x, max.x),
-        std::clamp(point.y, min.y, max.y),
-        std::clamp(point.z, min.z, max.z)
+        std::clamp(point.X, min.X, max.X),
+        std::clamp(point.Y, min.Y, max.Y),
+        std::clamp(point.Z, min.Z, max.Z)
     );
 }
 
 Vector3D BoxCollider::GetPosition() const {
-    return position;
+    return centerPosition;
 }
 
 void BoxCollider::SetPosition(const Vector3D& pos) {
+    // Translate the bounds with the center; the box keeps its size.
+    const Vector3D offset = pos - centerPosition;
+    minimum = minimum + offset;
+    maximum = maximum + offset;
+    centerPosition = pos;
     position = pos;
 }
 
+AABB BoxCollider::GetBounds() {
+    return AABB(GetMinimum(), GetMaximum());
+}
+
 } // namespace ptx
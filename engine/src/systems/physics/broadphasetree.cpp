@@ -0,0 +1,228 @@
+#include <ptx/systems/physics/broadphasetree.hpp>
+#include <algorithm>
+#include <cstdlib>
+
+namespace ptx {
+
+BroadPhaseTree::BroadPhaseTree(float margin)
+    : root(kNullNode), freeList(kNullNode), proxyCount(0), margin(margin < 0.0f ? 0.0f : margin) {
+}
+
+// === Proxy Management ===
+
+int32_t BroadPhaseTree::CreateProxy(const AABB& bounds, void* userData) {
+    const int32_t leaf = AllocateNode();
+    nodes[leaf].bounds = bounds.Expanded(margin);
+    nodes[leaf].userData = userData;
+    nodes[leaf].height = 0;
+
+    InsertLeaf(leaf);
+    ++proxyCount;
+    return leaf;
+}
+
+void BroadPhaseTree::DestroyProxy(int32_t proxy) {
+    if (proxy < 0 || proxy >= static_cast<int32_t>(nodes.size())) return;
+    if (!nodes[proxy].IsLeaf() || nodes[proxy].height < 0) return;
+
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    --proxyCount;
+}
+
+bool BroadPhaseTree::MoveProxy(int32_t proxy, const AABB& bounds) {
+    if (proxy < 0 || proxy >= static_cast<int32_t>(nodes.size())) return false;
+
+    if (nodes[proxy].bounds.Contains(bounds)) {
+        return false;
+    }
+
+    RemoveLeaf(proxy);
+    nodes[proxy].bounds = bounds.Expanded(margin);
+    InsertLeaf(proxy);
+    return true;
+}
+
+void BroadPhaseTree::Clear() {
+    nodes.clear();
+    root = kNullNode;
+    freeList = kNullNode;
+    proxyCount = 0;
+}
+
+// === Node Pool ===
+
+int32_t BroadPhaseTree::AllocateNode() {
+    if (freeList == kNullNode) {
+        nodes.emplace_back();
+        return static_cast<int32_t>(nodes.size() - 1);
+    }
+
+    const int32_t node = freeList;
+    freeList = nodes[node].parent;
+    nodes[node] = Node();
+    return node;
+}
+
+void BroadPhaseTree::FreeNode(int32_t node) {
+    nodes[node].parent = freeList;
+    nodes[node].child1 = kNullNode;
+    nodes[node].child2 = kNullNode;
+    nodes[node].height = -1;
+    nodes[node].userData = nullptr;
+    freeList = node;
+}
+
+// === Tree Maintenance ===
+
+void BroadPhaseTree::InsertLeaf(int32_t leaf) {
+    if (root == kNullNode) {
+        root = leaf;
+        nodes[root].parent = kNullNode;
+        return;
+    }
+
+    // Descend towards the sibling with the lowest surface-area cost.
+    const AABB leafBounds = nodes[leaf].bounds;
+    int32_t index = root;
+    while (!nodes[index].IsLeaf()) {
+        const int32_t child1 = nodes[index].child1;
+        const int32_t child2 = nodes[index].child2;
+
+        const float area = nodes[index].bounds.GetSurfaceArea();
+        const float combinedArea = AABB::Union(nodes[index].bounds, leafBounds).GetSurfaceArea();
+
+        // Cost of pairing the leaf with this node, and the inherited cost of pushing it further down.
+        const float cost = 2.0f * combinedArea;
+        const float inheritance = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int32_t child) {
+            const float merged = AABB::Union(leafBounds, nodes[child].bounds).GetSurfaceArea();
+            if (nodes[child].IsLeaf()) return merged + inheritance;
+            return (merged - nodes[child].bounds.GetSurfaceArea()) + inheritance;
+        };
+
+        const float cost1 = descendCost(child1);
+        const float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2) break;
+
+        index = cost1 < cost2 ? child1 : child2;
+    }
+
+    const int32_t sibling = index;
+    const int32_t oldParent = nodes[sibling].parent;
+    const int32_t newParent = AllocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].bounds = AABB::Union(leafBounds, nodes[sibling].bounds);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    if (oldParent != kNullNode) {
+        if (nodes[oldParent].child1 == sibling) {
+            nodes[oldParent].child1 = newParent;
+        } else {
+            nodes[oldParent].child2 = newParent;
+        }
+    } else {
+        root = newParent;
+    }
+
+    Refit(nodes[leaf].parent);
+}
+
+void BroadPhaseTree::RemoveLeaf(int32_t leaf) {
+    if (leaf == root) {
+        root = kNullNode;
+        return;
+    }
+
+    const int32_t parent = nodes[leaf].parent;
+    const int32_t grandParent = nodes[parent].parent;
+    const int32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+    if (grandParent != kNullNode) {
+        if (nodes[grandParent].child1 == parent) {
+            nodes[grandParent].child1 = sibling;
+        } else {
+            nodes[grandParent].child2 = sibling;
+        }
+        nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+        Refit(grandParent);
+    } else {
+        root = sibling;
+        nodes[sibling].parent = kNullNode;
+        FreeNode(parent);
+    }
+}
+
+void BroadPhaseTree::Refit(int32_t index) {
+    while (index != kNullNode) {
+        index = Balance(index);
+
+        const int32_t child1 = nodes[index].child1;
+        const int32_t child2 = nodes[index].child2;
+        nodes[index].height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+        nodes[index].bounds = AABB::Union(nodes[child1].bounds, nodes[child2].bounds);
+
+        index = nodes[index].parent;
+    }
+}
+
+int32_t BroadPhaseTree::Balance(int32_t a) {
+    Node& nodeA = nodes[a];
+    if (nodeA.IsLeaf() || nodeA.height < 2) return a;
+
+    const int32_t b = nodeA.child1;
+    const int32_t c = nodeA.child2;
+    const int32_t balance = nodes[c].height - nodes[b].height;
+
+    // Rotate the taller child up; `up` replaces `a`, `down` is the shorter child.
+    auto rotate = [&](int32_t up, int32_t down, bool upIsChild2) -> int32_t {
+        Node& nodeUp = nodes[up];
+        const int32_t f = nodeUp.child1;
+        const int32_t g = nodeUp.child2;
+
+        nodeUp.child1 = a;
+        nodeUp.parent = nodes[a].parent;
+        nodes[a].parent = up;
+
+        if (nodeUp.parent != kNullNode) {
+            if (nodes[nodeUp.parent].child1 == a) {
+                nodes[nodeUp.parent].child1 = up;
+            } else {
+                nodes[nodeUp.parent].child2 = up;
+            }
+        } else {
+            root = up;
+        }
+
+        // Keep the taller grandchild under `up`, hand the other one to `a`.
+        const int32_t keep = nodes[f].height > nodes[g].height ? f : g;
+        const int32_t give = keep == f ? g : f;
+
+        nodeUp.child2 = keep;
+        if (upIsChild2) {
+            nodes[a].child2 = give;
+        } else {
+            nodes[a].child1 = give;
+        }
+        nodes[give].parent = a;
+
+        nodes[a].bounds = AABB::Union(nodes[down].bounds, nodes[give].bounds);
+        nodeUp.bounds = AABB::Union(nodes[a].bounds, nodes[keep].bounds);
+        nodes[a].height = 1 + std::max(nodes[down].height, nodes[give].height);
+        nodeUp.height = 1 + std::max(nodes[a].height, nodes[keep].height);
+        return up;
+    };
+
+    if (balance > 1) return rotate(c, b, true);
+    if (balance < -1) return rotate(b, c, false);
+    return a;
+}
+
+} // namespace ptx
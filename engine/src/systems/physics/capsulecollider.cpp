@@ -44,9 +44,9 @@ bool CapsuleCollider::Raycast(const Vector3D& origin, const Vector3D& direction,
     // TODO: Implement proper capsule-ray intersection
 
     Vector3D oc = origin - centerPosition;
-    float a = direction.dot(direction);
-    float b = 2.0f * oc.dot(direction);
-    float c = oc.dot(oc) - radius * radius;
+    float a = direction.DotProduct(direction);
+    float b = 2.0f * oc.DotProduct(direction);
+    float c = oc.DotProduct(oc) - radius * radius;
     float discriminant = b * b - 4 * a * c;
 
     if (discriminant < 0) {
@@ -65,7 +65,7 @@ bool CapsuleCollider::Raycast(const Vector3D& origin, const Vector3D& direction,
     hit.distance = t;
     hit.point = origin + direction * t;
     hit.normal = (hit.point - centerPosition);
-    hit.normal.normalize();
+    hit.normal = hit.normal.UnitSphere();
     hit.collider = this;
 
     return true;
@@ -78,21 +78,21 @@ bool CapsuleCollider::ContainsPoint(const Vector3D& point) {
 
     // Find closest point on segment to the test point
     Vector3D segment = p2 - p1;
-    float segmentLength = segment.length();
+    float segmentLength = segment.Magnitude();
 
     if (segmentLength < 1e-6f) {
         // Degenerate capsule (sphere)
-        return (point - centerPosition).length() <= radius;
+        return (point - centerPosition).Magnitude() <= radius;
     }
 
     // Project point onto segment
-    float t = (point - p1).dot(segment) / (segmentLength * segmentLength);
+    float t = (point - p1).DotProduct(segment) / (segmentLength * segmentLength);
     t = std::clamp(t, 0.0f, 1.0f);
 
     Vector3D closestOnSegment = p1 + segment * t;
 
     // Check distance from closest point on segment
-    return (point - closestOnSegment).length() <= radius;
+    return (point - closestOnSegment).Magnitude() <= radius;
 }
 
 Vector3D CapsuleCollider::ClosestPoint(const Vector3D& point) {
@@ -102,34 +102,34 @@ Vector3D CapsuleCollider::ClosestPoint(const Vector3D& point) {
 
     // Find closest point on segment
     Vector3D segment = p2 - p1;
-    float segmentLength = segment.length();
+    float segmentLength = segment.Magnitude();
 
     if (segmentLength < 1e-6f) {
         // Degenerate capsule (sphere)
         Vector3D dir = point - centerPosition;
-        float dist = dir.length();
+        float dist = dir.Magnitude();
         if (dist <= radius) {
             return point;
         }
-        dir.normalize();
+        dir = dir.UnitSphere();
         return centerPosition + dir * radius;
     }
 
     // Project point onto segment
-    float t = (point - p1).dot(segment) / (segmentLength * segmentLength);
+    float t = (point - p1).DotProduct(segment) / (segmentLength * segmentLength);
     t = std::clamp(t, 0.0f, 1.0f);
 
     Vector3D closestOnSegment = p1 + segment * t;
 
     // Project to surface from segment
     Vector3D dir = point - closestOnSegment;
-    float dist = dir.length();
+    float dist = dir.Magnitude();
 
     if (dist <= radius) {
         return point;  // Point is inside
     }
 
-    dir.normalize();
+    dir = dir.UnitSphere();
     return closestOnSegment + dir * radius;
 }
 
@@ -141,4 +141,11 @@ void CapsuleCollider::SetPosition(const Vector3D& pos) {
     centerPosition = pos;
 }
 
+AABB CapsuleCollider::GetBounds() {
+    Vector3D p1, p2;
+    GetSegment(p1, p2);
+
+    return AABB::Union(AABB::FromSphere(p1, radius), AABB::FromSphere(p2, radius));
+}
+
 } // namespace ptx
@@ -1,12 +1,37 @@
 #include <ptx/systems/physics/collider.hpp>
+#include <atomic>
 
 namespace ptx {
 
+namespace {
+std::atomic<uint32_t> nextColliderID{1};
+}
+
 Collider::Collider(ColliderType type)
-    : type(type), isTrigger(false), isEnabled(true), layer(0),
+    : type(type), id(nextColliderID.fetch_add(1, std::memory_order_relaxed)),
+      isTrigger(false), isEnabled(true), layer(0),
       tag(""), material(), owner(nullptr) {
 }
 
+Collider::Collider(const Collider& other)
+    : type(other.type), id(nextColliderID.fetch_add(1, std::memory_order_relaxed)),
+      isTrigger(other.isTrigger), isEnabled(other.isEnabled), layer(other.layer),
+      tag(other.tag), material(other.material), owner(other.owner) {
+}
+
+Collider& Collider::operator=(const Collider& other) {
+    if (this != &other) {
+        type = other.type;
+        isTrigger = other.isTrigger;
+        isEnabled = other.isEnabled;
+        layer = other.layer;
+        tag = other.tag;
+        material = other.material;
+        owner = other.owner;
+    }
+    return *this;
+}
+
 Collider::~Collider() {
 }
 
@@ -1,10 +1,12 @@
 #include <ptx/systems/physics/collisionmanager.hpp>
+#include <ptx/core/platform/threadpool.hpp>
 #include <algorithm>
 #include <cmath>
 
 namespace ptx {
 
-CollisionManager::CollisionManager() {
+CollisionManager::CollisionManager()
+    : frameIndex(0) {
     SetDefaultCollisionMatrix();
 }
 
@@ -21,20 +23,48 @@ void CollisionManager::RegisterCollider(Collider* collider) {
     auto it = std::find(colliders.begin(), colliders.end(), collider);
     if (it == colliders.end()) {
         colliders.push_back(collider);
+        proxies.push_back(broadPhase.CreateProxy(collider->GetBounds(), collider));
     }
 }
 
 void CollisionManager::UnregisterCollider(Collider* collider) {
     if (collider == nullptr) return;
 
-    colliders.erase(
-        std::remove(colliders.begin(), colliders.end(), collider),
-        colliders.end()
-    );
+    auto it = std::find(colliders.begin(), colliders.end(), collider);
+    if (it == colliders.end()) return;
+
+    size_t index = static_cast<size_t>(it - colliders.begin());
+    broadPhase.DestroyProxy(proxies[index]);
+
+    colliders.erase(it);
+    proxies.erase(proxies.begin() + static_cast<std::ptrdiff_t>(index));
+
+    if (contacts.RemoveCollider(collider) > 0) {
+        PruneContactLists();
+    }
 }
 
 void CollisionManager::UnregisterAllColliders() {
     colliders.clear();
+    proxies.clear();
+    broadPhase.Clear();
+    contacts.Clear();
+    currentContacts.clear();
+    previousContacts.clear();
+}
+
+void CollisionManager::PruneContactLists() {
+    auto removed = [this](uint32_t index) { return !contacts.Get(index).active; };
+    currentContacts.erase(std::remove_if(currentContacts.begin(), currentContacts.end(), removed), currentContacts.end());
+    previousContacts.erase(std::remove_if(previousContacts.begin(), previousContacts.end(), removed), previousContacts.end());
+}
+
+// === Broadphase ===
+
+void CollisionManager::SyncBroadPhase() {
+    for (size_t i = 0; i < colliders.size(); ++i) {
+        broadPhase.MoveProxy(proxies[i], colliders[i]->GetBounds());
+    }
 }
 
 // === Collision Matrix ===
@@ -63,73 +93,99 @@ void CollisionManager::SetDefaultCollisionMatrix() {
 // === Collision Detection ===
 
 void CollisionManager::Update() {
-    currentCollisions.clear();
+    ++frameIndex;
+
+    // Last frame's contacts become the previous set; storage is swapped, not copied.
+    std::swap(currentContacts, previousContacts);
+    currentContacts.clear();
+    enterEvents.clear();
+    stayEvents.clear();
+    exitEvents.clear();
+
+    SyncBroadPhase();
 
     // Broadphase: generate potential collision pairs
-    std::vector<std::pair<Collider*, Collider*>> pairs;
-    BroadPhase(pairs);
+    candidatePairs.clear();
+    BroadPhase(candidatePairs);
 
-    // Narrowphase: test collision pairs
-    NarrowPhase(pairs);
+    // Narrowphase: test collision pairs and refresh the contact cache
+    NarrowPhase(candidatePairs);
 
-    // Update collision states for next frame
-    previousCollisions = currentCollisions;
+    DispatchEvents();
 }
 
 void CollisionManager::BroadPhase(std::vector<std::pair<Collider*, Collider*>>& pairs) {
-    // Simple O(n^2) broadphase
-    // TODO: Implement spatial partitioning (octree, BVH) for better performance
-
+    // Each collider queries the tree with its tight bounds; the proxy ordering
+    // check reports every overlapping pair exactly once.
     for (size_t i = 0; i < colliders.size(); ++i) {
-        if (!colliders[i]->IsEnabled()) continue;
+        Collider* a = colliders[i];
+        if (!a->IsEnabled()) continue;
 
-        for (size_t j = i + 1; j < colliders.size(); ++j) {
-            if (!colliders[j]->IsEnabled()) continue;
+        const int32_t proxyA = proxies[i];
+        broadPhase.Query(a->GetBounds(), [&](int32_t proxyB) {
+            if (proxyB <= proxyA) return true;
 
-            // Check layer collision
-            if (!CanLayersCollide(colliders[i]->GetLayer(), colliders[j]->GetLayer())) {
-                continue;
-            }
+            Collider* b = static_cast<Collider*>(broadPhase.GetUserData(proxyB));
+            if (!b->IsEnabled()) return true;
+            if (!CanLayersCollide(a->GetLayer(), b->GetLayer())) return true;
 
-            // Simple AABB bounds check would go here
-            // For now, add all pairs (narrowphase will filter)
-            pairs.emplace_back(colliders[i], colliders[j]);
-        }
+            pairs.emplace_back(a, b);
+            return true;
+        });
     }
 }
 
 void CollisionManager::NarrowPhase(const std::vector<std::pair<Collider*, Collider*>>& pairs) {
     for (const auto& pair : pairs) {
         CollisionInfo info;
-        if (TestCollision(pair.first, pair.second, info)) {
-            uint64_t pairID = GetPairID(pair.first, pair.second);
-            currentCollisions.insert(pairID);
-
-            // Check if this is a new collision (enter) or ongoing (stay)
-            if (previousCollisions.find(pairID) == previousCollisions.end()) {
-                // Collision enter
-                for (auto& callback : onCollisionEnterCallbacks) {
-                    callback(info);
-                }
-            } else {
-                // Collision stay
-                for (auto& callback : onCollisionStayCallbacks) {
-                    callback(info);
-                }
-            }
+        if (!TestCollision(pair.first, pair.second, info)) continue;
+
+        bool created = false;
+        uint32_t index = contacts.FindOrCreate(GetPairID(pair.first, pair.second), created);
+        ContactManifold& manifold = contacts.Get(index);
+
+        manifold.info = info;
+        manifold.touchingFrame = frameIndex;
+        currentContacts.push_back(index);
+
+        // A manifold only survives while its pair keeps touching, so an existing one means "stay".
+        if (created) {
+            enterEvents.push_back(info);
+        } else {
+            stayEvents.push_back(info);
         }
     }
 
-    // Check for collision exits
-    for (uint64_t pairID : previousCollisions) {
-        if (currentCollisions.find(pairID) == currentCollisions.end()) {
-            // Collision exit (info not available, create empty)
-            CollisionInfo info;
-            for (auto& callback : onCollisionExitCallbacks) {
+    // Pairs that touched last frame but not this one exit with their last known contact data.
+    for (uint32_t index : previousContacts) {
+        ContactManifold& manifold = contacts.Get(index);
+        if (!manifold.active || manifold.touchingFrame == frameIndex) continue;
+
+        exitEvents.push_back(manifold.info);
+        contacts.Remove(index);
+    }
+}
+
+void CollisionManager::DispatchEvents() {
+    auto dispatch = [](const std::vector<CollisionInfo>& events,
+                       const std::vector<CollisionBatchCallback>& batchCallbacks,
+                       const std::vector<CollisionCallback>& callbacks) {
+        if (events.empty()) return;
+
+        for (const auto& callback : batchCallbacks) {
+            callback(events.data(), events.size());
+        }
+
+        for (const auto& callback : callbacks) {
+            for (const CollisionInfo& info : events) {
                 callback(info);
             }
         }
-    }
+    };
+
+    dispatch(enterEvents, onCollisionEnterBatchCallbacks, onCollisionEnterCallbacks);
+    dispatch(stayEvents, onCollisionStayBatchCallbacks, onCollisionStayCallbacks);
+    dispatch(exitEvents, onCollisionExitBatchCallbacks, onCollisionExitCallbacks);
 }
 
 bool CollisionManager::TestCollision(Collider* a, Collider* b, CollisionInfo& info) {
@@ -148,10 +204,10 @@ bool CollisionManager::TestCollision(Collider* a, Collider* b, CollisionInfo& in
                             static_cast<BoxCollider*>(b), info);
     }
     else if (a->GetType() == ColliderType::Box && b->GetType() == ColliderType::Sphere) {
+        // Keep A/B as passed and flip the sphere->box normal so it still points from A to B.
         bool result = TestSphereBox(static_cast<SphereCollider*>(b),
                                     static_cast<BoxCollider*>(a), info);
         if (result) {
-            std::swap(info.colliderA, info.colliderB);
             info.normal = info.normal * -1.0f;
         }
         return result;
@@ -172,9 +228,9 @@ bool CollisionManager::Raycast(const Vector3D& origin, const Vector3D& direction
     bool foundHit = false;
     float closestDistance = maxDistance;
 
-    for (auto* collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        if (!IsLayerInMask(collider->GetLayer(), layerMask)) continue;
+    broadPhase.Raycast(origin, direction, maxDistance, [&](int32_t proxy, float currentMax) {
+        Collider* collider = static_cast<Collider*>(broadPhase.GetUserData(proxy));
+        if (!PassesFilter(collider, layerMask)) return currentMax;
 
         RaycastHit tempHit;
         if (collider->Raycast(origin, direction, tempHit, maxDistance)) {
@@ -184,7 +240,9 @@ bool CollisionManager::Raycast(const Vector3D& origin, const Vector3D& direction
                 foundHit = true;
             }
         }
-    }
+
+        return closestDistance;
+    });
 
     return foundHit;
 }
@@ -194,15 +252,17 @@ int CollisionManager::RaycastAll(const Vector3D& origin, const Vector3D& directi
                                  uint32_t layerMask) {
     hits.clear();
 
-    for (auto* collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        if (!IsLayerInMask(collider->GetLayer(), layerMask)) continue;
+    broadPhase.Raycast(origin, direction, maxDistance, [&](int32_t proxy, float currentMax) {
+        Collider* collider = static_cast<Collider*>(broadPhase.GetUserData(proxy));
+        if (!PassesFilter(collider, layerMask)) return currentMax;
 
         RaycastHit hit;
         if (collider->Raycast(origin, direction, hit, maxDistance)) {
             hits.push_back(hit);
         }
-    }
+
+        return currentMax;
+    });
 
     // Sort by distance
     std::sort(hits.begin(), hits.end(),
@@ -217,18 +277,17 @@ int CollisionManager::RaycastAll(const Vector3D& origin, const Vector3D& directi
 
 bool CollisionManager::OverlapSphere(const Vector3D& center, float radius,
                                      uint32_t layerMask) {
-    for (auto* collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        if (!IsLayerInMask(collider->GetLayer(), layerMask)) continue;
+    bool found = false;
 
-        Vector3D closest = collider->ClosestPoint(center);
-        float dist = (closest - center).length();
-        if (dist <= radius) {
-            return true;
-        }
-    }
+    broadPhase.Query(AABB::FromSphere(center, radius), [&](int32_t proxy) {
+        Collider* collider = static_cast<Collider*>(broadPhase.GetUserData(proxy));
+        if (!PassesFilter(collider, layerMask)) return true;
 
-    return false;
+        found = OverlapsSphere(collider, center, radius);
+        return !found;
+    });
+
+    return found;
 }
 
 int CollisionManager::OverlapSphereAll(const Vector3D& center, float radius,
@@ -236,36 +295,148 @@ int CollisionManager::OverlapSphereAll(const Vector3D& center, float radius,
                                        uint32_t layerMask) {
     results.clear();
 
-    for (auto* collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        if (!IsLayerInMask(collider->GetLayer(), layerMask)) continue;
-
-        Vector3D closest = collider->ClosestPoint(center);
-        float dist = (closest - center).length();
-        if (dist <= radius) {
+    broadPhase.Query(AABB::FromSphere(center, radius), [&](int32_t proxy) {
+        Collider* collider = static_cast<Collider*>(broadPhase.GetUserData(proxy));
+        if (PassesFilter(collider, layerMask) && OverlapsSphere(collider, center, radius)) {
             results.push_back(collider);
         }
-    }
+        return true;
+    });
 
     return static_cast<int>(results.size());
 }
 
 bool CollisionManager::OverlapBox(const Vector3D& center, const Vector3D& extents,
                                   uint32_t layerMask) {
-    // Create a temporary box collider for testing
-    BoxCollider queryBox(center, extents);
+    const AABB box(center - extents, center + extents);
+    bool found = false;
 
-    for (auto* collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        if (!IsLayerInMask(collider->GetLayer(), layerMask)) continue;
+    broadPhase.Query(box, [&](int32_t proxy) {
+        Collider* collider = static_cast<Collider*>(broadPhase.GetUserData(proxy));
+        if (!PassesFilter(collider, layerMask)) return true;
 
-        CollisionInfo info;
-        if (TestCollision(&queryBox, collider, info)) {
-            return true;
+        found = OverlapsBox(collider, box);
+        return !found;
+    });
+
+    return found;
+}
+
+// === Batched Queries ===
+
+int CollisionManager::RaycastBatch(const RaycastQuery* queries, size_t count, RaycastHit* hits) {
+    if (queries == nullptr || hits == nullptr || count == 0) return 0;
+
+    const size_t packetSize = BroadPhaseTree::kPacketSize;
+    const size_t packetCount = (count + packetSize - 1) / packetSize;
+    std::vector<int> packetHits(packetCount, 0);
+
+    ThreadPool::Shared().ParallelFor(packetCount, 1, [&](size_t begin, size_t end) {
+        for (size_t packet = begin; packet < end; ++packet) {
+            const size_t first = packet * packetSize;
+            const size_t n = std::min(packetSize, count - first);
+            packetHits[packet] = RaycastPacket(queries + first, n, hits + first);
         }
+    });
+
+    int total = 0;
+    for (int h : packetHits) total += h;
+    return total;
+}
+
+int CollisionManager::RaycastBatch(const std::vector<RaycastQuery>& queries, std::vector<RaycastHit>& hits) {
+    hits.assign(queries.size(), RaycastHit());
+    return RaycastBatch(queries.data(), queries.size(), hits.data());
+}
+
+int CollisionManager::OverlapSphereBatch(const OverlapSphereQuery* queries, size_t count, bool* results) {
+    if (queries == nullptr || results == nullptr || count == 0) return 0;
+
+    const size_t packetSize = BroadPhaseTree::kPacketSize;
+    const size_t packetCount = (count + packetSize - 1) / packetSize;
+    std::vector<int> packetHits(packetCount, 0);
+
+    ThreadPool::Shared().ParallelFor(packetCount, 1, [&](size_t begin, size_t end) {
+        for (size_t packet = begin; packet < end; ++packet) {
+            const size_t first = packet * packetSize;
+            const size_t n = std::min(packetSize, count - first);
+            packetHits[packet] = OverlapSpherePacket(queries + first, n, results + first);
+        }
+    });
+
+    int total = 0;
+    for (int h : packetHits) total += h;
+    return total;
+}
+
+int CollisionManager::RaycastPacket(const RaycastQuery* queries, size_t count, RaycastHit* hits) const {
+    Vector3D origins[BroadPhaseTree::kPacketSize];
+    Vector3D inverseDirections[BroadPhaseTree::kPacketSize];
+    float maxDistances[BroadPhaseTree::kPacketSize]; // shrinks as closer hits are found
+
+    for (size_t i = 0; i < count; ++i) {
+        origins[i] = queries[i].origin;
+        inverseDirections[i] = AABB::SafeInverse(queries[i].direction);
+        maxDistances[i] = queries[i].maxDistance;
+        hits[i] = RaycastHit();
     }
 
-    return false;
+    broadPhase.RaycastPacket(origins, inverseDirections, maxDistances, count,
+        [&](int32_t proxy, uint64_t rayMask) {
+            Collider* collider = static_cast<Collider*>(broadPhase.GetUserData(proxy));
+            if (!collider->IsEnabled()) return;
+
+            for (uint64_t bits = rayMask; bits != 0; bits &= bits - 1) {
+                const int ray = __builtin_ctzll(bits);
+                const RaycastQuery& query = queries[ray];
+                if (!IsLayerInMask(collider->GetLayer(), query.layerMask)) continue;
+
+                RaycastHit tempHit;
+                if (collider->Raycast(query.origin, query.direction, tempHit, query.maxDistance) &&
+                    tempHit.distance < maxDistances[ray]) {
+                    maxDistances[ray] = tempHit.distance;
+                    hits[ray] = tempHit;
+                }
+            }
+        });
+
+    int hitCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (hits[i].collider != nullptr) ++hitCount;
+    }
+    return hitCount;
+}
+
+int CollisionManager::OverlapSpherePacket(const OverlapSphereQuery* queries, size_t count, bool* results) const {
+    AABB bounds[BroadPhaseTree::kPacketSize];
+    for (size_t i = 0; i < count; ++i) {
+        bounds[i] = AABB::FromSphere(queries[i].center, queries[i].radius);
+        results[i] = false;
+    }
+
+    const uint64_t allQueries = count == 64 ? ~0ULL : ((1ULL << count) - 1ULL);
+    broadPhase.QueryPacket(bounds, count, allQueries,
+        [&](int32_t proxy, uint64_t queryMask, uint64_t& activeMask) {
+            Collider* collider = static_cast<Collider*>(broadPhase.GetUserData(proxy));
+            if (!collider->IsEnabled()) return;
+
+            for (uint64_t bits = queryMask; bits != 0; bits &= bits - 1) {
+                const int index = __builtin_ctzll(bits);
+                const OverlapSphereQuery& query = queries[index];
+                if (!IsLayerInMask(collider->GetLayer(), query.layerMask)) continue;
+
+                if (OverlapsSphere(collider, query.center, query.radius)) {
+                    results[index] = true;
+                    activeMask &= ~(1ULL << index); // answered, retire from the traversal
+                }
+            }
+        });
+
+    int overlapCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (results[i]) ++overlapCount;
+    }
+    return overlapCount;
 }
 
 // === Callbacks ===
@@ -282,38 +453,79 @@ void CollisionManager::AddCollisionExitCallback(CollisionCallback callback) {
     onCollisionExitCallbacks.push_back(callback);
 }
 
+void CollisionManager::AddCollisionEnterBatchCallback(CollisionBatchCallback callback) {
+    onCollisionEnterBatchCallbacks.push_back(callback);
+}
+
+void CollisionManager::AddCollisionStayBatchCallback(CollisionBatchCallback callback) {
+    onCollisionStayBatchCallbacks.push_back(callback);
+}
+
+void CollisionManager::AddCollisionExitBatchCallback(CollisionBatchCallback callback) {
+    onCollisionExitBatchCallbacks.push_back(callback);
+}
+
 void CollisionManager::ClearCallbacks() {
     onCollisionEnterCallbacks.clear();
     onCollisionStayCallbacks.clear();
     onCollisionExitCallbacks.clear();
+    onCollisionEnterBatchCallbacks.clear();
+    onCollisionStayBatchCallbacks.clear();
+    onCollisionExitBatchCallbacks.clear();
 }
 
 // === Private Helper Methods ===
 
-uint64_t CollisionManager::GetPairID(Collider* a, Collider* b) const {
-    uintptr_t ptrA = reinterpret_cast<uintptr_t>(a);
-    uintptr_t ptrB = reinterpret_cast<uintptr_t>(b);
+uint64_t CollisionManager::GetPairID(const Collider* a, const Collider* b) const {
+    // 32-bit IDs pack losslessly into 64 bits, unlike pointers on 64-bit hosts.
+    return ContactCache::MakeKey(a->GetID(), b->GetID());
+}
+
+bool CollisionManager::IsLayerInMask(int layer, uint32_t mask) const {
+    return (mask & (1u << layer)) != 0;
+}
 
-    // Ensure consistent ordering
-    if (ptrA > ptrB) std::swap(ptrA, ptrB);
+bool CollisionManager::PassesFilter(Collider* collider, uint32_t mask) const {
+    return collider->IsEnabled() && IsLayerInMask(collider->GetLayer(), mask);
+}
 
-    return (static_cast<uint64_t>(ptrA) << 32) | static_cast<uint64_t>(ptrB);
+bool CollisionManager::OverlapsSphere(Collider* collider, const Vector3D& center, float radius) const {
+    Vector3D closest = collider->ClosestPoint(center);
+    float dist = (closest - center).Magnitude();
+    return dist <= radius;
 }
 
-bool CollisionManager::IsLayerInMask(int layer, uint32_t mask) const {
-    return (mask & (1 << layer)) != 0;
+bool CollisionManager::OverlapsBox(Collider* collider, const AABB& box) const {
+    if (collider->GetType() == ColliderType::Box) {
+        return collider->GetBounds().Overlaps(box);
+    }
+
+    // Alternating projection between the box and the (convex) collider converges
+    // on the closest pair of points; a projection landing inside the box is an overlap.
+    Vector3D point = box.GetCenter();
+    for (int i = 0; i < 4; ++i) {
+        Vector3D onCollider = collider->ClosestPoint(point);
+        if (box.ContainsPoint(onCollider)) return true;
+
+        Vector3D onBox = box.ClosestPoint(onCollider);
+        if (collider->ContainsPoint(onBox)) return true;
+
+        point = onBox;
+    }
+
+    return false;
 }
 
 bool CollisionManager::TestSphereSphere(SphereCollider* a, SphereCollider* b,
                                        CollisionInfo& info) {
     Vector3D delta = b->GetPosition() - a->GetPosition();
-    float dist = delta.length();
+    float dist = delta.Magnitude();
     float radiusSum = a->GetRadius() + b->GetRadius();
 
     if (dist < radiusSum) {
         info.penetrationDepth = radiusSum - dist;
         info.normal = delta;
-        info.normal.normalize();
+        info.normal = info.normal.UnitSphere();
         info.contactPoint = a->GetPosition() + info.normal * a->GetRadius();
         return true;
     }
@@ -323,19 +535,40 @@ bool CollisionManager::TestSphereSphere(SphereCollider* a, SphereCollider* b,
 
 bool CollisionManager::TestSphereBox(SphereCollider* sphere, BoxCollider* box,
                                      CollisionInfo& info) {
-    Vector3D closest = box->ClosestPoint(sphere->GetPosition());
-    Vector3D delta = sphere->GetPosition() - closest;
-    float dist = delta.length();
+    Vector3D center = sphere->GetPosition();
+    Vector3D closest = box->ClosestPoint(center);
+    Vector3D delta = closest - center;
+    float dist = delta.Magnitude();
+
+    if (dist >= sphere->GetRadius()) return false;
 
-    if (dist < sphere->GetRadius()) {
+    if (dist > 1e-6f) {
+        // Normal points from the sphere (A) towards the box (B).
         info.penetrationDepth = sphere->GetRadius() - dist;
-        info.normal = delta;
-        info.normal.normalize();
+        info.normal = delta / dist;
         info.contactPoint = closest;
         return true;
     }
 
-    return false;
+    // Center inside the box: push out through the nearest face.
+    Vector3D minimum = box->GetMinimum();
+    Vector3D maximum = box->GetMaximum();
+    const float faces[6] = {
+        center.X - minimum.X, maximum.X - center.X,
+        center.Y - minimum.Y, maximum.Y - center.Y,
+        center.Z - minimum.Z, maximum.Z - center.Z
+    };
+
+    int nearest = 0;
+    for (int i = 1; i < 6; ++i) {
+        if (faces[i] < faces[nearest]) nearest = i;
+    }
+
+    const float sign = (nearest & 1) ? -1.0f : 1.0f;
+    info.normal = Vector3D(nearest / 2 == 0 ? sign : 0.0f, nearest / 2 == 1 ? sign : 0.0f, nearest / 2 == 2 ? sign : 0.0f);
+    info.penetrationDepth = faces[nearest] + sphere->GetRadius();
+    info.contactPoint = center - info.normal * faces[nearest];
+    return true;
 }
 
 bool CollisionManager::TestBoxBox(BoxCollider* a, BoxCollider* b, CollisionInfo& info) {
@@ -346,24 +579,35 @@ bool CollisionManager::TestBoxBox(BoxCollider* a, BoxCollider* b, CollisionInfo&
     Vector3D maxB = b->GetMaximum();
 
     // Check for overlap on all axes
-    bool overlapX = (minA.x <= maxB.x && maxA.x >= minB.x);
-    bool overlapY = (minA.y <= maxB.y && maxA.y >= minB.y);
-    bool overlapZ = (minA.z <= maxB.z && maxA.z >= minB.z);
+    bool overlapX = (minA.X <= maxB.X && maxA.X >= minB.X);
+    bool overlapY = (minA.Y <= maxB.Y && maxA.Y >= minB.Y);
+    bool overlapZ = (minA.Z <= maxB.Z && maxA.Z >= minB.Z);
 
-    if (overlapX && overlapY && overlapZ) {
-        // Calculate penetration and contact info (simplified)
-        Vector3D centerA = a->GetPosition();
-        Vector3D centerB = b->GetPosition();
+    if (!(overlapX && overlapY && overlapZ)) return false;
 
-        info.normal = centerB - centerA;
-        info.normal.normalize();
-        info.contactPoint = (centerA + centerB) * 0.5f;
-        info.penetrationDepth = 0.1f;  // Simplified
+    // Separate along the axis of least overlap.
+    const float overlaps[3] = {
+        std::min(maxA.X, maxB.X) - std::max(minA.X, minB.X),
+        std::min(maxA.Y, maxB.Y) - std::max(minA.Y, minB.Y),
+        std::min(maxA.Z, maxB.Z) - std::max(minA.Z, minB.Z)
+    };
 
-        return true;
-    }
+    int axis = 0;
+    if (overlaps[1] < overlaps[axis]) axis = 1;
+    if (overlaps[2] < overlaps[axis]) axis = 2;
 
-    return false;
+    Vector3D delta = b->GetPosition() - a->GetPosition();
+    const float d[3] = { delta.X, delta.Y, delta.Z };
+    const float sign = d[axis] < 0.0f ? -1.0f : 1.0f;
+
+    info.normal = Vector3D(axis == 0 ? sign : 0.0f, axis == 1 ? sign : 0.0f, axis == 2 ? sign : 0.0f);
+    info.penetrationDepth = overlaps[axis];
+
+    // Center of the overlap region
+    info.contactPoint = Vector3D((std::max(minA.X, minB.X) + std::min(maxA.X, maxB.X)) * 0.5f,
+                                 (std::max(minA.Y, minB.Y) + std::min(maxA.Y, maxB.Y)) * 0.5f,
+                                 (std::max(minA.Z, minB.Z) + std::min(maxA.Z, maxB.Z)) * 0.5f);
+    return true;
 }
 
 } // namespace ptx
@@ -0,0 +1,166 @@
+#include <ptx/systems/physics/contactcache.hpp>
+#include <algorithm>
+
+namespace ptx {
+
+ContactCache::ContactCache(size_t initialCapacity)
+    : count(0), usedSlots(0) {
+    Reserve(std::max<size_t>(initialCapacity, 8));
+}
+
+// === Lookup ===
+
+uint64_t ContactCache::Hash(uint64_t key) {
+    // SplitMix64 finalizer: spreads sequential collider IDs across the table.
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return key;
+}
+
+size_t ContactCache::FindSlot(uint64_t key) const {
+    const size_t mask = slots.size() - 1;
+    size_t slot = static_cast<size_t>(Hash(key)) & mask;
+
+    for (;;) {
+        const int32_t entry = slots[slot];
+        if (entry == kEmptySlot) return slot;
+        if (entry >= 0 && manifolds[static_cast<size_t>(entry)].key == key) return slot;
+        slot = (slot + 1) & mask;
+    }
+}
+
+uint32_t ContactCache::Find(uint64_t key) const {
+    if (slots.empty()) return kInvalidIndex;
+
+    const int32_t entry = slots[FindSlot(key)];
+    return entry >= 0 ? static_cast<uint32_t>(entry) : kInvalidIndex;
+}
+
+uint32_t ContactCache::FindOrCreate(uint64_t key, bool& created) {
+    const uint32_t existing = Find(key);
+    if (existing != kInvalidIndex) {
+        created = false;
+        return existing;
+    }
+
+    // Keep the table at most half full, counting tombstones. If most used slots
+    // are tombstones, rehash in place instead of growing.
+    if ((usedSlots + 1) * 2 > slots.size()) {
+        const bool grow = (count + 1) * 4 > slots.size();
+        Rehash(grow ? slots.size() * 2 : slots.size());
+    }
+
+    uint32_t index;
+    if (!freeIndices.empty()) {
+        index = freeIndices.back();
+        freeIndices.pop_back();
+    } else {
+        index = static_cast<uint32_t>(manifolds.size());
+        manifolds.emplace_back();
+        slotOfManifold.push_back(0);
+    }
+
+    ContactManifold& manifold = manifolds[index];
+    manifold = ContactManifold();
+    manifold.key = key;
+    manifold.active = true;
+
+    const size_t mask = slots.size() - 1;
+    size_t slot = static_cast<size_t>(Hash(key)) & mask;
+    while (slots[slot] >= 0) {
+        slot = (slot + 1) & mask;
+    }
+
+    if (slots[slot] == kEmptySlot) ++usedSlots;
+    slots[slot] = static_cast<int32_t>(index);
+    slotOfManifold[index] = static_cast<uint32_t>(slot);
+
+    ++count;
+    created = true;
+    return index;
+}
+
+// === Removal ===
+
+void ContactCache::Remove(uint32_t index) {
+    if (index >= manifolds.size() || !manifolds[index].active) return;
+
+    slots[slotOfManifold[index]] = kDeletedSlot;
+    manifolds[index].active = false;
+    freeIndices.push_back(index);
+    --count;
+}
+
+size_t ContactCache::RemoveCollider(const Collider* collider) {
+    size_t removed = 0;
+
+    for (uint32_t i = 0; i < manifolds.size(); ++i) {
+        const ContactManifold& manifold = manifolds[i];
+        if (!manifold.active) continue;
+
+        if (manifold.info.colliderA == collider || manifold.info.colliderB == collider) {
+            Remove(i);
+            ++removed;
+        }
+    }
+
+    return removed;
+}
+
+void ContactCache::Clear() {
+    std::fill(slots.begin(), slots.end(), kEmptySlot);
+
+    freeIndices.clear();
+    for (size_t i = manifolds.size(); i > 0; --i) {
+        manifolds[i - 1].active = false;
+        freeIndices.push_back(static_cast<uint32_t>(i - 1));
+    }
+
+    count = 0;
+    usedSlots = 0;
+}
+
+// === Storage ===
+
+void ContactCache::Reserve(size_t capacity) {
+    manifolds.reserve(capacity);
+    freeIndices.reserve(capacity);
+    slotOfManifold.reserve(capacity);
+
+    size_t needed = 16;
+    while (needed < capacity * 2) {
+        needed <<= 1;
+    }
+
+    if (slots.size() < needed) {
+        Rehash(needed);
+    }
+}
+
+void ContactCache::Rehash(size_t newSlotCount) {
+    slots.assign(newSlotCount, kEmptySlot);
+    usedSlots = 0;
+
+    const size_t mask = newSlotCount - 1;
+    for (uint32_t i = 0; i < manifolds.size(); ++i) {
+        if (!manifolds[i].active) continue;
+
+        size_t slot = static_cast<size_t>(Hash(manifolds[i].key)) & mask;
+        while (slots[slot] != kEmptySlot) {
+            slot = (slot + 1) & mask;
+        }
+
+        slots[slot] = static_cast<int32_t>(i);
+        slotOfManifold[i] = static_cast<uint32_t>(slot);
+        ++usedSlots;
+    }
+
+    if (freeIndices.capacity() < manifolds.capacity()) {
+        freeIndices.reserve(manifolds.capacity());
+    }
+}
+
+} // namespace ptx
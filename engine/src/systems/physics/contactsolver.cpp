@@ -0,0 +1,175 @@
+#include <ptx/systems/physics/contactsolver.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace ptx {
+
+namespace {
+
+const Vector3D kZero(0, 0, 0);
+
+// Builds two unit tangents perpendicular to a unit normal.
+void BuildTangents(const Vector3D& normal, Vector3D& tangent1, Vector3D& tangent2) {
+    if (std::fabs(normal.X) >= 0.57735f) {
+        tangent1 = Vector3D(normal.Y, -normal.X, 0.0f);
+    } else {
+        tangent1 = Vector3D(0.0f, normal.Z, -normal.Y);
+    }
+
+    tangent1 = tangent1.UnitSphere();
+    tangent2 = normal.CrossProduct(tangent1);
+}
+
+float EffectiveMass(const Vector3D& direction, const Vector3D& rA, const Vector3D& rB,
+                    float inverseMassA, float inverseMassB,
+                    const Vector3D& inverseInertiaA, const Vector3D& inverseInertiaB) {
+    const Vector3D rnA = rA.CrossProduct(direction);
+    const Vector3D rnB = rB.CrossProduct(direction);
+    const float k = inverseMassA + inverseMassB +
+                    rnA.DotProduct(inverseInertiaA * rnA) +
+                    rnB.DotProduct(inverseInertiaB * rnB);
+    return k > 0.0f ? 1.0f / k : 0.0f;
+}
+
+// Local copy of the two bodies touched by a constraint.
+struct BodyPair {
+    Vector3D vA, wA, vB, wB;
+    Vector3D iA, iB;
+    float mA, mB;
+
+    BodyPair(const ContactConstraint& c, const SolverBodies& bodies)
+        : vA(c.bodyA >= 0 ? bodies.linearVelocities[c.bodyA] : kZero),
+          wA(c.bodyA >= 0 ? bodies.angularVelocities[c.bodyA] : kZero),
+          vB(c.bodyB >= 0 ? bodies.linearVelocities[c.bodyB] : kZero),
+          wB(c.bodyB >= 0 ? bodies.angularVelocities[c.bodyB] : kZero),
+          iA(c.bodyA >= 0 ? bodies.inverseInertias[c.bodyA] : kZero),
+          iB(c.bodyB >= 0 ? bodies.inverseInertias[c.bodyB] : kZero),
+          mA(c.bodyA >= 0 ? bodies.inverseMasses[c.bodyA] : 0.0f),
+          mB(c.bodyB >= 0 ? bodies.inverseMasses[c.bodyB] : 0.0f) {}
+
+    Vector3D RelativeVelocity(const ContactConstraint& c) const {
+        return (vB + wB.CrossProduct(c.rB)) - (vA + wA.CrossProduct(c.rA));
+    }
+
+    void Apply(const ContactConstraint& c, const Vector3D& impulse) {
+        vA = vA - impulse * mA;
+        wA = wA - iA * c.rA.CrossProduct(impulse);
+        vB = vB + impulse * mB;
+        wB = wB + iB * c.rB.CrossProduct(impulse);
+    }
+
+    // Only movable bodies are written back; static and kinematic bodies may be shared between islands.
+    void Store(const ContactConstraint& c, SolverBodies& bodies) const {
+        if (mA > 0.0f) {
+            bodies.linearVelocities[c.bodyA] = vA;
+            bodies.angularVelocities[c.bodyA] = wA;
+        }
+        if (mB > 0.0f) {
+            bodies.linearVelocities[c.bodyB] = vB;
+            bodies.angularVelocities[c.bodyB] = wB;
+        }
+    }
+};
+
+} // namespace
+
+void ContactSolver::Prepare(ContactConstraint& c, const ContactManifold& manifold,
+                            const SolverBodies& bodies, const ContactSolverSettings& settings, float deltaTime) {
+    const CollisionInfo& info = manifold.info;
+
+    c.normal = info.normal;
+    BuildTangents(c.normal, c.tangent1, c.tangent2);
+
+    const Vector3D centerA = c.bodyA >= 0 ? bodies.positions[c.bodyA] : info.colliderA->GetPosition();
+    const Vector3D centerB = c.bodyB >= 0 ? bodies.positions[c.bodyB] : info.colliderB->GetPosition();
+    c.rA = info.contactPoint - centerA;
+    c.rB = info.contactPoint - centerB;
+
+    const BodyPair pair(c, bodies);
+    c.normalMass = EffectiveMass(c.normal, c.rA, c.rB, pair.mA, pair.mB, pair.iA, pair.iB);
+    c.tangentMass1 = EffectiveMass(c.tangent1, c.rA, c.rB, pair.mA, pair.mB, pair.iA, pair.iB);
+    c.tangentMass2 = EffectiveMass(c.tangent2, c.rA, c.rB, pair.mA, pair.mB, pair.iA, pair.iB);
+
+    const PhysicsMaterial materialA = info.colliderA->GetMaterial();
+    const PhysicsMaterial materialB = info.colliderB->GetMaterial();
+    c.friction = std::sqrt(std::max(materialA.friction, 0.0f) * std::max(materialB.friction, 0.0f));
+    const float restitution = std::max(materialA.bounciness, materialB.bounciness);
+
+    // Separating velocity target: bounce back fast approaches, then push out of penetration.
+    const float approach = pair.RelativeVelocity(c).DotProduct(c.normal);
+    float bias = 0.0f;
+    if (approach < -settings.restitutionThreshold) {
+        bias = -restitution * approach;
+    }
+
+    const float penetration = info.penetrationDepth - settings.linearSlop;
+    if (penetration > 0.0f && deltaTime > 0.0f) {
+        bias = std::max(bias, std::min(settings.baumgarte * penetration / deltaTime, settings.maxCorrectionSpeed));
+    }
+    c.velocityBias = bias;
+
+    if (settings.warmStarting) {
+        c.normalImpulse = manifold.normalImpulse;
+        c.tangentImpulse1 = manifold.tangentImpulse1;
+        c.tangentImpulse2 = manifold.tangentImpulse2;
+    } else {
+        c.normalImpulse = 0.0f;
+        c.tangentImpulse1 = 0.0f;
+        c.tangentImpulse2 = 0.0f;
+    }
+}
+
+void ContactSolver::WarmStart(const ContactConstraint* constraints, size_t count, SolverBodies& bodies) {
+    for (size_t i = 0; i < count; ++i) {
+        const ContactConstraint& c = constraints[i];
+        if (c.normalImpulse == 0.0f && c.tangentImpulse1 == 0.0f && c.tangentImpulse2 == 0.0f) continue;
+
+        BodyPair pair(c, bodies);
+        pair.Apply(c, c.normal * c.normalImpulse + c.tangent1 * c.tangentImpulse1 + c.tangent2 * c.tangentImpulse2);
+        pair.Store(c, bodies);
+    }
+}
+
+void ContactSolver::SolveVelocity(ContactConstraint* constraints, size_t count, SolverBodies& bodies) {
+    for (size_t i = 0; i < count; ++i) {
+        ContactConstraint& c = constraints[i];
+        BodyPair pair(c, bodies);
+
+        // Friction first so the normal constraint has the final say on penetration.
+        const float maxFriction = c.friction * c.normalImpulse;
+
+        Vector3D dv = pair.RelativeVelocity(c);
+        float lambda = -c.tangentMass1 * dv.DotProduct(c.tangent1);
+        float accumulated = std::clamp(c.tangentImpulse1 + lambda, -maxFriction, maxFriction);
+        lambda = accumulated - c.tangentImpulse1;
+        c.tangentImpulse1 = accumulated;
+        pair.Apply(c, c.tangent1 * lambda);
+
+        dv = pair.RelativeVelocity(c);
+        lambda = -c.tangentMass2 * dv.DotProduct(c.tangent2);
+        accumulated = std::clamp(c.tangentImpulse2 + lambda, -maxFriction, maxFriction);
+        lambda = accumulated - c.tangentImpulse2;
+        c.tangentImpulse2 = accumulated;
+        pair.Apply(c, c.tangent2 * lambda);
+
+        dv = pair.RelativeVelocity(c);
+        lambda = c.normalMass * (c.velocityBias - dv.DotProduct(c.normal));
+        accumulated = std::max(c.normalImpulse + lambda, 0.0f);
+        lambda = accumulated - c.normalImpulse;
+        c.normalImpulse = accumulated;
+        pair.Apply(c, c.normal * lambda);
+
+        pair.Store(c, bodies);
+    }
+}
+
+void ContactSolver::StoreImpulses(const ContactConstraint* constraints, size_t count, ContactCache& cache) {
+    for (size_t i = 0; i < count; ++i) {
+        ContactManifold& manifold = cache.Get(constraints[i].manifold);
+        manifold.normalImpulse = constraints[i].normalImpulse;
+        manifold.tangentImpulse1 = constraints[i].tangentImpulse1;
+        manifold.tangentImpulse2 = constraints[i].tangentImpulse2;
+    }
+}
+
+} // namespace ptx
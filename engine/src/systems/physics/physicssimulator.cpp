@@ -1,7 +1,7 @@
 #include <ptx/systems/physics/physicssimulator.hpp>
 
 PhysicsSimulator::PhysicsSimulator()
-    : bC(Vector3D(0, 0, 0), Vector3D(300, 200, 100)), previousTime(0), startedSim(false) {
+    : bC(Vector3D(0, 0, 0), Vector3D(300, 200, 100)), objects(), previousTime(0), startedSim(false) {
 
     lights[0].Set(Vector3D(1000, 0, 0), Vector3D(255, 0, 0), 1000.0f, 0.75f, 0.25f); // Set lights position, color intensity, falloff distance, and falloff curvature
     lights[1].Set(Vector3D(0, 1000, 0), Vector3D(0, 255, 0), 1000.0f, 0.75f, 0.25f);
@@ -62,6 +62,8 @@ void PhysicsSimulator::Update(Vector3D acceleration, Quaternion rotation) {
     bMS->Update(dT, accelNormalized, rotation);
 
     for (int i = 0; i < 12; i++) {
+        if (objects[i] == nullptr) continue;
+
         float positionZ = objects[i]->GetTransform()->GetPosition().Z;
         float scaleRatio = Mathematics::Map(positionZ, -50.0f, 50.0f, 1.2f, 0.8f);
 
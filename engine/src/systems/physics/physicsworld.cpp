@@ -0,0 +1,519 @@
+#include <ptx/systems/physics/physicsworld.hpp>
+#include <ptx/core/platform/threadpool.hpp>
+#include <algorithm>
+#include <cfloat>
+
+namespace ptx {
+
+PhysicsWorld::PhysicsWorld()
+    : islandCount(0), awakeIslandCount(0),
+      gravity(0.0f, -9.81f, 0.0f), velocityIterations(8), sleepingEnabled(true),
+      timeToSleep(0.5f), linearSleepTolerance(0.05f), angularSleepTolerance(0.05f) {
+}
+
+// === Bodies ===
+
+int32_t PhysicsWorld::CreateBody(Collider* collider, const RigidBody& body) {
+    if (collider == nullptr || colliderToHandle.find(collider) != colliderToHandle.end()) {
+        return kInvalidBody;
+    }
+
+    int32_t handle;
+    if (!freeHandles.empty()) {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+    } else {
+        handle = static_cast<int32_t>(handleToDense.size());
+        handleToDense.push_back(-1);
+    }
+
+    const int32_t dense = static_cast<int32_t>(colliders.size());
+    handleToDense[handle] = dense;
+    denseToHandle.push_back(handle);
+    colliderToHandle[collider] = handle;
+
+    colliders.push_back(collider);
+    types.push_back(body.type);
+    positions.push_back(collider->GetPosition());
+    linearVelocities.push_back(body.type == RigidBodyType::Static ? Vector3D(0, 0, 0) : body.linearVelocity);
+    angularVelocities.push_back(body.type == RigidBodyType::Static ? Vector3D(0, 0, 0) : body.angularVelocity);
+    forces.push_back(Vector3D(0, 0, 0));
+    inverseMasses.push_back(0.0f);
+    inverseInertias.push_back(Vector3D(0, 0, 0));
+    linearDampings.push_back(body.linearDamping);
+    angularDampings.push_back(body.angularDamping);
+    gravityScales.push_back(body.gravityScale);
+    sleepTimers.push_back(0.0f);
+    awakeFlags.push_back(1);
+    canSleepFlags.push_back(body.canSleep ? 1 : 0);
+
+    if (body.type == RigidBodyType::Dynamic) {
+        ComputeMass(dense, body.mass);
+    }
+
+    collisionManager.RegisterCollider(collider);
+    return handle;
+}
+
+void PhysicsWorld::DestroyBody(int32_t body) {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0) return;
+
+    collisionManager.UnregisterCollider(colliders[dense]);
+    colliderToHandle.erase(colliders[dense]);
+
+    // Swap-remove keeps every array dense.
+    const size_t last = colliders.size() - 1;
+    auto remove = [dense, last](auto& values) {
+        values[dense] = values[last];
+        values.pop_back();
+    };
+
+    remove(colliders);
+    remove(types);
+    remove(positions);
+    remove(linearVelocities);
+    remove(angularVelocities);
+    remove(forces);
+    remove(inverseMasses);
+    remove(inverseInertias);
+    remove(linearDampings);
+    remove(angularDampings);
+    remove(gravityScales);
+    remove(sleepTimers);
+    remove(awakeFlags);
+    remove(canSleepFlags);
+    remove(denseToHandle);
+
+    if (static_cast<size_t>(dense) < colliders.size()) {
+        handleToDense[denseToHandle[dense]] = dense;
+    }
+
+    handleToDense[body] = -1;
+    freeHandles.push_back(body);
+}
+
+void PhysicsWorld::Clear() {
+    for (Collider* collider : colliders) {
+        collisionManager.UnregisterCollider(collider);
+    }
+
+    colliders.clear();
+    types.clear();
+    positions.clear();
+    linearVelocities.clear();
+    angularVelocities.clear();
+    forces.clear();
+    inverseMasses.clear();
+    inverseInertias.clear();
+    linearDampings.clear();
+    angularDampings.clear();
+    gravityScales.clear();
+    sleepTimers.clear();
+    awakeFlags.clear();
+    canSleepFlags.clear();
+
+    handleToDense.clear();
+    denseToHandle.clear();
+    freeHandles.clear();
+    colliderToHandle.clear();
+
+    constraints.clear();
+    sortedConstraints.clear();
+    islandCount = 0;
+    awakeIslandCount = 0;
+}
+
+int32_t PhysicsWorld::DenseIndex(int32_t body) const {
+    if (body < 0 || body >= static_cast<int32_t>(handleToDense.size())) return -1;
+    return handleToDense[body];
+}
+
+bool PhysicsWorld::IsValid(int32_t body) const {
+    return DenseIndex(body) >= 0;
+}
+
+int32_t PhysicsWorld::GetBody(const Collider* collider) const {
+    auto it = colliderToHandle.find(collider);
+    return it != colliderToHandle.end() ? it->second : kInvalidBody;
+}
+
+Collider* PhysicsWorld::GetCollider(int32_t body) const {
+    const int32_t dense = DenseIndex(body);
+    return dense >= 0 ? colliders[dense] : nullptr;
+}
+
+RigidBodyType PhysicsWorld::GetType(int32_t body) const {
+    const int32_t dense = DenseIndex(body);
+    return dense >= 0 ? types[dense] : RigidBodyType::Static;
+}
+
+float PhysicsWorld::GetMass(int32_t body) const {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0 || inverseMasses[dense] <= 0.0f) return 0.0f;
+    return 1.0f / inverseMasses[dense];
+}
+
+Vector3D PhysicsWorld::GetPosition(int32_t body) const {
+    const int32_t dense = DenseIndex(body);
+    return dense >= 0 ? positions[dense] : Vector3D(0, 0, 0);
+}
+
+void PhysicsWorld::SetPosition(int32_t body, const Vector3D& position) {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0) return;
+
+    positions[dense] = position;
+    colliders[dense]->SetPosition(position);
+    Wake(dense);
+}
+
+Vector3D PhysicsWorld::GetLinearVelocity(int32_t body) const {
+    const int32_t dense = DenseIndex(body);
+    return dense >= 0 ? linearVelocities[dense] : Vector3D(0, 0, 0);
+}
+
+void PhysicsWorld::SetLinearVelocity(int32_t body, const Vector3D& velocity) {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0 || types[dense] == RigidBodyType::Static) return;
+
+    linearVelocities[dense] = velocity;
+    Wake(dense);
+}
+
+Vector3D PhysicsWorld::GetAngularVelocity(int32_t body) const {
+    const int32_t dense = DenseIndex(body);
+    return dense >= 0 ? angularVelocities[dense] : Vector3D(0, 0, 0);
+}
+
+void PhysicsWorld::SetAngularVelocity(int32_t body, const Vector3D& velocity) {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0 || types[dense] == RigidBodyType::Static) return;
+
+    angularVelocities[dense] = velocity;
+    Wake(dense);
+}
+
+void PhysicsWorld::ApplyForce(int32_t body, const Vector3D& force) {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0 || types[dense] != RigidBodyType::Dynamic) return;
+
+    forces[dense] = forces[dense] + force;
+    Wake(dense);
+}
+
+void PhysicsWorld::ApplyImpulse(int32_t body, const Vector3D& impulse, const Vector3D& point) {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0 || types[dense] != RigidBodyType::Dynamic) return;
+
+    const Vector3D r = point - positions[dense];
+    linearVelocities[dense] = linearVelocities[dense] + impulse * inverseMasses[dense];
+    angularVelocities[dense] = angularVelocities[dense] + inverseInertias[dense] * r.CrossProduct(impulse);
+    Wake(dense);
+}
+
+bool PhysicsWorld::IsAwake(int32_t body) const {
+    const int32_t dense = DenseIndex(body);
+    return dense >= 0 && awakeFlags[dense] != 0;
+}
+
+void PhysicsWorld::SetAwake(int32_t body, bool awake) {
+    const int32_t dense = DenseIndex(body);
+    if (dense < 0) return;
+
+    if (awake) {
+        Wake(dense);
+        return;
+    }
+
+    if (types[dense] != RigidBodyType::Dynamic) return;
+
+    awakeFlags[dense] = 0;
+    sleepTimers[dense] = timeToSleep;
+    linearVelocities[dense] = Vector3D(0, 0, 0);
+    angularVelocities[dense] = Vector3D(0, 0, 0);
+    forces[dense] = Vector3D(0, 0, 0);
+}
+
+void PhysicsWorld::Wake(int32_t dense) {
+    awakeFlags[dense] = 1;
+    sleepTimers[dense] = 0.0f;
+}
+
+void PhysicsWorld::ComputeMass(int32_t dense, float mass) {
+    Collider* collider = colliders[dense];
+    const float density = collider->GetMaterial().density > 0.0f ? collider->GetMaterial().density : 1.0f;
+
+    Vector3D inertia;
+    if (collider->GetType() == ColliderType::Sphere) {
+        const float radius = static_cast<SphereCollider*>(collider)->GetRadius();
+        if (mass <= 0.0f) mass = density * (4.0f / 3.0f) * 3.14159265f * radius * radius * radius;
+
+        const float i = 0.4f * mass * radius * radius;
+        inertia = Vector3D(i, i, i);
+    } else {
+        // Boxes and everything else use their bounds as a solid box.
+        const Vector3D size = collider->GetBounds().GetExtents() * 2.0f;
+        if (mass <= 0.0f) mass = density * size.X * size.Y * size.Z;
+
+        const float xx = size.X * size.X, yy = size.Y * size.Y, zz = size.Z * size.Z;
+        inertia = Vector3D(mass * (yy + zz), mass * (xx + zz), mass * (xx + yy)) / 12.0f;
+    }
+
+    if (mass <= 0.0f) mass = 1.0f;
+
+    auto invert = [](float value) { return value > 0.0f ? 1.0f / value : 0.0f; };
+    inverseMasses[dense] = 1.0f / mass;
+    inverseInertias[dense] = Vector3D(invert(inertia.X), invert(inertia.Y), invert(inertia.Z));
+}
+
+// === Simulation ===
+
+void PhysicsWorld::SetSleepingEnabled(bool enabled) {
+    sleepingEnabled = enabled;
+    if (enabled) return;
+
+    for (size_t i = 0; i < colliders.size(); ++i) {
+        Wake(static_cast<int32_t>(i));
+    }
+}
+
+size_t PhysicsWorld::GetAwakeBodyCount() const {
+    size_t count = 0;
+    for (size_t i = 0; i < colliders.size(); ++i) {
+        if (types[i] == RigidBodyType::Dynamic && awakeFlags[i] != 0) ++count;
+    }
+    return count;
+}
+
+void PhysicsWorld::Step(float deltaTime) {
+    if (deltaTime <= 0.0f) return;
+
+    IntegrateVelocities(deltaTime);
+
+    collisionManager.Update();
+
+    BuildConstraints(deltaTime);
+    BuildIslands();
+
+    // Islands share no dynamic bodies, so each one is an independent task.
+    auto solveRange = [this, deltaTime](size_t begin, size_t end) {
+        for (size_t island = begin; island < end; ++island) {
+            if (islandAwake[island]) SolveIsland(island, deltaTime);
+        }
+    };
+
+    if (awakeIslandCount > 1) {
+        ThreadPool& pool = ThreadPool::Shared();
+        const size_t grain = std::max<size_t>(1, islandCount / (pool.GetConcurrency() * 4));
+        pool.ParallelFor(islandCount, grain, solveRange);
+    } else {
+        solveRange(0, islandCount);
+    }
+
+    // Kinematic bodies follow their velocity regardless of contacts.
+    for (size_t i = 0; i < colliders.size(); ++i) {
+        if (types[i] != RigidBodyType::Kinematic) continue;
+
+        positions[i] = positions[i] + linearVelocities[i] * deltaTime;
+        colliders[i]->SetPosition(positions[i]);
+    }
+}
+
+void PhysicsWorld::IntegrateVelocities(float deltaTime) {
+    for (size_t i = 0; i < colliders.size(); ++i) {
+        if (types[i] != RigidBodyType::Dynamic || awakeFlags[i] == 0) {
+            forces[i] = Vector3D(0, 0, 0);
+            continue;
+        }
+
+        // Positions may have been moved through the collider directly.
+        positions[i] = colliders[i]->GetPosition();
+
+        const Vector3D acceleration = gravity * gravityScales[i] + forces[i] * inverseMasses[i];
+        linearVelocities[i] = (linearVelocities[i] + acceleration * deltaTime) * (1.0f / (1.0f + deltaTime * linearDampings[i]));
+        angularVelocities[i] = angularVelocities[i] * (1.0f / (1.0f + deltaTime * angularDampings[i]));
+        forces[i] = Vector3D(0, 0, 0);
+    }
+}
+
+void PhysicsWorld::BuildConstraints(float deltaTime) {
+    constraints.clear();
+
+    SolverBodies bodies = { positions.data(), linearVelocities.data(), angularVelocities.data(),
+                            inverseMasses.data(), inverseInertias.data() };
+
+    const ContactCache& cache = collisionManager.GetContacts();
+    for (uint32_t index : collisionManager.GetActiveContacts()) {
+        const ContactManifold& manifold = cache.Get(index);
+        Collider* a = manifold.info.colliderA;
+        Collider* b = manifold.info.colliderB;
+        if (a->IsTrigger() || b->IsTrigger()) continue;
+
+        const int32_t handleA = GetBody(a);
+        const int32_t handleB = GetBody(b);
+        const int32_t denseA = handleA != kInvalidBody ? handleToDense[handleA] : -1;
+        const int32_t denseB = handleB != kInvalidBody ? handleToDense[handleB] : -1;
+
+        const bool dynamicA = denseA >= 0 && types[denseA] == RigidBodyType::Dynamic;
+        const bool dynamicB = denseB >= 0 && types[denseB] == RigidBodyType::Dynamic;
+        if (!dynamicA && !dynamicB) continue;
+
+        // A moving kinematic body wakes whatever it touches.
+        auto wakeIfPushed = [&](int32_t kinematic, int32_t other) {
+            if (kinematic < 0 || types[kinematic] != RigidBodyType::Kinematic) return;
+            const Vector3D& v = linearVelocities[kinematic];
+            if (v.DotProduct(v) > 0.0f) Wake(other);
+        };
+        if (dynamicB) wakeIfPushed(denseA, denseB);
+        if (dynamicA) wakeIfPushed(denseB, denseA);
+
+        ContactConstraint constraint;
+        constraint.bodyA = denseA;
+        constraint.bodyB = denseB;
+        constraint.manifold = index;
+        ContactSolver::Prepare(constraint, manifold, bodies, solverSettings, deltaTime);
+        constraints.push_back(constraint);
+    }
+}
+
+int32_t PhysicsWorld::FindRoot(int32_t dense) {
+    while (unionParents[dense] != dense) {
+        unionParents[dense] = unionParents[unionParents[dense]];
+        dense = unionParents[dense];
+    }
+    return dense;
+}
+
+void PhysicsWorld::BuildIslands() {
+    const size_t bodyCount = colliders.size();
+
+    // Union-find over dynamic bodies linked by contacts. Static and kinematic
+    // bodies never join islands, so a floor does not merge everything on it.
+    unionParents.resize(bodyCount);
+    for (size_t i = 0; i < bodyCount; ++i) {
+        unionParents[i] = static_cast<int32_t>(i);
+    }
+
+    for (const ContactConstraint& c : constraints) {
+        if (c.bodyA < 0 || c.bodyB < 0) continue;
+        if (types[c.bodyA] != RigidBodyType::Dynamic || types[c.bodyB] != RigidBodyType::Dynamic) continue;
+
+        const int32_t rootA = FindRoot(c.bodyA);
+        const int32_t rootB = FindRoot(c.bodyB);
+        if (rootA != rootB) unionParents[rootB] = rootA;
+    }
+
+    bodyIslands.assign(bodyCount, -1);
+    islandCount = 0;
+    for (size_t i = 0; i < bodyCount; ++i) {
+        if (types[i] == RigidBodyType::Dynamic && FindRoot(static_cast<int32_t>(i)) == static_cast<int32_t>(i)) {
+            bodyIslands[i] = static_cast<int32_t>(islandCount++);
+        }
+    }
+    for (size_t i = 0; i < bodyCount; ++i) {
+        if (types[i] == RigidBodyType::Dynamic) {
+            bodyIslands[i] = bodyIslands[FindRoot(static_cast<int32_t>(i))];
+        }
+    }
+
+    // An island is solved if any member is awake; solving wakes the rest.
+    islandAwake.assign(islandCount, 0);
+    for (size_t i = 0; i < bodyCount; ++i) {
+        if (bodyIslands[i] >= 0 && awakeFlags[i] != 0) islandAwake[bodyIslands[i]] = 1;
+    }
+
+    awakeIslandCount = 0;
+    for (size_t island = 0; island < islandCount; ++island) {
+        awakeIslandCount += islandAwake[island];
+    }
+
+    // Counting sort of bodies by island.
+    islandBodyStarts.assign(islandCount + 1, 0);
+    for (size_t i = 0; i < bodyCount; ++i) {
+        if (bodyIslands[i] >= 0) ++islandBodyStarts[bodyIslands[i] + 1];
+    }
+    for (size_t island = 0; island < islandCount; ++island) {
+        islandBodyStarts[island + 1] += islandBodyStarts[island];
+    }
+
+    islandBodies.resize(islandBodyStarts[islandCount]);
+    islandCursors.assign(islandBodyStarts.begin(), islandBodyStarts.end() - 1);
+    for (size_t i = 0; i < bodyCount; ++i) {
+        const int32_t island = bodyIslands[i];
+        if (island < 0) continue;
+
+        if (islandAwake[island] && awakeFlags[i] == 0) Wake(static_cast<int32_t>(i));
+        islandBodies[islandCursors[island]++] = static_cast<int32_t>(i);
+    }
+
+    // Counting sort of constraints by the island of their dynamic body.
+    constraintIslands.resize(constraints.size());
+    islandConstraintStarts.assign(islandCount + 1, 0);
+    for (size_t i = 0; i < constraints.size(); ++i) {
+        const ContactConstraint& c = constraints[i];
+        const bool dynamicA = c.bodyA >= 0 && types[c.bodyA] == RigidBodyType::Dynamic;
+        constraintIslands[i] = bodyIslands[dynamicA ? c.bodyA : c.bodyB];
+        ++islandConstraintStarts[constraintIslands[i] + 1];
+    }
+    for (size_t island = 0; island < islandCount; ++island) {
+        islandConstraintStarts[island + 1] += islandConstraintStarts[island];
+    }
+
+    sortedConstraints.resize(constraints.size());
+    islandCursors.assign(islandConstraintStarts.begin(), islandConstraintStarts.end() - 1);
+    for (size_t i = 0; i < constraints.size(); ++i) {
+        sortedConstraints[islandCursors[constraintIslands[i]]++] = constraints[i];
+    }
+}
+
+void PhysicsWorld::SolveIsland(size_t island, float deltaTime) {
+    SolverBodies bodies = { positions.data(), linearVelocities.data(), angularVelocities.data(),
+                            inverseMasses.data(), inverseInertias.data() };
+
+    ContactConstraint* islandConstraints = sortedConstraints.data() + islandConstraintStarts[island];
+    const size_t constraintCount = islandConstraintStarts[island + 1] - islandConstraintStarts[island];
+
+    if (solverSettings.warmStarting) {
+        ContactSolver::WarmStart(islandConstraints, constraintCount, bodies);
+    }
+
+    for (int iteration = 0; iteration < velocityIterations; ++iteration) {
+        ContactSolver::SolveVelocity(islandConstraints, constraintCount, bodies);
+    }
+
+    ContactSolver::StoreImpulses(islandConstraints, constraintCount, collisionManager.GetContacts());
+
+    // Integrate positions and track how long the island has been at rest.
+    const float linearTolerance = linearSleepTolerance * linearSleepTolerance;
+    const float angularTolerance = angularSleepTolerance * angularSleepTolerance;
+    float minSleepTime = FLT_MAX;
+
+    for (uint32_t i = islandBodyStarts[island]; i < islandBodyStarts[island + 1]; ++i) {
+        const int32_t body = islandBodies[i];
+        const Vector3D& v = linearVelocities[body];
+        const Vector3D& w = angularVelocities[body];
+
+        positions[body] = positions[body] + v * deltaTime;
+        colliders[body]->SetPosition(positions[body]);
+
+        if (canSleepFlags[body] == 0 || v.DotProduct(v) > linearTolerance || w.DotProduct(w) > angularTolerance) {
+            sleepTimers[body] = 0.0f;
+        } else {
+            sleepTimers[body] += deltaTime;
+        }
+
+        minSleepTime = std::min(minSleepTime, sleepTimers[body]);
+    }
+
+    if (!sleepingEnabled || minSleepTime < timeToSleep) return;
+
+    for (uint32_t i = islandBodyStarts[island]; i < islandBodyStarts[island + 1]; ++i) {
+        const int32_t body = islandBodies[i];
+        awakeFlags[body] = 0;
+        linearVelocities[body] = Vector3D(0, 0, 0);
+        angularVelocities[body] = Vector3D(0, 0, 0);
+    }
+}
+
+} // namespace ptx
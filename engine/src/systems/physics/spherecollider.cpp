@@ -22,10 +22,10 @@ bool SphereCollider::Raycast(const Vector3D& origin, const Vector3D& direction,
     // Sphere: |P - center|^2 = radius^2
 
     Vector3D oc = origin - position;
-    float a = direction.dot(direction);
-    float b = 2.0f * oc.dot(direction);
+    float a = direction.DotProduct(direction);
+    float b = 2.0f * oc.DotProduct(direction);
     float radius = GetRadius();
-    float c = oc.dot(oc) - radius * radius;
+    float c = oc.DotProduct(oc) - radius * radius;
     float discriminant = b * b - 4 * a * c;
 
     if (discriminant < 0) {
@@ -47,7 +47,7 @@ bool SphereCollider::Raycast(const Vector3D& origin, const Vector3D& direction,
     hit.distance = t;
     hit.point = origin + direction * t;
     hit.normal = (hit.point - position);
-    hit.normal.normalize();
+    hit.normal = hit.normal.UnitSphere();
     hit.collider = this;
 
     return true;
@@ -55,13 +55,14 @@ bool SphereCollider::Raycast(const Vector3D& origin, const Vector3D& direction,
 
 bool SphereCollider::ContainsPoint(const Vector3D& point) {
     float radius = GetRadius();
-    float distSquared = (point - position).lengthSquared();
+    Vector3D delta = point - position;
+    float distSquared = delta.DotProduct(delta);
     return distSquared <= (radius * radius);
 }
 
 Vector3D SphereCollider::ClosestPoint(const Vector3D& point) {
     Vector3D dir = point - position;
-    float dist = dir.length();
+    float dist = dir.Magnitude();
     float radius = GetRadius();
 
     if (dist <= radius) {
@@ -70,7 +71,7 @@ Vector3D SphereCollider::ClosestPoint(const Vector3D& point) {
     }
 
     // Point is outside, project to surface
-    dir.normalize();
+    dir = dir.UnitSphere();
     return position + dir * radius;
 }
 
@@ -82,4 +83,8 @@ void SphereCollider::SetPosition(const Vector3D& pos) {
     position = pos;
 }
 
+AABB SphereCollider::GetBounds() {
+    return AABB::FromSphere(position, GetRadius());
+}
+
 } // namespace ptx
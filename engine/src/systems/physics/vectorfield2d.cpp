@@ -1,86 +1,354 @@
 #include <ptx/systems/physics/vectorfield2d.hpp>
+#include <ptx/core/platform/threadpool.hpp>
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
-VectorField2D::VectorField2D(uint16_t x, uint16_t y)
-    : vecXP(static_cast<size_t>(x) * y, 0),
-      vecYP(static_cast<size_t>(x) * y, 0),
-      vecDP(static_cast<size_t>(x) * y, 0),
-      vecX(static_cast<size_t>(x) * y, 0),
-      vecY(static_cast<size_t>(x) * y, 0),
-      vecD(static_cast<size_t>(x) * y, 0),
+namespace {
+
+// Below this many interior rows a sweep is cheaper than waking the pool.
+constexpr size_t kMinimumParallelRows = 48;
+
+// Runs body(yBegin, yEnd) over interior rows [1, countY - 1), split into bands on the shared pool.
+template <typename Body>
+void ForEachRowBand(uint16_t countY, const Body& body) {
+    const size_t rows = countY > 2 ? static_cast<size_t>(countY) - 2 : 0;
+    if (rows == 0) return;
+
+    if (rows < kMinimumParallelRows) {
+        body(1, static_cast<size_t>(countY) - 1);
+        return;
+    }
+
+    ptx::ThreadPool& pool = ptx::ThreadPool::Shared();
+    const size_t grain = std::max<size_t>(16, rows / (pool.GetConcurrency() * 2));
+    pool.ParallelFor(rows, grain, [&body](size_t begin, size_t end) {
+        body(begin + 1, end + 1);
+    });
+}
+
+// Zeroes magnitudes small enough to decay into denormals, which are orders of magnitude
+// slower on most FPUs; 1e-12 is still far above anything visible after quantization.
+void FlushTiny(std::vector<float>& values) {
+    for (float& value : values) {
+        value = std::fabs(value) < 1e-12f ? 0.0f : value;
+    }
+}
+
+int8_t ToFixed(float value) {
+    const float scaled = std::min(std::max(value, -1.0f), 1.0f) * 127.0f;
+    return static_cast<int8_t>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+}
+
+constexpr float kFromFixed = 1.0f / 127.0f;
+
+} // namespace
+
+VectorField2D::VectorField2D(uint16_t x, uint16_t y, Storage storage)
+    : velocityX(static_cast<size_t>(x) * y, 0.0f),
+      velocityY(static_cast<size_t>(x) * y, 0.0f),
+      densities(static_cast<size_t>(x) * y, 0.0f),
+      velocityXP(static_cast<size_t>(x) * y, 0.0f),
+      velocityYP(static_cast<size_t>(x) * y, 0.0f),
+      densitiesP(static_cast<size_t>(x) * y, 0.0f),
+      pressure(static_cast<size_t>(x) * y, 0.0f),
+      divergence(static_cast<size_t>(x) * y, 0.0f),
       countX(x),
-      countY(y) {}
+      countY(y),
+      storage(storage) {
+    if (storage == Storage::Fixed8) {
+        vecX.assign(SampleCount(), 0);
+        vecY.assign(SampleCount(), 0);
+        vecD.assign(SampleCount(), 0);
+    }
+}
 
-void VectorField2D::Boundary() {
-    // Handle edges
+// === Storage ===
+
+float VectorField2D::CellScale() const noexcept {
+    // Square cells sized by the longer axis; 1 / h in Stam's notation.
+    return static_cast<float>(std::max(countX, countY) - 2);
 }
 
-void VectorField2D::Diffuse(float viscosity, float dt) {
-    float a = dt * viscosity * (float)countX * (float)countY;
-    float aS = 1.0f + (4.0f * a);
+void VectorField2D::Load() {
+    if (storage != Storage::Fixed8) return;
 
-    for (uint32_t i = 0; i < countX * countY; i++) {
-        vecDP[i] = Mathematics::Constrain(vecD[i] - 1, 0, 127);
+    const size_t count = SampleCount();
+    for (size_t i = 0; i < count; i++) {
+        velocityX[i] = static_cast<float>(vecX[i]) * kFromFixed;
+        velocityY[i] = static_cast<float>(vecY[i]) * kFromFixed;
+        densities[i] = static_cast<float>(vecD[i]) * kFromFixed;
     }
+}
 
-    for (int x = 1; x < countX - 1; x++) {
-        for (int y = 1; y < countY - 1; y++) {
-            uint32_t index = x + countX * y;
-            uint32_t top = x + countX * (y - 1);
-            uint32_t bot = x + countX * (y + 1);
-            uint32_t rgt = index + 1;
-            uint32_t lft = index - 1;
+void VectorField2D::Store() {
+    if (storage != Storage::Fixed8) return;
+
+    const size_t count = SampleCount();
+    for (size_t i = 0; i < count; i++) {
+        vecX[i] = ToFixed(velocityX[i]);
+        vecY[i] = ToFixed(velocityY[i]);
+        vecD[i] = ToFixed(densities[i]);
+    }
+}
 
-            float value = ((float)vecDP[index] + a * ((float)vecD[top] + (float)vecD[bot] + (float)vecD[rgt] + (float)vecD[lft])) / aS;
+float VectorField2D::ReadDensity(uint32_t index) const {
+    return storage == Storage::Fixed8 ? static_cast<float>(vecD[index]) * kFromFixed : densities[index];
+}
+
+void VectorField2D::WriteDensity(uint32_t index, float value) {
+    if (storage == Storage::Fixed8) {
+        vecD[index] = ToFixed(value);
+    } else {
+        densities[index] = value;
+    }
+}
+
+void VectorField2D::WriteVelocity(uint32_t index, float x, float y) {
+    if (storage == Storage::Fixed8) {
+        vecX[index] = ToFixed(x);
+        vecY[index] = ToFixed(y);
+    } else {
+        velocityX[index] = x;
+        velocityY[index] = y;
+    }
+}
+
+// === Solver ===
+
+void VectorField2D::SetBoundary(BoundaryKind kind, float* field) const {
+    if (countX < 3 || countY < 3) return;
+
+    const uint32_t w = countX;
+    const uint32_t last = static_cast<uint32_t>(countY - 1) * w;
+    const float signX = kind == VelocityX ? -1.0f : 1.0f;
+    const float signY = kind == VelocityY ? -1.0f : 1.0f;
+
+    for (uint32_t y = 1; y < static_cast<uint32_t>(countY) - 1; y++) {
+        field[y * w] = signX * field[y * w + 1];
+        field[y * w + w - 1] = signX * field[y * w + w - 2];
+    }
 
-            vecD[index] = value;
+    for (uint32_t x = 1; x < w - 1; x++) {
+        field[x] = signY * field[x + w];
+        field[last + x] = signY * field[last + x - w];
+    }
+
+    field[0] = 0.5f * (field[1] + field[w]);
+    field[w - 1] = 0.5f * (field[w - 2] + field[2 * w - 1]);
+    field[last] = 0.5f * (field[last + 1] + field[last - w]);
+    field[last + w - 1] = 0.5f * (field[last + w - 2] + field[last - 1]);
+}
+
+void VectorField2D::LinearSolve(BoundaryKind kind, float* field, const float* source, float a, float c) const {
+    const uint32_t w = countX;
+    const float inverseC = 1.0f / c;
+
+    for (uint8_t k = 0; k < iterations; k++) {
+        // Red-black ordering: a color only reads the other color, so bands never race.
+        for (uint32_t color = 0; color < 2; color++) {
+            ForEachRowBand(countY, [=](size_t yBegin, size_t yEnd) {
+                for (size_t y = yBegin; y < yEnd; y++) {
+                    float* row = field + y * w;
+                    const float* up = row - w;
+                    const float* down = row + w;
+                    const float* b = source + y * w;
+
+                    for (uint32_t x = 1 + ((1 + y + color) & 1); x < w - 1; x += 2) {
+                        row[x] = (b[x] + a * (row[x - 1] + row[x + 1] + up[x] + down[x])) * inverseC;
+                    }
+                }
+            });
         }
+
+        SetBoundary(kind, field);
     }
+}
+
+void VectorField2D::DiffuseField(BoundaryKind kind, float* field, const float* source, float rate, float dt) const {
+    const float n = CellScale();
+    const float a = dt * rate * n * n;
+    LinearSolve(kind, field, source, a, 1.0f + 4.0f * a);
+}
+
+void VectorField2D::AdvectField(BoundaryKind kind, float* field, const float* source,
+                                const float* u, const float* v, float dt) const {
+    const uint32_t w = countX;
+    const float dt0 = dt * CellScale();
+    const float maxX = static_cast<float>(countX) - 1.5f;
+    const float maxY = static_cast<float>(countY) - 1.5f;
+
+    ForEachRowBand(countY, [=](size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y++) {
+            const uint32_t row = static_cast<uint32_t>(y) * w;
+
+            for (uint32_t x = 1; x < w - 1; x++) {
+                const uint32_t index = row + x;
+
+                // Trace back along the velocity and sample the source bilinearly.
+                const float xA = std::min(std::max(static_cast<float>(x) - dt0 * u[index], 0.5f), maxX);
+                const float yA = std::min(std::max(static_cast<float>(y) - dt0 * v[index], 0.5f), maxY);
+
+                const uint32_t x0 = static_cast<uint32_t>(xA);
+                const uint32_t y0 = static_cast<uint32_t>(yA);
+                const float s1 = xA - static_cast<float>(x0);
+                const float t1 = yA - static_cast<float>(y0);
+
+                const float* s = source + y0 * w + x0;
+                const float top = s[0] + s1 * (s[1] - s[0]);
+                const float bottom = s[w] + s1 * (s[w + 1] - s[w]);
+                field[index] = top + t1 * (bottom - top);
+            }
+        }
+    });
+
+    SetBoundary(kind, field);
+}
+
+void VectorField2D::ProjectVelocity() {
+    const uint32_t w = countX;
+    const float n = CellScale();
+    const float halfH = 0.5f / n;
+    const float halfN = 0.5f * n;
+    float* u = velocityX.data();
+    float* v = velocityY.data();
+    float* p = pressure.data();
+    float* div = divergence.data();
+
+    ForEachRowBand(countY, [=](size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y++) {
+            const uint32_t row = static_cast<uint32_t>(y) * w;
+            for (uint32_t x = 1; x < w - 1; x++) {
+                const uint32_t i = row + x;
+                div[i] = -halfH * (u[i + 1] - u[i - 1] + v[i + w] - v[i - w]);
+            }
+        }
+    });
+
+    // Pressure from the previous step is a close guess, so it is kept as the starting point.
+    SetBoundary(Scalar, div);
+    SetBoundary(Scalar, p);
+    LinearSolve(Scalar, p, div, 1.0f, 4.0f);
+
+    ForEachRowBand(countY, [=](size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y++) {
+            const uint32_t row = static_cast<uint32_t>(y) * w;
+            for (uint32_t x = 1; x < w - 1; x++) {
+                const uint32_t i = row + x;
+                u[i] -= halfN * (p[i + 1] - p[i - 1]);
+                v[i] -= halfN * (p[i + w] - p[i - w]);
+            }
+        }
+    });
+
+    SetBoundary(VelocityX, u);
+    SetBoundary(VelocityY, v);
+}
+
+void VectorField2D::Boundary() {
+    Load();
+    SetBoundary(VelocityX, velocityX.data());
+    SetBoundary(VelocityY, velocityY.data());
+    SetBoundary(Scalar, densities.data());
+    Store();
+}
+
+void VectorField2D::Diffuse(float viscosity, float dt) {
+    if (countX < 3 || countY < 3) return;
 
-    // Boundary();
+    Load();
+    densitiesP = densities;
+    DiffuseField(Scalar, densities.data(), densitiesP.data(), viscosity, dt);
+    Store();
 }
 
 void VectorField2D::Advect(float dt) {
-    int x0, x1, y0, y1;
-    float s0, s1, t0, t1;
+    if (countX < 3 || countY < 3) return;
 
-    float dtX = dt * (float)countX;
-    float dtY = dt * (float)countY;
+    Load();
+    std::swap(densities, densitiesP);
+    AdvectField(Scalar, densities.data(), densitiesP.data(), velocityX.data(), velocityY.data(), dt);
+    Store();
+}
 
-    for (int x = 1; x < countX - 1; x++) {
-        for (int y = 1; y < countY - 1; y++) {
-            uint32_t index = x + countX * y;
-            float xA = (float)x - dtX * (float)vecX[index];
-            float yA = (float)y - dtY * (float)vecY[index];
+void VectorField2D::Project() {
+    if (countX < 3 || countY < 3) return;
 
-            if (xA < 0.5f) xA = 0.5f;
-            if (xA > countX + 0.5f) xA = countX + 0.5f;
-            x0 = (int)xA;
-            x1 = x0 + 1;
+    Load();
+    ProjectVelocity();
+    Store();
+}
 
-            if (yA < 0.5f) yA = 0.5f;
-            if (yA > countY + 0.5f) yA = countY + 0.5f;
-            y0 = (int)yA;
-            y1 = y0 + 1;
+void VectorField2D::Step(float dt, float viscosity, float diffusion) {
+    if (dt <= 0.0f || countX < 3 || countY < 3) return;
 
-            s1 = xA - x0;
-            s0 = 1.0f - s1;
-            t1 = yA - y0;
-            t0 = 1.0f - t1;
+    Load();
 
-            float td00 = t0 * (float)vecDP[Mathematics::Constrain(uint32_t(x0 + countX * y0), uint32_t(0), index)];
-            float td01 = t1 * (float)vecDP[Mathematics::Constrain(uint32_t(x0 + countX * y1), uint32_t(0), index)];
-            float td10 = t0 * (float)vecDP[Mathematics::Constrain(uint32_t(x1 + countX * y0), uint32_t(0), index)];
-            float td11 = t1 * (float)vecDP[Mathematics::Constrain(uint32_t(x1 + countX * y1), uint32_t(0), index)];
+    // Velocity: diffuse, project, self-advect, project.
+    if (viscosity > 0.0f) {
+        velocityXP = velocityX;
+        velocityYP = velocityY;
+        DiffuseField(VelocityX, velocityX.data(), velocityXP.data(), viscosity, dt);
+        DiffuseField(VelocityY, velocityY.data(), velocityYP.data(), viscosity, dt);
+        ProjectVelocity();
+    }
 
-            float value = s0 * (td00 + td01) + s1 * (td10 + td11);
+    std::swap(velocityX, velocityXP);
+    std::swap(velocityY, velocityYP);
+    AdvectField(VelocityX, velocityX.data(), velocityXP.data(), velocityXP.data(), velocityYP.data(), dt);
+    AdvectField(VelocityY, velocityY.data(), velocityYP.data(), velocityXP.data(), velocityYP.data(), dt);
+    ProjectVelocity();
 
-            vecD[index] = value;
-        }
+    // Density: diffuse, then carry along the divergence-free velocity.
+    if (diffusion > 0.0f) {
+        densitiesP = densities;
+        DiffuseField(Scalar, densities.data(), densitiesP.data(), diffusion, dt);
+    }
+
+    std::swap(densities, densitiesP);
+    AdvectField(Scalar, densities.data(), densitiesP.data(), velocityX.data(), velocityY.data(), dt);
+
+    FlushTiny(velocityX);
+    FlushTiny(velocityY);
+    FlushTiny(densities);
+    FlushTiny(pressure);
+
+    Store();
+}
+
+void VectorField2D::AddDensity(uint16_t x, uint16_t y, float amount) {
+    if (x >= countX || y >= countY) return;
+
+    const uint32_t index = x + countX * y;
+    WriteDensity(index, ReadDensity(index) + amount);
+}
+
+void VectorField2D::AddVelocity(uint16_t x, uint16_t y, float velocityX, float velocityY) {
+    if (x >= countX || y >= countY) return;
+
+    const Vector2D current = GetVelocity(x, y);
+    WriteVelocity(x + countX * y, current.X + velocityX, current.Y + velocityY);
+}
+
+float VectorField2D::GetDensity(uint16_t x, uint16_t y) const {
+    if (x >= countX || y >= countY) return 0.0f;
+
+    return ReadDensity(x + countX * y);
+}
+
+Vector2D VectorField2D::GetVelocity(uint16_t x, uint16_t y) const {
+    if (x >= countX || y >= countY) return Vector2D();
+
+    const uint32_t index = x + countX * y;
+    if (storage == Storage::Fixed8) {
+        return Vector2D(static_cast<float>(vecX[index]) * kFromFixed, static_cast<float>(vecY[index]) * kFromFixed);
     }
 
-    // Boundary();
+    return Vector2D(velocityX[index], velocityY[index]);
 }
 
+// === Authoring effects ===
+
 void VectorField2D::SineField(float ratio, float period, float amplitude) {
     for (int x = 0; x < countX; x++) {
         for (int y = 0; y < countY; y++) {
@@ -89,9 +357,10 @@ void VectorField2D::SineField(float ratio, float period, float amplitude) {
 
             uint32_t index = x + countX * y;
 
-            vecX[index] = Mathematics::Constrain(sinf((posX + posY) / (period * 6.28f * 1000.0f) + ratio * 6.28f) * amplitude, -1.0f, 1.0f) * 127.0f;
-            vecY[index] = Mathematics::Constrain(cosf((posX - posY) / (period * 6.28f * 1000.0f) + ratio * 6.28f) * amplitude, -1.0f, 1.0f) * 127.0f;
-            vecD[index] = Mathematics::Constrain((sinf((posX + posY) / (period * 6.28f * 50.0f)) + cosf((posX - posY) / (period * 6.28f * 50.0f))) * amplitude, -1.0f, 1.0f) * 127.0f;
+            WriteVelocity(index,
+                          Mathematics::Constrain(sinf((posX + posY) / (period * 6.28f * 1000.0f) + ratio * 6.28f) * amplitude, -1.0f, 1.0f),
+                          Mathematics::Constrain(cosf((posX - posY) / (period * 6.28f * 1000.0f) + ratio * 6.28f) * amplitude, -1.0f, 1.0f));
+            WriteDensity(index, Mathematics::Constrain((sinf((posX + posY) / (period * 6.28f * 50.0f)) + cosf((posX - posY) / (period * 6.28f * 50.0f))) * amplitude, -1.0f, 1.0f));
         }
     }
 }
@@ -110,9 +379,8 @@ void VectorField2D::StepField(float ratio, float period, float intensity) {
             bool xOdd = (int)(posX * 0.3f / (10.0f / period)) % 2;
             bool yOdd = (int)(posY * 0.3f / (10.0f / period)) % 2;
 
-            vecX[index] = xOdd ? 127 : -128;
-            vecY[index] = yOdd ? 127 : -128;
-            if (xOdd != yOdd) vecD[index] = Mathematics::Constrain(int8_t(vecD[index] + intensity), int8_t(0), int8_t(127));
+            WriteVelocity(index, xOdd ? 1.0f : -1.0f, yOdd ? 1.0f : -1.0f);
+            if (xOdd != yOdd) WriteDensity(index, Mathematics::Constrain(ReadDensity(index) + intensity * kFromFixed, 0.0f, 1.0f));
         }
     }
 }
@@ -129,11 +397,7 @@ void VectorField2D::MovingSquareField(float ratio, float period, float intensity
             uint32_t index = x + countX * y;
 
             if (posX < period / 2.0f && posX > -period / 2.0f && posY < period / 2.0f && posY > -period / 2.0f) {
-                vecD[index] = Mathematics::Constrain(int8_t(vecD[index] + intensity), int8_t(0), int8_t(127));
-            } else {
-                // vecX[index] = -intensity;
-                // vecY[index] = -128;
-                // vecD[index] = 0;
+                WriteDensity(index, Mathematics::Constrain(ReadDensity(index) + intensity * kFromFixed, 0.0f, 1.0f));
             }
         }
     }
@@ -150,8 +414,9 @@ void VectorField2D::SpiralField(float ratio, float period, float amplitude){
 
             uint32_t index = x + countX * y;
 
-            vecX[index] = Mathematics::Constrain((posX * cosf(2.0f * magn * period / 40.0f + phase)) * 0.01f * amplitude, -1.0f, 1.0f) * 127.0f;
-            vecY[index] = Mathematics::Constrain((posY * sinf(2.0f * magn * period / 40.0f + phase)) * 0.01f * amplitude, -1.0f, 1.0f) * 127.0f;
+            WriteVelocity(index,
+                          Mathematics::Constrain((posX * cosf(2.0f * magn * period / 40.0f + phase)) * 0.01f * amplitude, -1.0f, 1.0f),
+                          Mathematics::Constrain((posY * sinf(2.0f * magn * period / 40.0f + phase)) * 0.01f * amplitude, -1.0f, 1.0f));
         }
     }
 }
@@ -186,7 +451,7 @@ void VectorField2D::SetRotation(float rotation){
     this->rotation = rotation;
 }
 
-uint32_t VectorField2D::GetVectorAtPosition(float x, float y, bool &inBounds){
+bool VectorField2D::ToCellCoordinates(float x, float y, float& cellX, float& cellY) const {
     Vector2D input = Vector2D(x, y);
 
     input = input - position + size / 2.0f;
@@ -196,14 +461,20 @@ uint32_t VectorField2D::GetVectorAtPosition(float x, float y, bool &inBounds){
         input = input.Rotate(rotation, size / 2.0f);//rotate by center coordinate
     }
 
-    inBounds = input.X > 0  && input.X < size.X &&
-               input.Y > 0  && input.Y < size.Y;
+    if (!(input.X > 0 && input.X < size.X && input.Y > 0 && input.Y < size.Y)) return false;
+
+    cellX = Mathematics::Map(input.X, 0.0f, size.X, 0.0f, countX - 1.0f);
+    cellY = Mathematics::Map(input.Y, 0.0f, size.Y, 0.0f, countY - 1.0f);
+    return true;
+}
+
+uint32_t VectorField2D::GetVectorAtPosition(float x, float y, bool &inBounds){
+    float scaleX, scaleY;
+    inBounds = ToCellCoordinates(x, y, scaleX, scaleY);
 
     if (inBounds){
-        float scaleX = Mathematics::Map(input.X, 0.0f, size.X, 0.0f, countX - 1.0f);
-        float scaleY = Mathematics::Map(input.Y, 0.0f, size.Y, 0.0f, countY - 1.0f);
-        uint16_t colX = (uint16_t)floorf(scaleX);
-        uint16_t rowY = (uint16_t)floorf(scaleY);
+        uint16_t colX = (uint16_t)std::min(floorf(scaleX), countX - 2.0f);
+        uint16_t rowY = (uint16_t)std::min(floorf(scaleY), countY - 2.0f);
         
         //Vector corners
         uint32_t q11 = rowY * countX + colX;
@@ -211,21 +482,48 @@ uint32_t VectorField2D::GetVectorAtPosition(float x, float y, bool &inBounds){
         uint32_t q21 = (rowY + 1) * countX + colX;
         uint32_t q22 = (rowY + 1) * countX + (colX + 1);
         
-        //Bilinear interpolation
-        float x1 = colX * (size.X / (float)(countX - 1));
-        float x2 = (colX + 1) * (size.X / (float)(countX - 1));
-        float y1 = rowY * (size.Y / (float)(countY - 1));
-        float y2 = (rowY + 1) * (size.Y / (float)(countY - 1));
+        //Bilinear interpolation in cell units; v12 is the (x1, y2) corner
+        float x1 = colX;
+        float x2 = colX + 1.0f;
+        float y1 = rowY;
+        float y2 = rowY + 1.0f;
         
-        float v11 = vecD[q11];
-        float v12 = vecD[q12];
-        float v21 = vecD[q21];
-        float v22 = vecD[q22];
+        float v11 = ReadDensity(q11) * 127.0f;
+        float v12 = ReadDensity(q21) * 127.0f;
+        float v21 = ReadDensity(q12) * 127.0f;
+        float v22 = ReadDensity(q22) * 127.0f;
         
         float value = Mathematics::BilinearInterpolation(scaleX, scaleY, x1, y1, x2, y2, v11, v12, v21, v22);
         
-        return (uint32_t)value;
+        return value > 0.0f ? (uint32_t)value : 0;
     }
 
     return 0;
 }
+
+Vector2D VectorField2D::SampleVelocity(float x, float y, bool& inBounds) const {
+    float cellX, cellY;
+    inBounds = countX >= 2 && countY >= 2 && ToCellCoordinates(x, y, cellX, cellY);
+    if (!inBounds) return Vector2D();
+
+    const uint16_t x0 = (uint16_t)std::min(floorf(cellX), countX - 2.0f);
+    const uint16_t y0 = (uint16_t)std::min(floorf(cellY), countY - 2.0f);
+    const float s = cellX - x0;
+    const float t = cellY - y0;
+
+    const Vector2D v00 = GetVelocity(x0, y0);
+    const Vector2D v10 = GetVelocity(x0 + 1, y0);
+    const Vector2D v01 = GetVelocity(x0, y0 + 1);
+    const Vector2D v11 = GetVelocity(x0 + 1, y0 + 1);
+
+    const Vector2D top = v00 + (v10 - v00) * s;
+    const Vector2D bottom = v01 + (v11 - v01) * s;
+    Vector2D velocity = (top + (bottom - top) * t) * std::max(size.X, size.Y);
+
+    // Field-local direction back to world space.
+    if (!Mathematics::IsClose(rotation, 0.0f, 0.001f)) {
+        velocity = velocity.Rotate(-rotation, Vector2D(0, 0));
+    }
+
+    return velocity;
+}
@@ -7,7 +7,7 @@
 #include <ptx/core/math/mathematics.hpp>
 
 PixelGroup::PixelGroup(uint16_t pixelCount, Vector2D size, Vector2D position, uint16_t rowCount)
-    : bounds(position, size, 0.0f),
+    : bounds(Shape::Bounds{position, position}),
       pixelColors(pixelCount),
       pixelBuffer(pixelCount),
       up(pixelCount, kInvalidIndex),
@@ -30,7 +30,8 @@ PixelGroup::PixelGroup(uint16_t pixelCount, Vector2D size, Vector2D position, ui
 
 PixelGroup::PixelGroup(const Vector2D* pixelLocations, uint16_t pixelCount, Direction direction)
     : direction(direction),
-      bounds(position, size, 0.0f),
+      bounds(Shape::Bounds{pixelLocations && pixelCount > 0 ? pixelLocations[0] : Vector2D(),
+                           pixelLocations && pixelCount > 0 ? pixelLocations[0] : Vector2D()}),
       pixelColors(pixelCount),
       pixelBuffer(pixelCount),
       up(pixelCount, kInvalidIndex),
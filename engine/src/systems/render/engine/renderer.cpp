@@ -1,12 +1,111 @@
 #include <ptx/systems/render/engine/renderer.hpp>
 
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Working memory owned by one camera slot during a parallel render.
+ */
+struct CameraScratch {
+    Rasterizer::Scratch raster;
+    std::vector<float> depth;
+};
+
+std::vector<CameraScratch> cameraScratch;
+Rasterizer::Stats rasterStats;
+
+void AddStats(const Rasterizer::Stats& stats) {
+    rasterStats.meshesDrawn += stats.meshesDrawn;
+    rasterStats.meshesCulled += stats.meshesCulled;
+}
+
+bool SharesPixelGroup(CameraBase** cameras, uint8_t count) {
+    for (uint8_t i = 0; i < count; ++i) {
+        if (!cameras[i] || !cameras[i]->GetPixelGroup()) continue;
+        for (uint8_t j = i + 1; j < count; ++j) {
+            if (cameras[j] && cameras[j]->GetPixelGroup() == cameras[i]->GetPixelGroup()) return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 void RenderingEngine::Rasterize(Scene* scene, CameraManager* cameraManager) {
-    for (int i = 0; i < cameraManager->GetCameraCount(); i++) {
-        Rasterizer::Rasterize(scene, cameraManager->GetCameras()[i]);
+    Rasterize(scene, cameraManager, nullptr);
+}
+
+void RenderingEngine::Rasterize(Scene* scene, CameraManager* cameraManager, ParticleSplatter* particles) {
+    rasterStats = Rasterizer::Stats();
+    if (!cameraManager) return;
+
+    CameraBase** cameras = cameraManager->GetCameras();
+    const uint8_t count = cameraManager->GetCameraCount();
+    if (cameraScratch.size() < count) cameraScratch.resize(count);
+
+    for (uint8_t i = 0; i < count; ++i) {
+        CameraScratch& scratch = cameraScratch[i];
+        IPixelGroup* pixelGroup = cameras[i] ? cameras[i]->GetPixelGroup() : nullptr;
+        scratch.depth.resize(particles && pixelGroup ? pixelGroup->GetPixelCount() : 0);
+        float* depth = scratch.depth.empty() ? nullptr : scratch.depth.data();
+
+        Rasterizer::PrepareCamera(cameras[i]);
+        Rasterizer::Rasterize(scene, cameras[i], depth, &scratch.raster);
+        AddStats(scratch.raster.stats);
+
+        if (particles) particles->Splat(cameras[i], depth);
     }
 }
 
+void RenderingEngine::RasterizeParallel(Scene* scene, CameraManager* cameraManager, ParticleSplatter* particles,
+                                        ptx::ThreadPool* pool) {
+    rasterStats = Rasterizer::Stats();
+    if (!cameraManager) return;
+
+    ptx::ThreadPool& workers = pool ? *pool : ptx::ThreadPool::Shared();
+    CameraBase** cameras = cameraManager->GetCameras();
+    const uint8_t count = cameraManager->GetCameraCount();
+
+    // Shared pixel groups would make the result depend on which camera finishes last.
+    if (count < 2 || workers.GetWorkerCount() == 0 || SharesPixelGroup(cameras, count)) {
+        Rasterize(scene, cameraManager, particles);
+        return;
+    }
+
+    // Serial phase: everything that writes camera state or resizes scratch.
+    if (cameraScratch.size() < count) cameraScratch.resize(count);
+    for (uint8_t i = 0; i < count; ++i) {
+        Rasterizer::PrepareCamera(cameras[i]);
+
+        IPixelGroup* pixelGroup = cameras[i] ? cameras[i]->GetPixelGroup() : nullptr;
+        cameraScratch[i].depth.resize(particles && pixelGroup ? pixelGroup->GetPixelCount() : 0);
+    }
+
+    // Parallel phase: scene and cameras are read-only, each camera writes its own pixels.
+    workers.ParallelFor(count, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            CameraScratch& scratch = cameraScratch[i];
+            Rasterizer::Rasterize(scene, cameras[i], scratch.depth.empty() ? nullptr : scratch.depth.data(), &scratch.raster);
+        }
+    });
+
+    for (uint8_t i = 0; i < count; ++i) AddStats(cameraScratch[i].raster.stats);
+
+    if (!particles) return;
+
+    for (uint8_t i = 0; i < count; ++i) {
+        particles->Splat(cameras[i], cameraScratch[i].depth.empty() ? nullptr : cameraScratch[i].depth.data());
+    }
+}
+
+Rasterizer::Stats RenderingEngine::GetRasterStats() {
+    return rasterStats;
+}
+
 void RenderingEngine::RayTrace(Scene* scene, CameraManager* cameraManager) {
+    if (!cameraManager) return;
+
     for (int i = 0; i < cameraManager->GetCameraCount(); i++) {
         RayTracer::RayTrace(scene, cameraManager->GetCameras()[i]);
     }
@@ -59,6 +59,34 @@ RasterTriangle2D::RasterTriangle2D(const Transform& camTransform, const Quaterni
     CalculateBoundsAndDenominator();
 }
 
+/**
+ * @brief Build a raster triangle from vertices already projected into camera space.
+ * @param sourceTriangle Source 3D triangle (positions/UVs).
+ * @param sourceNormal   Normal storage that outlives the triangle (non-owning).
+ * @param projectedP1    Camera-space first vertex; Z is the depth.
+ * @param projectedP2    Camera-space second vertex.
+ * @param projectedP3    Camera-space third vertex.
+ * @param mat            Material pointer associated with the triangle (non-owning).
+ */
+RasterTriangle2D::RasterTriangle2D(const RasterTriangle3D& sourceTriangle, const Vector3D* sourceNormal,
+                                   const Vector3D& projectedP1, const Vector3D& projectedP2,
+                                   const Vector3D& projectedP3, IMaterial* mat)
+    : Triangle2D(Vector2D(projectedP1.X, projectedP1.Y), Vector2D(projectedP2.X, projectedP2.Y),
+                 Vector2D(projectedP3.X, projectedP3.Y)),
+      t3p1(sourceTriangle.p1), t3p2(sourceTriangle.p2), t3p3(sourceTriangle.p3), normal(sourceNormal),
+      material(mat), p1UV(nullptr), p2UV(nullptr), p3UV(nullptr), hasUV(sourceTriangle.hasUV),
+      averageDepth((projectedP1.Z + projectedP2.Z + projectedP3.Z) / 3.0f), denominator(0.0f),
+      bounds(Rectangle2D(Vector2D(0.0f, 0.0f), Vector2D(1.0f, 1.0f)))
+{
+    if (hasUV) {
+        p1UV = sourceTriangle.uv1;
+        p2UV = sourceTriangle.uv2;
+        p3UV = sourceTriangle.uv3;
+    }
+
+    CalculateBoundsAndDenominator();
+}
+
 /**
  * @brief Precompute AABB and cached values for barycentric tests.
  *
@@ -85,7 +113,7 @@ void RasterTriangle2D::CalculateBoundsAndDenominator() {
     float minY = Mathematics::Min(p1.Y, p2.Y, p3.Y);
     float maxX = Mathematics::Max(p1.X, p2.X, p3.X);
     float maxY = Mathematics::Max(p1.Y, p2.Y, p3.Y);
-    this->bounds = Rectangle2D(Vector2D(minX, minY), Vector2D(maxX, maxY));
+    this->bounds = Rectangle2D(Shape::Bounds{Vector2D(minX, minY), Vector2D(maxX, maxY)});
 }
 
 /**
@@ -98,8 +126,9 @@ void RasterTriangle2D::CalculateBoundsAndDenominator() {
  * @return true if the point lies inside the triangle (including edges).
  */
 bool RasterTriangle2D::GetBarycentricCoords(float x, float y, float& u, float& v, float& w) const {
-    // If triangle is degenerate, no point is inside.
-    if (Mathematics::FAbs(denominator) < Mathematics::EPSILON) return false;
+    // If triangle is degenerate, no point is inside. The stored value is 1/det, which is
+    // small for large triangles, so test the degenerate marker rather than a tolerance.
+    if (denominator == 0.0f) return false;
 
     // Vector from the point to the triangle's first vertex
     Vector2D v2 = Vector2D(x, y) - p1;
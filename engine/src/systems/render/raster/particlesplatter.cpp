@@ -0,0 +1,269 @@
+#include <ptx/systems/render/raster/particlesplatter.hpp>
+#include <ptx/core/platform/threadpool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+constexpr float kPixelsPerTile = 64.0f;   // Target pixels per tile
+constexpr int kMaxTilesPerAxis = 64;
+
+uint8_t ToChannel(float value) {
+    return static_cast<uint8_t>(std::min(255.0f, std::max(0.0f, value + 0.5f)));
+}
+
+}  // namespace
+
+ParticleSplatter::ParticleSplatter(ptx::ParticleSystem* particleSystem, ParticleBlendMode blendMode)
+    : particleSystem(particleSystem), blendMode(blendMode), minimumRadius(0.5f), intensity(1.0f),
+      tiledCamera(nullptr), tiledPixelCount(0), tilesX(0), tilesY(0),
+      tileOrigin(0.0f, 0.0f), inverseTileSize(1.0f, 1.0f), visibleCount(0) {
+}
+
+void ParticleSplatter::Render(Scene* scene, CameraBase* camera) {
+    if (!camera || !camera->GetPixelGroup()) return;
+
+    depthScratch.resize(camera->GetPixelGroup()->GetPixelCount());
+    Rasterizer::Rasterize(scene, camera, depthScratch.data());
+    Splat(camera, depthScratch.data());
+}
+
+void ParticleSplatter::Splat(CameraBase* camera, const float* depthBuffer) {
+    visibleCount = 0;
+    if (!particleSystem || !camera || camera->Is2D()) return;
+
+    IPixelGroup* pixelGroup = camera->GetPixelGroup();
+    if (!pixelGroup || pixelGroup->GetPixelCount() == 0) return;
+
+    if (camera != tiledCamera || pixelGroup->GetPixelCount() != tiledPixelCount) {
+        BuildPixelTiles(camera);
+    }
+
+    const size_t count = ProjectParticles(camera);
+    if (count == 0) return;
+
+    BinParticles(count);
+
+    // Tiles own disjoint pixels, so they shade independently.
+    const size_t tileCount = GetTileCount();
+    ptx::ThreadPool::Shared().ParallelFor(tileCount, 1, [&](size_t begin, size_t end) {
+        for (size_t tile = begin; tile < end; ++tile) {
+            ShadeTile(tile, pixelGroup, depthBuffer);
+        }
+    });
+}
+
+// === Tiles ===
+
+void ParticleSplatter::BuildPixelTiles(CameraBase* camera) {
+    IPixelGroup* pixelGroup = camera->GetPixelGroup();
+    const uint16_t pixelCount = pixelGroup->GetPixelCount();
+
+    const Vector2D minimum = camera->GetCameraMinCoordinate();
+    const Vector2D maximum = camera->GetCameraMaxCoordinate();
+    const float width = std::max(maximum.X - minimum.X, 1e-6f);
+    const float height = std::max(maximum.Y - minimum.Y, 1e-6f);
+
+    // Roughly square tiles holding kPixelsPerTile pixels each.
+    const float targetTiles = std::max(1.0f, pixelCount / kPixelsPerTile);
+    const float columns = std::sqrt(targetTiles * width / height);
+    tilesX = static_cast<uint16_t>(std::min(kMaxTilesPerAxis, std::max(1, static_cast<int>(std::lround(columns)))));
+    tilesY = static_cast<uint16_t>(std::min(kMaxTilesPerAxis, std::max(1, static_cast<int>(std::lround(targetTiles / tilesX)))));
+
+    tileOrigin = minimum;
+    inverseTileSize = Vector2D(tilesX / width, tilesY / height);
+
+    const size_t tileCount = GetTileCount();
+    pixelX.resize(pixelCount);
+    pixelY.resize(pixelCount);
+    std::vector<uint32_t> pixelTiles(pixelCount);
+    tilePixelStarts.assign(tileCount + 1, 0);
+
+    for (uint16_t i = 0; i < pixelCount; ++i) {
+        const Vector2D coordinate = pixelGroup->GetCoordinate(i);
+        pixelX[i] = coordinate.X;
+        pixelY[i] = coordinate.Y;
+
+        const int x = std::min(tilesX - 1, std::max(0, static_cast<int>((coordinate.X - tileOrigin.X) * inverseTileSize.X)));
+        const int y = std::min(tilesY - 1, std::max(0, static_cast<int>((coordinate.Y - tileOrigin.Y) * inverseTileSize.Y)));
+        pixelTiles[i] = static_cast<uint32_t>(y * tilesX + x);
+        ++tilePixelStarts[pixelTiles[i] + 1];
+    }
+
+    for (size_t t = 0; t < tileCount; ++t) {
+        tilePixelStarts[t + 1] += tilePixelStarts[t];
+    }
+
+    std::vector<uint32_t> cursors(tilePixelStarts.begin(), tilePixelStarts.end() - 1);
+    tilePixels.resize(pixelCount);
+    for (uint16_t i = 0; i < pixelCount; ++i) {
+        tilePixels[cursors[pixelTiles[i]]++] = i;
+    }
+
+    tiledCamera = camera;
+    tiledPixelCount = pixelCount;
+}
+
+bool ParticleSplatter::TileRange(float x, float y, float r, int& x0, int& y0, int& x1, int& y1) const {
+    const float left = (x - r - tileOrigin.X) * inverseTileSize.X;
+    const float right = (x + r - tileOrigin.X) * inverseTileSize.X;
+    const float bottom = (y - r - tileOrigin.Y) * inverseTileSize.Y;
+    const float top = (y + r - tileOrigin.Y) * inverseTileSize.Y;
+
+    // Edge pixels were clamped into the border tiles, so border tiles extend to the camera edge.
+    if (right < 0.0f || top < 0.0f || left >= tilesX || bottom >= tilesY) return false;
+
+    x0 = std::max(0, static_cast<int>(std::floor(left)));
+    y0 = std::max(0, static_cast<int>(std::floor(bottom)));
+    x1 = std::min(tilesX - 1, static_cast<int>(std::floor(right)));
+    y1 = std::min(tilesY - 1, static_cast<int>(std::floor(top)));
+    return true;
+}
+
+// === Particles ===
+
+size_t ParticleSplatter::ProjectParticles(CameraBase* camera) {
+    // Same camera-space projection as RasterTriangle2D so particles line up with meshes.
+    Transform* transform = camera->GetTransform();
+    transform->SetBaseRotation(camera->GetCameraLayout()->GetRotation());
+    const Quaternion lookDirection = transform->GetRotation().Multiply(camera->GetLookOffset());
+    const Quaternion inverseRotation = transform->GetRotation().Multiply(lookDirection).Conjugate();
+    const Vector3D cameraPosition = transform->GetPosition();
+    const Vector3D scale = transform->GetScale();
+    const float radiusScale = 0.5f / std::max((std::fabs(scale.X) + std::fabs(scale.Y)) * 0.5f, 1e-6f);
+
+    size_t total = 0;
+    for (const auto& emitter : particleSystem->GetEmitters()) {
+        if (emitter) total += emitter->GetPool().GetAliveCount();
+    }
+
+    screenX.resize(total);
+    screenY.resize(total);
+    depth.resize(total);
+    radius.resize(total);
+    colorR.resize(total);
+    colorG.resize(total);
+    colorB.resize(total);
+    alpha.resize(total);
+
+    size_t count = 0;
+    for (const auto& emitter : particleSystem->GetEmitters()) {
+        if (!emitter) continue;
+
+        const ptx::ParticleSpan span = emitter->GetPool().GetSpan();
+        for (size_t i = 0; i < span.count; ++i) {
+            const float weight = span.alpha[i] * intensity;
+            if (weight <= 0.0f) continue;
+
+            const Vector3D world(span.positionX[i], span.positionY[i], span.positionZ[i]);
+            const Vector3D local = inverseRotation.RotateVector(world - cameraPosition) / scale;
+
+            screenX[count] = local.X;
+            screenY[count] = local.Y;
+            depth[count] = local.Z;
+            radius[count] = std::max(minimumRadius, span.size[i] * radiusScale);
+            colorR[count] = span.colorR[i] * 255.0f;
+            colorG[count] = span.colorG[i] * 255.0f;
+            colorB[count] = span.colorB[i] * 255.0f;
+            alpha[count] = weight;
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+void ParticleSplatter::BinParticles(size_t count) {
+    const size_t tileCount = GetTileCount();
+    tileParticleStarts.assign(tileCount + 1, 0);
+
+    // Counting sort: particles are listed per tile in projection order, which keeps output deterministic.
+    for (size_t i = 0; i < count; ++i) {
+        int x0, y0, x1, y1;
+        if (radius[i] <= 0.0f || !TileRange(screenX[i], screenY[i], radius[i], x0, y0, x1, y1)) continue;
+
+        ++visibleCount;
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                ++tileParticleStarts[y * tilesX + x + 1];
+            }
+        }
+    }
+
+    for (size_t t = 0; t < tileCount; ++t) {
+        tileParticleStarts[t + 1] += tileParticleStarts[t];
+    }
+
+    tileParticleCursors.assign(tileParticleStarts.begin(), tileParticleStarts.end() - 1);
+    tileParticles.resize(tileParticleStarts[tileCount]);
+
+    for (size_t i = 0; i < count; ++i) {
+        int x0, y0, x1, y1;
+        if (radius[i] <= 0.0f || !TileRange(screenX[i], screenY[i], radius[i], x0, y0, x1, y1)) continue;
+
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                tileParticles[tileParticleCursors[y * tilesX + x]++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
+
+void ParticleSplatter::ShadeTile(size_t tile, IPixelGroup* pixelGroup, const float* depthBuffer) {
+    uint32_t* particles = tileParticles.data() + tileParticleStarts[tile];
+    const uint32_t particleCount = tileParticleStarts[tile + 1] - tileParticleStarts[tile];
+    if (particleCount == 0) return;
+
+    if (blendMode == ParticleBlendMode::Alpha) {
+        // Back to front (larger Z is farther); ties keep projection order.
+        std::sort(particles, particles + particleCount, [this](uint32_t a, uint32_t b) {
+            return depth[a] > depth[b] || (depth[a] == depth[b] && a < b);
+        });
+    }
+
+    RGBColor* colors = pixelGroup->GetColors();
+
+    for (uint32_t p = tilePixelStarts[tile]; p < tilePixelStarts[tile + 1]; ++p) {
+        const uint16_t pixel = tilePixels[p];
+        const float x = pixelX[pixel];
+        const float y = pixelY[pixel];
+        const float surfaceDepth = depthBuffer ? depthBuffer[pixel] : std::numeric_limits<float>::max();
+
+        float r = colors[pixel].R;
+        float g = colors[pixel].G;
+        float b = colors[pixel].B;
+        bool touched = false;
+
+        for (uint32_t k = 0; k < particleCount; ++k) {
+            const uint32_t i = particles[k];
+            if (depth[i] >= surfaceDepth) continue;
+
+            const float dx = x - screenX[i];
+            const float dy = y - screenY[i];
+            const float distanceSquared = dx * dx + dy * dy;
+            const float radiusSquared = radius[i] * radius[i];
+            if (distanceSquared >= radiusSquared) continue;
+
+            // Soft disc: full weight at the center, zero at the rim.
+            const float weight = alpha[i] * (1.0f - distanceSquared / radiusSquared);
+            touched = true;
+
+            if (blendMode == ParticleBlendMode::Additive) {
+                r += colorR[i] * weight;
+                g += colorG[i] * weight;
+                b += colorB[i] * weight;
+            } else {
+                const float coverage = std::min(weight, 1.0f);
+                r += (colorR[i] - r) * coverage;
+                g += (colorG[i] - g) * coverage;
+                b += (colorB[i] - b) * coverage;
+            }
+        }
+
+        if (touched) {
+            colors[pixel] = RGBColor(ToChannel(r), ToChannel(g), ToChannel(b));
+        }
+    }
+}
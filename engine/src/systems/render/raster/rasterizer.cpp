@@ -1,5 +1,6 @@
 #include <ptx/systems/render/raster/rasterizer.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -10,11 +11,43 @@ bool RasterTriangleOverlaps(const void* item, const Rectangle2D& bounds) {
     return triangle != nullptr && triangle->Overlaps(bounds);
 }
 
+Vector3D ProjectVertex(const Quaternion& inverseRotation, const Vector3D& position, const Vector3D& scale,
+                       const Vector3D& vertex) {
+    return inverseRotation.RotateVector(vertex - position) / scale;
+}
+
+// Projects the eight corners of the mesh bounds and tests the resulting rectangle against
+// the camera extent. Meshes without known bounds are always kept.
+bool MeshInView(Mesh* mesh, const Quaternion& inverseRotation, const Vector3D& position, const Vector3D& scale,
+                const Vector2D& minCoord, const Vector2D& maxCoord) {
+    Vector3D minimum, maximum;
+    if (!mesh->GetWorldBounds(minimum, maximum)) return true;
+
+    Vector2D screenMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Vector2D screenMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+    for (uint8_t corner = 0; corner < 8; ++corner) {
+        const Vector3D point((corner & 1) ? maximum.X : minimum.X,
+                             (corner & 2) ? maximum.Y : minimum.Y,
+                             (corner & 4) ? maximum.Z : minimum.Z);
+        const Vector3D projected = ProjectVertex(inverseRotation, position, scale, point);
+
+        screenMin.X = std::min(screenMin.X, projected.X);
+        screenMin.Y = std::min(screenMin.Y, projected.Y);
+        screenMax.X = std::max(screenMax.X, projected.X);
+        screenMax.Y = std::max(screenMax.Y, projected.Y);
+    }
+
+    // Strict comparisons: a mesh touching the edge can still cover an edge pixel.
+    return !(screenMax.X < minCoord.X || screenMin.X > maxCoord.X ||
+             screenMax.Y < minCoord.Y || screenMin.Y > maxCoord.Y);
+}
+
 }  // namespace
 
 RGBColor Rasterizer::RasterizePixel(RasterTriangle2D** candidate_triangles,
                                     unsigned short count,
-                                    const Vector2D& pixel_coord) {
+                                    const Vector2D& pixel_coord,
+                                    float& depth) {
     float closest_z = std::numeric_limits<float>::max();
     const RasterTriangle2D* hit_triangle = nullptr;
     float hit_u = 0.0f, hit_v = 0.0f, hit_w = 0.0f;
@@ -32,6 +65,7 @@ RGBColor Rasterizer::RasterizePixel(RasterTriangle2D** candidate_triangles,
         }
     }
 
+    depth = closest_z;
     if (!hit_triangle) {
         return RGBColor(0, 0, 0);
     }
@@ -59,49 +93,164 @@ RGBColor Rasterizer::RasterizePixel(RasterTriangle2D** candidate_triangles,
     return mat.GetShader()->Shade(surf, mat);
 }
 
+void Rasterizer::PrepareCamera(CameraBase* camera) {
+    if (!camera || camera->Is2D()) return;
+
+    if (camera->GetTransform() && camera->GetCameraLayout()) {
+        camera->GetTransform()->SetBaseRotation(camera->GetCameraLayout()->GetRotation());
+    }
+
+    // Fill the lazily cached bounds here so concurrent renders only read them.
+    camera->GetCameraMinCoordinate();
+    camera->GetCameraMaxCoordinate();
+}
+
 void Rasterizer::Rasterize(Scene* scene, CameraBase* camera) {
-    if (!scene || !camera || camera->Is2D()) return;
+    Rasterize(scene, camera, nullptr);
+}
+
+void Rasterizer::Rasterize(Scene* scene, CameraBase* camera, float* depthBuffer) {
+    PrepareCamera(camera);
+
+    Scratch scratch;
+    Rasterize(scene, camera, depthBuffer, &scratch);
+}
+
+void Rasterizer::Rasterize(Scene* scene, CameraBase* camera, float* depthBuffer, Scratch* scratch) {
+    if (depthBuffer && camera && camera->GetPixelGroup()) {
+        std::fill_n(depthBuffer, camera->GetPixelGroup()->GetPixelCount(), std::numeric_limits<float>::max());
+    }
+
+    Scratch temporary;
+    if (!scratch) scratch = &temporary;
+    scratch->stats = Stats();
+
+    if (!scene || !camera || camera->Is2D() || !camera->GetTransform() || !camera->GetPixelGroup()) return;
 
     // --- Setup ---
-    camera->GetTransform()->SetBaseRotation(camera->GetCameraLayout()->GetRotation());
-    Quaternion lookDirection = camera->GetTransform()->GetRotation().Multiply(camera->GetLookOffset());
+    // Project through a copy so the shared camera transform is never written here.
+    Transform view = *camera->GetTransform();
+    if (camera->GetCameraLayout()) view.SetBaseRotation(camera->GetCameraLayout()->GetRotation());
+    Quaternion lookDirection = view.GetRotation().Multiply(camera->GetLookOffset());
 
     Vector2D minCoord = camera->GetCameraMinCoordinate();
     Vector2D maxCoord = camera->GetCameraMaxCoordinate();
-    QuadTree tree(Rectangle2D(minCoord, maxCoord), &RasterTriangleOverlaps);
+    QuadTree tree(Rectangle2D(Shape::Bounds{minCoord, maxCoord}), &RasterTriangleOverlaps);
+
+    const Quaternion inverseRotation = view.GetRotation().Multiply(lookDirection).Conjugate();
+    const Vector3D position = view.GetPosition();
+    const Vector3D scale = view.GetScale();
+
+    // 1) Cull whole meshes, then count triangles and cacheable vertices of the survivors
+    const uint8_t meshCount = scene->GetMeshCount();
+    scratch->meshVisible.assign(meshCount, 0);
 
-    // 1) Count triangles
     uint32_t totalTriangles = 0;
-    for (uint8_t i = 0; i < scene->GetMeshCount(); ++i) {
+    uint32_t totalVertices = 0;
+    for (uint8_t i = 0; i < meshCount; ++i) {
         Mesh* mesh = scene->GetMeshes()[i];
-        if (mesh && mesh->IsEnabled() && mesh->GetTriangleGroup()) {
-            totalTriangles += mesh->GetTriangleGroup()->GetTriangleCount();
+        ITriangleGroup* triangleGroup = mesh && mesh->IsEnabled() ? mesh->GetTriangleGroup() : nullptr;
+        if (!triangleGroup || triangleGroup->GetTriangleCount() <= 0) continue;
+
+        if (!MeshInView(mesh, inverseRotation, position, scale, minCoord, maxCoord)) {
+            ++scratch->stats.meshesCulled;
+            continue;
+        }
+
+        scratch->meshVisible[i] = 1;
+        ++scratch->stats.meshesDrawn;
+
+        totalTriangles += triangleGroup->GetTriangleCount();
+        if (triangleGroup->GetIndexGroup() && triangleGroup->GetVertices()) {
+            totalVertices += triangleGroup->GetVertexCount();
         }
     }
-    if (totalTriangles == 0) return;
 
-    // 2) Project all to 2D
-    std::vector<RasterTriangle2D> projectedTriangles;
+    // 2) Project each unique vertex once, then set up triangles from the cache
+    std::vector<RasterTriangle2D>& projectedTriangles = scratch->triangles;
+    projectedTriangles.clear();
+    if (totalTriangles == 0) {
+        // Everything was culled: write the black frame drawing would have produced, minus the work.
+        if (scratch->stats.meshesCulled > 0) {
+            IPixelGroup* pixelGroup = camera->GetPixelGroup();
+            for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); ++i) *pixelGroup->GetColor(i) = RGBColor(0, 0, 0);
+        }
+        return;
+    }
+
+    scratch->screenX.resize(totalVertices);
+    scratch->screenY.resize(totalVertices);
+    scratch->screenDepth.resize(totalVertices);
+    float* screenX = scratch->screenX.data();
+    float* screenY = scratch->screenY.data();
+    float* screenDepth = scratch->screenDepth.data();
+
+    // Triangles keep pointers into `normals`, so it must not reallocate while filling.
+    std::vector<Vector3D>& normals = scratch->normals;
+    normals.clear();
+    normals.reserve(totalTriangles);
+
     projectedTriangles.reserve(totalTriangles);
-    for (uint8_t i = 0; i < scene->GetMeshCount(); ++i) {
-        Mesh* mesh = scene->GetMeshes()[i];
-        if (!mesh || !mesh->IsEnabled()) continue;
 
+    uint32_t vertexBase = 0;
+    for (uint8_t i = 0; i < meshCount; ++i) {
+        if (!scratch->meshVisible[i]) continue;
+
+        Mesh* mesh = scene->GetMeshes()[i];
         ITriangleGroup* triangleGroup = mesh->GetTriangleGroup();
-        if (!triangleGroup) continue;
+        const IndexGroup* indices = triangleGroup->GetIndexGroup();
+        const Vector3D* vertices = triangleGroup->GetVertices();
+        const bool cached = indices && vertices;
+
+        if (cached) {
+            for (int k = 0; k < triangleGroup->GetVertexCount(); ++k) {
+                const Vector3D projected = ProjectVertex(inverseRotation, position, scale, vertices[k]);
+                screenX[vertexBase + k] = projected.X;
+                screenY[vertexBase + k] = projected.Y;
+                screenDepth[vertexBase + k] = projected.Z;
+            }
+        }
 
         for (uint16_t j = 0; j < triangleGroup->GetTriangleCount(); ++j) {
-            const Triangle3D& src = triangleGroup->GetTriangles()[j];
+            const Vector3D* a;
+            const Vector3D* b;
+            const Vector3D* c;
+            Vector3D projectedA, projectedB, projectedC;
+
+            if (cached) {
+                // Vertices carry the current mesh transform; Triangle3D holds construction-time copies.
+                const uint32_t ia = vertexBase + indices[j].A;
+                const uint32_t ib = vertexBase + indices[j].B;
+                const uint32_t ic = vertexBase + indices[j].C;
+                a = &vertices[indices[j].A];
+                b = &vertices[indices[j].B];
+                c = &vertices[indices[j].C];
+                projectedA = Vector3D(screenX[ia], screenY[ia], screenDepth[ia]);
+                projectedB = Vector3D(screenX[ib], screenY[ib], screenDepth[ib]);
+                projectedC = Vector3D(screenX[ic], screenY[ic], screenDepth[ic]);
+            } else {
+                const Triangle3D& src = triangleGroup->GetTriangles()[j];
+                a = &src.p1;
+                b = &src.p2;
+                c = &src.p3;
+                projectedA = ProjectVertex(inverseRotation, position, scale, *a);
+                projectedB = ProjectVertex(inverseRotation, position, scale, *b);
+                projectedC = ProjectVertex(inverseRotation, position, scale, *c);
+            }
 
             RasterTriangle3D rtri = mesh->HasUV()
-                ? RasterTriangle3D(&src.p1, &src.p2, &src.p3,
+                ? RasterTriangle3D(a, b, c,
                                    &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].A],
                                    &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].B],
                                    &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].C])
-                : RasterTriangle3D(&src.p1, &src.p2, &src.p3);
+                : RasterTriangle3D(a, b, c);
 
-            projectedTriangles.emplace_back(*camera->GetTransform(), lookDirection, rtri, mesh->GetMaterial());
+            normals.push_back(rtri.normal);
+            projectedTriangles.emplace_back(rtri, &normals.back(), projectedA, projectedB, projectedC,
+                                            mesh->GetMaterial());
         }
+
+        if (cached) vertexBase += triangleGroup->GetVertexCount();
     }
 
     // 3) Build acceleration
@@ -116,12 +265,14 @@ void Rasterizer::Rasterize(Scene* scene, CameraBase* camera) {
         auto* leaf = tree.GetRoot()->FindLeaf(p);
 
         RGBColor out(0,0,0);
+        float depth = std::numeric_limits<float>::max();
         if (leaf && leaf->GetItemCount() > 0) {
             RasterTriangle2D** items = leaf->GetItems<RasterTriangle2D>();
-            out = RasterizePixel(items, leaf->GetItemCount(), p);
+            out = RasterizePixel(items, leaf->GetItemCount(), p, depth);
         }
         *pixelGroup->GetColor(i) = out;
+        if (depthBuffer) depthBuffer[i] = depth;
     }
 
-    // 5) Cleanup handled automatically by std::vector storage
+    // 5) Triangle and vertex storage stays in the scratch for the next render
 }
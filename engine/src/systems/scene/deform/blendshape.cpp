@@ -16,4 +16,6 @@ void Blendshape::BlendObject3D(ITriangleGroup* obj) {
     for (int i = 0; i < count; i++) {
         obj->GetVertices()[indexes[i]] = obj->GetVertices()[indexes[i]] + vertices[i] * Weight; // Add value of morph vertex to original vertex
     }
+
+    obj->MarkVerticesChanged();
 }
@@ -75,6 +75,8 @@ void MeshAlign::NormalizeObjectPlane(Mesh** objs, uint8_t numObjects, Vector3D c
 
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -87,6 +89,8 @@ void MeshAlign::NormalizeObjectCenter(Mesh** objs, uint8_t numObjects, Vector3D
 
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -350,6 +354,8 @@ void MeshAlign::AlignObjectsNoScale(Mesh** objs, uint8_t numObjects) {
             modifiedVector = modifiedVector + cameraTarget;
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -442,5 +448,7 @@ void MeshAlign::AlignObjects(Mesh** objs, uint8_t numObjects) {
 
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
@@ -56,6 +56,8 @@ void MeshDeformer::PerspectiveDeform(float scaleRatio, Vector3D center, Axis axi
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -78,6 +80,8 @@ void MeshDeformer::SinusoidalDeform(float magnitude, float timeRatio, float peri
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -100,6 +104,8 @@ void MeshDeformer::DropwaveDeform(float magnitude, float timeRatio, float period
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -122,6 +128,8 @@ void MeshDeformer::SineWaveSurfaceDeform(Vector3D offset, float magnitude, float
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -182,6 +190,8 @@ void MeshDeformer::CosineInterpolationDeformer(float* pointMultiplier, int point
                 break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkVerticesChanged();
     }
 }
 
@@ -49,6 +49,8 @@ void TriangleGroupDeformer::SinusoidalDeform(float magnitude, float timeRatio, f
                     break;
             }
         }
+
+        objects[i]->MarkVerticesChanged();
     }
 }
 
@@ -71,6 +73,8 @@ void TriangleGroupDeformer::DropwaveDeform(float magnitude, float timeRatio, flo
                     break;
             }
         }
+
+        objects[i]->MarkVerticesChanged();
     }
 }
 
@@ -93,6 +97,8 @@ void TriangleGroupDeformer::SineWaveSurfaceDeform(Vector3D offset, float magnitu
                     break;
             }
         }
+
+        objects[i]->MarkVerticesChanged();
     }
 }
 
@@ -149,6 +155,8 @@ void TriangleGroupDeformer::CosineInterpolationDeformer(float* pointMultiplier,
                     break;
             }
         }
+
+        objects[i]->MarkVerticesChanged();
     }
 }
 
@@ -68,18 +68,54 @@ void Mesh::ResetVertices() {
     for (int i = 0; i < modifiedTriangles->GetVertexCount(); i++) {
         modifiedTriangles->GetVertices()[i] = originalTriangles->GetVertices()[i];
     }
+
+    modifiedTriangles->MarkVerticesChanged();
+    boundsValid = false;
 }
 
 void Mesh::UpdateTransform() {
-    for (int i = 0; i < modifiedTriangles->GetVertexCount(); i++) {
-        Vector3D modifiedVector = modifiedTriangles->GetVertices()[i];
+    const int vertexCount = modifiedTriangles->GetVertexCount();
+    Vector3D* vertices = modifiedTriangles->GetVertices();
+
+    for (int i = 0; i < vertexCount; i++) {
+        Vector3D modifiedVector = vertices[i];
 
         modifiedVector = (modifiedVector - transform.GetScaleOffset()) * transform.GetScale() + transform.GetScaleOffset();
         modifiedVector = transform.GetRotation().RotateVector(modifiedVector - transform.GetRotationOffset()) + transform.GetRotationOffset();
         modifiedVector = modifiedVector + transform.GetPosition();
 
-        modifiedTriangles->GetVertices()[i] = modifiedVector;
+        vertices[i] = modifiedVector;
+
+        // Grow the bounds while the vertex is in hand rather than walking the vertices again.
+        boundsMinimum = i == 0 ? modifiedVector : Vector3D::Min(boundsMinimum, modifiedVector);
+        boundsMaximum = i == 0 ? modifiedVector : Vector3D::Max(boundsMaximum, modifiedVector);
     }
+
+    modifiedTriangles->MarkVerticesChanged();
+    boundsVersion = modifiedTriangles->GetVertexVersion();
+    boundsValid = vertexCount > 0;
+}
+
+void Mesh::UpdateBounds() {
+    const int vertexCount = modifiedTriangles->GetVertexCount();
+    const Vector3D* vertices = modifiedTriangles->GetVertices();
+
+    for (int i = 0; i < vertexCount; i++) {
+        boundsMinimum = i == 0 ? vertices[i] : Vector3D::Min(boundsMinimum, vertices[i]);
+        boundsMaximum = i == 0 ? vertices[i] : Vector3D::Max(boundsMaximum, vertices[i]);
+    }
+
+    boundsVersion = modifiedTriangles->GetVertexVersion();
+    boundsValid = vertexCount > 0;
+}
+
+bool Mesh::GetWorldBounds(Vector3D& minimum, Vector3D& maximum) const {
+    // Any vertex write since the bounds were computed makes them unusable.
+    if (!boundsValid || boundsVersion != modifiedTriangles->GetVertexVersion()) return false;
+
+    minimum = boundsMinimum;
+    maximum = boundsMaximum;
+    return true;
 }
 
 ITriangleGroup* Mesh::GetTriangleGroup() {
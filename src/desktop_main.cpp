@@ -3,8 +3,9 @@
 #include <thread>
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
 
-#include "../lib/ptx/core/platform/time.hpp"
+#include "../lib/ptx/core/time/framepacer.hpp"
 #include "minimal_shm/minimalshmproject.hpp"
 
 static MinimalShmProject project;
@@ -18,33 +19,41 @@ int main(int argc, char** argv) {
 
     project.Initialize();
 
-    const double target_hz = 60.0;
-    const double target_dt_s = 1.0 / target_hz;
+    // Display frame N on the display thread while frame N+1 animates and renders.
+    project.SetPipelined(true);
+
+    // Render the cameras concurrently; the scene is only read while rendering.
+    project.SetParallelRender(true);
+
+    // Deadline-based pacing: coarse sleep, then spin onto the deadline.
+    FramePacer pacer(60.0f);
 
-    uint32_t t0_ms = ptx::Time::Millis();
     double time_accum = 0.0;
     const double ratio_period_s = 5.0;
 
     while (g_running.load(std::memory_order_relaxed)) {
-        uint32_t t1_ms = ptx::Time::Millis();
-        float dt_s = float(int32_t(t1_ms - t0_ms)) / 1000.0f;
-        t0_ms = t1_ms;
+        const float dt_s = pacer.WaitForNextFrame();
 
         time_accum += dt_s;
         double ratio = std::fmod(time_accum / ratio_period_s, 1.0);
 
-        project.Animate(static_cast<float>(ratio));
-        project.Render();
-        project.Display();
+        project.Frame(static_cast<float>(ratio));
+    }
 
-        uint32_t t2_ms = ptx::Time::Millis();
-        float frame_time_s = float(int32_t(t2_ms - t1_ms)) / 1000.0f;
+    // Finish the frame in flight before the controller goes away.
+    project.SetPipelined(false);
 
-        if (frame_time_s < target_dt_s) {
-            const double sleep_s = target_dt_s - frame_time_s;
-            using namespace std::chrono;
-            std::this_thread::sleep_for(duration<double>(sleep_s));
+    // PTX_FRAME_STATS=<path> dumps the pacing histograms for offline inspection.
+    if (const char* stats_path = std::getenv("PTX_FRAME_STATS")) {
+        if (FILE* f = std::fopen(stats_path, "w")) {
+            std::fputs(pacer.ExportJson().c_str(), f);
+            std::fclose(f);
         }
     }
+
+    std::fprintf(stderr, "frames: %u, missed: %u, frame p99: %u us, lateness p99: %u us\n",
+                 pacer.GetFrameCount(), pacer.GetMissedFrames(),
+                 pacer.GetFrameTimeHistogram().GetPercentile(0.99f),
+                 pacer.GetLatenessHistogram().GetPercentile(0.99f));
     return 0;
 }
@@ -0,0 +1,123 @@
+/**
+ * @file testrandomstream.cpp
+ * @brief Implementation of RandomStream unit tests.
+ */
+
+#include "testrandomstream.hpp"
+
+using namespace ptx;
+
+// ========== Constructor Tests ==========
+
+void TestRandomStream::TestDefaultConstructor() {
+    RandomStream a;
+    RandomStream b;
+
+    for (int i = 0; i < 16; ++i) {
+        TEST_ASSERT_EQUAL_UINT32(a.Next(), b.Next());
+    }
+}
+
+void TestRandomStream::TestParameterizedConstructor() {
+    RandomStream a(42, 7);
+    RandomStream b(42, 7);
+    RandomStream c(43, 7);
+
+    bool differs = false;
+    for (int i = 0; i < 16; ++i) {
+        const uint32_t value = a.Next();
+        TEST_ASSERT_EQUAL_UINT32(value, b.Next());
+        differs |= value != c.Next();
+    }
+    TEST_ASSERT_TRUE(differs);
+}
+
+// ========== Method Tests ==========
+
+void TestRandomStream::TestSeedRestarts() {
+    RandomStream random(5, 3);
+    const uint32_t first = random.Next();
+    random.Next();
+
+    random.Seed(5, 3);
+    TEST_ASSERT_EQUAL_UINT32(first, random.Next());
+}
+
+void TestRandomStream::TestNextFloatRange() {
+    RandomStream random(1, 0);
+    float sum = 0.0f;
+
+    for (int i = 0; i < 4096; ++i) {
+        const float value = random.NextFloat();
+        TEST_ASSERT_TRUE(value >= 0.0f && value < 1.0f);
+        sum += value;
+    }
+
+    // Roughly uniform: the mean stays near one half.
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 0.5f, sum / 4096.0f);
+}
+
+void TestRandomStream::TestFloatRange() {
+    RandomStream random(2, 0);
+
+    for (int i = 0; i < 1024; ++i) {
+        const float value = random.Float(-3.0f, 5.0f);
+        TEST_ASSERT_TRUE(value >= -3.0f && value < 5.0f);
+    }
+}
+
+void TestRandomStream::TestIntRange() {
+    RandomStream random(3, 0);
+    bool seen[5] = { false, false, false, false, false };
+
+    for (int i = 0; i < 1024; ++i) {
+        const int value = random.Int(-2, 2);
+        TEST_ASSERT_TRUE(value >= -2 && value <= 2);
+        seen[value + 2] = true;
+    }
+
+    for (bool hit : seen) TEST_ASSERT_TRUE(hit);
+}
+
+void TestRandomStream::TestMix() {
+    TEST_ASSERT_TRUE(RandomStream::Mix(1, 2) == RandomStream::Mix(1, 2));
+    TEST_ASSERT_TRUE(RandomStream::Mix(1, 2) != RandomStream::Mix(1, 3));
+    TEST_ASSERT_TRUE(RandomStream::Mix(1, 2) != RandomStream::Mix(2, 2));
+}
+
+// ========== Functionality Tests ==========
+
+void TestRandomStream::TestStreamsDiffer() {
+    RandomStream a(99, 0);
+    RandomStream b(99, 1);
+
+    int matches = 0;
+    for (int i = 0; i < 64; ++i) {
+        if (a.Next() == b.Next()) ++matches;
+    }
+    TEST_ASSERT_LESS_THAN(2, matches);
+}
+
+// ========== Edge Cases ==========
+
+void TestRandomStream::TestEdgeCases() {
+    RandomStream random(0, 0);
+
+    TEST_ASSERT_EQUAL(4, random.Int(4, 4));
+    TEST_ASSERT_EQUAL(4, random.Int(4, 1));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, random.Float(2.0f, 2.0f));
+}
+
+// ========== Test Runner ==========
+
+void TestRandomStream::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestParameterizedConstructor);
+    RUN_TEST(TestSeedRestarts);
+    RUN_TEST(TestNextFloatRange);
+    RUN_TEST(TestFloatRange);
+    RUN_TEST(TestIntRange);
+    RUN_TEST(TestMix);
+    RUN_TEST(TestStreamsDiffer);
+    RUN_TEST(TestEdgeCases);
+}
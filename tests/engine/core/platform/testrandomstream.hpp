@@ -0,0 +1,45 @@
+/**
+ * @file testrandomstream.hpp
+ * @brief Unit tests for the RandomStream class.
+ *
+ * Covers determinism, stream independence and output ranges.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/core/platform/randomstream.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestRandomStream
+ * @brief Contains static test methods for the RandomStream class.
+ */
+class TestRandomStream {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+    static void TestParameterizedConstructor();
+
+    // Method tests
+    static void TestSeedRestarts();
+    static void TestNextFloatRange();
+    static void TestFloatRange();
+    static void TestIntRange();
+    static void TestMix();
+
+    // Functionality tests
+    static void TestStreamsDiffer();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,147 @@
+/**
+ * @file testspscring.cpp
+ * @brief Implementation of SPSCRing unit tests.
+ */
+
+#include "testspscring.hpp"
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using ptx::SPSCRing;
+
+// ========== Constructor Tests ==========
+
+void TestSPSCRing::TestConstructor() {
+    SPSCRing<float> ring(100);
+    TEST_ASSERT_EQUAL(128, ring.GetCapacity());
+    TEST_ASSERT_EQUAL(0, ring.Size());
+    TEST_ASSERT_EQUAL(128, ring.FreeSpace());
+
+    SPSCRing<float> exact(64);
+    TEST_ASSERT_EQUAL(64, exact.GetCapacity());
+}
+
+// ========== Method Tests ==========
+
+void TestSPSCRing::TestWriteRead() {
+    SPSCRing<int> ring(8);
+    const int input[5] = {1, 2, 3, 4, 5};
+    TEST_ASSERT_EQUAL(5, ring.Write(input, 5));
+    TEST_ASSERT_EQUAL(5, ring.Size());
+
+    int output[8] = {};
+    TEST_ASSERT_EQUAL(3, ring.Read(output, 3));
+    TEST_ASSERT_EQUAL(1, output[0]);
+    TEST_ASSERT_EQUAL(3, output[2]);
+
+    // A full ring accepts only what fits.
+    const int more[8] = {6, 7, 8, 9, 10, 11, 12, 13};
+    TEST_ASSERT_EQUAL(6, ring.Write(more, 8));
+    TEST_ASSERT_EQUAL(8, ring.Size());
+    TEST_ASSERT_EQUAL(0, ring.FreeSpace());
+
+    TEST_ASSERT_EQUAL(8, ring.Read(output, 8));
+    TEST_ASSERT_EQUAL(4, output[0]);
+    TEST_ASSERT_EQUAL(11, output[7]);
+}
+
+void TestSPSCRing::TestDiscard() {
+    SPSCRing<int> ring(4);
+    const int input[3] = {1, 2, 3};
+    ring.Write(input, 3);
+    ring.Discard();
+    TEST_ASSERT_EQUAL(0, ring.Size());
+
+    int output[4] = {};
+    TEST_ASSERT_EQUAL(0, ring.Read(output, 4));
+}
+
+// ========== Functionality Tests ==========
+
+void TestSPSCRing::TestWrapAround() {
+    SPSCRing<int> ring(8);
+    int next = 0;
+    int expected = 0;
+    bool ordered = true;
+
+    // Odd block sizes walk the positions across the end of the storage many times.
+    for (int round = 0; round < 100; ++round) {
+        int input[5];
+        for (int& value : input) value = next++;
+        const size_t written = ring.Write(input, 5);
+        next -= static_cast<int>(5 - written);
+
+        int output[3];
+        const size_t read = ring.Read(output, 3);
+        for (size_t i = 0; i < read; ++i) {
+            ordered = ordered && output[i] == expected++;
+        }
+    }
+
+    TEST_ASSERT_TRUE(ordered);
+}
+
+void TestSPSCRing::TestConcurrentTransfer() {
+    SPSCRing<uint32_t> ring(256);
+    const uint32_t total = 200000;
+
+    std::thread producer([&ring, total]() {
+        uint32_t value = 0;
+        uint32_t block[37];
+        while (value < total) {
+            uint32_t count = 0;
+            while (count < 37 && value + count < total) {
+                block[count] = value + count;
+                ++count;
+            }
+            value += static_cast<uint32_t>(ring.Write(block, count));
+        }
+    });
+
+    uint32_t expected = 0;
+    bool ordered = true;
+    uint32_t block[53];
+    while (expected < total) {
+        const size_t read = ring.Read(block, 53);
+        for (size_t i = 0; i < read; ++i) {
+            ordered = ordered && block[i] == expected++;
+        }
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_EQUAL(0, ring.Size());
+}
+
+// ========== Edge Cases ==========
+
+void TestSPSCRing::TestEdgeCases() {
+    SPSCRing<float> ring(0);
+    TEST_ASSERT_EQUAL(1, ring.GetCapacity());
+
+    float value = 1.0f;
+    TEST_ASSERT_EQUAL(0, ring.Write(nullptr, 4));
+    TEST_ASSERT_EQUAL(0, ring.Write(&value, 0));
+    TEST_ASSERT_EQUAL(1, ring.Write(&value, 1));
+    TEST_ASSERT_EQUAL(0, ring.Write(&value, 1));
+
+    float out = 0.0f;
+    TEST_ASSERT_EQUAL(0, ring.Read(nullptr, 1));
+    TEST_ASSERT_EQUAL(1, ring.Read(&out, 1));
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, 1.0f, out);
+}
+
+// ========== Test Runner ==========
+
+void TestSPSCRing::RunAllTests() {
+    RUN_TEST(TestConstructor);
+
+    RUN_TEST(TestWriteRead);
+    RUN_TEST(TestDiscard);
+
+    RUN_TEST(TestWrapAround);
+    RUN_TEST(TestConcurrentTransfer);
+
+    RUN_TEST(TestEdgeCases);
+}
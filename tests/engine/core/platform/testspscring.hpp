@@ -0,0 +1,39 @@
+/**
+ * @file testspscring.hpp
+ * @brief Unit tests for the SPSCRing class.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/core/platform/spscring.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestSPSCRing
+ * @brief Contains static test methods for the SPSCRing class.
+ */
+class TestSPSCRing {
+public:
+    // Constructor tests
+    static void TestConstructor();
+
+    // Method tests
+    static void TestWriteRead();
+    static void TestDiscard();
+
+    // Functionality tests
+    static void TestWrapAround();
+    static void TestConcurrentTransfer();
+
+    // Edge case tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
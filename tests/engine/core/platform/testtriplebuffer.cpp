@@ -0,0 +1,99 @@
+/**
+ * @file testtriplebuffer.cpp
+ * @brief Implementation of TripleBuffer unit tests.
+ */
+
+#include "testtriplebuffer.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using ptx::TripleBuffer;
+
+// ========== Constructor Tests ==========
+
+void TestTripleBuffer::TestConstructor() {
+    TripleBuffer<std::vector<int>> buffer(std::vector<int>(4, 7));
+    TEST_ASSERT_EQUAL(4, buffer.GetReadBuffer().size());
+    TEST_ASSERT_EQUAL(7, buffer.GetReadBuffer()[0]);
+    TEST_ASSERT_EQUAL(4, buffer.GetWriteBuffer().size());
+}
+
+// ========== Method Tests ==========
+
+void TestTripleBuffer::TestPublishAcquire() {
+    TripleBuffer<int> buffer(0);
+    TEST_ASSERT_FALSE(buffer.Acquire());
+
+    buffer.GetWriteBuffer() = 5;
+    buffer.Publish();
+    TEST_ASSERT_TRUE(buffer.Acquire());
+    TEST_ASSERT_EQUAL(5, buffer.GetReadBuffer());
+
+    // Nothing new: the reader keeps its value.
+    TEST_ASSERT_FALSE(buffer.Acquire());
+    TEST_ASSERT_EQUAL(5, buffer.GetReadBuffer());
+}
+
+// ========== Functionality Tests ==========
+
+void TestTripleBuffer::TestLatestValueWins() {
+    TripleBuffer<int> buffer(0);
+    for (int i = 1; i <= 3; ++i) {
+        buffer.GetWriteBuffer() = i;
+        buffer.Publish();
+    }
+
+    TEST_ASSERT_TRUE(buffer.Acquire());
+    TEST_ASSERT_EQUAL(3, buffer.GetReadBuffer());
+
+    // The writer never touches the buffer the reader holds.
+    buffer.GetWriteBuffer() = 99;
+    TEST_ASSERT_EQUAL(3, buffer.GetReadBuffer());
+}
+
+void TestTripleBuffer::TestConcurrentSnapshots() {
+    // Each snapshot holds one value repeated; a torn read would mix two values.
+    TripleBuffer<std::vector<uint32_t>> buffer(std::vector<uint32_t>(64, 0));
+    std::atomic<bool> done{false};
+
+    std::thread writer([&buffer, &done]() {
+        for (uint32_t value = 1; value <= 50000; ++value) {
+            std::vector<uint32_t>& out = buffer.GetWriteBuffer();
+            for (uint32_t& entry : out) entry = value;
+            buffer.Publish();
+        }
+        done.store(true);
+    });
+
+    bool consistent = true;
+    bool monotonic = true;
+    uint32_t last = 0;
+    while (!done.load()) {
+        buffer.Acquire();
+        const std::vector<uint32_t>& in = buffer.GetReadBuffer();
+        for (uint32_t entry : in) {
+            consistent = consistent && entry == in[0];
+        }
+        monotonic = monotonic && in[0] >= last;
+        last = in[0];
+    }
+    writer.join();
+    buffer.Acquire();
+
+    TEST_ASSERT_TRUE(consistent);
+    TEST_ASSERT_TRUE(monotonic);
+    TEST_ASSERT_EQUAL(50000, buffer.GetReadBuffer()[0]);
+}
+
+// ========== Test Runner ==========
+
+void TestTripleBuffer::RunAllTests() {
+    RUN_TEST(TestConstructor);
+
+    RUN_TEST(TestPublishAcquire);
+
+    RUN_TEST(TestLatestValueWins);
+    RUN_TEST(TestConcurrentSnapshots);
+}
@@ -0,0 +1,35 @@
+/**
+ * @file testtriplebuffer.hpp
+ * @brief Unit tests for the TripleBuffer class.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/core/platform/triplebuffer.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestTripleBuffer
+ * @brief Contains static test methods for the TripleBuffer class.
+ */
+class TestTripleBuffer {
+public:
+    // Constructor tests
+    static void TestConstructor();
+
+    // Method tests
+    static void TestPublishAcquire();
+
+    // Functionality tests
+    static void TestLatestValueWins();
+    static void TestConcurrentSnapshots();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -4,6 +4,43 @@
  */
 
 #include "testmaxfilter.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief The original shift-array MaxFilter, which summed its block history in float.
+ */
+class ReferenceMaxFilter {
+public:
+    explicit ReferenceMaxFilter(size_t memory)
+        : capacity(memory), history(std::max<size_t>(1, memory / 10), 0.0f) {}
+
+    float Filter(float value) {
+        values.push_back(value);
+        if (values.size() > capacity) values.erase(values.begin());
+
+        float extreme = values[0];
+        for (float v : values) extreme = std::max(extreme, v);
+
+        if (history.back() != extreme) {
+            history.erase(history.begin());
+            history.push_back(extreme);
+        }
+
+        float sum = 0.0f;
+        for (float v : history) sum += v;
+        return sum / static_cast<float>(history.size());
+    }
+
+private:
+    size_t capacity;
+    std::vector<float> values;
+    std::vector<float> history;
+};
+
+} // namespace
 
 // ========== Constructor Tests ==========
 
@@ -71,8 +108,66 @@ void TestMaxFilter::TestGetCapacity() {
     TEST_ASSERT_EQUAL_size_t(50, filter2.GetCapacity());
 }
 
+
+void TestMaxFilter::TestFilterBlock() {
+    std::vector<float> input(200);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<float>((i * 37) % 23) - 11.0f;
+    }
+
+    // The block call matches sample-by-sample filtering, including in place.
+    MaxFilter single(40);
+    MaxFilter block(40);
+    std::vector<float> output(input.size());
+    block.FilterBlock(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        const float expected = single.Filter(input[i]);
+        TEST_ASSERT_EQUAL_FLOAT(expected, output[i]);
+    }
+
+    MaxFilter inPlace(40);
+    std::vector<float> samples = input;
+    inPlace.FilterBlock(samples.data(), samples.data(), samples.size());
+    TEST_ASSERT_EQUAL_FLOAT(output.back(), samples.back());
+
+    // Null buffers are ignored.
+    block.FilterBlock(nullptr, output.data(), 4);
+    block.FilterBlock(input.data(), nullptr, 4);
+}
+
 // ========== Max Filter Behavior Tests ==========
 
+void TestMaxFilter::TestSlidingWindow() {
+    // Below 20 samples there is a single history block, so the output is the window max itself.
+    MaxFilter filter(8);
+    std::vector<float> history;
+    for (int i = 0; i < 300; ++i) {
+        const float value = static_cast<float>((i * 29) % 31) - 15.0f;
+        history.push_back(value);
+
+        const size_t begin = history.size() > 8 ? history.size() - 8 : 0;
+        const float expected = *std::max_element(history.begin() + begin, history.end());
+        const float result = filter.Filter(value);
+        TEST_ASSERT_EQUAL_FLOAT(expected, result);
+    }
+}
+
+void TestMaxFilter::TestMatchesReference() {
+    // The block history is now summed in double rather than float, so outputs match the
+    // original implementation within float rounding rather than bit for bit.
+    const size_t memories[3] = {40, 100, 480};
+    for (size_t memory : memories) {
+        MaxFilter filter(memory);
+        ReferenceMaxFilter reference(memory);
+        for (int i = 0; i < 2000; ++i) {
+            const float value = static_cast<float>((i * 7919) % 1009) * 0.0137f - 6.9f;
+            const float expected = reference.Filter(value);
+            const float result = filter.Filter(value);
+            TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected, result);
+        }
+    }
+}
+
 // ========== Edge Cases ==========
 
 void TestMaxFilter::TestEdgeCases() {
@@ -102,6 +197,9 @@ void TestMaxFilter::RunAllTests() {
     RUN_TEST(TestFilter);
     RUN_TEST(TestReset);
     RUN_TEST(TestGetCapacity);
+    RUN_TEST(TestFilterBlock);
+    RUN_TEST(TestSlidingWindow);
+    RUN_TEST(TestMatchesReference);
 
     RUN_TEST(TestEdgeCases);
 
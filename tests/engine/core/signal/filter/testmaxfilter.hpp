@@ -30,8 +30,11 @@ public:
     static void TestFilter();
     static void TestReset();
     static void TestGetCapacity();
+    static void TestFilterBlock();
 
     // Max filter behavior tests
+    static void TestSlidingWindow();
+    static void TestMatchesReference();
 
     // Edge case & integration tests
     static void TestEdgeCases();
@@ -4,8 +4,46 @@
  */
 
 #include "testminfilter.hpp"
+#include <algorithm>
+#include <vector>
 #include <cmath>
 
+namespace {
+
+/**
+ * @brief The original shift-array MinFilter, which summed its block history in float.
+ */
+class ReferenceMinFilter {
+public:
+    explicit ReferenceMinFilter(size_t memory, bool ignoreSame)
+        : capacity(memory), history(std::max<size_t>(1, memory / 10), 0.0f), ignoreSame(ignoreSame) {}
+
+    float Filter(float value) {
+        values.push_back(value);
+        if (values.size() > capacity) values.erase(values.begin());
+
+        float extreme = values[0];
+        for (float v : values) extreme = std::min(extreme, v);
+
+        if (history.back() != extreme || !ignoreSame) {
+            history.erase(history.begin());
+            history.push_back(extreme);
+        }
+
+        float sum = 0.0f;
+        for (float v : history) sum += v;
+        return sum / static_cast<float>(history.size());
+    }
+
+private:
+    size_t capacity;
+    std::vector<float> values;
+    std::vector<float> history;
+    bool ignoreSame;
+};
+
+} // namespace
+
 // ========== Constructor Tests ==========
 
 void TestMinFilter::TestDefaultConstructor() {
@@ -75,8 +113,68 @@ void TestMinFilter::TestGetCapacity() {
     TEST_ASSERT_EQUAL(40, filter3.GetCapacity());
 }
 
+
+void TestMinFilter::TestFilterBlock() {
+    std::vector<float> input(200);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<float>((i * 37) % 23) - 11.0f;
+    }
+
+    // The block call matches sample-by-sample filtering, including in place.
+    MinFilter single(40);
+    MinFilter block(40);
+    std::vector<float> output(input.size());
+    block.FilterBlock(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        const float expected = single.Filter(input[i]);
+        TEST_ASSERT_EQUAL_FLOAT(expected, output[i]);
+    }
+
+    MinFilter inPlace(40);
+    std::vector<float> samples = input;
+    inPlace.FilterBlock(samples.data(), samples.data(), samples.size());
+    TEST_ASSERT_EQUAL_FLOAT(output.back(), samples.back());
+
+    // Null buffers are ignored.
+    block.FilterBlock(nullptr, output.data(), 4);
+    block.FilterBlock(input.data(), nullptr, 4);
+}
+
 // ========== Minimum Tracking Tests ==========
 
+void TestMinFilter::TestSlidingWindow() {
+    // Below 20 samples there is a single history block, so the output is the window min itself.
+    MinFilter filter(8);
+    std::vector<float> history;
+    for (int i = 0; i < 300; ++i) {
+        const float value = static_cast<float>((i * 29) % 31) - 15.0f;
+        history.push_back(value);
+
+        const size_t begin = history.size() > 8 ? history.size() - 8 : 0;
+        const float expected = *std::min_element(history.begin() + begin, history.end());
+        const float result = filter.Filter(value);
+        TEST_ASSERT_EQUAL_FLOAT(expected, result);
+    }
+}
+
+void TestMinFilter::TestMatchesReference() {
+    // The block history is now summed in double rather than float, so outputs match the
+    // original implementation within float rounding rather than bit for bit.
+    const size_t memories[3] = {40, 100, 480};
+    for (size_t memory : memories) {
+        for (bool ignoreSame : {true, false}) {
+            MinFilter filter(memory, ignoreSame);
+            ReferenceMinFilter reference(memory, ignoreSame);
+            for (int i = 0; i < 2000; ++i) {
+                const float value = static_cast<float>((i * 7919) % 1009) * 0.0137f - 6.9f;
+                const float expected = reference.Filter(value);
+                const float result = filter.Filter(value);
+                TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected, result);
+            }
+        }
+    }
+}
+
 // ========== Edge Cases ==========
 
 void TestMinFilter::TestEdgeCases() {
@@ -106,6 +204,9 @@ void TestMinFilter::RunAllTests() {
     RUN_TEST(TestFilter);
     RUN_TEST(TestReset);
     RUN_TEST(TestGetCapacity);
+    RUN_TEST(TestFilterBlock);
+    RUN_TEST(TestSlidingWindow);
+    RUN_TEST(TestMatchesReference);
 
     RUN_TEST(TestEdgeCases);
 
@@ -29,8 +29,11 @@ public:
     static void TestFilter();
     static void TestReset();
     static void TestGetCapacity();
+    static void TestFilterBlock();
 
     // Minimum tracking tests
+    static void TestSlidingWindow();
+    static void TestMatchesReference();
 
     // Edge case & integration tests
     static void TestEdgeCases();
@@ -4,6 +4,7 @@
  */
 
 #include "testpeakdetection.hpp"
+#include <algorithm>
 #include <vector>
 
 // ========== Constructor Tests ==========
@@ -115,6 +116,140 @@ void TestPeakDetection::TestGetInfluence() {
 
 // ========== Peak Detection Tests ==========
 
+void TestPeakDetection::TestCalculateIgnoresSteadySignal() {
+    PeakDetection detector(64, 8, 2.0f, 0.5f);
+
+    // Alternating signal: constant statistics, nothing stands out.
+    std::vector<float> data(64);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = (i % 2 == 0) ? 4.0f : 6.0f;
+    }
+    data[30] = 40.0f;
+
+    std::vector<bool> peaks;
+    detector.Calculate(data.data(), peaks);
+
+    size_t detected = 0;
+    for (size_t i = 0; i < peaks.size(); ++i) {
+        if (peaks[i]) {
+            ++detected;
+        }
+    }
+
+    TEST_ASSERT_TRUE(peaks[30]);
+    TEST_ASSERT_EQUAL(1, detected);
+}
+
+void TestPeakDetection::TestCalculateChannels() {
+    PeakDetection detector(9, 4, 2.0f, 0.5f);
+
+    std::vector<float> frame(9);
+    std::vector<uint8_t> peaks;
+
+    // Warm-up frames fill the history and never report peaks.
+    for (int f = 0; f < 4; ++f) {
+        for (size_t c = 0; c < frame.size(); ++c) {
+            frame[c] = 10.0f + static_cast<float>(c) + ((f % 2 == 0) ? 0.5f : -0.5f);
+        }
+        detector.CalculateChannels(frame.data(), peaks);
+        TEST_ASSERT_EQUAL(9, peaks.size());
+        for (size_t c = 0; c < peaks.size(); ++c) {
+            TEST_ASSERT_EQUAL(0, peaks[c]);
+        }
+    }
+
+    // Spike channels on both sides of the four-wide SIMD boundary and in the scalar tail.
+    for (size_t c = 0; c < frame.size(); ++c) {
+        frame[c] = 10.0f + static_cast<float>(c);
+    }
+    frame[3] += 20.0f;
+    frame[4] += 20.0f;
+    frame[8] += 20.0f;
+    frame[6] -= 20.0f;
+
+    detector.CalculateChannels(frame.data(), peaks);
+
+    for (size_t c = 0; c < peaks.size(); ++c) {
+        const int expected = (c == 3 || c == 4 || c == 8) ? 1 : 0;
+        TEST_ASSERT_EQUAL(expected, peaks[c]);
+    }
+
+    // Reset drops the history, so the next frame is warm-up again.
+    detector.Reset();
+    detector.CalculateChannels(frame.data(), peaks);
+    for (size_t c = 0; c < peaks.size(); ++c) {
+        TEST_ASSERT_EQUAL(0, peaks[c]);
+    }
+
+    detector.CalculateChannels(nullptr, peaks);
+    TEST_ASSERT_EQUAL(0, peaks.size());
+}
+
+void TestPeakDetection::TestCalculateChannelsMatchesSingleChannel() {
+    const size_t channels = 7;
+    const size_t frames = 200;
+    PeakDetection detector(channels, 6, 1.5f, 0.25f);
+    PeakDetection single(1, 6, 1.5f, 0.25f);
+
+    // Every channel carries the same stream as a one-channel detector, so the SIMD lanes and
+    // the scalar tail must agree with it frame by frame across several history laps.
+    std::vector<float> frame(channels);
+    std::vector<uint8_t> peaks;
+    std::vector<uint8_t> reference;
+    uint32_t state = 12345u;
+    size_t detected = 0;
+
+    for (size_t f = 0; f < frames; ++f) {
+        state = state * 1664525u + 1013904223u;
+        float sample = static_cast<float>((state >> 8) & 0xFFFF) / 65536.0f;
+        if ((state >> 28) == 0) {
+            sample += 8.0f;
+        }
+
+        std::fill(frame.begin(), frame.end(), sample);
+
+        detector.CalculateChannels(frame.data(), peaks);
+        single.CalculateChannels(&sample, reference);
+
+        if (reference[0]) {
+            ++detected;
+        }
+
+        for (size_t c = 0; c < channels; ++c) {
+            const int peak = peaks[c];
+            const int expected = reference[0];
+            TEST_ASSERT_EQUAL(expected, peak);
+        }
+    }
+
+    TEST_ASSERT_TRUE(detected > 0);
+}
+
+void TestPeakDetection::TestChannelStateIsLazy() {
+    PeakDetection detector(64, 12, 0.75f, 0.5f);
+    TEST_ASSERT_FALSE(detector.HasChannelState());
+
+    // Single-buffer detection and Reset never allocate the per-channel history.
+    std::vector<float> data(64, 1.0f);
+    data[30] = 8.0f;
+    std::vector<bool> peaks;
+    detector.Calculate(data.data(), peaks);
+    detector.Reset();
+    TEST_ASSERT_FALSE(detector.HasChannelState());
+
+    std::vector<uint8_t> flags;
+    detector.CalculateChannels(nullptr, flags);
+    TEST_ASSERT_FALSE(detector.HasChannelState());
+
+    // The first real frame allocates it, and Reset keeps it for reuse.
+    detector.CalculateChannels(data.data(), flags);
+    TEST_ASSERT_TRUE(detector.HasChannelState());
+    TEST_ASSERT_EQUAL(64, flags.size());
+
+    detector.Reset();
+    TEST_ASSERT_TRUE(detector.HasChannelState());
+}
+
 // ========== Edge Cases ==========
 
 void TestPeakDetection::TestEdgeCases() {
@@ -147,6 +282,11 @@ void TestPeakDetection::RunAllTests() {
     RUN_TEST(TestGetThreshold);
     RUN_TEST(TestGetInfluence);
 
+    RUN_TEST(TestCalculateIgnoresSteadySignal);
+    RUN_TEST(TestCalculateChannels);
+    RUN_TEST(TestCalculateChannelsMatchesSingleChannel);
+    RUN_TEST(TestChannelStateIsLazy);
+
     RUN_TEST(TestEdgeCases);
 
 }
@@ -34,6 +34,10 @@ public:
     static void TestGetInfluence();
 
     // Peak detection tests
+    static void TestCalculateIgnoresSteadySignal();
+    static void TestCalculateChannels();
+    static void TestCalculateChannelsMatchesSingleChannel();
+    static void TestChannelStateIsLazy();
 
     // Edge case & integration tests
     static void TestEdgeCases();
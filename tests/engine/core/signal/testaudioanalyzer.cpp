@@ -0,0 +1,209 @@
+/**
+ * @file testaudioanalyzer.cpp
+ * @brief Implementation of AudioAnalyzer unit tests.
+ */
+
+#include "testaudioanalyzer.hpp"
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr float kTwoPi = 6.28318530717958f;
+
+std::vector<float> MakeTone(float frequency, float amplitude, float sampleRate, size_t count) {
+    std::vector<float> samples(count);
+    for (size_t i = 0; i < count; ++i) {
+        samples[i] = amplitude * std::sin(kTwoPi * frequency * static_cast<float>(i) / sampleRate);
+    }
+    return samples;
+}
+
+size_t LoudestBand(const AudioAnalysis& analysis) {
+    size_t loudest = 0;
+    for (size_t b = 1; b < analysis.bands.size(); ++b) {
+        if (analysis.bands[b] > analysis.bands[loudest]) loudest = b;
+    }
+    return loudest;
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestAudioAnalyzer::TestConstructor() {
+    AudioAnalyzer analyzer(44100.0f, 512, 128, 32);
+    TEST_ASSERT_EQUAL(32, analyzer.GetBandCount());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 44100.0f, analyzer.GetSampleRate());
+    TEST_ASSERT_EQUAL(512, analyzer.GetSTFT().GetFrameSize());
+    TEST_ASSERT_EQUAL(128, analyzer.GetSTFT().GetHopSize());
+    TEST_ASSERT_FALSE(analyzer.IsRunning());
+
+    bool threw = false;
+    try {
+        AudioAnalyzer invalid(48000.0f, 512, 0, 32);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    TEST_ASSERT_TRUE(threw);
+}
+
+// ========== Method Tests ==========
+
+void TestAudioAnalyzer::TestPushSamples() {
+    AudioAnalyzer analyzer(48000.0f, 256, 64, 16);
+    std::vector<float> samples(4096, 0.25f);
+
+    // The ring holds eight frames; the rest is counted as dropped, not queued.
+    const size_t accepted = analyzer.PushSamples(samples.data(), samples.size());
+    TEST_ASSERT_EQUAL(2048, accepted);
+    TEST_ASSERT_EQUAL_UINT32(2048, static_cast<uint32_t>(analyzer.GetDroppedSamples()));
+
+    analyzer.ProcessPending();
+    TEST_ASSERT_EQUAL(64, analyzer.PushSamples(samples.data(), 64));
+}
+
+void TestAudioAnalyzer::TestProcessPending() {
+    AudioAnalyzer analyzer(48000.0f, 256, 64, 16);
+    std::vector<float> samples = MakeTone(1000.0f, 0.5f, 48000.0f, 256 + 64 * 3);
+
+    analyzer.PushSamples(samples.data(), 200);
+    TEST_ASSERT_EQUAL(0, analyzer.ProcessPending());
+    TEST_ASSERT_EQUAL_UINT32(0, static_cast<uint32_t>(analyzer.Acquire().frame));
+
+    analyzer.PushSamples(samples.data() + 200, samples.size() - 200);
+    TEST_ASSERT_EQUAL(4, analyzer.ProcessPending());
+
+    const AudioAnalysis& analysis = analyzer.Acquire();
+    TEST_ASSERT_EQUAL_UINT32(4, static_cast<uint32_t>(analysis.frame));
+    TEST_ASSERT_EQUAL(16, analysis.bands.size());
+    TEST_ASSERT_EQUAL(16, analysis.peaks.size());
+}
+
+// ========== Functionality Tests ==========
+
+void TestAudioAnalyzer::TestToneLandsInBand() {
+    const float sampleRate = 48000.0f;
+    AudioAnalyzer analyzer(sampleRate, 1024, 256, 24, 40.0f);
+    analyzer.SetSmoothing(1.0f, 1.0f);
+    analyzer.SetDynamicRange(60.0f);
+
+    // A -6 dB sine in the middle of bin 64 (3 kHz) should read about 1 - 6/60.
+    std::vector<float> tone = MakeTone(3000.0f, 0.5f, sampleRate, 4096);
+    analyzer.PushSamples(tone.data(), tone.size());
+    analyzer.ProcessPending();
+
+    const AudioAnalysis& analysis = analyzer.Acquire();
+    const size_t loudest = LoudestBand(analysis);
+
+    // Band edges are log-spaced from 40 Hz to 24 kHz.
+    const float position = std::log(3000.0f / 40.0f) / std::log(24000.0f / 40.0f) * 24.0f;
+    const size_t expectedBand = static_cast<size_t>(position);
+    TEST_ASSERT_TRUE(loudest + 1 >= expectedBand && loudest <= expectedBand + 1);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 0.9f, analysis.bands[loudest]);
+    TEST_ASSERT_TRUE(analysis.bands[0] < 0.5f);
+}
+
+void TestAudioAnalyzer::TestPeakOnOnset() {
+    const float sampleRate = 48000.0f;
+    AudioAnalyzer analyzer(sampleRate, 512, 128, 16, 100.0f);
+
+    // Quiet noise-like floor long enough to fill the detector history, then a loud tone.
+    std::vector<float> floor(512 + 128 * 40);
+    uint32_t state = 1u;
+    for (float& sample : floor) {
+        state = state * 1664525u + 1013904223u;
+        sample = (static_cast<float>(state >> 8) / 16777216.0f - 0.5f) * 0.002f;
+    }
+    analyzer.PushSamples(floor.data(), floor.size());
+    analyzer.ProcessPending();
+    analyzer.Acquire();
+
+    std::vector<float> tone = MakeTone(2000.0f, 0.8f, sampleRate, 128);
+    analyzer.PushSamples(tone.data(), tone.size());
+    TEST_ASSERT_EQUAL(1, analyzer.ProcessPending());
+
+    const AudioAnalysis& analysis = analyzer.Acquire();
+    size_t peakCount = 0;
+    for (uint8_t peak : analysis.peaks) {
+        peakCount += peak;
+    }
+    TEST_ASSERT_TRUE(peakCount > 0);
+    TEST_ASSERT_EQUAL(1, analysis.peaks[LoudestBand(analysis)]);
+}
+
+void TestAudioAnalyzer::TestBackgroundThread() {
+    AudioAnalyzer analyzer(48000.0f, 256, 64, 16);
+    TEST_ASSERT_TRUE(analyzer.Start());
+    TEST_ASSERT_TRUE(analyzer.IsRunning());
+    TEST_ASSERT_TRUE(analyzer.Start());
+
+    // Feed in small capture-sized blocks while the render side polls snapshots.
+    std::vector<float> tone = MakeTone(1500.0f, 0.5f, 48000.0f, 256 + 64 * 63);
+    size_t position = 0;
+    uint64_t lastFrame = 0;
+    bool monotonic = true;
+    while (position < tone.size()) {
+        const size_t block = std::min<size_t>(48, tone.size() - position);
+        position += analyzer.PushSamples(tone.data() + position, block);
+
+        const uint64_t frame = analyzer.Acquire().frame;
+        monotonic = monotonic && frame >= lastFrame;
+        lastFrame = frame;
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (analyzer.Acquire().frame < 64 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    analyzer.Stop();
+
+    TEST_ASSERT_FALSE(analyzer.IsRunning());
+    TEST_ASSERT_TRUE(monotonic);
+    TEST_ASSERT_EQUAL_UINT32(64, static_cast<uint32_t>(analyzer.Acquire().frame));
+    TEST_ASSERT_EQUAL_UINT32(0, static_cast<uint32_t>(analyzer.GetDroppedSamples()));
+}
+
+// ========== Edge Cases ==========
+
+void TestAudioAnalyzer::TestEdgeCases() {
+    AudioAnalyzer analyzer(0.0f, 64, 64, 0);
+    TEST_ASSERT_EQUAL(1, analyzer.GetBandCount());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 48000.0f, analyzer.GetSampleRate());
+
+    TEST_ASSERT_EQUAL(0, analyzer.PushSamples(nullptr, 16));
+    TEST_ASSERT_EQUAL(0, analyzer.ProcessPending());
+
+    const AudioAnalysis& empty = analyzer.Acquire();
+    TEST_ASSERT_EQUAL_UINT32(0, static_cast<uint32_t>(empty.frame));
+    TEST_ASSERT_EQUAL(1, empty.bands.size());
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, 0.0f, empty.bands[0]);
+
+    // More bands than bins still yields one value per band.
+    AudioAnalyzer dense(48000.0f, 64, 32, 100);
+    std::vector<float> tone = MakeTone(5000.0f, 0.5f, 48000.0f, 128);
+    dense.PushSamples(tone.data(), tone.size());
+    dense.ProcessPending();
+    TEST_ASSERT_EQUAL(100, dense.Acquire().bands.size());
+
+    analyzer.Stop();
+}
+
+// ========== Test Runner ==========
+
+void TestAudioAnalyzer::RunAllTests() {
+    RUN_TEST(TestConstructor);
+
+    RUN_TEST(TestPushSamples);
+    RUN_TEST(TestProcessPending);
+
+    RUN_TEST(TestToneLandsInBand);
+    RUN_TEST(TestPeakOnOnset);
+    RUN_TEST(TestBackgroundThread);
+
+    RUN_TEST(TestEdgeCases);
+}
@@ -0,0 +1,40 @@
+/**
+ * @file testaudioanalyzer.hpp
+ * @brief Unit tests for the AudioAnalyzer class.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/core/signal/audioanalyzer.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestAudioAnalyzer
+ * @brief Contains static test methods for the AudioAnalyzer class.
+ */
+class TestAudioAnalyzer {
+public:
+    // Constructor tests
+    static void TestConstructor();
+
+    // Method tests
+    static void TestPushSamples();
+    static void TestProcessPending();
+
+    // Functionality tests
+    static void TestToneLandsInBand();
+    static void TestPeakOnOnset();
+    static void TestBackgroundThread();
+
+    // Edge case tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
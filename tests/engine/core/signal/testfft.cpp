@@ -4,6 +4,25 @@
  */
 
 #include "testfft.hpp"
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// Reference O(n^2) DFT of an interleaved complex signal.
+std::vector<double> DirectDFT(const std::vector<float>& input, int size) {
+    std::vector<double> out(2 * size, 0.0);
+    for (int k = 0; k < size; ++k) {
+        for (int t = 0; t < size; ++t) {
+            const double angle = -2.0 * 3.14159265358979323846 * k * t / size;
+            out[2 * k]     += input[2 * t] * std::cos(angle) - input[2 * t + 1] * std::sin(angle);
+            out[2 * k + 1] += input[2 * t] * std::sin(angle) + input[2 * t + 1] * std::cos(angle);
+        }
+    }
+    return out;
+}
+
+} // namespace
 
 // ========== Constructor Tests ==========
 
@@ -116,6 +135,96 @@ void TestFFT::TestComplexMagnitude() {
         TEST_ASSERT_TRUE(magnitude[i] >= 0.0f);
     }
 }
+
+void TestFFT::TestForwardReal() {
+    FFT fft(8);
+    const float input[8] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+
+    float spectrum[10];
+    fft.ForwardReal(input, spectrum);
+
+    // Same bins as the complex transform of the zero-imaginary signal.
+    float complex[16];
+    for (int i = 0; i < 8; ++i) {
+        complex[2 * i] = input[i];
+        complex[2 * i + 1] = 0.0f;
+    }
+    fft.Forward(complex);
+
+    for (int i = 0; i < 10; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, complex[i], spectrum[i]);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 36.0f, spectrum[0]);
+
+    float magnitude[5];
+    fft.RealMagnitude(spectrum, magnitude);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 36.0f, magnitude[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 4.0f, magnitude[4]);
+}
+
+void TestFFT::TestInverseReal() {
+    FFT fft(16);
+    float input[16];
+    for (int i = 0; i < 16; ++i) {
+        input[i] = std::sin(i * 0.7f) + 0.25f * i;
+    }
+
+    float spectrum[18];
+    float output[16];
+    fft.ForwardReal(input, spectrum);
+    fft.InverseReal(spectrum, output, true);
+    for (int i = 0; i < 16; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, input[i], output[i]);
+    }
+
+    // Unscaled and in place: the result is Size() times the input.
+    fft.InverseReal(spectrum, spectrum, false);
+    for (int i = 0; i < 16; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, 16.0f * input[i], spectrum[i]);
+    }
+}
+
+// ========== Functionality Tests ==========
+
+void TestFFT::TestMatchesDirectDFT() {
+    // Both radix-4 layouts (even and odd log2 size) and sizes large enough for the vector path.
+    for (int size = 2; size <= 512; size *= 2) {
+        FFT fft(size);
+        std::vector<float> data(2 * size);
+        for (int i = 0; i < 2 * size; ++i) {
+            data[i] = std::sin(i * 0.37f) + std::cos(i * 1.3f);
+        }
+
+        const std::vector<double> expected = DirectDFT(data, size);
+        std::vector<float> actual = data;
+        fft.Forward(actual.data());
+
+        const float tolerance = 1e-4f * size;
+        for (int i = 0; i < 2 * size; ++i) {
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, static_cast<float>(expected[i]), actual[i]);
+        }
+
+        fft.Inverse(actual.data(), true);
+        for (int i = 0; i < 2 * size; ++i) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-4f, data[i], actual[i]);
+        }
+
+        // Real transform of the real parts matches the first half of a zero-imaginary complex transform.
+        std::vector<float> real(size);
+        std::vector<float> complex(2 * size, 0.0f);
+        for (int i = 0; i < size; ++i) {
+            real[i] = data[2 * i];
+            complex[2 * i] = data[2 * i];
+        }
+        std::vector<float> spectrum(size + 2);
+        fft.ForwardReal(real.data(), spectrum.data());
+        fft.Forward(complex.data());
+        for (int i = 0; i < size + 2; ++i) {
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, complex[i], spectrum[i]);
+        }
+    }
+}
+
 // ========== Edge Cases ==========
 
 // ========== Test Runner ==========
@@ -229,6 +338,22 @@ void TestFFT::TestEdgeCases() {
     TEST_ASSERT_EQUAL(32, instance1.Size());
     TEST_ASSERT_EQUAL(32, instance2.Size());
     TEST_ASSERT_EQUAL(&instance1, &instance2);  // Same address
+
+    // Smallest real transform: sum and difference, and its inverse.
+    const float pair[2] = {3.0f, 1.0f};
+    float pairSpectrum[4];
+    fft2.ForwardReal(pair, pairSpectrum);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 4.0f, pairSpectrum[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 2.0f, pairSpectrum[2]);
+    float pairOutput[2];
+    fft2.InverseReal(pairSpectrum, pairOutput);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 3.0f, pairOutput[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f, pairOutput[1]);
+
+    // Null buffers are ignored.
+    fft8.ForwardReal(nullptr, zeroData);
+    fft8.InverseReal(nullptr, zeroData);
+    fft8.RealMagnitude(zeroData, nullptr);
 }
 
 void TestFFT::RunAllTests() {
@@ -238,5 +363,8 @@ void TestFFT::RunAllTests() {
     RUN_TEST(TestForward);
     RUN_TEST(TestInverse);
     RUN_TEST(TestComplexMagnitude);
+    RUN_TEST(TestForwardReal);
+    RUN_TEST(TestInverseReal);
+    RUN_TEST(TestMatchesDirectDFT);
     RUN_TEST(TestEdgeCases);
 }
@@ -30,8 +30,11 @@ public:
     static void TestForward();
     static void TestInverse();
     static void TestComplexMagnitude();
+    static void TestForwardReal();
+    static void TestInverseReal();
 
     // Functionality tests
+    static void TestMatchesDirectDFT();
 
     // Edge case & integration tests
     static void TestEdgeCases();
@@ -0,0 +1,172 @@
+/**
+ * @file teststft.cpp
+ * @brief Implementation of STFT unit tests.
+ */
+
+#include "teststft.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr float kPi = 3.14159265358979f;
+
+std::vector<float> MakeSignal(size_t count) {
+    std::vector<float> samples(count);
+    for (size_t i = 0; i < count; ++i) {
+        samples[i] = std::sin(i * 0.05f) + 0.3f * std::sin(i * 0.9f);
+    }
+    return samples;
+}
+
+// Streams samples through analysis and straight back through resynthesis.
+std::vector<float> RoundTrip(STFT& stft, const std::vector<float>& input, size_t blockSize) {
+    std::vector<float> output;
+    size_t position = 0;
+    while (position < input.size()) {
+        const size_t block = std::min(blockSize, input.size() - position);
+        position += stft.Push(input.data() + position, block);
+        if (stft.HasFrame()) {
+            stft.Synthesize(stft.GetSpectrum());
+            output.insert(output.end(), stft.GetOutput(), stft.GetOutput() + stft.GetHopSize());
+        }
+    }
+    return output;
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestSTFT::TestConstructor() {
+    STFT stft(64, 16);
+    TEST_ASSERT_EQUAL_INT(64, stft.GetFrameSize());
+    TEST_ASSERT_EQUAL_INT(16, stft.GetHopSize());
+    TEST_ASSERT_EQUAL_INT(33, stft.GetBinCount());
+    TEST_ASSERT_FALSE(stft.HasFrame());
+
+    // Periodic Hann: zero at the start, one at the center.
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, stft.GetWindow()[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, stft.GetWindow()[32]);
+
+    STFT rectangular(32, 32, STFT::Window::Rectangular);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, rectangular.GetWindow()[0]);
+}
+
+// ========== Method Tests ==========
+
+void TestSTFT::TestPush() {
+    STFT stft(16, 4);
+    const std::vector<float> samples = MakeSignal(40);
+
+    // The first frame needs a full frame of samples.
+    TEST_ASSERT_EQUAL_size_t(10, stft.Push(samples.data(), 10));
+    TEST_ASSERT_FALSE(stft.HasFrame());
+    TEST_ASSERT_EQUAL_size_t(6, stft.Push(samples.data() + 10, 30));
+    TEST_ASSERT_TRUE(stft.HasFrame());
+
+    // Later frames complete every hop.
+    TEST_ASSERT_EQUAL_size_t(4, stft.Push(samples.data() + 16, 24));
+    TEST_ASSERT_TRUE(stft.HasFrame());
+    TEST_ASSERT_EQUAL_size_t(3, stft.Push(samples.data() + 20, 3));
+    TEST_ASSERT_FALSE(stft.HasFrame());
+}
+
+void TestSTFT::TestReset() {
+    STFT stft(16, 8);
+    const std::vector<float> samples = MakeSignal(16);
+    stft.Push(samples.data(), 16);
+    TEST_ASSERT_TRUE(stft.HasFrame());
+
+    stft.Reset();
+    TEST_ASSERT_FALSE(stft.HasFrame());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, stft.GetMagnitudes()[0]);
+
+    // A full frame is needed again after the reset.
+    TEST_ASSERT_EQUAL_size_t(8, stft.Push(samples.data(), 8));
+    TEST_ASSERT_FALSE(stft.HasFrame());
+}
+
+// ========== Functionality Tests ==========
+
+void TestSTFT::TestToneLandsInBin() {
+    STFT stft(64, 32);
+    std::vector<float> tone(64);
+    for (size_t i = 0; i < tone.size(); ++i) {
+        tone[i] = std::cos(2.0f * kPi * 8.0f * i / 64.0f);
+    }
+
+    stft.Push(tone.data(), tone.size());
+    TEST_ASSERT_TRUE(stft.HasFrame());
+
+    // Bin 8 carries the tone: amplitude * N/2 * Hann coherent gain 0.5.
+    const float* magnitudes = stft.GetMagnitudes();
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 16.0f, magnitudes[8]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 8.0f, magnitudes[7]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.0f, magnitudes[20]);
+}
+
+void TestSTFT::TestOverlapAddReconstructs() {
+    const std::vector<float> input = MakeSignal(1000);
+
+    const STFT::Window windows[] = {STFT::Window::Hann, STFT::Window::Hamming, STFT::Window::Blackman};
+    for (STFT::Window window : windows) {
+        for (int hop = 16; hop <= 32; hop *= 2) {
+            STFT stft(64, hop, window);
+            const std::vector<float> output = RoundTrip(stft, input, 37);
+            TEST_ASSERT_TRUE(output.size() >= 900);
+
+            // Past the first frame every output sample has its full set of overlapping frames.
+            for (size_t i = 64; i < output.size(); ++i) {
+                TEST_ASSERT_FLOAT_WITHIN(1e-4f, input[i], output[i]);
+            }
+        }
+    }
+}
+
+// ========== Edge Cases ==========
+
+void TestSTFT::TestEdgeCases() {
+    bool threw = false;
+    try {
+        STFT badSize(48, 16);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    TEST_ASSERT_TRUE(threw);
+
+    threw = false;
+    try {
+        STFT badHop(64, 65);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    TEST_ASSERT_TRUE(threw);
+
+    // No overlap with a rectangular window is still an exact round trip.
+    STFT blocks(32, 32, STFT::Window::Rectangular);
+    const std::vector<float> input = MakeSignal(256);
+    const std::vector<float> output = RoundTrip(blocks, input, 100);
+    TEST_ASSERT_EQUAL_size_t(256, output.size());
+    for (size_t i = 0; i < output.size(); ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, input[i], output[i]);
+    }
+
+    // Null and empty input.
+    TEST_ASSERT_EQUAL_size_t(0, blocks.Push(nullptr, 10));
+    TEST_ASSERT_EQUAL_size_t(0, blocks.Push(input.data(), 0));
+    TEST_ASSERT_FALSE(blocks.HasFrame());
+    blocks.Synthesize(nullptr);
+}
+
+// ========== Test Runner ==========
+
+void TestSTFT::RunAllTests() {
+    RUN_TEST(TestConstructor);
+    RUN_TEST(TestPush);
+    RUN_TEST(TestReset);
+    RUN_TEST(TestToneLandsInBin);
+    RUN_TEST(TestOverlapAddReconstructs);
+    RUN_TEST(TestEdgeCases);
+}
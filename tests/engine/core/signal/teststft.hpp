@@ -0,0 +1,39 @@
+/**
+ * @file teststft.hpp
+ * @brief Unit tests for the STFT class.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/core/signal/stft.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestSTFT
+ * @brief Contains static test methods for the STFT class.
+ */
+class TestSTFT {
+public:
+    // Constructor tests
+    static void TestConstructor();
+
+    // Method tests
+    static void TestPush();
+    static void TestReset();
+
+    // Functionality tests
+    static void TestToneLandsInBin();
+    static void TestOverlapAddReconstructs();
+
+    // Edge case tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
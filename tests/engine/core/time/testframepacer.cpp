@@ -0,0 +1,250 @@
+/**
+ * @file testframepacer.cpp
+ * @brief Implementation of FramePacer unit tests.
+ */
+
+#include "testframepacer.hpp"
+
+#include <string>
+
+namespace {
+
+/**
+ * @brief Pacer on a fake clock: each read advances 1 us, sleeps overshoot by a set amount.
+ */
+class FakeClockPacer : public FramePacer {
+public:
+    explicit FakeClockPacer(float frequency) : FramePacer(frequency) {}
+
+    uint64_t time = 1000000000ull;
+    uint64_t overshoot = 0;
+    uint32_t sleeps = 0;
+
+    /** @brief Simulates frame work. */
+    void Work(uint64_t nanos) { time += nanos; }
+
+protected:
+    uint64_t Now() override {
+        time += 1000;
+        return time;
+    }
+
+    void Sleep(uint64_t nanos) override {
+        ++sleeps;
+        time += nanos + overshoot;
+    }
+};
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestFramePacer::TestConstructor() {
+    FramePacer pacer(100.0f);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, pacer.GetFrequency());
+    TEST_ASSERT_TRUE(pacer.GetPeriodNanos() == 10000000ull);
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.GetFrameCount());
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.GetMissedFrames());
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.GetFrameTimeHistogram().GetCount());
+    TEST_ASSERT_TRUE(pacer.GetSpinMicros() > 0);
+}
+
+// ========== Method Tests ==========
+
+void TestFramePacer::TestHistogram() {
+    FrameHistogram histogram(10, 4);
+    for (uint32_t value : {0u, 5u, 12u, 15u, 15u, 39u, 40u, 1000u}) histogram.Record(value);
+
+    TEST_ASSERT_EQUAL_UINT32(8, histogram.GetCount());
+    TEST_ASSERT_EQUAL_UINT32(2, histogram.GetBucket(0));
+    TEST_ASSERT_EQUAL_UINT32(3, histogram.GetBucket(1));
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.GetBucket(2));
+    TEST_ASSERT_EQUAL_UINT32(1, histogram.GetBucket(3));
+    TEST_ASSERT_EQUAL_UINT32(2, histogram.GetOverflow());
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.GetMin());
+    TEST_ASSERT_EQUAL_UINT32(1000, histogram.GetMax());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1126.0f / 8.0f, histogram.GetMean());
+
+    // Percentiles report the upper bucket edge, or the max once in the overflow.
+    TEST_ASSERT_EQUAL_UINT32(20, histogram.GetPercentile(0.5f));
+    TEST_ASSERT_EQUAL_UINT32(1000, histogram.GetPercentile(1.0f));
+
+    histogram.Reset();
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.GetCount());
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.GetBucket(1));
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.GetPercentile(0.5f));
+}
+
+void TestFramePacer::TestSetFrequency() {
+    FramePacer pacer(60.0f);
+    pacer.SetFrequency(120.0f);
+    TEST_ASSERT_EQUAL_FLOAT(120.0f, pacer.GetFrequency());
+    TEST_ASSERT_TRUE(pacer.GetPeriodNanos() == 8333333ull);
+
+    pacer.SetSpinMicros(250);
+    TEST_ASSERT_EQUAL_UINT32(250, pacer.GetSpinMicros());
+}
+
+// ========== Functionality Tests ==========
+
+void TestFramePacer::TestHitsDeadlines() {
+    FakeClockPacer pacer(100.0f);
+    const float first = pacer.WaitForNextFrame();
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, first);
+
+    for (int i = 0; i < 50; ++i) {
+        pacer.Work(3000000);
+        pacer.WaitForNextFrame();
+    }
+
+    // Sleeps cover all but the spin window, and the spin lands within one clock tick.
+    TEST_ASSERT_EQUAL_UINT32(50, pacer.sleeps);
+    TEST_ASSERT_EQUAL_UINT32(50, pacer.GetFrameCount());
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.GetMissedFrames());
+    TEST_ASSERT_TRUE(pacer.GetLatenessHistogram().GetMax() <= 1);
+    TEST_ASSERT_TRUE(pacer.GetFrameTimeHistogram().GetMin() >= 9998);
+    TEST_ASSERT_TRUE(pacer.GetFrameTimeHistogram().GetMax() <= 10002);
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, 0.01f, pacer.GetDeltaSeconds());
+}
+
+void TestFramePacer::TestSleepOvershootIsSpunOut() {
+    FakeClockPacer pacer(100.0f);
+    pacer.SetSpinMicros(1000);
+    pacer.overshoot = 800000;   // Less than the spin window.
+    pacer.WaitForNextFrame();
+
+    for (int i = 0; i < 10; ++i) pacer.WaitForNextFrame();
+    TEST_ASSERT_TRUE(pacer.GetLatenessHistogram().GetMax() <= 1);
+
+    // An overshoot past the deadline shows up as lateness, not as drift.
+    pacer.overshoot = 1500000;
+    pacer.ResetStats();
+    for (int i = 0; i < 10; ++i) pacer.WaitForNextFrame();
+    TEST_ASSERT_TRUE(pacer.GetLatenessHistogram().GetMin() >= 499);
+    TEST_ASSERT_TRUE(pacer.GetLatenessHistogram().GetMax() <= 502);
+    TEST_ASSERT_TRUE(pacer.GetFrameTimeHistogram().GetMin() >= 9999);
+    TEST_ASSERT_TRUE(pacer.GetFrameTimeHistogram().GetMax() <= 10502);
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.GetMissedFrames());
+}
+
+void TestFramePacer::TestMissedFrames() {
+    FakeClockPacer pacer(100.0f);
+    pacer.WaitForNextFrame();
+
+    // A 35 ms frame at 100 Hz misses the 20 and 30 ms deadlines and restarts the schedule.
+    pacer.Work(35000000);
+    pacer.WaitForNextFrame();
+    TEST_ASSERT_EQUAL_UINT32(2, pacer.GetMissedFrames());
+    TEST_ASSERT_EQUAL_UINT32(1, pacer.GetMissedHistogram().GetBucket(2));
+
+    // The next frame is paced a full period after the late one, not squeezed in.
+    pacer.WaitForNextFrame();
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, 0.01f, pacer.GetDeltaSeconds());
+    TEST_ASSERT_EQUAL_UINT32(2, pacer.GetMissedFrames());
+
+    // A frame late by less than a period is not a miss; the following wait shortens instead.
+    pacer.Work(14000000);
+    pacer.WaitForNextFrame();
+    TEST_ASSERT_EQUAL_UINT32(2, pacer.GetMissedFrames());
+    pacer.WaitForNextFrame();
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, 0.006f, pacer.GetDeltaSeconds());
+}
+
+void TestFramePacer::TestFixedStep() {
+    FakeClockPacer pacer(50.0f);
+    TimeStep step(100.0f);
+    pacer.SetFixedStep(&step);
+    pacer.WaitForNextFrame();
+
+    // 20 ms frames feed two 10 ms steps each.
+    int steps = 0;
+    for (int i = 0; i < 5; ++i) {
+        pacer.WaitForNextFrame();
+        while (step.ConsumeStep()) ++steps;
+    }
+
+    TEST_ASSERT_EQUAL_INT(10, steps);
+    TEST_ASSERT_TRUE(step.GetAlpha() < 0.01f);
+
+    pacer.SetFixedStep(nullptr);
+    pacer.WaitForNextFrame();
+    TEST_ASSERT_FALSE(step.ConsumeStep());
+}
+
+void TestFramePacer::TestExportJson() {
+    FakeClockPacer pacer(100.0f);
+    pacer.WaitForNextFrame();
+    pacer.WaitForNextFrame();
+    pacer.Work(25000000);
+    pacer.WaitForNextFrame();
+
+    const std::string json = pacer.ExportJson();
+    TEST_ASSERT_TRUE(json.front() == '{' && json.back() == '}');
+    TEST_ASSERT_TRUE(json.find("\"frames\":2") != std::string::npos);
+    TEST_ASSERT_TRUE(json.find("\"missed\":1") != std::string::npos);
+    TEST_ASSERT_TRUE(json.find("\"frame_time_us\":{\"width\":100,\"count\":2") != std::string::npos);
+    TEST_ASSERT_TRUE(json.find("\"lateness_us\":{") != std::string::npos);
+    TEST_ASSERT_TRUE(json.find("\"missed_per_overrun\":{") != std::string::npos);
+}
+
+void TestFramePacer::TestRealClock() {
+    FramePacer pacer(200.0f);
+    const uint64_t start = ptx::Time::Nanos();
+    pacer.WaitForNextFrame();
+    for (int i = 0; i < 10; ++i) pacer.WaitForNextFrame();
+    const uint64_t elapsed = ptx::Time::Nanos() - start;
+
+    // Ten 5 ms periods; never early, generous upper bound for loaded machines.
+    TEST_ASSERT_TRUE(elapsed >= 50000000ull);
+    TEST_ASSERT_TRUE(elapsed < 250000000ull);
+    TEST_ASSERT_EQUAL_UINT32(10, pacer.GetFrameCount());
+}
+
+// ========== Edge Cases ==========
+
+void TestFramePacer::TestEdgeCases() {
+    // Non-positive frequencies are ignored.
+    FramePacer pacer(0.0f);
+    TEST_ASSERT_EQUAL_FLOAT(60.0f, pacer.GetFrequency());
+    pacer.SetFrequency(-5.0f);
+    TEST_ASSERT_EQUAL_FLOAT(60.0f, pacer.GetFrequency());
+
+    // Restart makes the next wait return immediately without recording a frame.
+    FakeClockPacer fake(100.0f);
+    fake.WaitForNextFrame();
+    fake.WaitForNextFrame();
+    fake.Work(500000000);
+    fake.Restart();
+    const float restarted = fake.WaitForNextFrame();
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, restarted);
+    TEST_ASSERT_EQUAL_UINT32(1, fake.GetFrameCount());
+    TEST_ASSERT_EQUAL_UINT32(0, fake.GetMissedFrames());
+
+    // Zero spin window: pure sleep still reaches the deadline.
+    fake.SetSpinMicros(0);
+    fake.WaitForNextFrame();
+    TEST_ASSERT_TRUE(fake.GetLatenessHistogram().GetMax() <= 1);
+
+    // Degenerate histograms clamp to one bucket of width one.
+    FrameHistogram tiny(0, 0);
+    TEST_ASSERT_EQUAL_UINT32(1, tiny.GetBucketCount());
+    TEST_ASSERT_EQUAL_UINT32(1, tiny.GetBucketWidth());
+    tiny.Record(3);
+    TEST_ASSERT_EQUAL_UINT32(1, tiny.GetOverflow());
+    TEST_ASSERT_EQUAL_UINT32(0, tiny.GetBucket(7));
+}
+
+// ========== Test Runner ==========
+
+void TestFramePacer::RunAllTests() {
+    RUN_TEST(TestConstructor);
+    RUN_TEST(TestHistogram);
+    RUN_TEST(TestSetFrequency);
+    RUN_TEST(TestHitsDeadlines);
+    RUN_TEST(TestSleepOvershootIsSpunOut);
+    RUN_TEST(TestMissedFrames);
+    RUN_TEST(TestFixedStep);
+    RUN_TEST(TestExportJson);
+    RUN_TEST(TestRealClock);
+    RUN_TEST(TestEdgeCases);
+}
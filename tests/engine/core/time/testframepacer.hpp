@@ -0,0 +1,45 @@
+/**
+ * @file testframepacer.hpp
+ * @brief Unit tests for the FramePacer and FrameHistogram classes.
+ *
+ * Pacing tests run against a fake clock so deadlines, lateness and misses are exact.
+ *
+ * @date 18/10/2026
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/core/time/framepacer.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestFramePacer
+ * @brief Contains static test methods for the FramePacer class.
+ */
+class TestFramePacer {
+public:
+    // Constructor tests
+    static void TestConstructor();
+
+    // Method tests
+    static void TestHistogram();
+    static void TestSetFrequency();
+
+    // Functionality tests
+    static void TestHitsDeadlines();
+    static void TestSleepOvershootIsSpunOut();
+    static void TestMissedFrames();
+    static void TestFixedStep();
+    static void TestExportJson();
+    static void TestRealClock();
+
+    // Edge case tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
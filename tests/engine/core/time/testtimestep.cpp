@@ -19,6 +19,48 @@ void TestTimeStep::TestSetFrequency() {
 
 // ========== IsReady Tests ==========
 
+// ========== Accumulate Tests ==========
+
+void TestTimeStep::TestAccumulate() {
+    TimeStep ts(100.0f);  // 10ms steps
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, ts.GetStepSeconds());
+    TEST_ASSERT_FALSE(ts.ConsumeStep());
+
+    ts.Accumulate(0.025f);
+    ts.Accumulate(-1.0f);  // Ignored
+    TEST_ASSERT_TRUE(ts.ConsumeStep());
+    TEST_ASSERT_TRUE(ts.ConsumeStep());
+    TEST_ASSERT_FALSE(ts.ConsumeStep());
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.5f, ts.GetAlpha());
+}
+
+void TestTimeStep::TestAccumulateClamp() {
+    TimeStep ts(100.0f);  // 10ms steps
+    TEST_ASSERT_EQUAL(5, ts.GetMaxSteps());
+
+    // A 10 s stall runs at most the capped number of catch-up steps.
+    ts.Accumulate(10.0f);
+    int steps = 0;
+    while (ts.ConsumeStep()) ++steps;
+    TEST_ASSERT_EQUAL(5, steps);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, ts.GetAlpha());
+
+    // The cap applies to the running total, not each call.
+    ts.SetMaxSteps(2);
+    ts.Accumulate(0.015f);
+    ts.Accumulate(0.015f);
+    steps = 0;
+    while (ts.ConsumeStep()) ++steps;
+    TEST_ASSERT_EQUAL(2, steps);
+
+    // Zero removes the cap.
+    ts.SetMaxSteps(0);
+    ts.Accumulate(1.0f);
+    steps = 0;
+    while (ts.ConsumeStep()) ++steps;
+    TEST_ASSERT_TRUE(steps >= 99 && steps <= 100);
+}
+
 // ========== Edge Case Tests ==========
 
 // ========== Test Runner ==========
@@ -44,6 +86,8 @@ void TestTimeStep::TestParameterizedConstructor() {
 void TestTimeStep::RunAllTests() {
 
     RUN_TEST(TestSetFrequency);
+    RUN_TEST(TestAccumulate);
+    RUN_TEST(TestAccumulateClamp);
 
     RUN_TEST(TestDefaultConstructor);
     RUN_TEST(TestEdgeCases);
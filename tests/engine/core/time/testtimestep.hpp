@@ -28,6 +28,10 @@ public:
 
     // IsReady tests
 
+    // Accumulate tests
+    static void TestAccumulate();
+    static void TestAccumulateClamp();
+
     // Edge case tests
 
     /**
@@ -0,0 +1,346 @@
+/**
+ * @file testprofiler.cpp
+ * @brief Implementation of Profiler unit tests.
+ */
+
+#include "testprofiler.hpp"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ptx::Profiler;
+using ptx::ProfilerMode;
+using ptx::ProfileStats;
+using ptx::TraceScope;
+
+namespace {
+
+const char* kTracePath = "ptx_test_profiler_trace.json";
+
+// Puts the singleton back to its defaults and empties every ring
+void ResetProfiler() {
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.Disable();
+    profiler.SetMode(ProfilerMode::Detailed);
+    profiler.SetTraceBufferSize(16384);
+    profiler.CollectTraceEvents();
+    profiler.ClearStats();
+}
+
+/**
+ * @brief Minimal JSON syntax checker for the exported trace.
+ */
+class JSONChecker {
+public:
+    explicit JSONChecker(const std::string& text) : text(text), pos(0) {}
+
+    bool IsValid() {
+        SkipSpace();
+        if (!Value()) return false;
+        SkipSpace();
+        return pos == text.size();
+    }
+
+private:
+    const std::string& text;
+    size_t pos;
+
+    void SkipSpace() {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) ++pos;
+    }
+
+    bool Consume(char c) {
+        SkipSpace();
+        if (pos < text.size() && text[pos] == c) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    bool Literal(const char* word) {
+        const std::string expected(word);
+        if (text.compare(pos, expected.size(), expected) != 0) return false;
+        pos += expected.size();
+        return true;
+    }
+
+    bool String() {
+        if (!Consume('"')) return false;
+        while (pos < text.size()) {
+            const char c = text[pos++];
+            if (c == '"') return true;
+            if (static_cast<unsigned char>(c) < 0x20) return false;
+            if (c == '\\') {
+                if (pos >= text.size()) return false;
+                const char escaped = text[pos++];
+                if (escaped == 'u') {
+                    for (int i = 0; i < 4; ++i) {
+                        if (pos >= text.size() || !std::isxdigit(static_cast<unsigned char>(text[pos++]))) return false;
+                    }
+                } else if (std::string("\"\\/bfnrt").find(escaped) == std::string::npos) {
+                    return false;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool Number() {
+        const size_t start = pos;
+        if (pos < text.size() && text[pos] == '-') ++pos;
+        size_t digits = 0;
+        while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) ++pos, ++digits;
+        if (digits == 0) return false;
+        if (pos < text.size() && text[pos] == '.') {
+            ++pos;
+            digits = 0;
+            while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) ++pos, ++digits;
+            if (digits == 0) return false;
+        }
+        return pos > start;
+    }
+
+    bool Value() {
+        SkipSpace();
+        if (pos >= text.size()) return false;
+
+        const char c = text[pos];
+        if (c == '{') {
+            ++pos;
+            if (Consume('}')) return true;
+            do {
+                if (!String() || !Consume(':') || !Value()) return false;
+            } while (Consume(','));
+            return Consume('}');
+        }
+        if (c == '[') {
+            ++pos;
+            if (Consume(']')) return true;
+            do {
+                if (!Value()) return false;
+            } while (Consume(','));
+            return Consume(']');
+        }
+        if (c == '"') return String();
+        if (c == 't') return Literal("true");
+        if (c == 'f') return Literal("false");
+        if (c == 'n') return Literal("null");
+        return Number();
+    }
+};
+
+// Reads the "tid" field from one exported trace line
+int ReadTid(const std::string& line) {
+    const size_t at = line.find("\"tid\": ");
+    return at == std::string::npos ? -1 : std::atoi(line.c_str() + at + 7);
+}
+
+} // namespace
+
+// ========== Method Tests ==========
+
+void TestProfiler::TestInternName() {
+    const uint32_t first = Profiler::InternName("ProfilerTest.Intern");
+    const uint32_t second = Profiler::InternName(std::string("ProfilerTest.Intern"));
+    const uint32_t other = Profiler::InternName("ProfilerTest.InternOther");
+
+    TEST_ASSERT_EQUAL_UINT32(first, second);
+    TEST_ASSERT_TRUE(first != other);
+    TEST_ASSERT_EQUAL_STRING("ProfilerTest.Intern", Profiler::GetInstance().GetName(first).c_str());
+}
+
+void TestProfiler::TestSetMode() {
+    ResetProfiler();
+    Profiler& profiler = Profiler::GetInstance();
+
+    profiler.SetMode(ProfilerMode::LowOverhead);
+    TEST_ASSERT_FALSE(profiler.IsRecording());  // Still disabled
+
+    profiler.Enable();
+    TEST_ASSERT_TRUE(profiler.IsRecording());
+
+    profiler.SetMode(ProfilerMode::Detailed);
+    TEST_ASSERT_FALSE(profiler.IsRecording());
+
+    ResetProfiler();
+}
+
+// ========== Functionality Tests ==========
+
+void TestProfiler::TestMultiThreadStats() {
+    ResetProfiler();
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.SetMode(ProfilerMode::LowOverhead);
+    profiler.Enable();
+
+    const uint32_t scopeId = Profiler::InternName("ProfilerTest.Scope");
+    const uint32_t fixedId = Profiler::InternName("ProfilerTest.Fixed");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&profiler, scopeId, fixedId]() {
+            for (int i = 0; i < 500; ++i) {
+                TraceScope scope(scopeId);
+                const uint64_t start = Profiler::Now();
+                profiler.RecordEvent(fixedId, start, start + 2000);  // 2 us
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const size_t drained = profiler.CollectTraceEvents();
+    TEST_ASSERT_EQUAL_size_t(4000, drained);
+
+    const ProfileStats* scopeStats = profiler.GetStats("ProfilerTest.Scope");
+    const ProfileStats* fixedStats = profiler.GetStats("ProfilerTest.Fixed");
+    TEST_ASSERT_NOT_NULL(scopeStats);
+    TEST_ASSERT_NOT_NULL(fixedStats);
+    TEST_ASSERT_EQUAL(2000, scopeStats->callCount);
+    TEST_ASSERT_EQUAL(2000, fixedStats->callCount);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, static_cast<float>(fixedStats->minTime));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, static_cast<float>(fixedStats->maxTime));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, static_cast<float>(fixedStats->avgTime));
+
+    ResetProfiler();
+}
+
+void TestProfiler::TestDroppedEvents() {
+    ResetProfiler();
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.SetTraceBufferSize(16);
+
+    const uint32_t nameId = Profiler::InternName("ProfilerTest.Dropped");
+    const uint64_t droppedBefore = profiler.GetDroppedTraceEvents();
+
+    // A fresh thread picks up the 16-event ring; nothing drains it while it writes
+    std::thread writer([&profiler, nameId]() {
+        for (int i = 0; i < 40; ++i) {
+            profiler.RecordEvent(nameId, 0, 1000);
+        }
+    });
+    writer.join();
+
+    const uint64_t dropped = profiler.GetDroppedTraceEvents() - droppedBefore;
+    TEST_ASSERT_EQUAL_UINT32(24, static_cast<uint32_t>(dropped));
+
+    const size_t drained = profiler.CollectTraceEvents();
+    TEST_ASSERT_EQUAL_size_t(16, drained);
+
+    // The count survives the release of the exited thread's ring
+    const uint64_t droppedAfter = profiler.GetDroppedTraceEvents() - droppedBefore;
+    TEST_ASSERT_EQUAL_UINT32(24, static_cast<uint32_t>(droppedAfter));
+
+    const ProfileStats* stats = profiler.GetStats("ProfilerTest.Dropped");
+    TEST_ASSERT_NOT_NULL(stats);
+    TEST_ASSERT_EQUAL(16, stats->callCount);
+
+    ResetProfiler();
+}
+
+void TestProfiler::TestRetiredRingsReleased() {
+    ResetProfiler();
+    Profiler& profiler = Profiler::GetInstance();
+
+    const uint32_t nameId = Profiler::InternName("ProfilerTest.Retired");
+    const size_t ringsBefore = profiler.GetTraceThreadCount();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([&profiler, nameId]() {
+            profiler.RecordEvent(nameId, 0, 1000);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // Exited threads keep their rings until the collector has drained them
+    const size_t ringsHeld = profiler.GetTraceThreadCount();
+    TEST_ASSERT_EQUAL_size_t(ringsBefore + 3, ringsHeld);
+
+    const size_t drained = profiler.CollectTraceEvents();
+    TEST_ASSERT_EQUAL_size_t(3, drained);
+
+    const size_t ringsAfter = profiler.GetTraceThreadCount();
+    TEST_ASSERT_EQUAL_size_t(ringsBefore, ringsAfter);
+
+    ResetProfiler();
+}
+
+void TestProfiler::TestTraceRoundTrip() {
+    ResetProfiler();
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.SetMode(ProfilerMode::LowOverhead);
+    profiler.Enable();
+
+    TEST_ASSERT_TRUE(profiler.StartTrace(kTracePath, 1));
+    TEST_ASSERT_TRUE(profiler.IsTracing());
+    TEST_ASSERT_FALSE(profiler.StartTrace(kTracePath, 1));  // Already open
+
+    const uint32_t nameId = Profiler::InternName("ProfilerTest.Traced \"quoted\"");
+    std::thread worker([&profiler, nameId]() {
+        profiler.SetThreadName("ProfilerWorker");
+        for (int i = 0; i < 10; ++i) {
+            TraceScope scope(nameId);
+        }
+    });
+    worker.join();
+
+    profiler.StopTrace();
+    TEST_ASSERT_FALSE(profiler.IsTracing());
+
+    std::ifstream file(kTracePath);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    file.close();
+    std::remove(kTracePath);
+
+    const std::string text = buffer.str();
+    JSONChecker checker(text);
+    TEST_ASSERT_TRUE(checker.IsValid());
+
+    // One thread_name record for the worker lane, and every event on that lane
+    int workerTid = -1;
+    int metadataCount = 0;
+    int eventCount = 0;
+    bool eventsOnWorkerLane = true;
+    std::vector<int> eventTids;
+
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.find("\"name\": \"thread_name\"") != std::string::npos &&
+            line.find("\"args\": {\"name\": \"ProfilerWorker\"}") != std::string::npos) {
+            workerTid = ReadTid(line);
+            ++metadataCount;
+        } else if (line.find("\"name\": \"ProfilerTest.Traced \\\"quoted\\\"\"") != std::string::npos &&
+                   line.find("\"ph\": \"X\"") != std::string::npos) {
+            eventTids.push_back(ReadTid(line));
+            ++eventCount;
+        }
+    }
+    for (int tid : eventTids) {
+        if (tid != workerTid) eventsOnWorkerLane = false;
+    }
+
+    TEST_ASSERT_EQUAL(1, metadataCount);
+    TEST_ASSERT_TRUE(workerTid > 0);
+    TEST_ASSERT_EQUAL(10, eventCount);
+    TEST_ASSERT_TRUE(eventsOnWorkerLane);
+
+    ResetProfiler();
+}
+
+void TestProfiler::RunAllTests() {
+    RUN_TEST(TestInternName);
+    RUN_TEST(TestSetMode);
+
+    RUN_TEST(TestMultiThreadStats);
+    RUN_TEST(TestDroppedEvents);
+    RUN_TEST(TestRetiredRingsReleased);
+    RUN_TEST(TestTraceRoundTrip);
+}
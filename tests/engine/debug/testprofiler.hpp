@@ -0,0 +1,36 @@
+/**
+ * @file testprofiler.hpp
+ * @brief Unit tests for the Profiler low-overhead trace path.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/debug/profiler.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestProfiler
+ * @brief Contains static test methods for the Profiler class.
+ */
+class TestProfiler {
+public:
+    // Method tests
+    static void TestInternName();
+    static void TestSetMode();
+
+    // Functionality tests
+    static void TestMultiThreadStats();
+    static void TestDroppedEvents();
+    static void TestRetiredRingsReleased();
+    static void TestTraceRoundTrip();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
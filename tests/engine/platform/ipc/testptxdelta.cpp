@@ -0,0 +1,284 @@
+/**
+ * @file testptxdelta.cpp
+ * @brief Implementation of ptx_delta unit tests.
+ */
+
+#include "testptxdelta.hpp"
+#include <ptx/core/platform/randomstream.hpp>
+#include <vector>
+
+namespace {
+
+constexpr const char* kDeltaName = "/ptx_test_delta";
+constexpr size_t kFrameBytes = 300;   // 100 RGB888 pixels
+
+void Release(PTXDelta& delta) {
+#if PTX_HAS_POSIX_SHM
+    if (delta.base) munmap(delta.base, delta.size);
+    if (delta.fd >= 0) close(delta.fd);
+    shm_unlink(kDeltaName);
+#endif
+    delta = PTXDelta{};
+}
+
+std::vector<uint8_t> Ramp(size_t bytes) {
+    std::vector<uint8_t> frame(bytes);
+    for (size_t i = 0; i < bytes; ++i) frame[i] = uint8_t(i * 7);
+    return frame;
+}
+
+PTXDeltaPacket Header(const std::vector<uint8_t>& packet, size_t bytes) {
+    PTXDeltaPacket header{};
+    TEST_ASSERT_TRUE(ptx_delta_header(packet.data(), bytes, header));
+    return header;
+}
+
+PTXDeltaSpan SpanAt(const std::vector<uint8_t>& packet, size_t offset) {
+    PTXDeltaSpan span{};
+    std::memcpy(&span, packet.data() + offset, sizeof(span));
+    return span;
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestPTXDelta::TestChannelInit() {
+#if PTX_HAS_POSIX_SHM
+    PTXDelta delta;
+    TEST_ASSERT_TRUE(ptx_delta_init(delta, kDeltaName, 48));
+    TEST_ASSERT_EQUAL_UINT32(0x55434443, delta.hdr->magic);
+    TEST_ASSERT_EQUAL_UINT32(48, delta.hdr->frame_bytes);
+    TEST_ASSERT_EQUAL_UINT32(PTX_DELTA_SLOTS, delta.hdr->slot_count);
+    TEST_ASSERT_TRUE(delta.hdr->capacity >= ptx_delta_bound(48));
+
+    PTXDeltaReader reader;
+    TEST_ASSERT_TRUE(ptx_delta_attach(reader, kDeltaName));
+    TEST_ASSERT_TRUE(ptx_delta_latest_frame(reader) == 0);
+
+    std::vector<uint8_t> packet(ptx_delta_bound(48));
+    TEST_ASSERT_EQUAL_size_t(0, ptx_delta_read_packet(reader, 1, packet.data(), packet.size()));
+
+    ptx_delta_detach(reader);
+    Release(delta);
+#endif
+}
+
+// ========== Method Tests ==========
+
+void TestPTXDelta::TestFirstDiff() {
+    const std::vector<uint8_t> a = Ramp(100);
+    TEST_ASSERT_EQUAL_size_t(100, ptx_delta_first_diff(a.data(), a.data(), 0, 100));
+
+    // Positions at the start, inside and across the 16- and 8-byte steps, and in the tail.
+    const size_t positions[] = {0, 7, 15, 16, 17, 40, 63, 95, 99};
+    for (size_t position : positions) {
+        std::vector<uint8_t> b = a;
+        b[position] ^= 0x80;
+        TEST_ASSERT_EQUAL_size_t(position, ptx_delta_first_diff(a.data(), b.data(), 0, 100));
+        TEST_ASSERT_EQUAL_size_t(position, ptx_delta_first_diff(a.data(), b.data(), position, 100));
+        if (position > 0) TEST_ASSERT_EQUAL_size_t(position, ptx_delta_first_diff(a.data(), b.data(), 0, position + 1));
+        TEST_ASSERT_EQUAL_size_t(100, ptx_delta_first_diff(a.data(), b.data(), position + 1, 100));
+    }
+}
+
+void TestPTXDelta::TestEncodeSpans() {
+    const std::vector<uint8_t> prev = Ramp(kFrameBytes);
+    std::vector<uint8_t> packet(ptx_delta_bound(kFrameBytes));
+
+    // Identical frames: a header and no spans.
+    size_t bytes = ptx_delta_encode(prev.data(), prev.data(), kFrameBytes, 3, 2, 1, packet.data(), packet.size());
+    TEST_ASSERT_EQUAL_size_t(sizeof(PTXDeltaPacket), bytes);
+    PTXDeltaPacket header = Header(packet, bytes);
+    TEST_ASSERT_EQUAL_UINT32(PTX_DELTA_SPANS, header.kind);
+    TEST_ASSERT_EQUAL_UINT32(0, header.span_count);
+    TEST_ASSERT_TRUE(header.frame == 2 && header.base_frame == 1);
+
+    // One channel of pixel 10 changed: the span covers that whole pixel.
+    std::vector<uint8_t> cur = prev;
+    cur[31] = 0xAB;
+    bytes = ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3, 2, 1, packet.data(), packet.size());
+    TEST_ASSERT_EQUAL_size_t(sizeof(PTXDeltaPacket) + sizeof(PTXDeltaSpan) + 3, bytes);
+    header = Header(packet, bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, header.span_count);
+
+    const PTXDeltaSpan span = SpanAt(packet, sizeof(PTXDeltaPacket));
+    TEST_ASSERT_EQUAL_UINT32(30, span.offset);
+    TEST_ASSERT_EQUAL_UINT32(3, span.length);
+
+    std::vector<uint8_t> local = prev;
+    TEST_ASSERT_TRUE(ptx_delta_apply(local.data(), kFrameBytes, packet.data(), bytes));
+    TEST_ASSERT_TRUE(local == cur);
+}
+
+void TestPTXDelta::TestEncodeFallsBackToFull() {
+    const std::vector<uint8_t> prev = Ramp(kFrameBytes);
+    std::vector<uint8_t> cur(kFrameBytes);
+    for (size_t i = 0; i < kFrameBytes; ++i) cur[i] = uint8_t(prev[i] + 1);
+
+    std::vector<uint8_t> packet(ptx_delta_bound(kFrameBytes));
+    size_t bytes = ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3, 5, 4, packet.data(), packet.size());
+    TEST_ASSERT_EQUAL_size_t(ptx_delta_bound(kFrameBytes), bytes);
+    PTXDeltaPacket header = Header(packet, bytes);
+    TEST_ASSERT_EQUAL_UINT32(PTX_DELTA_FULL, header.kind);
+    TEST_ASSERT_TRUE(header.base_frame == 0);
+
+    // Every other pixel changed: spans would cost more than the frame.
+    cur = prev;
+    for (size_t p = 0; p < kFrameBytes / 3; p += 2) cur[p * 3] ^= 0xFF;
+    bytes = ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3, 5, 4, packet.data(), packet.size());
+    TEST_ASSERT_EQUAL_UINT32(PTX_DELTA_FULL, Header(packet, bytes).kind);
+
+    // No previous frame.
+    bytes = ptx_delta_encode(nullptr, cur.data(), kFrameBytes, 3, 1, 0, packet.data(), packet.size());
+    TEST_ASSERT_EQUAL_UINT32(PTX_DELTA_FULL, Header(packet, bytes).kind);
+
+    std::vector<uint8_t> local(kFrameBytes, 0);
+    TEST_ASSERT_TRUE(ptx_delta_apply(local.data(), kFrameBytes, packet.data(), bytes));
+    TEST_ASSERT_TRUE(local == cur);
+}
+
+void TestPTXDelta::TestSpanMerging() {
+    const std::vector<uint8_t> prev = Ramp(kFrameBytes);
+    std::vector<uint8_t> packet(ptx_delta_bound(kFrameBytes));
+
+    // Pixels 10 and 12: the 3-byte gap is cheaper than a second span header.
+    std::vector<uint8_t> cur = prev;
+    cur[30] ^= 1;
+    cur[36] ^= 1;
+    size_t bytes = ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3, 2, 1, packet.data(), packet.size());
+    TEST_ASSERT_EQUAL_UINT32(1, Header(packet, bytes).span_count);
+    PTXDeltaSpan span = SpanAt(packet, sizeof(PTXDeltaPacket));
+    TEST_ASSERT_EQUAL_UINT32(30, span.offset);
+    TEST_ASSERT_EQUAL_UINT32(9, span.length);
+
+    // Pixels 10 and 20 stay separate.
+    cur = prev;
+    cur[30] ^= 1;
+    cur[60] ^= 1;
+    bytes = ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3, 2, 1, packet.data(), packet.size());
+    TEST_ASSERT_EQUAL_UINT32(2, Header(packet, bytes).span_count);
+    span = SpanAt(packet, sizeof(PTXDeltaPacket) + sizeof(PTXDeltaSpan) + 3);
+    TEST_ASSERT_EQUAL_UINT32(60, span.offset);
+    TEST_ASSERT_EQUAL_UINT32(3, span.length);
+}
+
+// ========== Functionality Tests ==========
+
+void TestPTXDelta::TestRandomRoundTrip() {
+    ptx::RandomStream random(1234, 0);
+    std::vector<uint8_t> prev = Ramp(kFrameBytes);
+    std::vector<uint8_t> packet(ptx_delta_bound(kFrameBytes));
+
+    for (int iteration = 0; iteration < 300; ++iteration) {
+        std::vector<uint8_t> cur = prev;
+        const int runs = random.Int(0, 12);
+        for (int r = 0; r < runs; ++r) {
+            const int start = random.Int(0, int(kFrameBytes) - 1);
+            const int length = random.Int(1, 20);
+            for (int i = start; i < start + length && i < int(kFrameBytes); ++i) cur[i] = uint8_t(random.Next());
+        }
+
+        const size_t bytes = ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3,
+                                              iteration + 2, iteration + 1, packet.data(), packet.size());
+        TEST_ASSERT_TRUE(bytes > 0 && bytes <= ptx_delta_bound(kFrameBytes));
+
+        std::vector<uint8_t> local = prev;
+        TEST_ASSERT_TRUE(ptx_delta_apply(local.data(), kFrameBytes, packet.data(), bytes));
+        TEST_ASSERT_TRUE(local == cur);
+        prev = cur;
+    }
+}
+
+void TestPTXDelta::TestChannelCatchUp() {
+#if PTX_HAS_POSIX_SHM
+    PTXDelta delta;
+    TEST_ASSERT_TRUE(ptx_delta_init(delta, kDeltaName, kFrameBytes));
+    PTXDeltaReader reader;
+    TEST_ASSERT_TRUE(ptx_delta_attach(reader, kDeltaName));
+
+    std::vector<uint8_t> prev = Ramp(kFrameBytes);
+    TEST_ASSERT_EQUAL_size_t(ptx_delta_bound(kFrameBytes), ptx_delta_publish(delta, nullptr, prev.data(), 1));
+
+    // A cursor blinking over a static frame.
+    auto step = [&](uint64_t frame) {
+        std::vector<uint8_t> cur = prev;
+        cur[150] = uint8_t(frame);
+        const size_t bytes = ptx_delta_publish(delta, prev.data(), cur.data(), frame);
+        TEST_ASSERT_EQUAL_size_t(sizeof(PTXDeltaPacket) + sizeof(PTXDeltaSpan) + 3, bytes);
+        prev = cur;
+    };
+    for (uint64_t frame = 2; frame <= 5; ++frame) step(frame);
+
+    std::vector<uint8_t> local(kFrameBytes, 0);
+    std::vector<uint8_t> scratch(ptx_delta_bound(kFrameBytes));
+    uint64_t frame = 0;
+    TEST_ASSERT_TRUE(ptx_delta_catch_up(reader, local.data(), frame, scratch.data(), scratch.size()));
+    TEST_ASSERT_TRUE(frame == 5);
+    TEST_ASSERT_TRUE(local == prev);
+
+    // Bridges forward single packets.
+    TEST_ASSERT_EQUAL_size_t(47, ptx_delta_read_packet(reader, 5, scratch.data(), scratch.size()));
+
+    // Falling further behind than the ring holds requires a full resync.
+    for (uint64_t next = 6; next <= 6 + PTX_DELTA_SLOTS; ++next) step(next);
+    TEST_ASSERT_FALSE(ptx_delta_catch_up(reader, local.data(), frame, scratch.data(), scratch.size()));
+    TEST_ASSERT_TRUE(frame == 5);
+
+    ptx_delta_detach(reader);
+    Release(delta);
+#endif
+}
+
+// ========== Edge Cases ==========
+
+void TestPTXDelta::TestEdgeCases() {
+    const std::vector<uint8_t> prev = Ramp(kFrameBytes);
+    std::vector<uint8_t> cur = prev;
+    cur[0] ^= 1;
+
+    // Destination smaller than a full packet is refused.
+    std::vector<uint8_t> packet(ptx_delta_bound(kFrameBytes));
+    TEST_ASSERT_EQUAL_size_t(0, ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3, 2, 1,
+                                                 packet.data(), packet.size() - 1));
+
+    const size_t bytes = ptx_delta_encode(prev.data(), cur.data(), kFrameBytes, 3, 2, 1, packet.data(), packet.size());
+    std::vector<uint8_t> local = prev;
+
+    // Wrong frame size, truncated packet and bad magic.
+    TEST_ASSERT_FALSE(ptx_delta_apply(local.data(), kFrameBytes - 3, packet.data(), bytes));
+    TEST_ASSERT_FALSE(ptx_delta_apply(local.data(), kFrameBytes, packet.data(), bytes - 1));
+    std::vector<uint8_t> broken(packet.begin(), packet.begin() + bytes);
+    broken[0] ^= 0xFF;
+    TEST_ASSERT_FALSE(ptx_delta_apply(local.data(), kFrameBytes, broken.data(), bytes));
+
+    // A span past the end of the frame is rejected before anything is written.
+    broken.assign(packet.begin(), packet.begin() + bytes);
+    PTXDeltaSpan span{uint32_t(kFrameBytes - 1), 3};
+    std::memcpy(broken.data() + sizeof(PTXDeltaPacket), &span, sizeof(span));
+    TEST_ASSERT_FALSE(ptx_delta_apply(local.data(), kFrameBytes, broken.data(), bytes));
+    TEST_ASSERT_TRUE(local == prev);
+
+    TEST_ASSERT_FALSE(ptx_delta_apply(nullptr, kFrameBytes, packet.data(), bytes));
+
+#if PTX_HAS_POSIX_SHM
+    shm_unlink(kDeltaName);
+    PTXDeltaReader reader;
+    TEST_ASSERT_FALSE(ptx_delta_attach(reader, kDeltaName));
+    uint64_t frame = 0;
+    TEST_ASSERT_FALSE(ptx_delta_catch_up(reader, local.data(), frame, packet.data(), packet.size()));
+#endif
+}
+
+// ========== Test Runner ==========
+
+void TestPTXDelta::RunAllTests() {
+    RUN_TEST(TestChannelInit);
+    RUN_TEST(TestFirstDiff);
+    RUN_TEST(TestEncodeSpans);
+    RUN_TEST(TestEncodeFallsBackToFull);
+    RUN_TEST(TestSpanMerging);
+    RUN_TEST(TestRandomRoundTrip);
+    RUN_TEST(TestChannelCatchUp);
+    RUN_TEST(TestEdgeCases);
+}
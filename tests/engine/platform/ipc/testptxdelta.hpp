@@ -0,0 +1,42 @@
+/**
+ * @file testptxdelta.hpp
+ * @brief Unit tests for ptx_delta span encoding and the delta channel.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/platform/ipc/ptx_shm_reader.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestPTXDelta
+ * @brief Contains static test methods for the ptx_delta helpers.
+ */
+class TestPTXDelta {
+public:
+    // Constructor & lifecycle tests
+    static void TestChannelInit();
+
+    // Method tests
+    static void TestFirstDiff();
+    static void TestEncodeSpans();
+    static void TestEncodeFallsBackToFull();
+    static void TestSpanMerging();
+
+    // Functionality tests
+    static void TestRandomRoundTrip();
+    static void TestChannelCatchUp();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
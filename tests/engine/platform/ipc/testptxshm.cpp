@@ -0,0 +1,185 @@
+/**
+ * @file testptxshm.cpp
+ * @brief Implementation of ptx_shm unit tests.
+ */
+
+#include "testptxshm.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr const char* kFbName   = "/ptx_test_shm_fb";
+constexpr const char* kCtrlName = "/ptx_test_shm_ctrl";
+
+void Release(PTXShm& shm) {
+#if PTX_HAS_POSIX_SHM
+    if (shm.fb_base) munmap(shm.fb_base, shm.fb_size);
+    if (shm.ctrl_base) munmap(shm.ctrl_base, shm.ctrl_size);
+    if (shm.fb_fd >= 0) close(shm.fb_fd);
+    if (shm.ctrl_fd >= 0) close(shm.ctrl_fd);
+    shm_unlink(kFbName);
+    shm_unlink(kCtrlName);
+#endif
+    shm = PTXShm{};
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestPTXShm::TestInitLayout() {
+#if PTX_HAS_POSIX_SHM
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, 8, 2, kCtrlName));
+
+    // The v1 layout is unchanged; the extension area follows the ring.
+    uint8_t* base = static_cast<uint8_t*>(shm.fb_base);
+    TEST_ASSERT_TRUE(shm.fb_payload_base == base + sizeof(PTXFbHeader));
+    TEST_ASSERT_TRUE(reinterpret_cast<uint8_t*>(shm.fb_notify) == base + ptx_fb_ext_offset(2, 24, 3));
+    TEST_ASSERT_EQUAL_size_t(ptx_fb_ext_offset(2, 24, 3) + ptx_fb_ext_bytes(3), shm.fb_size);
+
+    TEST_ASSERT_TRUE(ptx_fb_find_notify(shm.fb_base, shm.fb_size) == shm.fb_notify);
+    TEST_ASSERT_TRUE(ptx_ctrl_find_notify(shm.ctrl_base, shm.ctrl_size) == shm.ctrl_notify);
+    TEST_ASSERT_TRUE(reinterpret_cast<uint8_t*>(shm.ctrl_notify) == static_cast<uint8_t*>(shm.ctrl_base) + sizeof(PTXCtrl));
+
+    TEST_ASSERT_EQUAL_UINT32(0, shm.fb_notify->event.load());
+    TEST_ASSERT_TRUE(ptx_fb_frame(shm) == 0);
+#if PTX_HAS_FUTEX
+    TEST_ASSERT_EQUAL_UINT32(PTX_NOTIFY_FUTEX, shm.fb_notify->flags);
+#endif
+
+    Release(shm);
+#endif
+}
+
+// ========== Method Tests ==========
+
+void TestPTXShm::TestFrameCounter() {
+#if PTX_HAS_POSIX_SHM
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, 4, 1, kCtrlName));
+
+    const std::vector<uint8_t> frame(12, 0x11);
+    uint64_t previousTime = 0;
+
+    for (uint64_t n = 1; n <= 5; ++n) {
+        ptx_publish_rgb888(shm, 4, 1, frame.data());
+
+        const PTXFbFrameInfo& info = shm.fb_frames[shm.fb_hdr->active_index];
+        TEST_ASSERT_TRUE(info.frame == n);
+        TEST_ASSERT_TRUE(info.publish_ns >= previousTime);
+        TEST_ASSERT_TRUE(ptx_fb_frame(shm) == n);
+        previousTime = info.publish_ns;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(5, shm.fb_notify->event.load());
+    TEST_ASSERT_TRUE(previousTime > 0);
+
+    Release(shm);
+#endif
+}
+
+void TestPTXShm::TestNotifyWaitTimeout() {
+#if PTX_HAS_POSIX_SHM
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, 4, 1, kCtrlName));
+
+    const auto start = std::chrono::steady_clock::now();
+    const uint32_t seen = shm.fb_notify->event.load();
+    TEST_ASSERT_EQUAL_UINT32(seen, ptx_notify_wait(shm.fb_notify, seen, 10));
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    TEST_ASSERT_TRUE(elapsed >= std::chrono::milliseconds(9));
+    TEST_ASSERT_EQUAL_UINT32(0, shm.fb_notify->waiters.load());
+
+    // An event that already happened returns immediately.
+    const std::vector<uint8_t> frame(12, 0);
+    ptx_publish_rgb888(shm, 4, 1, frame.data());
+    TEST_ASSERT_EQUAL_UINT32(seen + 1, ptx_notify_wait(shm.fb_notify, seen, 1000));
+
+    Release(shm);
+#endif
+}
+
+void TestPTXShm::TestCtrlNotify() {
+#if PTX_HAS_POSIX_SHM
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, 4, 1, kCtrlName));
+
+    const uint32_t seen = shm.ctrl_notify->event.load();
+    shm.ctrl->pause = 1;
+    ptx_ctrl_notify(shm);
+
+    TEST_ASSERT_EQUAL_UINT32(seen + 1, ptx_notify_wait(shm.ctrl_notify, seen, 1000));
+    // Frame publishing does not touch the control block's event.
+    TEST_ASSERT_EQUAL_UINT32(0, shm.fb_notify->event.load());
+
+    Release(shm);
+#endif
+}
+
+// ========== Functionality Tests ==========
+
+void TestPTXShm::TestNotifyWakeup() {
+#if PTX_HAS_POSIX_SHM
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, 4, 1, kCtrlName));
+
+    const uint32_t seen = shm.fb_notify->event.load();
+    uint32_t woke = seen;
+    std::chrono::steady_clock::duration waited{};
+
+    std::thread consumer([&]() {
+        const auto start = std::chrono::steady_clock::now();
+        woke = ptx_notify_wait(shm.fb_notify, seen, 5000);
+        waited = std::chrono::steady_clock::now() - start;
+    });
+
+    // Give the consumer time to block, then publish.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const std::vector<uint8_t> frame(12, 0x22);
+    ptx_publish_rgb888(shm, 4, 1, frame.data());
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(seen + 1, woke);
+    TEST_ASSERT_TRUE(waited < std::chrono::milliseconds(2000));
+    TEST_ASSERT_EQUAL_UINT32(0, shm.fb_notify->waiters.load());
+
+    Release(shm);
+#endif
+}
+
+// ========== Edge Cases ==========
+
+void TestPTXShm::TestEdgeCases() {
+    // Mappings without the extension area (older producers) report no wakeup block.
+    std::vector<uint8_t> legacy(sizeof(PTXFbHeader) + 3 * ptx_onebuf_bytes(1, 12), 0);
+    PTXFbHeader* header = reinterpret_cast<PTXFbHeader*>(legacy.data());
+    header->height = 1;
+    header->stride_bytes = 12;
+    header->buffer_count = 3;
+    TEST_ASSERT_NULL(ptx_fb_find_notify(legacy.data(), legacy.size()));
+    TEST_ASSERT_NULL(ptx_fb_find_notify(nullptr, 0));
+    TEST_ASSERT_NULL(ptx_ctrl_find_notify(legacy.data(), sizeof(PTXCtrl)));
+
+    // Null blocks are ignored.
+    ptx_notify_signal(nullptr);
+    TEST_ASSERT_EQUAL_UINT32(7, ptx_notify_wait(nullptr, 7, 0));
+
+    PTXShm unmapped;
+    TEST_ASSERT_TRUE(ptx_fb_frame(unmapped) == 0);
+    ptx_ctrl_notify(unmapped);
+}
+
+// ========== Test Runner ==========
+
+void TestPTXShm::RunAllTests() {
+    RUN_TEST(TestInitLayout);
+    RUN_TEST(TestFrameCounter);
+    RUN_TEST(TestNotifyWaitTimeout);
+    RUN_TEST(TestCtrlNotify);
+    RUN_TEST(TestNotifyWakeup);
+    RUN_TEST(TestEdgeCases);
+}
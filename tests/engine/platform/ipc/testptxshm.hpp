@@ -0,0 +1,43 @@
+/**
+ * @file testptxshm.hpp
+ * @brief Unit tests for the ptx_shm IPC helpers.
+ *
+ * Covers the extension area layout, per-buffer frame counters and timestamps,
+ * and blocking consumer wakeups.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/platform/ipc/ptx_shm.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestPTXShm
+ * @brief Contains static test methods for the ptx_shm helpers.
+ */
+class TestPTXShm {
+public:
+    // Constructor & lifecycle tests
+    static void TestInitLayout();
+
+    // Method tests
+    static void TestFrameCounter();
+    static void TestNotifyWaitTimeout();
+    static void TestCtrlNotify();
+
+    // Functionality tests
+    static void TestNotifyWakeup();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,426 @@
+/**
+ * @file testptxshmreader.cpp
+ * @brief Implementation of ptx_shm reader unit tests.
+ */
+
+#include "testptxshmreader.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if PTX_HAS_POSIX_SHM
+#include <sys/wait.h>
+#endif
+
+namespace {
+
+constexpr const char* kRegName  = "/ptx_test_rd_reg";
+constexpr const char* kCtrlName = "/ptx_test_rd_ctrl";
+constexpr uint32_t kCamIndex    = 9017;   // Channels: /ptx_fb9017, /ptx_geom9017
+constexpr const char* kFbName   = "/ptx_fb9017";
+constexpr const char* kGeomName = "/ptx_geom9017";
+constexpr uint32_t kPixels      = 32;
+
+void Unlink() {
+#if PTX_HAS_POSIX_SHM
+    shm_unlink(kRegName);
+    shm_unlink(kCtrlName);
+    shm_unlink(kFbName);
+    shm_unlink(kGeomName);
+#endif
+}
+
+void Release(PTXShm& shm) {
+#if PTX_HAS_POSIX_SHM
+    if (shm.fb_base) munmap(shm.fb_base, shm.fb_size);
+    if (shm.ctrl_base) munmap(shm.ctrl_base, shm.ctrl_size);
+    if (shm.fb_fd >= 0) close(shm.fb_fd);
+    if (shm.ctrl_fd >= 0) close(shm.ctrl_fd);
+#endif
+    shm = PTXShm{};
+}
+
+void Release(PTXGeom& geom) {
+#if PTX_HAS_POSIX_SHM
+    if (geom.base) munmap(geom.base, geom.size);
+    if (geom.fd >= 0) close(geom.fd);
+#endif
+    geom = PTXGeom{};
+}
+
+void Release(PTXRegistry& reg) {
+#if PTX_HAS_POSIX_SHM
+    if (reg.base) munmap(reg.base, reg.size);
+    if (reg.fd >= 0) close(reg.fd);
+#endif
+    reg = PTXRegistry{};
+}
+
+void Publish(PTXShm& shm, uint8_t value) {
+    const std::vector<uint8_t> frame(kPixels * 3, value);
+    ptx_publish_rgb888(shm, kPixels, 1, frame.data());
+}
+
+bool Uniform(const uint8_t* data, size_t bytes, uint8_t value) {
+    for (size_t i = 0; i < bytes; ++i) {
+        if (data[i] != value) return false;
+    }
+    return true;
+}
+
+std::vector<float> Geometry() {
+    std::vector<float> xy(kPixels * 2);
+    for (uint32_t i = 0; i < kPixels; ++i) {
+        xy[i * 2] = float(i);
+        xy[i * 2 + 1] = float(i) * 0.5f;
+    }
+    return xy;
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestPTXShmReader::TestAttachRegistry() {
+#if PTX_HAS_POSIX_SHM
+    Unlink();
+    PTXRegistry reg;
+    TEST_ASSERT_TRUE(ptx_registry_init(reg, kRegName, 2));
+    ptx_registry_set(reg, 0, "Main", kCamIndex, kPixels, 8, 4);
+
+    PTXRegistryReader reader;
+    TEST_ASSERT_TRUE(ptx_registry_attach(reader, kRegName));
+    TEST_ASSERT_EQUAL_UINT32(2, reader.capacity);
+
+    // Records are invisible until the count is published.
+    TEST_ASSERT_EQUAL_UINT32(0, ptx_registry_count(reader));
+    TEST_ASSERT_NULL(ptx_registry_camera(reader, 0));
+
+    ptx_registry_publish(reg, 1);
+    TEST_ASSERT_EQUAL_UINT32(1, ptx_registry_count(reader));
+
+    const PTXRegCamera* cam = ptx_registry_camera(reader, 0);
+    TEST_ASSERT_NOT_NULL(cam);
+    TEST_ASSERT_EQUAL_STRING("Main", cam->name);
+    TEST_ASSERT_EQUAL_UINT32(kPixels, cam->pixel_count);
+    TEST_ASSERT_EQUAL_UINT32(8, cam->width);
+
+    char fb[32], geom[32], delta[32];
+    ptx_registry_channel_names(*cam, fb, sizeof(fb), geom, sizeof(geom));
+    TEST_ASSERT_EQUAL_STRING(kFbName, fb);
+    TEST_ASSERT_EQUAL_STRING(kGeomName, geom);
+
+    // The producer's prefix is recorded in the registry and drives all three names.
+    TEST_ASSERT_EQUAL_STRING("/ptx_", ptx_registry_stream_prefix(reader));
+    ptx_registry_channel_names(*cam, fb, sizeof(fb), geom, sizeof(geom), "/ptx_test_", delta, sizeof(delta));
+    TEST_ASSERT_EQUAL_STRING("/ptx_test_fb9017", fb);
+    TEST_ASSERT_EQUAL_STRING("/ptx_test_geom9017", geom);
+    TEST_ASSERT_EQUAL_STRING("/ptx_test_delta9017", delta);
+
+    ptx_registry_detach(reader);
+    TEST_ASSERT_NULL(reader.hdr);
+    Release(reg);
+    Unlink();
+#endif
+}
+
+// ========== Method Tests ==========
+
+void TestPTXShmReader::TestLatestView() {
+#if PTX_HAS_POSIX_SHM
+    Unlink();
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, kPixels, 1, kCtrlName));
+
+    PTXFbReader reader;
+    TEST_ASSERT_TRUE(ptx_fb_attach(reader, kFbName));
+    TEST_ASSERT_NOT_NULL(reader.frames);
+
+    PTXFrameView view;
+    TEST_ASSERT_FALSE(ptx_fb_latest(reader, view));   // nothing published yet
+
+    Publish(shm, 0x20);
+    Publish(shm, 0x40);
+
+    TEST_ASSERT_TRUE(ptx_fb_latest(reader, view));
+    TEST_ASSERT_EQUAL_UINT32(kPixels, view.width);
+    TEST_ASSERT_EQUAL_size_t(kPixels * 3, view.bytes);
+    TEST_ASSERT_TRUE(view.frame == 2);
+    TEST_ASSERT_TRUE(view.publish_ns > 0);
+    TEST_ASSERT_TRUE(Uniform(view.data, view.bytes, 0x40));
+    TEST_ASSERT_TRUE(ptx_fb_still_valid(reader, view));
+    TEST_ASSERT_TRUE(ptx_fb_latest_frame(reader) == 2);
+
+    ptx_fb_detach(reader);
+    Release(shm);
+    Unlink();
+#endif
+}
+
+void TestPTXShmReader::TestStillValidAfterWrap() {
+#if PTX_HAS_POSIX_SHM
+    Unlink();
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, kPixels, 1, kCtrlName));
+    PTXFbReader reader;
+    TEST_ASSERT_TRUE(ptx_fb_attach(reader, kFbName));
+
+    Publish(shm, 1);
+    PTXFrameView view;
+    TEST_ASSERT_TRUE(ptx_fb_latest(reader, view));
+
+    // Publishing into the other ring slots leaves the view intact...
+    const uint32_t others = shm.fb_hdr->buffer_count - 1;
+    for (uint32_t i = 0; i < others; ++i) Publish(shm, uint8_t(2 + i));
+    TEST_ASSERT_TRUE(ptx_fb_still_valid(reader, view));
+
+    // ...until the ring wraps onto the viewed slot.
+    Publish(shm, 9);
+    TEST_ASSERT_FALSE(ptx_fb_still_valid(reader, view));
+
+    ptx_fb_detach(reader);
+    Release(shm);
+    Unlink();
+#endif
+}
+
+void TestPTXShmReader::TestGeometryRead() {
+#if PTX_HAS_POSIX_SHM
+    Unlink();
+    PTXGeom geom;
+    TEST_ASSERT_TRUE(ptx_geom_init(geom, kGeomName, kPixels));
+
+    PTXGeomReader reader;
+    TEST_ASSERT_TRUE(ptx_geom_attach(reader, kGeomName));
+    TEST_ASSERT_EQUAL_UINT32(kPixels, ptx_geom_count(reader));
+
+    std::vector<float> out(kPixels * 2, -1.0f);
+    uint64_t generation = 0;
+    TEST_ASSERT_FALSE(ptx_geom_read(reader, out.data(), kPixels, &generation));   // not published
+
+    const std::vector<float> xy = Geometry();
+    ptx_geom_publish(geom, xy.data(), kPixels);
+
+    TEST_ASSERT_TRUE(ptx_geom_read(reader, out.data(), kPixels, &generation));
+    TEST_ASSERT_TRUE(generation == 1);
+    TEST_ASSERT_TRUE(ptx_geom_reader_generation(reader) == 1);
+    for (size_t i = 0; i < xy.size(); ++i) TEST_ASSERT_EQUAL_FLOAT(xy[i], out[i]);
+
+    // Unchanged geometry keeps the generation, so consumers can skip re-reading.
+    TEST_ASSERT_FALSE(ptx_geom_publish_if_changed(geom, xy.data(), kPixels));
+    TEST_ASSERT_TRUE(ptx_geom_reader_generation(reader) == 1);
+
+    TEST_ASSERT_FALSE(ptx_geom_read(reader, out.data(), kPixels - 1));   // count mismatch
+
+    ptx_geom_detach(reader);
+    Release(geom);
+    Unlink();
+#endif
+}
+
+// ========== Functionality Tests ==========
+
+void TestPTXShmReader::TestCopyNeverTorn() {
+#if PTX_HAS_POSIX_SHM
+    Unlink();
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, kPixels, 1, kCtrlName));
+    PTXFbReader reader;
+    TEST_ASSERT_TRUE(ptx_fb_attach(reader, kFbName));
+    Publish(shm, 0);
+
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (int n = 1; n <= 4000; ++n) Publish(shm, uint8_t(n));
+        done.store(true);
+    });
+
+    std::vector<uint8_t> copy(kPixels * 3);
+    int copies = 0;
+    bool torn = false;
+    while (!done.load()) {
+        PTXFrameView info;
+        if (!ptx_fb_copy_latest(reader, copy.data(), copy.size(), &info)) continue;
+        ++copies;
+        // Every frame is a single value derived from its number; a mix means a torn copy.
+        if (!Uniform(copy.data(), copy.size(), uint8_t(info.frame - 1))) torn = true;
+    }
+    writer.join();
+
+    TEST_ASSERT_FALSE(torn);
+    TEST_ASSERT_GREATER_THAN(0, copies);
+
+    ptx_fb_detach(reader);
+    Release(shm);
+    Unlink();
+#endif
+}
+
+void TestPTXShmReader::TestCrossProcessProducer() {
+#if PTX_HAS_POSIX_SHM
+    Unlink();
+    int go[2];
+    TEST_ASSERT_EQUAL_INT(0, pipe(go));
+
+    const pid_t pid = fork();
+    TEST_ASSERT_TRUE(pid >= 0);
+
+    if (pid == 0) {
+        // Producer: channels first, then the registry, then frames once the consumer is attached.
+        close(go[1]);
+        PTXShm shm;
+        PTXGeom geom;
+        PTXRegistry reg;
+        if (!ptx_shm_init(shm, kFbName, kPixels, 1, kCtrlName) || !ptx_geom_init(geom, kGeomName, kPixels) ||
+            !ptx_registry_init(reg, kRegName, 1)) {
+            _exit(1);
+        }
+        const std::vector<float> xy = Geometry();
+        ptx_geom_publish(geom, xy.data(), kPixels);
+        ptx_registry_set(reg, 0, "Remote", kCamIndex, kPixels, kPixels, 1);
+        ptx_registry_publish(reg, 1);
+
+        char byte = 0;
+        if (read(go[0], &byte, 1) != 1) _exit(2);
+        for (int n = 1; n <= 50; ++n) {
+            Publish(shm, uint8_t(n * 3));
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+        _exit(0);
+    }
+
+    close(go[0]);
+
+    PTXRegistryReader registry;
+    bool attached = false;
+    for (int i = 0; i < 2000 && !attached; ++i) {
+        attached = ptx_registry_attach(registry, kRegName) && ptx_registry_count(registry) == 1;
+        if (!attached) {
+            ptx_registry_detach(registry);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    TEST_ASSERT_TRUE(attached);
+
+    const PTXRegCamera* cam = ptx_registry_camera(registry, 0);
+    TEST_ASSERT_NOT_NULL(cam);
+    TEST_ASSERT_EQUAL_STRING("Remote", cam->name);
+
+    char fbName[32], geomName[32];
+    ptx_registry_channel_names(*cam, fbName, sizeof(fbName), geomName, sizeof(geomName));
+
+    PTXFbReader fb;
+    PTXGeomReader geom;
+    TEST_ASSERT_TRUE(ptx_fb_attach(fb, fbName));
+    TEST_ASSERT_TRUE(ptx_geom_attach(geom, geomName));
+
+    std::vector<float> xy(kPixels * 2);
+    TEST_ASSERT_TRUE(ptx_geom_read(geom, xy.data(), kPixels));
+    const std::vector<float> expected = Geometry();
+    for (size_t i = 0; i < xy.size(); ++i) TEST_ASSERT_EQUAL_FLOAT(expected[i], xy[i]);
+
+    TEST_ASSERT_EQUAL_INT(1, int(write(go[1], "g", 1)));
+
+    std::vector<uint8_t> copy(kPixels * 3);
+    uint64_t last = 0;
+    int received = 0;
+    bool torn = false;
+    while (last < 50 && ptx_fb_wait(fb, last, 2000)) {
+        PTXFrameView info;
+        if (!ptx_fb_copy_latest(fb, copy.data(), copy.size(), &info)) continue;
+        if (info.frame <= last || !Uniform(copy.data(), copy.size(), uint8_t(info.frame * 3))) torn = true;
+        last = info.frame;
+        ++received;
+    }
+
+    int status = -1;
+    waitpid(pid, &status, 0);
+    close(go[1]);
+
+    TEST_ASSERT_FALSE(torn);
+    TEST_ASSERT_TRUE(last == 50);
+    TEST_ASSERT_GREATER_THAN(0, received);
+    TEST_ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    ptx_fb_detach(fb);
+    ptx_geom_detach(geom);
+    ptx_registry_detach(registry);
+    Unlink();
+#endif
+}
+
+// ========== Edge Cases ==========
+
+void TestPTXShmReader::TestEdgeCases() {
+#if PTX_HAS_POSIX_SHM
+    Unlink();
+
+    // Nothing published under these names.
+    PTXRegistryReader registry;
+    PTXFbReader fb;
+    PTXGeomReader geom;
+    TEST_ASSERT_FALSE(ptx_registry_attach(registry, kRegName));
+    TEST_ASSERT_FALSE(ptx_fb_attach(fb, kFbName));
+    TEST_ASSERT_FALSE(ptx_geom_attach(geom, kGeomName));
+    TEST_ASSERT_EQUAL_UINT32(0, ptx_registry_count(registry));
+
+    // Detached readers are inert.
+    PTXFrameView view;
+    uint8_t byte = 0;
+    TEST_ASSERT_FALSE(ptx_fb_latest(fb, view));
+    TEST_ASSERT_FALSE(ptx_fb_still_valid(fb, view));
+    TEST_ASSERT_FALSE(ptx_fb_copy_latest(fb, &byte, 1));
+    TEST_ASSERT_FALSE(ptx_fb_wait(fb, 0, 0));
+
+    // A mapping with the wrong magic is rejected.
+    PTXGeom other;
+    TEST_ASSERT_TRUE(ptx_geom_init(other, kFbName, 4));
+    TEST_ASSERT_FALSE(ptx_fb_attach(fb, kFbName));
+    Release(other);
+    shm_unlink(kFbName);
+
+    // Waiting with nothing new times out; a too-small destination is refused.
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, kFbName, kPixels, 1, kCtrlName));
+    TEST_ASSERT_TRUE(ptx_fb_attach(fb, kFbName));
+    Publish(shm, 5);
+    TEST_ASSERT_FALSE(ptx_fb_wait(fb, 1, 5));
+    TEST_ASSERT_TRUE(ptx_fb_wait(fb, 0, 0));
+    TEST_ASSERT_FALSE(ptx_fb_copy_latest(fb, &byte, 1));
+
+    ptx_fb_detach(fb);
+    Release(shm);
+
+    // A registry without the prefix trailer reads as the default prefix at full capacity.
+    const size_t legacyBytes = sizeof(PTXRegHeader) + 2 * sizeof(PTXRegCamera);
+    const int fd = shm_open(kRegName, O_CREAT | O_RDWR, 0666);
+    TEST_ASSERT_TRUE(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, ftruncate(fd, legacyBytes));
+    void* base = mmap(nullptr, legacyBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    TEST_ASSERT_TRUE(base != MAP_FAILED);
+    reinterpret_cast<PTXRegHeader*>(base)->magic = 0x55435247;
+
+    TEST_ASSERT_TRUE(ptx_registry_attach(registry, kRegName));
+    TEST_ASSERT_NULL(registry.ext);
+    TEST_ASSERT_EQUAL_UINT32(2, registry.capacity);
+    TEST_ASSERT_EQUAL_STRING("/ptx_", ptx_registry_stream_prefix(registry));
+
+    ptx_registry_detach(registry);
+    munmap(base, legacyBytes);
+    close(fd);
+    Unlink();
+#endif
+}
+
+// ========== Test Runner ==========
+
+void TestPTXShmReader::RunAllTests() {
+    RUN_TEST(TestAttachRegistry);
+    RUN_TEST(TestLatestView);
+    RUN_TEST(TestStillValidAfterWrap);
+    RUN_TEST(TestGeometryRead);
+    RUN_TEST(TestCopyNeverTorn);
+    RUN_TEST(TestCrossProcessProducer);
+    RUN_TEST(TestEdgeCases);
+}
@@ -0,0 +1,44 @@
+/**
+ * @file testptxshmreader.hpp
+ * @brief Unit tests for the ptx_shm consumer reader.
+ *
+ * Covers registry discovery, zero-copy and copied frame reads, torn-read
+ * detection, geometry reads and a producer running in a separate process.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/platform/ipc/ptx_shm_reader.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestPTXShmReader
+ * @brief Contains static test methods for the ptx_shm reader.
+ */
+class TestPTXShmReader {
+public:
+    // Constructor & lifecycle tests
+    static void TestAttachRegistry();
+
+    // Method tests
+    static void TestLatestView();
+    static void TestStillValidAfterWrap();
+    static void TestGeometryRead();
+
+    // Functionality tests
+    static void TestCopyNeverTorn();
+    static void TestCrossProcessProducer();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
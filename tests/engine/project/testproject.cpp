@@ -0,0 +1,217 @@
+/**
+ * @file testproject.cpp
+ * @brief Implementation of Project unit tests.
+ */
+
+#include "testproject.hpp"
+#include <ptx/systems/render/core/camera.hpp>
+#include <ptx/systems/render/core/pixelgroup.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Controller that records the first red value it displays.
+ */
+class RecordingController : public Controller {
+public:
+    explicit RecordingController(CameraManager* cameras) : Controller(cameras) {}
+
+    void Initialize() override {}
+
+    void Display() override {
+        // Read after the delay so a live read would see the next frame's colors.
+        if (delayMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+
+        CameraBase* camera = cameras->GetCameras()[0];
+        const RGBColor* colors = GetDisplayColors(0, camera->GetPixelGroup());
+        seen.push_back(colors[0].R);
+        threadId = std::this_thread::get_id();
+    }
+
+    int delayMs = 0;
+    std::vector<uint8_t> seen;
+    std::thread::id threadId;
+};
+
+/**
+ * @brief Minimal project counting updates.
+ */
+class CountingProject : public Project {
+public:
+    CountingProject(CameraManager* cameras, Controller* controller) : Project(cameras, controller, 1) {}
+
+    void Initialize() override {}
+
+    int updates = 0;
+    float lastRatio = -1.0f;
+
+protected:
+    void Update(float ratio) override {
+        ++updates;
+        lastRatio = ratio;
+    }
+};
+
+/**
+ * @brief One 4x4 camera, a recording controller and a project.
+ */
+struct TestRig {
+    Transform transform;
+    PixelGroup pixels{16, Vector2D(4, 4), Vector2D(0, 0), 4};
+    Camera camera{&transform, &pixels};
+    CameraBase* list[1] = { &camera };
+    CameraManager manager{list, 1};
+    RecordingController controller{&manager};
+    CountingProject project{&manager, &controller};
+
+    ~TestRig() { project.SetPipelined(false); }
+
+    void Fill(uint8_t red) {
+        for (uint16_t i = 0; i < 16; ++i) *pixels.GetColor(i) = RGBColor(red, 0, 0);
+    }
+};
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestProject::TestConstructor() {
+    TestRig rig;
+    TEST_ASSERT_FALSE(rig.project.IsPipelined());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, rig.project.GetAnimationTime());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, rig.project.GetRenderTime());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, rig.project.GetDisplayTime());
+    TEST_ASSERT_EQUAL_UINT32(0, rig.project.GetStageTiming(Project::FrameStage::Frame).samples);
+}
+
+// ========== Method Tests ==========
+
+void TestProject::TestStageTimings() {
+    TestRig rig;
+    rig.controller.delayMs = 2;
+
+    rig.project.Animate(0.5f);
+    rig.project.Display();
+    rig.project.Display();
+
+    const Project::StageTiming display = rig.project.GetStageTiming(Project::FrameStage::Display);
+    TEST_ASSERT_EQUAL_UINT32(2, display.samples);
+    TEST_ASSERT_TRUE(display.last >= 0.001f);
+    TEST_ASSERT_TRUE(display.max >= display.last);
+    TEST_ASSERT_TRUE(display.average > 0.0f);
+    TEST_ASSERT_EQUAL_FLOAT(display.last, rig.project.GetDisplayTime());
+    TEST_ASSERT_EQUAL_UINT32(1, rig.project.GetStageTiming(Project::FrameStage::Animate).samples);
+
+    rig.project.ResetStageTimings();
+    TEST_ASSERT_EQUAL_UINT32(0, rig.project.GetStageTiming(Project::FrameStage::Display).samples);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, rig.project.GetDisplayTime());
+}
+
+void TestProject::TestFrame() {
+    TestRig rig;
+    rig.project.Frame(0.25f);
+
+    TEST_ASSERT_EQUAL_INT(1, rig.project.updates);
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, rig.project.lastRatio);
+    TEST_ASSERT_EQUAL_size_t(1, rig.controller.seen.size());
+    TEST_ASSERT_EQUAL_UINT32(1, rig.project.GetStageTiming(Project::FrameStage::Render).samples);
+    TEST_ASSERT_EQUAL_UINT32(1, rig.project.GetStageTiming(Project::FrameStage::Frame).samples);
+    TEST_ASSERT_EQUAL_UINT32(0, rig.project.GetStageTiming(Project::FrameStage::Present).samples);
+    TEST_ASSERT_TRUE(rig.project.GetFrameRate() > 0.0f);
+
+    // Parallel rendering goes through the same frame stages.
+    TEST_ASSERT_FALSE(rig.project.IsParallelRender());
+    rig.project.SetParallelRender(true);
+    TEST_ASSERT_TRUE(rig.project.IsParallelRender());
+    rig.project.Frame(0.5f);
+    TEST_ASSERT_EQUAL_INT(2, rig.project.updates);
+    TEST_ASSERT_EQUAL_UINT32(2, rig.project.GetStageTiming(Project::FrameStage::Render).samples);
+}
+
+void TestProject::TestSetPipelined() {
+    TestRig rig;
+    rig.project.SetPipelined(true);
+    TEST_ASSERT_TRUE(rig.project.IsPipelined());
+
+    rig.project.Frame(0.0f);
+    rig.project.Flush();
+    TEST_ASSERT_EQUAL_size_t(1, rig.controller.seen.size());
+    TEST_ASSERT_TRUE(rig.controller.threadId != std::this_thread::get_id());
+    TEST_ASSERT_EQUAL_UINT32(1, rig.project.GetStageTiming(Project::FrameStage::Present).samples);
+    TEST_ASSERT_EQUAL_UINT32(1, rig.project.GetStageTiming(Project::FrameStage::Display).samples);
+
+    // Back to serial: display runs inline again.
+    rig.project.SetPipelined(false);
+    TEST_ASSERT_FALSE(rig.project.IsPipelined());
+    rig.project.Display();
+    TEST_ASSERT_EQUAL_size_t(2, rig.controller.seen.size());
+    TEST_ASSERT_TRUE(rig.controller.threadId == std::this_thread::get_id());
+}
+
+// ========== Functionality Tests ==========
+
+void TestProject::TestPipelinedDisplaysSnapshot() {
+    TestRig rig;
+    rig.controller.delayMs = 3;
+    rig.project.SetPipelined(true);
+
+    // Each frame is overwritten by the "next render" right after the hand-off.
+    for (uint8_t frame = 1; frame <= 5; ++frame) {
+        rig.Fill(frame);
+        rig.project.Display();
+        rig.Fill(static_cast<uint8_t>(100 + frame));
+    }
+    rig.project.Flush();
+
+    TEST_ASSERT_EQUAL_size_t(5, rig.controller.seen.size());
+    for (uint8_t frame = 1; frame <= 5; ++frame) {
+        TEST_ASSERT_EQUAL_UINT8(frame, rig.controller.seen[frame - 1]);
+    }
+}
+
+void TestProject::TestSerialDisplaysLiveColors() {
+    TestRig rig;
+    rig.Fill(42);
+    rig.project.Display();
+    TEST_ASSERT_EQUAL_size_t(1, rig.controller.seen.size());
+    TEST_ASSERT_EQUAL_UINT8(42, rig.controller.seen[0]);
+}
+
+// ========== Edge Cases ==========
+
+void TestProject::TestEdgeCases() {
+    // No controller: Display and Frame still animate and render.
+    TestRig rig;
+    CountingProject project(&rig.manager, nullptr);
+    project.SetPipelined(true);
+    project.Frame(0.5f);
+    project.Flush();
+    TEST_ASSERT_EQUAL_INT(1, project.updates);
+    project.SetPipelined(false);
+
+    // Flushing with nothing in flight returns immediately.
+    rig.project.SetPipelined(true);
+    rig.project.Flush();
+    TEST_ASSERT_EQUAL_size_t(0, rig.controller.seen.size());
+
+    // Toggling twice is harmless.
+    rig.project.SetPipelined(true);
+    rig.project.SetPipelined(false);
+    rig.project.SetPipelined(false);
+    TEST_ASSERT_EQUAL_UINT32(0, rig.project.GetStageTiming(Project::FrameStage::Count).samples);
+}
+
+// ========== Test Runner ==========
+
+void TestProject::RunAllTests() {
+    RUN_TEST(TestConstructor);
+    RUN_TEST(TestStageTimings);
+    RUN_TEST(TestFrame);
+    RUN_TEST(TestSetPipelined);
+    RUN_TEST(TestPipelinedDisplaysSnapshot);
+    RUN_TEST(TestSerialDisplaysLiveColors);
+    RUN_TEST(TestEdgeCases);
+}
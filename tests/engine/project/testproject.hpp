@@ -0,0 +1,41 @@
+/**
+ * @file testproject.hpp
+ * @brief Unit tests for the Project frame loop.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/project/project.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestProject
+ * @brief Contains static test methods for the Project class.
+ */
+class TestProject {
+public:
+    // Constructor & lifecycle tests
+    static void TestConstructor();
+
+    // Method tests
+    static void TestStageTimings();
+    static void TestFrame();
+    static void TestSetPipelined();
+
+    // Functionality tests
+    static void TestPipelinedDisplaysSnapshot();
+    static void TestSerialDisplaysLiveColors();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
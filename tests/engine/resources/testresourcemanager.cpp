@@ -0,0 +1,304 @@
+/**
+ * @file testresourcemanager.cpp
+ * @brief Implementation of ResourceManager unit tests.
+ */
+
+#include "testresourcemanager.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ptx::LoadPriority;
+using ptx::Resource;
+using ptx::ResourceHandle;
+using ptx::ResourceManager;
+
+namespace {
+
+// One resource type per test so a cache entry from one test never satisfies another
+struct CachedResource : Resource {};
+struct DedupResource : Resource {};
+struct BlockingResource : Resource {};
+struct OrderedResource : Resource {};
+struct QueuedResource : Resource {};
+struct NestedResource : Resource {};
+
+/**
+ * @brief Holds a loader thread inside its loader until the test opens it.
+ */
+class LoadGate {
+public:
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        entered = true;
+        changed.notify_all();
+        changed.wait(lock, [this]() { return open; });
+    }
+
+    void WaitUntilEntered() {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this]() { return entered; });
+    }
+
+    void Open() {
+        std::lock_guard<std::mutex> lock(mutex);
+        open = true;
+        changed.notify_all();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool entered = false;
+    bool open = false;
+};
+
+// Finishes outstanding work and drops the loaders registered by the previous test
+void ResetManager(size_t threadCount) {
+    ResourceManager& manager = ResourceManager::GetInstance();
+    manager.WaitForPendingLoads();
+    manager.SetLoaderThreadCount(threadCount);
+    manager.UnloadAllResources();
+}
+
+// Queues a load that parks the single loader thread on the gate
+void BlockLoaderThread(LoadGate& gate) {
+    ResourceManager& manager = ResourceManager::GetInstance();
+    manager.RegisterLoader<BlockingResource>([&gate](const std::string&) {
+        gate.Wait();
+        return std::make_shared<BlockingResource>();
+    });
+    manager.LoadAsync<BlockingResource>("blocker", nullptr, LoadPriority::Critical);
+    gate.WaitUntilEntered();
+}
+
+} // namespace
+
+// ========== Method Tests ==========
+
+void TestResourceManager::TestLoadCachesResource() {
+    ResetManager(0);
+    ResourceManager& manager = ResourceManager::GetInstance();
+
+    std::atomic<int> calls{0};
+    manager.RegisterLoader<CachedResource>([&calls](const std::string&) {
+        ++calls;
+        return std::make_shared<CachedResource>();
+    });
+
+    ResourceHandle<CachedResource> first = manager.Load<CachedResource>("cached");
+    ResourceHandle<CachedResource> second = manager.Load<CachedResource>("cached");
+
+    TEST_ASSERT_TRUE(first.IsValid());
+    TEST_ASSERT_TRUE(first.Get() == second.Get());
+    TEST_ASSERT_TRUE(manager.IsCached<CachedResource>("cached"));
+    TEST_ASSERT_TRUE(manager.GetCached<CachedResource>("cached").Get() == first.Get());
+
+    const size_t cachedCount = manager.GetCachedResourceCount<CachedResource>();
+    const int loaderCalls = calls.load();
+    TEST_ASSERT_EQUAL_size_t(1, cachedCount);
+    TEST_ASSERT_EQUAL(1, loaderCalls);
+
+    ResetManager(0);
+}
+
+// ========== Functionality Tests ==========
+
+void TestResourceManager::TestConcurrentLoadDedup() {
+    ResetManager(0);
+    ResourceManager& manager = ResourceManager::GetInstance();
+
+    std::atomic<int> calls{0};
+    manager.RegisterLoader<DedupResource>([&calls](const std::string&) {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return std::make_shared<DedupResource>();
+    });
+
+    std::mutex resultMutex;
+    std::vector<DedupResource*> results;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&]() {
+            DedupResource* loaded = manager.Load<DedupResource>("shared").Get();
+            std::lock_guard<std::mutex> lock(resultMutex);
+            results.push_back(loaded);
+        });
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        manager.LoadAsync<DedupResource>("shared", [&](ResourceHandle<DedupResource> handle) {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            results.push_back(handle.Get());
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+    manager.WaitForPendingLoads();
+
+    const int loaderCalls = calls.load();
+    const size_t resultCount = results.size();
+    TEST_ASSERT_EQUAL(1, loaderCalls);
+    TEST_ASSERT_EQUAL_size_t(8, resultCount);
+    TEST_ASSERT_NOT_NULL(results[0]);
+    for (DedupResource* loaded : results) {
+        TEST_ASSERT_TRUE(loaded == results[0]);
+    }
+
+    ResetManager(0);
+}
+
+void TestResourceManager::TestPriorityUpgrade() {
+    ResetManager(1);
+    ResourceManager& manager = ResourceManager::GetInstance();
+
+    std::mutex orderMutex;
+    std::vector<std::string> order;
+    manager.RegisterLoader<OrderedResource>([&](const std::string& path) {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(path);
+        return std::make_shared<OrderedResource>();
+    });
+
+    LoadGate gate;
+    BlockLoaderThread(gate);
+
+    // Queued behind the blocker: a normal load, then a streaming load raised to critical
+    std::atomic<int> upgradedCallbacks{0};
+    manager.LoadAsync<OrderedResource>("normal", nullptr, LoadPriority::Normal);
+    manager.LoadAsync<OrderedResource>("upgraded", [&](ResourceHandle<OrderedResource> handle) {
+        if (handle.IsValid()) ++upgradedCallbacks;
+    }, LoadPriority::Streaming);
+    manager.LoadAsync<OrderedResource>("upgraded", [&](ResourceHandle<OrderedResource> handle) {
+        if (handle.IsValid()) ++upgradedCallbacks;
+    }, LoadPriority::Critical);
+
+    const size_t pendingCount = manager.GetPendingLoadCount();
+    TEST_ASSERT_EQUAL_size_t(3, pendingCount);
+
+    gate.Open();
+    manager.WaitForPendingLoads();
+
+    // Loaded once, ahead of the normal load, and both requesters were notified
+    const size_t orderCount = order.size();
+    const int callbacks = upgradedCallbacks.load();
+    TEST_ASSERT_EQUAL_size_t(2, orderCount);
+    TEST_ASSERT_EQUAL_STRING("upgraded", order[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("normal", order[1].c_str());
+    TEST_ASSERT_EQUAL(2, callbacks);
+
+    ResetManager(0);
+}
+
+void TestResourceManager::TestSyncLoadTakesQueuedEntry() {
+    ResetManager(1);
+    ResourceManager& manager = ResourceManager::GetInstance();
+
+    std::atomic<int> calls{0};
+    manager.RegisterLoader<QueuedResource>([&calls](const std::string&) {
+        ++calls;
+        return std::make_shared<QueuedResource>();
+    });
+
+    LoadGate gate;
+    BlockLoaderThread(gate);
+
+    QueuedResource* asyncResult = nullptr;
+    manager.LoadAsync<QueuedResource>("queued", [&asyncResult](ResourceHandle<QueuedResource> handle) {
+        asyncResult = handle.Get();
+    }, LoadPriority::Streaming);
+
+    // The only loader thread is busy, so the synchronous load must run the entry itself
+    ResourceHandle<QueuedResource> handle = manager.Load<QueuedResource>("queued");
+    TEST_ASSERT_TRUE(handle.IsValid());
+    TEST_ASSERT_TRUE(asyncResult == handle.Get());
+
+    gate.Open();
+    manager.WaitForPendingLoads();
+
+    // The stale queue entry is skipped once the loader thread reaches it
+    const int loaderCalls = calls.load();
+    TEST_ASSERT_EQUAL(1, loaderCalls);
+    TEST_ASSERT_TRUE(manager.GetCached<QueuedResource>("queued").Get() == handle.Get());
+
+    ResetManager(0);
+}
+
+void TestResourceManager::TestCallbackCallsLoad() {
+    ResetManager(0);
+    ResourceManager& manager = ResourceManager::GetInstance();
+
+    manager.RegisterLoader<NestedResource>([](const std::string&) {
+        return std::make_shared<NestedResource>();
+    });
+
+    // Callbacks run outside the cache lock, so loading from one must not deadlock
+    std::atomic<bool> nestedLoaded{false};
+    manager.LoadAsync<NestedResource>("outer", [&](ResourceHandle<NestedResource>) {
+        nestedLoaded = manager.Load<NestedResource>("inner").IsValid();
+    });
+    manager.WaitForPendingLoads();
+    TEST_ASSERT_TRUE(nestedLoaded.load());
+
+    // A cached path invokes the callback inline on the calling thread
+    bool cachedNestedLoaded = false;
+    manager.LoadAsync<NestedResource>("outer", [&](ResourceHandle<NestedResource>) {
+        cachedNestedLoaded = manager.Load<NestedResource>("inner2").IsValid();
+    });
+    TEST_ASSERT_TRUE(cachedNestedLoaded);
+
+    const size_t cachedCount = manager.GetCachedResourceCount<NestedResource>();
+    TEST_ASSERT_EQUAL_size_t(3, cachedCount);
+
+    ResetManager(0);
+}
+
+void TestResourceManager::TestStopWithQueuedWork() {
+    ResetManager(1);
+    ResourceManager& manager = ResourceManager::GetInstance();
+
+    manager.RegisterLoader<OrderedResource>([](const std::string&) {
+        return std::make_shared<OrderedResource>();
+    });
+
+    LoadGate gate;
+    BlockLoaderThread(gate);
+
+    std::atomic<int> completed{0};
+    const LoadPriority priorities[3] = {LoadPriority::Critical, LoadPriority::Normal, LoadPriority::Streaming};
+    for (int i = 0; i < 6; ++i) {
+        manager.LoadAsync<OrderedResource>("queued" + std::to_string(i), [&completed](ResourceHandle<OrderedResource> handle) {
+            if (handle.IsValid()) ++completed;
+        }, priorities[i % 3]);
+    }
+
+    // Resizing the pool stops the current threads, which must drain the queue before joining
+    std::thread resizer([&manager]() { manager.SetLoaderThreadCount(2); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    gate.Open();
+    resizer.join();
+
+    const int completedCount = completed.load();
+    const size_t pendingCount = manager.GetPendingLoadCount();
+    const size_t cachedCount = manager.GetCachedResourceCount<OrderedResource>();
+    TEST_ASSERT_EQUAL(6, completedCount);
+    TEST_ASSERT_EQUAL_size_t(0, pendingCount);
+    TEST_ASSERT_EQUAL_size_t(6, cachedCount);
+
+    ResetManager(0);
+}
+
+void TestResourceManager::RunAllTests() {
+    RUN_TEST(TestLoadCachesResource);
+
+    RUN_TEST(TestConcurrentLoadDedup);
+    RUN_TEST(TestPriorityUpgrade);
+    RUN_TEST(TestSyncLoadTakesQueuedEntry);
+    RUN_TEST(TestCallbackCallsLoad);
+    RUN_TEST(TestStopWithQueuedWork);
+}
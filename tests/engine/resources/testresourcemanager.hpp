@@ -0,0 +1,36 @@
+/**
+ * @file testresourcemanager.hpp
+ * @brief Unit tests for the ResourceManager pending-load and loader-pool paths.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/resources/resourcemanager.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestResourceManager
+ * @brief Contains static test methods for the ResourceManager class.
+ */
+class TestResourceManager {
+public:
+    // Method tests
+    static void TestLoadCachesResource();
+
+    // Functionality tests
+    static void TestConcurrentLoadDedup();
+    static void TestPriorityUpgrade();
+    static void TestSyncLoadTakesQueuedEntry();
+    static void TestCallbackCallsLoad();
+    static void TestStopWithQueuedWork();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -4,45 +4,379 @@
  */
 
 #include "testvirtualcontroller.hpp"
+#include <ptx/systems/render/core/camera.hpp>
+#include <ptx/systems/render/core/pixelgroup.hpp>
+#include <vector>
+
+namespace {
+
+constexpr const char* kCtrlName = "/ptx_test_ctrl";
+constexpr const char* kRegName  = "/ptx_test_reg";
+constexpr const char* kPrefix   = "/ptx_test_";  // never the live "/ptx_" streams
+
+/**
+ * @brief One 4x4 camera wrapped in a CameraManager.
+ */
+struct TestRig {
+    Transform transform;
+    PixelGroup pixels{16, Vector2D(4, 4), Vector2D(0, 0), 4};
+    Camera camera{&transform, &pixels};
+    CameraBase* list[1] = { &camera };
+    CameraManager manager{list, 1};
+};
+
+#if PTX_HAS_POSIX_SHM
+/**
+ * @brief Maps an existing SHM object read-only; returns nullptr if absent.
+ */
+const uint8_t* MapExisting(const char* name, size_t& size) {
+    const int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) return nullptr;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) { close(fd); return nullptr; }
+    size = static_cast<size_t>(info.st_size);
+
+    void* base = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return base == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(base);
+}
+#endif
+
+void Unlink() {
+#if PTX_HAS_POSIX_SHM
+    shm_unlink("/ptx_test_fb0");
+    shm_unlink("/ptx_test_geom0");
+    shm_unlink("/ptx_test_delta0");
+    shm_unlink("/ptx_test_fb");
+    shm_unlink("/ptx_test_geom");
+    shm_unlink(kCtrlName);
+    shm_unlink(kRegName);
+#endif
+}
+
+} // namespace
 
 // ========== Constructor Tests ==========
 
 void TestVirtualController::TestDefaultConstructor() {
-    // VirtualController obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Placeholder
+    VirtualController controller(nullptr);
+
+    controller.Display();
+    TEST_ASSERT_EQUAL(0, static_cast<int>(controller.GetGeometryGeneration(0)));
+}
+
+void TestVirtualController::TestParameterizedConstructor() {
+    TestRig rig;
+    VirtualController controller(&rig.manager, kCtrlName, kRegName, kPrefix);
+
+    // Nothing is published before Initialize.
+    TEST_ASSERT_EQUAL(0, static_cast<int>(controller.GetGeometryGeneration(0)));
+    Unlink();
 }
 
 // ========== Method Tests ==========
+
 void TestVirtualController::TestInitialize() {
-    // VirtualController obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Placeholder
+#if PTX_HAS_POSIX_SHM
+    TestRig rig;
+    VirtualController controller(&rig.manager, kCtrlName, kRegName, kPrefix);
+    controller.Initialize();
+
+    // Geometry is published once during Initialize.
+    TEST_ASSERT_EQUAL(1, static_cast<int>(controller.GetGeometryGeneration(0)));
+
+    size_t size = 0;
+    const uint8_t* base = MapExisting("/ptx_test_geom0", size);
+    TEST_ASSERT_NOT_NULL(base);
+
+    const PTXGeomHeader* header = reinterpret_cast<const PTXGeomHeader*>(base);
+    const float* xy = reinterpret_cast<const float*>(base + sizeof(PTXGeomHeader));
+    TEST_ASSERT_EQUAL_UINT32(0x5543474D, header->magic);
+    TEST_ASSERT_EQUAL_UINT32(16, header->count);
+    TEST_ASSERT_TRUE((header->seq.load() & 1ULL) == 1ULL);
+
+    const Vector2D coordinate = rig.pixels.GetCoordinate(5);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, coordinate.X, xy[10]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, coordinate.Y, xy[11]);
+
+    munmap(const_cast<uint8_t*>(base), size);
+    Unlink();
+#endif
 }
+
 void TestVirtualController::TestDisplay() {
-    // VirtualController obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Placeholder
+#if PTX_HAS_POSIX_SHM
+    TestRig rig;
+    VirtualController controller(&rig.manager, kCtrlName, kRegName, kPrefix);
+    controller.Initialize();
+
+    for (uint16_t i = 0; i < 16; ++i) {
+        *rig.pixels.GetColor(i) = RGBColor(i, static_cast<uint8_t>(i * 2), static_cast<uint8_t>(255 - i));
+    }
+    controller.Display();
+
+    size_t size = 0;
+    const uint8_t* base = MapExisting("/ptx_test_fb0", size);
+    TEST_ASSERT_NOT_NULL(base);
+
+    const PTXFbHeader* header = reinterpret_cast<const PTXFbHeader*>(base);
+    TEST_ASSERT_EQUAL_UINT32(16, header->width);
+    TEST_ASSERT_EQUAL_UINT32(1, header->height);
+
+    const size_t onebuf = ptx_onebuf_bytes(header->height, header->stride_bytes);
+    const uint8_t* slot = base + sizeof(PTXFbHeader) + header->active_index * onebuf;
+    const PTXFbBuffer* buffer = reinterpret_cast<const PTXFbBuffer*>(slot);
+    const uint8_t* rgb = slot + sizeof(PTXFbBuffer);
+
+    TEST_ASSERT_TRUE((buffer->seq.load() & 1ULL) == 1ULL);
+    for (uint16_t i = 0; i < 16; ++i) {
+        TEST_ASSERT_EQUAL_UINT8(i, rgb[3 * i + 0]);
+        TEST_ASSERT_EQUAL_UINT8(i * 2, rgb[3 * i + 1]);
+        TEST_ASSERT_EQUAL_UINT8(255 - i, rgb[3 * i + 2]);
+    }
+
+    munmap(const_cast<uint8_t*>(base), size);
+    Unlink();
+#endif
 }
-// ========== Edge Cases ==========
 
-// ========== Test Runner ==========
+void TestVirtualController::TestInvalidateGeometry() {
+#if PTX_HAS_POSIX_SHM
+    TestRig rig;
+    VirtualController controller(&rig.manager, kCtrlName, kRegName, kPrefix);
+    controller.Initialize();
 
-void TestVirtualController::TestParameterizedConstructor() {
-    // VirtualController obj; // Requires constructor parameters
-    
-    // Test method functionality
-    TEST_ASSERT_TRUE(false);
+    // Unchanged coordinates do not bump the generation even when invalidated.
+    controller.InvalidateGeometry();
+    controller.Display();
+    TEST_ASSERT_EQUAL(1, static_cast<int>(controller.GetGeometryGeneration(0)));
+
+    // A camera with a different pixel group of the same size is republished.
+    PixelGroup moved(16, Vector2D(8, 8), Vector2D(1, 1), 4);
+    Camera other(&rig.transform, &moved);
+    rig.list[0] = &other;
+    controller.Display();
+    TEST_ASSERT_EQUAL(2, static_cast<int>(controller.GetGeometryGeneration(0)));
+
+    Unlink();
+#endif
+}
+
+// ========== Functionality Tests ==========
+
+void TestVirtualController::TestGeometryPublishedOnce() {
+#if PTX_HAS_POSIX_SHM
+    TestRig rig;
+    VirtualController controller(&rig.manager, kCtrlName, kRegName, kPrefix);
+    controller.Initialize();
+
+    for (int frame = 0; frame < 5; ++frame) controller.Display();
+    TEST_ASSERT_EQUAL(1, static_cast<int>(controller.GetGeometryGeneration(0)));
+
+    Unlink();
+#endif
 }
 
+void TestVirtualController::TestFbAcquireCommit() {
+#if PTX_HAS_POSIX_SHM
+    PTXShm shm;
+    TEST_ASSERT_TRUE(ptx_shm_init(shm, "/ptx_test_fb", 4, 2, kCtrlName));
+
+    const uint32_t before = shm.fb_hdr->active_index;
+
+    PTXFbSlot slot;
+    uint8_t* data = ptx_fb_acquire(shm, slot);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL_UINT32((before + 1) % shm.fb_hdr->buffer_count, slot.index);
+    TEST_ASSERT_TRUE((slot.buf->seq.load() & 1ULL) == 0ULL);
+
+    // Writing through the slot lands in the ring payload directly.
+    std::memset(data, 0xAB, 4 * 2 * 3);
+    PTXFbBuffer* buffer = slot.buf;
+    const uint32_t index = slot.index;
+    ptx_fb_commit(shm, slot);
+
+    TEST_ASSERT_TRUE((buffer->seq.load() & 1ULL) == 1ULL);
+    TEST_ASSERT_EQUAL_UINT32(index, shm.fb_hdr->active_index);
+    TEST_ASSERT_EQUAL_UINT8(0xAB, ptx_payload_ptr(shm, index, 4, 2)[23]);
+    TEST_ASSERT_NULL(slot.buf);
+
+    // The copying path goes through the same ring.
+    const uint8_t frame[4 * 2 * 3] = { 7 };
+    ptx_publish_rgb888(shm, 4, 2, frame);
+    TEST_ASSERT_EQUAL_UINT32((index + 1) % shm.fb_hdr->buffer_count, shm.fb_hdr->active_index);
+    TEST_ASSERT_EQUAL_UINT8(7, ptx_payload_ptr(shm, shm.fb_hdr->active_index, 4, 2)[0]);
+
+    munmap(shm.fb_base, shm.fb_size);
+    munmap(shm.ctrl_base, shm.ctrl_size);
+    close(shm.fb_fd);
+    close(shm.ctrl_fd);
+    Unlink();
+#endif
+}
+
+void TestVirtualController::TestGeomPublishIfChanged() {
+#if PTX_HAS_POSIX_SHM
+    PTXGeom geom;
+    TEST_ASSERT_TRUE(ptx_geom_init(geom, "/ptx_test_geom", 2));
+    TEST_ASSERT_EQUAL(0, static_cast<int>(ptx_geom_generation(geom)));
+
+    float xy[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    // The first publish always happens, even if the payload is already zero.
+    TEST_ASSERT_TRUE(ptx_geom_publish_if_changed(geom, xy, 2));
+    TEST_ASSERT_EQUAL(1, static_cast<int>(ptx_geom_generation(geom)));
+
+    TEST_ASSERT_FALSE(ptx_geom_publish_if_changed(geom, xy, 2));
+    TEST_ASSERT_EQUAL(1, static_cast<int>(ptx_geom_generation(geom)));
+
+    xy[3] = 1.5f;
+    TEST_ASSERT_TRUE(ptx_geom_publish_if_changed(geom, xy, 2));
+    TEST_ASSERT_EQUAL(2, static_cast<int>(ptx_geom_generation(geom)));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.5f, geom.xy[3]);
+
+    // Unconditional publishing still bumps the generation.
+    ptx_geom_publish(geom, xy, 2);
+    TEST_ASSERT_EQUAL(3, static_cast<int>(ptx_geom_generation(geom)));
+
+    munmap(geom.base, geom.size);
+    close(geom.fd);
+    Unlink();
+#endif
+}
+
+void TestVirtualController::TestDeltaOutput() {
+#if PTX_HAS_POSIX_SHM
+    TestRig rig;
+    VirtualController controller(&rig.manager, kCtrlName, kRegName, kPrefix);
+    TEST_ASSERT_FALSE(controller.IsDeltaOutput());
+    controller.SetDeltaOutput(true);
+    controller.Initialize();
+
+    // The first frame has no predecessor and goes out whole.
+    for (uint16_t i = 0; i < 16; ++i) *rig.pixels.GetColor(i) = RGBColor(10, 20, static_cast<uint8_t>(i));
+    controller.Display();
+    TEST_ASSERT_EQUAL_UINT32(ptx_delta_bound(16 * 3), controller.GetDeltaBytes(0));
+
+    // Unchanged frame: header only. One pixel changed: one 3-byte span.
+    controller.Display();
+    TEST_ASSERT_EQUAL_UINT32(sizeof(PTXDeltaPacket), controller.GetDeltaBytes(0));
+
+    *rig.pixels.GetColor(9) = RGBColor(255, 0, 0);
+    controller.Display();
+    TEST_ASSERT_EQUAL_UINT32(sizeof(PTXDeltaPacket) + sizeof(PTXDeltaSpan) + 3, controller.GetDeltaBytes(0));
+
+    // Chaining the packets reproduces the framebuffer.
+    PTXDeltaReader reader;
+    PTXFbReader fb;
+    TEST_ASSERT_TRUE(ptx_delta_attach(reader, "/ptx_test_delta0"));
+    TEST_ASSERT_TRUE(ptx_fb_attach(fb, "/ptx_test_fb0"));
+
+    std::vector<uint8_t> local(16 * 3, 0), scratch(ptx_delta_bound(16 * 3)), expected(16 * 3);
+    uint64_t frame = 0;
+    TEST_ASSERT_TRUE(ptx_delta_catch_up(reader, local.data(), frame, scratch.data(), scratch.size()));
+    TEST_ASSERT_TRUE(frame == 3);
+    TEST_ASSERT_TRUE(ptx_fb_copy_latest(fb, expected.data(), expected.size()));
+    TEST_ASSERT_TRUE(local == expected);
+    TEST_ASSERT_EQUAL_UINT8(255, local[27]);
+
+    ptx_delta_detach(reader);
+    ptx_fb_detach(fb);
+    Unlink();
+#endif
+}
+
+void TestVirtualController::TestReaderFindsPrefixedChannels() {
+#if PTX_HAS_POSIX_SHM
+    TestRig rig;
+    VirtualController controller(&rig.manager, kCtrlName, kRegName, kPrefix);
+    controller.SetDeltaOutput(true);
+    controller.Initialize();
+
+    for (uint16_t i = 0; i < 16; ++i) *rig.pixels.GetColor(i) = RGBColor(static_cast<uint8_t>(i), 40, 80);
+    controller.Display();
+
+    // A consumer that only knows the registry name finds every channel.
+    PTXRegistryReader registry;
+    TEST_ASSERT_TRUE(ptx_registry_attach(registry, kRegName));
+    TEST_ASSERT_EQUAL_UINT32(1, ptx_registry_count(registry));
+    TEST_ASSERT_EQUAL_STRING(kPrefix, ptx_registry_stream_prefix(registry));
+
+    const PTXRegCamera* cam = ptx_registry_camera(registry, 0);
+    TEST_ASSERT_NOT_NULL(cam);
+
+    char fbName[48], geomName[48], deltaName[48];
+    ptx_registry_channel_names(*cam, fbName, sizeof(fbName), geomName, sizeof(geomName),
+                               ptx_registry_stream_prefix(registry), deltaName, sizeof(deltaName));
+    TEST_ASSERT_EQUAL_STRING("/ptx_test_fb0", fbName);
+    TEST_ASSERT_EQUAL_STRING("/ptx_test_geom0", geomName);
+    TEST_ASSERT_EQUAL_STRING("/ptx_test_delta0", deltaName);
+
+    PTXFbReader fb;
+    PTXGeomReader geom;
+    PTXDeltaReader delta;
+    TEST_ASSERT_TRUE(ptx_fb_attach(fb, fbName));
+    TEST_ASSERT_TRUE(ptx_geom_attach(geom, geomName));
+    TEST_ASSERT_TRUE(ptx_delta_attach(delta, deltaName));
+
+    std::vector<uint8_t> rgb(16 * 3);
+    TEST_ASSERT_TRUE(ptx_fb_copy_latest(fb, rgb.data(), rgb.size()));
+    TEST_ASSERT_EQUAL_UINT8(7, rgb[21]);
+    TEST_ASSERT_EQUAL_UINT8(40, rgb[22]);
+
+    std::vector<float> xy(16 * 2);
+    TEST_ASSERT_TRUE(ptx_geom_read(geom, xy.data(), 16));
+    const Vector2D coordinate = rig.pixels.GetCoordinate(5);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, coordinate.X, xy[10]);
+
+    std::vector<uint8_t> local(16 * 3, 0), scratch(ptx_delta_bound(16 * 3));
+    uint64_t frame = 0;
+    TEST_ASSERT_TRUE(ptx_delta_catch_up(delta, local.data(), frame, scratch.data(), scratch.size()));
+    TEST_ASSERT_TRUE(local == rgb);
+
+    ptx_delta_detach(delta);
+    ptx_geom_detach(geom);
+    ptx_fb_detach(fb);
+    ptx_registry_detach(registry);
+    Unlink();
+#endif
+}
+
+// ========== Edge Cases ==========
+
 void TestVirtualController::TestEdgeCases() {
-    // VirtualController obj; // Requires constructor parameters
-    
-    // Test method functionality
-    TEST_ASSERT_TRUE(false);
+    // Unmapped handles are rejected instead of dereferenced.
+    PTXShm shm;
+    PTXFbSlot slot;
+    TEST_ASSERT_NULL(ptx_fb_acquire(shm, slot));
+    ptx_fb_commit(shm, slot);
+
+    PTXGeom geom;
+    const float xy[2] = { 1.0f, 2.0f };
+    TEST_ASSERT_FALSE(ptx_geom_publish_if_changed(geom, xy, 1));
+    TEST_ASSERT_EQUAL(0, static_cast<int>(ptx_geom_generation(geom)));
+
+    // No camera manager: nothing is published.
+    VirtualController controller(nullptr, kCtrlName, kRegName, kPrefix);
+    controller.Initialize();
+    controller.Display();
+    TEST_ASSERT_EQUAL(0, static_cast<int>(controller.GetGeometryGeneration(42)));
+    Unlink();
 }
 
+// ========== Test Runner ==========
+
 void TestVirtualController::RunAllTests() {
     RUN_TEST(TestDefaultConstructor);
     RUN_TEST(TestParameterizedConstructor);
     RUN_TEST(TestInitialize);
     RUN_TEST(TestDisplay);
+    RUN_TEST(TestInvalidateGeometry);
+    RUN_TEST(TestGeometryPublishedOnce);
+    RUN_TEST(TestFbAcquireCommit);
+    RUN_TEST(TestGeomPublishIfChanged);
+    RUN_TEST(TestDeltaOutput);
+    RUN_TEST(TestReaderFindsPrefixedChannels);
     RUN_TEST(TestEdgeCases);
 }
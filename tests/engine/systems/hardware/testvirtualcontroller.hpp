@@ -2,7 +2,8 @@
  * @file testvirtualcontroller.hpp
  * @brief Unit tests for the VirtualController class.
  *
- * TODO: Add detailed description of what this test suite covers.
+ * Covers SHM channel setup, publish-once geometry with generation tracking, and
+ * zero-copy framebuffer publishing through the ring acquire/commit API.
  *
  * @date 10/10/2025
  * @version 1.0
@@ -13,6 +14,7 @@
 
 #include <unity.h>
 #include <ptx/systems/hardware/virtualcontroller.hpp>
+#include <ptx/platform/ipc/ptx_shm_reader.hpp>
 #include <utils/testhelpers.hpp>
 
 /**
@@ -28,8 +30,14 @@ public:
     // Method tests
     static void TestInitialize();
     static void TestDisplay();
+    static void TestInvalidateGeometry();
 
     // Functionality tests
+    static void TestGeometryPublishedOnce();
+    static void TestFbAcquireCommit();
+    static void TestGeomPublishIfChanged();
+    static void TestDeltaOutput();
+    static void TestReaderFindsPrefixedChannels();
 
     // Edge case & integration tests
     static void TestEdgeCases();
@@ -0,0 +1,310 @@
+/**
+ * @file testparticleaffector.cpp
+ * @brief Implementation of particle affector unit tests.
+ */
+
+#include "testparticleaffector.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace ptx;
+
+namespace {
+
+void SpawnAt(ParticlePool& pool, const Vector3D& position, const Vector3D& velocity) {
+    const size_t index = pool.Spawn();
+    pool.SetPosition(index, position);
+    pool.SetVelocity(index, velocity);
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestParticleAffector::TestDefaultStages() {
+    TEST_ASSERT_TRUE(GravityAffector().GetStage() == ParticleAffectorStage::Forces);
+    TEST_ASSERT_TRUE(DragAffector().GetStage() == ParticleAffectorStage::Forces);
+    TEST_ASSERT_TRUE(AttractorAffector().GetStage() == ParticleAffectorStage::Forces);
+    TEST_ASSERT_TRUE(PlaneCollisionAffector().GetStage() == ParticleAffectorStage::Constraints);
+    TEST_ASSERT_TRUE(SphereCollisionAffector().GetStage() == ParticleAffectorStage::Constraints);
+
+    CallbackAffector callback(nullptr, ParticleAffectorStage::Constraints);
+    TEST_ASSERT_TRUE(callback.GetStage() == ParticleAffectorStage::Constraints);
+    TEST_ASSERT_TRUE(callback.IsEnabled());
+}
+
+// ========== Method Tests ==========
+
+void TestParticleAffector::TestGravity() {
+    ParticlePool pool(4);
+    SpawnAt(pool, Vector3D(0, 0, 0), Vector3D(1, 0, 0));
+    SpawnAt(pool, Vector3D(0, 0, 0), Vector3D(0, 2, 0));
+
+    GravityAffector gravity(Vector3D(0, -10, 5));
+    gravity.Apply(pool.GetSpan(), 0.5f);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, pool.GetVelocity(0).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, -5.0f, pool.GetVelocity(0).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 2.5f, pool.GetVelocity(0).Z);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, -3.0f, pool.GetVelocity(1).Y);
+}
+
+void TestParticleAffector::TestDrag() {
+    ParticlePool pool(2);
+    SpawnAt(pool, Vector3D(0, 0, 0), Vector3D(4, -2, 8));
+
+    DragAffector drag(0.5f);
+    drag.Apply(pool.GetSpan(), 0.5f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 3.0f, pool.GetVelocity(0).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, -1.5f, pool.GetVelocity(0).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 6.0f, pool.GetVelocity(0).Z);
+
+    // A step longer than 1 / coefficient stops the particle instead of reversing it.
+    drag.Apply(pool.GetSpan(), 10.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetVelocity(0).Magnitude());
+}
+
+void TestParticleAffector::TestTurbulence() {
+    SimplexNoise noise(7);
+    ParticlePool pool(16);
+    for (int i = 0; i < 16; ++i) {
+        SpawnAt(pool, Vector3D(i * 3.1f, i * 1.7f, i * 0.9f), Vector3D(0, 0, 0));
+    }
+
+    TurbulenceAffector turbulence(&noise, 4.0f, 0.2f, 1.0f);
+    turbulence.Prepare(0.1f);
+    turbulence.Apply(pool.GetSpan(), 0.1f);
+
+    // Noise is in [-1, 1]; the kick is bounded by strength * dt and not zero everywhere.
+    float total = 0.0f;
+    for (size_t i = 0; i < pool.GetAliveCount(); ++i) {
+        const Vector3D velocity = pool.GetVelocity(i);
+        TEST_ASSERT_TRUE(std::fabs(velocity.X) <= 0.4f + 1e-5f);
+        TEST_ASSERT_TRUE(std::fabs(velocity.Y) <= 0.4f + 1e-5f);
+        TEST_ASSERT_TRUE(std::fabs(velocity.Z) <= 0.4f + 1e-5f);
+        total += velocity.Magnitude();
+    }
+    TEST_ASSERT_TRUE(total > 0.0f);
+
+    // Same inputs give the same kick.
+    ParticlePool copy(1);
+    SpawnAt(copy, pool.GetPosition(3), Vector3D(0, 0, 0));
+    TurbulenceAffector again(&noise, 4.0f, 0.2f, 1.0f);
+    again.Prepare(0.1f);
+    again.Apply(copy.GetSpan(), 0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, pool.GetVelocity(3).X, copy.GetVelocity(0).X);
+}
+
+void TestParticleAffector::TestAttractor() {
+    ParticlePool pool(3);
+    SpawnAt(pool, Vector3D(5, 0, 0), Vector3D(0, 0, 0));   // Halfway out
+    SpawnAt(pool, Vector3D(0, -20, 0), Vector3D(0, 0, 0)); // Outside radius
+    SpawnAt(pool, Vector3D(0, 0, 0), Vector3D(0, 0, 0));   // At the center
+
+    AttractorAffector attractor(Vector3D(0, 0, 0), 10.0f, 10.0f);
+    attractor.Apply(pool.GetSpan(), 1.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, -5.0f, pool.GetVelocity(0).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetVelocity(0).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetVelocity(1).Magnitude());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetVelocity(2).Magnitude());
+
+    // Negative strength repels.
+    attractor.SetStrength(-10.0f);
+    attractor.Apply(pool.GetSpan(), 1.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, pool.GetVelocity(0).X);
+}
+
+void TestParticleAffector::TestVectorField() {
+    VectorField2D field(16, 16, VectorField2D::Storage::Float);
+    field.SetSize(16.0f, 16.0f);
+    field.SetPosition(0.0f, 0.0f);
+    for (uint16_t y = 0; y < 16; ++y) {
+        for (uint16_t x = 0; x < 16; ++x) {
+            field.AddVelocity(x, y, 0.25f, 0.0f);
+        }
+    }
+
+    bool inBounds = false;
+    const Vector2D sampled = field.SampleVelocity(1.0f, -2.0f, inBounds);
+    TEST_ASSERT_TRUE(inBounds);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 4.0f, sampled.X);   // 0.25 field widths/s * 16 units
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, sampled.Y);
+
+    ParticlePool pool(2);
+    SpawnAt(pool, Vector3D(1, -2, 0), Vector3D(0, 1, 3));
+    SpawnAt(pool, Vector3D(100, 0, 0), Vector3D(0, 1, 3));
+
+    VectorFieldAffector affector(&field, 2.0f);
+    affector.Apply(pool.GetSpan(), 0.25f);
+
+    // Half way toward the field velocity; Z and out-of-field particles untouched.
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 2.0f, pool.GetVelocity(0).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.5f, pool.GetVelocity(0).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 3.0f, pool.GetVelocity(0).Z);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetVelocity(1).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, pool.GetVelocity(1).Y);
+}
+
+void TestParticleAffector::TestPlaneCollision() {
+    ParticlePool pool(2);
+    SpawnAt(pool, Vector3D(1, -0.5f, 0), Vector3D(2, -4, 0));
+    SpawnAt(pool, Vector3D(0, 3, 0), Vector3D(0, -1, 0));
+
+    PlaneCollisionAffector plane(Vector3D(0, 2, 0), 0.0f, 0.5f, 0.25f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, plane.GetNormal().Y);
+
+    plane.Apply(pool.GetSpan(), 0.1f);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetPosition(0).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, pool.GetPosition(0).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 2.0f, pool.GetVelocity(0).Y);   // -4 reflected * 0.5
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.5f, pool.GetVelocity(0).X);   // 2 * (1 - 0.25)
+
+    // Particles on the free side are untouched.
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 3.0f, pool.GetPosition(1).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, -1.0f, pool.GetVelocity(1).Y);
+}
+
+void TestParticleAffector::TestSphereCollision() {
+    ParticlePool pool(2);
+    SpawnAt(pool, Vector3D(0.5f, 0, 0), Vector3D(-1, 1, 0));
+    SpawnAt(pool, Vector3D(3, 0, 0), Vector3D(-1, 0, 0));
+
+    SphereCollisionAffector sphere(Vector3D(0, 0, 0), 1.0f, 1.0f, 0.0f);
+    sphere.Apply(pool.GetSpan(), 0.1f);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, pool.GetPosition(0).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, pool.GetVelocity(0).X);   // Elastic reflection
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, pool.GetVelocity(0).Y);   // Frictionless tangent
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 3.0f, pool.GetPosition(1).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, -1.0f, pool.GetVelocity(1).X);
+}
+
+void TestParticleAffector::TestSphereContainment() {
+    ParticlePool pool(2);
+    SpawnAt(pool, Vector3D(0, 0, 5), Vector3D(0, 0, 2));
+    SpawnAt(pool, Vector3D(0, 0, 1), Vector3D(0, 0, 2));
+
+    SphereCollisionAffector sphere(Vector3D(0, 0, 0), 2.0f, 0.0f, 0.0f, true);
+    TEST_ASSERT_TRUE(sphere.IsContaining());
+    sphere.Apply(pool.GetSpan(), 0.1f);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 2.0f, pool.GetPosition(0).Z);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.0f, pool.GetVelocity(0).Z);   // No bounce
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, pool.GetPosition(1).Z);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, pool.GetVelocity(1).Z);
+}
+
+void TestParticleAffector::TestCallback() {
+    ParticlePool pool(8);
+    for (int i = 0; i < 8; ++i) SpawnAt(pool, Vector3D(0, 0, 0), Vector3D(0, 0, 0));
+
+    int calls = 0;
+    size_t seen = 0;
+    CallbackAffector callback([&](const ParticleSpan& span, float deltaTime) {
+        ++calls;
+        seen += span.count;
+        for (size_t i = 0; i < span.count; ++i) span.velocityX[i] = deltaTime;
+    });
+
+    callback.Apply(pool.GetSpan(), 0.25f);
+    TEST_ASSERT_EQUAL(1, calls);
+    TEST_ASSERT_EQUAL(8, static_cast<int>(seen));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.25f, pool.GetVelocity(7).X);
+
+    // Empty spans skip the call.
+    callback.Apply(ParticleSpan(), 0.25f);
+    TEST_ASSERT_EQUAL(1, calls);
+}
+
+// ========== Functionality Tests ==========
+
+void TestParticleAffector::TestSlicesMatchWholeSpan() {
+    SimplexNoise noise(3);
+    ParticlePool whole(64);
+    ParticlePool sliced(64);
+    for (int i = 0; i < 64; ++i) {
+        const Vector3D position(i * 0.37f - 10.0f, i * 0.11f - 2.0f, i * 0.23f);
+        SpawnAt(whole, position, Vector3D(1, 0, -1));
+        SpawnAt(sliced, position, Vector3D(1, 0, -1));
+    }
+
+    AttractorAffector attractor(Vector3D(0, 1, 2), 5.0f, 8.0f);
+    TurbulenceAffector turbulence(&noise, 2.0f, 0.3f, 0.0f);
+    PlaneCollisionAffector plane(Vector3D(0, 1, 0), 0.0f, 0.3f, 0.2f);
+
+    ParticleAffector* kernels[] = { &attractor, &turbulence, &plane };
+    for (ParticleAffector* kernel : kernels) {
+        kernel->Apply(whole.GetSpan(), 0.05f);
+
+        // Affectors must be safe to run on disjoint slices.
+        const ParticleSpan span = sliced.GetSpan();
+        for (size_t begin = 0; begin < span.count; begin += 10) {
+            kernel->Apply(span.Slice(begin, std::min(begin + 10, span.count)), 0.05f);
+        }
+    }
+
+    for (size_t i = 0; i < 64; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, whole.GetVelocity(i).X, sliced.GetVelocity(i).X);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, whole.GetVelocity(i).Y, sliced.GetVelocity(i).Y);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, whole.GetPosition(i).Y, sliced.GetPosition(i).Y);
+    }
+}
+
+// ========== Edge Cases ==========
+
+void TestParticleAffector::TestEdgeCases() {
+    // Null sources and empty spans are no-ops.
+    TurbulenceAffector turbulence(nullptr);
+    VectorFieldAffector field(nullptr);
+    turbulence.Apply(ParticleSpan(), 0.1f);
+    field.Apply(ParticleSpan(), 0.1f);
+
+    ParticlePool pool(1);
+    SpawnAt(pool, Vector3D(0, 0, 0), Vector3D(1, 2, 3));
+    turbulence.Apply(pool.GetSpan(), 0.1f);
+    field.Apply(pool.GetSpan(), 0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, pool.GetVelocity(0).Y);
+
+    // Degenerate parameters are clamped.
+    AttractorAffector attractor;
+    attractor.SetRadius(0.0f);
+    TEST_ASSERT_TRUE(attractor.GetRadius() > 0.0f);
+    DragAffector drag(-1.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, drag.GetCoefficient());
+
+    PlaneCollisionAffector plane;
+    plane.SetPlane(Vector3D(0, 0, 0), 1.0f);   // Keeps the previous normal
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, plane.GetNormal().Y);
+
+    // A particle at the exact sphere center is pushed out along +Y.
+    ParticlePool centered(1);
+    SpawnAt(centered, Vector3D(1, 1, 1), Vector3D(0, 0, 0));
+    SphereCollisionAffector sphere(Vector3D(1, 1, 1), 0.5f);
+    sphere.Apply(centered.GetSpan(), 0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.5f, centered.GetPosition(0).Y);
+
+    // Out-of-bounds sampling reports it.
+    VectorField2D small(4, 4);
+    bool inBounds = true;
+    small.SampleVelocity(1000.0f, 0.0f, inBounds);
+    TEST_ASSERT_FALSE(inBounds);
+}
+
+// ========== Test Runner ==========
+
+void TestParticleAffector::RunAllTests() {
+    RUN_TEST(TestDefaultStages);
+    RUN_TEST(TestGravity);
+    RUN_TEST(TestDrag);
+    RUN_TEST(TestTurbulence);
+    RUN_TEST(TestAttractor);
+    RUN_TEST(TestVectorField);
+    RUN_TEST(TestPlaneCollision);
+    RUN_TEST(TestSphereCollision);
+    RUN_TEST(TestSphereContainment);
+    RUN_TEST(TestCallback);
+    RUN_TEST(TestSlicesMatchWholeSpan);
+    RUN_TEST(TestEdgeCases);
+}
@@ -0,0 +1,55 @@
+/**
+ * @file testparticleaffector.hpp
+ * @brief Unit tests for the batch particle affectors.
+ *
+ * Each kernel is run directly on a ParticlePool span.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/particles/affectors/attractoraffector.hpp>
+#include <ptx/systems/particles/affectors/callbackaffector.hpp>
+#include <ptx/systems/particles/affectors/dragaffector.hpp>
+#include <ptx/systems/particles/affectors/gravityaffector.hpp>
+#include <ptx/systems/particles/affectors/planecollisionaffector.hpp>
+#include <ptx/systems/particles/affectors/spherecollisionaffector.hpp>
+#include <ptx/systems/particles/affectors/turbulenceaffector.hpp>
+#include <ptx/systems/particles/affectors/vectorfieldaffector.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestParticleAffector
+ * @brief Contains static test methods for the particle affectors.
+ */
+class TestParticleAffector {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultStages();
+
+    // Method tests
+    static void TestGravity();
+    static void TestDrag();
+    static void TestTurbulence();
+    static void TestAttractor();
+    static void TestVectorField();
+    static void TestPlaneCollision();
+    static void TestSphereCollision();
+    static void TestSphereContainment();
+    static void TestCallback();
+
+    // Functionality tests
+    static void TestSlicesMatchWholeSpan();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
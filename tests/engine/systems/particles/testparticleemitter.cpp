@@ -0,0 +1,240 @@
+/**
+ * @file testparticleemitter.cpp
+ * @brief Implementation of ParticleEmitter unit tests.
+ */
+
+#include "testparticleemitter.hpp"
+
+using namespace ptx;
+
+namespace {
+
+ParticleEmitterConfig FixedConfig(int maxParticles) {
+    ParticleEmitterConfig config;
+    config.maxParticles = maxParticles;
+    config.lifetimeMin = 1.0f;
+    config.lifetimeMax = 1.0f;
+    config.velocityMin = Vector3D(0, 0, 0);
+    config.velocityMax = Vector3D(0, 0, 0);
+    config.gravity = Vector3D(0, 0, 0);
+    return config;
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestParticleEmitter::TestDefaultConstructor() {
+    ParticleEmitter emitter;
+
+    TEST_ASSERT_FALSE(emitter.IsPlaying());
+    TEST_ASSERT_EQUAL(0, emitter.GetActiveParticleCount());
+    TEST_ASSERT_EQUAL(emitter.GetConfig().maxParticles, static_cast<int>(emitter.GetPool().GetCapacity()));
+}
+
+void TestParticleEmitter::TestParameterizedConstructor() {
+    ParticleEmitter emitter(FixedConfig(250));
+
+    TEST_ASSERT_EQUAL(250, static_cast<int>(emitter.GetPool().GetCapacity()));
+    TEST_ASSERT_EQUAL(0, emitter.GetActiveParticleCount());
+}
+
+// ========== Method Tests ==========
+
+void TestParticleEmitter::TestEmitBurst() {
+    ParticleEmitter emitter(FixedConfig(10));
+
+    emitter.EmitBurst(4);
+    TEST_ASSERT_EQUAL(4, emitter.GetActiveParticleCount());
+
+    // Bursts past capacity are truncated.
+    emitter.EmitBurst(20);
+    TEST_ASSERT_EQUAL(10, emitter.GetActiveParticleCount());
+}
+
+void TestParticleEmitter::TestUpdateEmitsAtRate() {
+    ParticleEmitterConfig config = FixedConfig(100);
+    config.emissionRate = 10.0f;
+    config.lifetimeMin = config.lifetimeMax = 10.0f;
+    ParticleEmitter emitter(config);
+
+    emitter.Play();
+    for (int i = 0; i < 10; ++i) emitter.Update(0.1001f);
+
+    TEST_ASSERT_EQUAL(10, emitter.GetActiveParticleCount());
+}
+
+void TestParticleEmitter::TestUpdateExpiresParticles() {
+    ParticleEmitter emitter(FixedConfig(10));
+    emitter.EmitBurst(10);
+
+    emitter.Update(0.5f);
+    TEST_ASSERT_EQUAL(10, emitter.GetActiveParticleCount());
+
+    emitter.Update(0.6f);
+    TEST_ASSERT_EQUAL(0, emitter.GetActiveParticleCount());
+}
+
+void TestParticleEmitter::TestUpdateCallback() {
+    ParticleEmitter emitter(FixedConfig(10));
+    emitter.EmitBurst(6);
+
+    int calls = 0;
+    emitter.AddUpdateCallback([&calls](Particle& particle, float) {
+        // Kill every other particle, push the rest upward.
+        if (calls++ % 2 == 0) {
+            particle.active = false;
+        } else {
+            particle.position = particle.position + Vector3D(0, 1, 0);
+        }
+    });
+
+    emitter.Update(0.1f);
+
+    TEST_ASSERT_EQUAL(6, calls);
+    TEST_ASSERT_EQUAL(3, emitter.GetActiveParticleCount());
+    for (int i = 0; i < emitter.GetActiveParticleCount(); ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, emitter.GetParticle(i).position.Y);
+    }
+
+    emitter.ClearUpdateCallbacks();
+    emitter.Update(0.1f);
+    TEST_ASSERT_EQUAL(6, calls);
+}
+
+void TestParticleEmitter::TestSetConfig() {
+    ParticleEmitter emitter(FixedConfig(10));
+    emitter.EmitBurst(10);
+
+    emitter.SetConfig(FixedConfig(5));
+    TEST_ASSERT_EQUAL(5, static_cast<int>(emitter.GetPool().GetCapacity()));
+    TEST_ASSERT_EQUAL(5, emitter.GetActiveParticleCount());
+}
+
+void TestParticleEmitter::TestGetParticle() {
+    ParticleEmitterConfig config = FixedConfig(4);
+    config.sizeStart = 2.0f;
+    config.sizeEnd = 0.0f;
+    config.velocityMin = config.velocityMax = Vector3D(1, 0, 0);
+    ParticleEmitter emitter(config);
+    emitter.GetTransform().SetPosition(Vector3D(5, 0, 0));
+
+    emitter.Emit();
+    emitter.Update(0.5f);
+
+    const Particle particle = emitter.GetParticle(0);
+    TEST_ASSERT_TRUE(particle.IsAlive());
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 5.5f, particle.position.X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 1.0f, particle.size);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.5f, particle.GetLifetimeProgress());
+
+    TEST_ASSERT_FALSE(emitter.GetParticle(3).active);
+}
+
+void TestParticleEmitter::TestAffectorStages() {
+    ParticleEmitter emitter(FixedConfig(4));
+    emitter.Emit();
+
+    // Forces run before integration, constraints after.
+    auto gravity = std::make_shared<GravityAffector>(Vector3D(0, 10, 0));
+    auto ceiling = std::make_shared<PlaneCollisionAffector>(Vector3D(0, -1, 0), -0.05f, 0.0f, 0.0f);
+    emitter.AddAffector(ceiling);
+    emitter.AddAffector(gravity);
+    TEST_ASSERT_EQUAL(2, static_cast<int>(emitter.GetAffectors().size()));
+
+    emitter.Update(0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.05f, emitter.GetParticle(0).position.Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.0f, emitter.GetParticle(0).velocity.Y);
+
+    // Disabled affectors are skipped.
+    ceiling->SetEnabled(false);
+    emitter.Update(0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.15f, emitter.GetParticle(0).position.Y);
+
+    TEST_ASSERT_TRUE(emitter.RemoveAffector(gravity));
+    TEST_ASSERT_FALSE(emitter.RemoveAffector(gravity));
+    emitter.ClearAffectors();
+    TEST_ASSERT_EQUAL(0, static_cast<int>(emitter.GetAffectors().size()));
+}
+
+void TestParticleEmitter::TestBatchCallback() {
+    ParticleEmitter emitter(FixedConfig(8));
+    emitter.EmitBurst(4);
+
+    int calls = 0;
+    auto callback = emitter.AddBatchCallback([&](const ParticleSpan& span, float) {
+        ++calls;
+        // Kill the first particle by expiring it.
+        if (span.count > 0) span.age[0] = 1.0f / span.inverseLifetime[0];
+    });
+
+    // Expired particles are retired when the update finishes.
+    emitter.Update(0.1f);
+    TEST_ASSERT_EQUAL(1, calls);
+    TEST_ASSERT_EQUAL(3, emitter.GetActiveParticleCount());
+
+    emitter.RemoveAffector(callback);
+    emitter.Update(0.1f);
+    TEST_ASSERT_EQUAL(1, calls);
+    TEST_ASSERT_EQUAL(3, emitter.GetActiveParticleCount());
+}
+
+// ========== Functionality Tests ==========
+
+void TestParticleEmitter::TestLargePool() {
+    ParticleEmitterConfig config = FixedConfig(100000);
+    config.lifetimeMin = 0.5f;
+    config.lifetimeMax = 1.5f;
+    ParticleEmitter emitter(config);
+
+    emitter.EmitBurst(100000);
+    TEST_ASSERT_EQUAL(100000, emitter.GetActiveParticleCount());
+
+    for (int i = 0; i < 10; ++i) emitter.Update(0.1f);
+
+    const int alive = emitter.GetActiveParticleCount();
+    TEST_ASSERT_TRUE(alive > 0 && alive < 100000);
+
+    // Alive particles stay packed: every one in [0, alive) is still within its lifetime.
+    const ParticlePool& pool = emitter.GetPool();
+    for (int i = 0; i < alive; i += 997) {
+        TEST_ASSERT_TRUE(pool.GetAge(i) < pool.GetLifetime(i));
+    }
+}
+
+// ========== Edge Cases ==========
+
+void TestParticleEmitter::TestEdgeCases() {
+    ParticleEmitter emitter(FixedConfig(0));
+    emitter.Emit();
+    TEST_ASSERT_EQUAL(0, emitter.GetActiveParticleCount());
+
+    // Negative capacity is treated as empty.
+    emitter.SetConfig(FixedConfig(-5));
+    TEST_ASSERT_EQUAL(0, static_cast<int>(emitter.GetPool().GetCapacity()));
+
+    // Stop clears particles, non-positive time steps do nothing.
+    emitter.SetConfig(FixedConfig(4));
+    emitter.EmitBurst(4);
+    emitter.Update(0.0f);
+    TEST_ASSERT_EQUAL(4, emitter.GetActiveParticleCount());
+    emitter.Stop();
+    TEST_ASSERT_EQUAL(0, emitter.GetActiveParticleCount());
+}
+
+// ========== Test Runner ==========
+
+void TestParticleEmitter::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestParameterizedConstructor);
+    RUN_TEST(TestEmitBurst);
+    RUN_TEST(TestUpdateEmitsAtRate);
+    RUN_TEST(TestUpdateExpiresParticles);
+    RUN_TEST(TestUpdateCallback);
+    RUN_TEST(TestSetConfig);
+    RUN_TEST(TestGetParticle);
+    RUN_TEST(TestAffectorStages);
+    RUN_TEST(TestBatchCallback);
+    RUN_TEST(TestLargePool);
+    RUN_TEST(TestEdgeCases);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file testparticleemitter.hpp
+ * @brief Unit tests for the ParticleEmitter class.
+ *
+ * Covers emission, expiry, per-frame integration and update callbacks.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/particles/particleemitter.hpp>
+#include <ptx/systems/particles/affectors/gravityaffector.hpp>
+#include <ptx/systems/particles/affectors/planecollisionaffector.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestParticleEmitter
+ * @brief Contains static test methods for the ParticleEmitter class.
+ */
+class TestParticleEmitter {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+    static void TestParameterizedConstructor();
+
+    // Method tests
+    static void TestEmitBurst();
+    static void TestUpdateEmitsAtRate();
+    static void TestUpdateExpiresParticles();
+    static void TestUpdateCallback();
+    static void TestSetConfig();
+    static void TestGetParticle();
+    static void TestAffectorStages();
+    static void TestBatchCallback();
+
+    // Functionality tests
+    static void TestLargePool();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
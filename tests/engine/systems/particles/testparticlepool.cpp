@@ -0,0 +1,168 @@
+/**
+ * @file testparticlepool.cpp
+ * @brief Implementation of ParticlePool unit tests.
+ */
+
+#include "testparticlepool.hpp"
+
+using namespace ptx;
+
+// ========== Constructor Tests ==========
+
+void TestParticlePool::TestDefaultConstructor() {
+    ParticlePool pool;
+
+    TEST_ASSERT_EQUAL(0, pool.GetCapacity());
+    TEST_ASSERT_EQUAL(0, pool.GetAliveCount());
+    TEST_ASSERT_TRUE(pool.IsFull());
+    TEST_ASSERT_TRUE(pool.Spawn() == ParticlePool::kInvalidIndex);
+}
+
+void TestParticlePool::TestParameterizedConstructor() {
+    ParticlePool pool(64);
+
+    TEST_ASSERT_EQUAL(64, pool.GetCapacity());
+    TEST_ASSERT_EQUAL(0, pool.GetAliveCount());
+    TEST_ASSERT_FALSE(pool.IsFull());
+}
+
+// ========== Method Tests ==========
+
+void TestParticlePool::TestSpawn() {
+    ParticlePool pool(3);
+
+    TEST_ASSERT_EQUAL(0, pool.Spawn());
+    TEST_ASSERT_EQUAL(1, pool.Spawn());
+    TEST_ASSERT_EQUAL(2, pool.Spawn());
+    TEST_ASSERT_TRUE(pool.Spawn() == ParticlePool::kInvalidIndex);
+    TEST_ASSERT_EQUAL(3, pool.GetAliveCount());
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetAge(1));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, pool.GetAlpha(1));
+}
+
+void TestParticlePool::TestKillSwapsLast() {
+    ParticlePool pool(4);
+    for (int i = 0; i < 4; ++i) {
+        const size_t index = pool.Spawn();
+        pool.SetPosition(index, Vector3D(static_cast<float>(i), 0, 0));
+    }
+
+    pool.Kill(1);
+
+    TEST_ASSERT_EQUAL(3, pool.GetAliveCount());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pool.GetPosition(0).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 3.0f, pool.GetPosition(1).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, pool.GetPosition(2).X);
+
+    // The freed slot is reused by the next spawn.
+    TEST_ASSERT_EQUAL(3, pool.Spawn());
+}
+
+void TestParticlePool::TestAge() {
+    ParticlePool pool(8);
+    for (int i = 0; i < 8; ++i) {
+        const size_t index = pool.Spawn();
+        pool.SetLifetime(index, (i % 2 == 0) ? 0.5f : 2.0f);
+        pool.SetPosition(index, Vector3D(static_cast<float>(i), 0, 0));
+    }
+
+    TEST_ASSERT_EQUAL(0, pool.Age(0.25f));
+    TEST_ASSERT_EQUAL(4, pool.Age(0.25f));
+    TEST_ASSERT_EQUAL(4, pool.GetAliveCount());
+
+    // Only the long-lived (odd) particles remain, still packed at the front.
+    for (size_t i = 0; i < pool.GetAliveCount(); ++i) {
+        TEST_ASSERT_EQUAL(1, static_cast<int>(pool.GetPosition(i).X) % 2);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, pool.GetAge(i));
+    }
+}
+
+void TestParticlePool::TestIntegrate() {
+    ParticlePool pool(2);
+    const size_t index = pool.Spawn();
+    pool.SetVelocity(index, Vector3D(1, 0, 0));
+    pool.SetLifetime(index, 2.0f);
+    pool.SetAge(index, 1.0f);
+    pool.SetRotationSpeed(index, 2.0f);
+
+    ParticleGradient gradient;
+    gradient.sizeStart = 2.0f;
+    gradient.sizeEnd = 4.0f;
+    gradient.colorStart = Vector3D(1, 0, 0);
+    gradient.colorEnd = Vector3D(0, 0, 1);
+    gradient.alphaStart = 1.0f;
+    gradient.alphaEnd = 0.0f;
+
+    pool.Integrate(0.5f, Vector3D(0, -2, 0), gradient);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.5f, pool.GetPosition(index).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, -1.0f, pool.GetVelocity(index).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, -0.5f, pool.GetPosition(index).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, pool.GetRotation(index));
+
+    // Halfway through its lifetime.
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 3.0f, pool.GetSize(index));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.5f, pool.GetColor(index).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.5f, pool.GetColor(index).Z);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.5f, pool.GetAlpha(index));
+}
+
+void TestParticlePool::TestSetCapacity() {
+    ParticlePool pool(10);
+    for (int i = 0; i < 10; ++i) pool.Spawn();
+
+    pool.SetCapacity(4);
+    TEST_ASSERT_EQUAL(4, pool.GetCapacity());
+    TEST_ASSERT_EQUAL(4, pool.GetAliveCount());
+
+    pool.SetCapacity(100000);
+    TEST_ASSERT_EQUAL(4, pool.GetAliveCount());
+    TEST_ASSERT_FALSE(pool.IsFull());
+}
+
+void TestParticlePool::TestSlice() {
+    ParticlePool pool(10);
+    for (int i = 0; i < 10; ++i) {
+        pool.SetPosition(pool.Spawn(), Vector3D(static_cast<float>(i), 0, 0));
+    }
+
+    const ParticleSpan slice = pool.GetSpan().Slice(4, 20);
+    TEST_ASSERT_EQUAL(6, slice.count);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 4.0f, slice.positionX[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 9.0f, slice.positionX[5]);
+}
+
+// ========== Edge Cases ==========
+
+void TestParticlePool::TestEdgeCases() {
+    ParticlePool pool(2);
+
+    // Killing out of range is ignored.
+    pool.Kill(0);
+    TEST_ASSERT_EQUAL(0, pool.GetAliveCount());
+
+    // Zero lifetime is clamped so progress stays finite.
+    const size_t index = pool.Spawn();
+    pool.SetLifetime(index, 0.0f);
+    TEST_ASSERT_TRUE(pool.GetLifetime(index) > 0.0f);
+    TEST_ASSERT_EQUAL(1, pool.Age(0.001f));
+
+    // Integrating an empty pool is a no-op.
+    pool.Integrate(1.0f, Vector3D(0, -10, 0), ParticleGradient());
+    TEST_ASSERT_EQUAL(0, pool.GetAliveCount());
+}
+
+// ========== Test Runner ==========
+
+void TestParticlePool::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestParameterizedConstructor);
+    RUN_TEST(TestSpawn);
+    RUN_TEST(TestKillSwapsLast);
+    RUN_TEST(TestAge);
+    RUN_TEST(TestIntegrate);
+    RUN_TEST(TestSetCapacity);
+    RUN_TEST(TestSlice);
+    RUN_TEST(TestEdgeCases);
+}
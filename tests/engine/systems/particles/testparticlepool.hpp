@@ -0,0 +1,43 @@
+/**
+ * @file testparticlepool.hpp
+ * @brief Unit tests for the ParticlePool class.
+ *
+ * Covers packed spawn/kill, lifetime expiry and the integration kernel.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/particles/particlepool.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestParticlePool
+ * @brief Contains static test methods for the ParticlePool class.
+ */
+class TestParticlePool {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+    static void TestParameterizedConstructor();
+
+    // Method tests
+    static void TestSpawn();
+    static void TestKillSwapsLast();
+    static void TestAge();
+    static void TestIntegrate();
+    static void TestSetCapacity();
+    static void TestSlice();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
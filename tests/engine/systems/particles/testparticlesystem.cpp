@@ -0,0 +1,184 @@
+/**
+ * @file testparticlesystem.cpp
+ * @brief Implementation of ParticleSystem unit tests.
+ */
+
+#include "testparticlesystem.hpp"
+#include <vector>
+
+using namespace ptx;
+
+namespace {
+
+ParticleEmitterConfig BusyConfig() {
+    ParticleEmitterConfig config;
+    config.emissionRate = 2000.0f;
+    config.maxParticles = 1000;
+    config.lifetimeMin = 0.2f;
+    config.lifetimeMax = 0.6f;
+    return config;
+}
+
+// Builds a two-emitter system and steps it; returns the final state of both pools.
+void Simulate(bool parallel, size_t chunkSize, uint64_t seed, std::vector<float>& out) {
+    ParticleSystem system;
+    system.SetParallel(parallel);
+    system.SetChunkSize(chunkSize);
+    system.SetSeed(seed);
+    system.CreateEmitter(BusyConfig())->Play();
+    system.CreateEmitter(BusyConfig())->Play();
+
+    for (int i = 0; i < 20; ++i) system.Update(1.0f / 60.0f);
+
+    out.clear();
+    for (const auto& emitter : system.GetEmitters()) {
+        const ParticleSpan span = emitter->GetPool().GetSpan();
+        out.push_back(static_cast<float>(span.count));
+        for (size_t i = 0; i < span.count; ++i) {
+            out.push_back(span.positionX[i]);
+            out.push_back(span.velocityY[i]);
+            out.push_back(span.age[i]);
+        }
+    }
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestParticleSystem::TestDefaultConstructor() {
+    ParticleSystem system;
+
+    TEST_ASSERT_EQUAL(0, system.GetEmitterCount());
+    TEST_ASSERT_EQUAL(0, system.GetTotalActiveParticles());
+    TEST_ASSERT_TRUE(system.IsParallel());
+    TEST_ASSERT_EQUAL(ParticleEmitter::kDefaultChunkSize, system.GetChunkSize());
+}
+
+// ========== Method Tests ==========
+
+void TestParticleSystem::TestCreateAndRemoveEmitters() {
+    ParticleSystem system;
+    auto a = system.CreateEmitter();
+    auto b = system.CreateEmitter(BusyConfig());
+
+    TEST_ASSERT_EQUAL(2, system.GetEmitterCount());
+
+    system.RemoveEmitter(a);
+    TEST_ASSERT_EQUAL(1, system.GetEmitterCount());
+    TEST_ASSERT_TRUE(system.GetEmitters()[0] == b);
+
+    system.ClearEmitters();
+    TEST_ASSERT_EQUAL(0, system.GetEmitterCount());
+}
+
+void TestParticleSystem::TestChunkSize() {
+    ParticleSystem system;
+    auto before = system.CreateEmitter();
+
+    system.SetChunkSize(64);
+    auto after = system.CreateEmitter();
+
+    TEST_ASSERT_EQUAL(64, before->GetChunkSize());
+    TEST_ASSERT_EQUAL(64, after->GetChunkSize());
+
+    system.SetChunkSize(0);
+    TEST_ASSERT_EQUAL(1, system.GetChunkSize());
+}
+
+void TestParticleSystem::TestActiveParticleCount() {
+    ParticleSystem system;
+    auto a = system.CreateEmitter(BusyConfig());
+    auto b = system.CreateEmitter(BusyConfig());
+    a->Play();
+    b->Play();
+
+    system.Update(0.05f);
+    const int total = a->GetActiveParticleCount() + b->GetActiveParticleCount();
+    TEST_ASSERT_GREATER_THAN(0, total);
+    TEST_ASSERT_EQUAL(total, system.GetTotalActiveParticles());
+
+    system.RemoveEmitter(a);
+    TEST_ASSERT_EQUAL(b->GetActiveParticleCount(), system.GetTotalActiveParticles());
+
+    // Emitters driven directly are counted without a system update.
+    b->Clear();
+    TEST_ASSERT_EQUAL(0, system.GetTotalActiveParticles());
+    b->EmitBurst(5);
+    TEST_ASSERT_EQUAL(5, b->GetActiveParticleCount());
+    TEST_ASSERT_EQUAL(5, system.GetTotalActiveParticles());
+    b->Update(0.05f);
+    TEST_ASSERT_EQUAL(b->GetActiveParticleCount(), system.GetTotalActiveParticles());
+}
+
+// ========== Functionality Tests ==========
+
+void TestParticleSystem::TestParallelMatchesSerial() {
+    std::vector<float> serial;
+    std::vector<float> parallel;
+
+    // Small chunks force many tasks per emitter.
+    Simulate(false, 16, 1234, serial);
+    Simulate(true, 16, 1234, parallel);
+
+    TEST_ASSERT_EQUAL(serial.size(), parallel.size());
+    TEST_ASSERT_GREATER_THAN(2, static_cast<int>(serial.size()));
+    for (size_t i = 0; i < serial.size(); ++i) {
+        TEST_ASSERT_TRUE(serial[i] == parallel[i]);
+    }
+}
+
+void TestParticleSystem::TestSeedDeterminism() {
+    std::vector<float> first;
+    std::vector<float> second;
+    std::vector<float> other;
+
+    Simulate(true, 128, 7, first);
+    Simulate(true, 128, 7, second);
+    Simulate(true, 128, 8, other);
+
+    TEST_ASSERT_TRUE(first == second);
+    TEST_ASSERT_FALSE(first == other);
+}
+
+void TestParticleSystem::TestEmittersGetDistinctSeeds() {
+    ParticleSystem system;
+    auto a = system.CreateEmitter();
+    auto b = system.CreateEmitter();
+
+    TEST_ASSERT_TRUE(a->GetSeed() != b->GetSeed());
+
+    const uint64_t seedA = a->GetSeed();
+    system.SetSeed(99);
+    TEST_ASSERT_TRUE(a->GetSeed() != seedA);
+    system.SetSeed(0);
+    TEST_ASSERT_TRUE(a->GetSeed() == seedA);
+}
+
+// ========== Edge Cases ==========
+
+void TestParticleSystem::TestEdgeCases() {
+    ParticleSystem system;
+
+    // Updating an empty system is a no-op.
+    system.Update(0.1f);
+    TEST_ASSERT_EQUAL(0, system.GetTotalActiveParticles());
+
+    // Zero delta spawns nothing.
+    system.CreateEmitter(BusyConfig())->Play();
+    system.Update(0.0f);
+    TEST_ASSERT_EQUAL(0, system.GetTotalActiveParticles());
+}
+
+// ========== Test Runner ==========
+
+void TestParticleSystem::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestCreateAndRemoveEmitters);
+    RUN_TEST(TestChunkSize);
+    RUN_TEST(TestActiveParticleCount);
+    RUN_TEST(TestParallelMatchesSerial);
+    RUN_TEST(TestSeedDeterminism);
+    RUN_TEST(TestEmittersGetDistinctSeeds);
+    RUN_TEST(TestEdgeCases);
+}
@@ -0,0 +1,44 @@
+/**
+ * @file testparticlesystem.hpp
+ * @brief Unit tests for the ParticleSystem class.
+ *
+ * Covers emitter management, cached counts and serial/parallel determinism.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/particles/particlesystem.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestParticleSystem
+ * @brief Contains static test methods for the ParticleSystem class.
+ */
+class TestParticleSystem {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+
+    // Method tests
+    static void TestCreateAndRemoveEmitters();
+    static void TestChunkSize();
+    static void TestActiveParticleCount();
+
+    // Functionality tests
+    static void TestParallelMatchesSerial();
+    static void TestSeedDeterminism();
+    static void TestEmittersGetDistinctSeeds();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -5,49 +5,199 @@
 
 #include "testboundarymotionsimulator.hpp"
 
+namespace {
+
+const Quaternion kIdentity;
+
+} // namespace
+
 // ========== Constructor Tests ==========
 
 void TestBoundaryMotionSimulator::TestDefaultConstructor() {
-    // BoundaryMotionSimulator obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Placeholder
+    Cube boundary(Vector3D(0, 0, 0), Vector3D(100, 100, 100));
+    BoundaryMotionSimulator sim(&boundary, 0.8f);
+
+    TEST_ASSERT_EQUAL(0, sim.GetSphereCount());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f / 120.0f, sim.GetFixedTimeStep());
+}
+
+void TestBoundaryMotionSimulator::TestParameterizedConstructor() {
+    Cube boundary(Vector3D(0, 0, 0), Vector3D(300, 200, 100));
+    Mesh* objects[3] = { nullptr, nullptr, nullptr };
+    BoundaryMotionSimulator sim(objects, 3, &boundary, 25.0f, 0.95f);
+
+    TEST_ASSERT_EQUAL(3, sim.GetSphereCount());
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, 25.0f, sim.GetRadius(i));
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, sim.GetVelocity(i).Magnitude());
+    }
 }
 
 // ========== Method Tests ==========
+
 void TestBoundaryMotionSimulator::TestRandomize() {
-    // BoundaryMotionSimulator obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Placeholder
+    BoundaryMotionSimulator sim(nullptr, 0.8f);
+    for (int i = 0; i < 10; i++) {
+        sim.AddSphere(Vector3D(i * 10.0f, 0, 0), 1.0f);
+    }
+
+    sim.Randomize(100.0f);
+
+    for (int i = 0; i < 10; i++) {
+        const Vector3D v = sim.GetVelocity(i);
+        TEST_ASSERT_TRUE(v.X >= -50.0f && v.X <= 50.0f);
+        TEST_ASSERT_TRUE(v.Y >= -50.0f && v.Y <= 50.0f);
+        TEST_ASSERT_TRUE(v.Z >= -50.0f && v.Z <= 50.0f);
+    }
 }
+
 void TestBoundaryMotionSimulator::TestRandomRatio() {
-    // BoundaryMotionSimulator obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Placeholder
+    BoundaryMotionSimulator sim(nullptr, 0.8f);
+
+    for (int i = 0; i < 20; i++) {
+        const Vector3D ratio = sim.RandomRatio(2.0f);
+        TEST_ASSERT_TRUE(ratio.X >= 1.0f && ratio.X <= 3.0f);
+        TEST_ASSERT_TRUE(ratio.Y >= 1.0f && ratio.Y <= 3.0f);
+        TEST_ASSERT_TRUE(ratio.Z >= 1.0f && ratio.Z <= 3.0f);
+    }
 }
+
 void TestBoundaryMotionSimulator::TestUpdate() {
-    // BoundaryMotionSimulator obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Placeholder
+    BoundaryMotionSimulator sim(nullptr, 0.8f);
+    sim.SetDamping(1.0f);
+    const int sphere = sim.AddSphere(Vector3D(0, 0, 0), 1.0f);
+
+    // One second of constant acceleration: v = a * t.
+    for (int i = 0; i < 60; i++) {
+        sim.Update(1.0f / 60.0f, Vector3D(0, -10, 0), kIdentity);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, -10.0f, sim.GetVelocity(sphere).Y);
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, -5.0f, sim.GetPosition(sphere).Y);
 }
-// ========== Edge Cases ==========
 
-// ========== Test Runner ==========
+void TestBoundaryMotionSimulator::TestAddSphere() {
+    BoundaryMotionSimulator sim(nullptr, 0.8f);
 
-void TestBoundaryMotionSimulator::TestParameterizedConstructor() {
-    // BoundaryMotionSimulator obj; // Requires constructor parameters
-    
-    // Test method functionality
-    TEST_ASSERT_TRUE(false);
+    TEST_ASSERT_EQUAL(0, sim.AddSphere(Vector3D(1, 2, 3), 2.0f));
+    TEST_ASSERT_EQUAL(1, sim.AddSphere(Vector3D(4, 5, 6), 0.0f)); // invalid radius falls back to 1
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, sim.GetRadius(1));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f, sim.GetPositions()[0].Y);
+
+    sim.Clear();
+    TEST_ASSERT_EQUAL(0, sim.GetSphereCount());
+}
+
+// ========== Functionality Tests ==========
+
+void TestBoundaryMotionSimulator::TestSphereCollision() {
+    BoundaryMotionSimulator sim(nullptr, 1.0f);
+    sim.SetDamping(1.0f);
+    const int left = sim.AddSphere(Vector3D(-5, 0, 0), 1.0f);
+    const int right = sim.AddSphere(Vector3D(5, 0, 0), 1.0f);
+    sim.SetVelocity(left, Vector3D(10, 0, 0));
+    sim.SetVelocity(right, Vector3D(-10, 0, 0));
+
+    for (int i = 0; i < 60; i++) {
+        sim.Update(1.0f / 60.0f, Vector3D(0, 0, 0), kIdentity);
+    }
+
+    // Equal spheres swap velocities in a perfectly elastic head-on collision.
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, -10.0f, sim.GetVelocity(left).X);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 10.0f, sim.GetVelocity(right).X);
+    TEST_ASSERT_TRUE(sim.GetPosition(left).X < sim.GetPosition(right).X);
+}
+
+void TestBoundaryMotionSimulator::TestStaysInsideBoundary() {
+    Cube boundary(Vector3D(0, 0, 0), Vector3D(20, 20, 20));
+    BoundaryMotionSimulator sim(&boundary, 0.9f);
+    const int sphere = sim.AddSphere(Vector3D(0, 0, 0), 1.0f);
+
+    // Fast enough to cross the whole box several times per frame without substeps.
+    sim.SetVelocity(sphere, Vector3D(2000, -1500, 1000));
+
+    for (int i = 0; i < 120; i++) {
+        sim.Update(1.0f / 60.0f, Vector3D(0, 0, 0), kIdentity);
+
+        const Vector3D p = sim.GetPosition(sphere);
+        TEST_ASSERT_TRUE(p.X >= -9.0f - 1e-3f && p.X <= 9.0f + 1e-3f);
+        TEST_ASSERT_TRUE(p.Y >= -9.0f - 1e-3f && p.Y <= 9.0f + 1e-3f);
+        TEST_ASSERT_TRUE(p.Z >= -9.0f - 1e-3f && p.Z <= 9.0f + 1e-3f);
+    }
+}
+
+void TestBoundaryMotionSimulator::TestFixedTimeStep() {
+    BoundaryMotionSimulator sim(nullptr, 0.8f);
+    sim.SetDamping(1.0f);
+    sim.SetFixedTimeStep(0.01f);
+    const int sphere = sim.AddSphere(Vector3D(0, 0, 0), 1.0f);
+    sim.SetVelocity(sphere, Vector3D(1, 0, 0));
+
+    // Less than one step accumulates without moving.
+    sim.Update(0.004f, Vector3D(0, 0, 0), kIdentity);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, sim.GetPosition(sphere).X);
+
+    // Together with the leftover, this completes exactly one step.
+    sim.Update(0.006f, Vector3D(0, 0, 0), kIdentity);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.01f, sim.GetPosition(sphere).X);
 }
 
+void TestBoundaryMotionSimulator::TestGridAvoidsQuadraticTests() {
+    Cube boundary(Vector3D(0, 0, 0), Vector3D(400, 400, 400));
+    BoundaryMotionSimulator sim(&boundary, 0.9f);
+
+    // 2000 spheres on a lattice, well separated.
+    for (int x = 0; x < 20; x++) {
+        for (int y = 0; y < 10; y++) {
+            for (int z = 0; z < 10; z++) {
+                sim.AddSphere(Vector3D(-190.0f + x * 19.0f, -190.0f + y * 38.0f, -190.0f + z * 38.0f), 2.0f);
+            }
+        }
+    }
+
+    sim.Update(1.0f / 60.0f, Vector3D(0, 0, 0), kIdentity);
+
+    const uint32_t allPairs = 2000u * 1999u / 2u;
+    TEST_ASSERT_TRUE(sim.GetPairTestCount() < allPairs / 100u);
+}
+
+// ========== Edge Cases ==========
+
 void TestBoundaryMotionSimulator::TestEdgeCases() {
-    // BoundaryMotionSimulator obj; // Requires constructor parameters
-    
-    // Test method functionality
-    TEST_ASSERT_TRUE(false);
+    // Empty and null inputs
+    BoundaryMotionSimulator empty(nullptr, 0, nullptr, 1.0f, 0.5f);
+    empty.Update(1.0f / 60.0f, Vector3D(0, -10, 0), kIdentity);
+    empty.Randomize(10.0f);
+    TEST_ASSERT_EQUAL(0, empty.GetSphereCount());
+
+    // Null objects array creates spheres at the origin
+    BoundaryMotionSimulator sim(nullptr, 2, nullptr, 1.0f, 0.5f);
+    TEST_ASSERT_EQUAL(2, sim.GetSphereCount());
+
+    // Coincident spheres are separated without producing NaNs
+    sim.Update(1.0f / 60.0f, Vector3D(0, 0, 0), kIdentity);
+    const float separation = (sim.GetPosition(1) - sim.GetPosition(0)).Magnitude();
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 2.0f, separation);
+
+    // Non-positive time steps do not advance the simulation
+    const Vector3D before = sim.GetPosition(0);
+    sim.Update(0.0f, Vector3D(0, -10, 0), kIdentity);
+    sim.Update(-1.0f, Vector3D(0, -10, 0), kIdentity);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, before.Y, sim.GetPosition(0).Y);
 }
 
+// ========== Test Runner ==========
+
 void TestBoundaryMotionSimulator::RunAllTests() {
     RUN_TEST(TestDefaultConstructor);
     RUN_TEST(TestParameterizedConstructor);
     RUN_TEST(TestRandomize);
     RUN_TEST(TestRandomRatio);
     RUN_TEST(TestUpdate);
+    RUN_TEST(TestAddSphere);
+    RUN_TEST(TestSphereCollision);
+    RUN_TEST(TestStaysInsideBoundary);
+    RUN_TEST(TestFixedTimeStep);
+    RUN_TEST(TestGridAvoidsQuadraticTests);
     RUN_TEST(TestEdgeCases);
 }
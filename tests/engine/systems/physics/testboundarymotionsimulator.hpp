@@ -2,7 +2,8 @@
  * @file testboundarymotionsimulator.hpp
  * @brief Unit tests for the BoundaryMotionSimulator class.
  *
- * TODO: Add detailed description of what this test suite covers.
+ * Covers sphere construction, grid-based sphere collisions, boundary
+ * reflection, and fixed-step integration.
  *
  * @date 10/10/2025
  * @version 1.0
@@ -29,8 +30,13 @@ public:
     static void TestRandomize();
     static void TestRandomRatio();
     static void TestUpdate();
+    static void TestAddSphere();
 
     // Functionality tests
+    static void TestSphereCollision();
+    static void TestStaysInsideBoundary();
+    static void TestFixedTimeStep();
+    static void TestGridAvoidsQuadraticTests();
 
     // Edge case & integration tests
     static void TestEdgeCases();
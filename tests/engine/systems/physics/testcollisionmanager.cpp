@@ -0,0 +1,325 @@
+/**
+ * @file testcollisionmanager.cpp
+ * @brief Implementation of CollisionManager unit tests.
+ */
+
+#include "testcollisionmanager.hpp"
+#include <memory>
+#include <vector>
+
+using namespace ptx;
+
+// ========== Constructor Tests ==========
+
+void TestCollisionManager::TestDefaultConstructor() {
+    CollisionManager manager;
+
+    TEST_ASSERT_EQUAL(0, manager.GetColliderCount());
+    TEST_ASSERT_TRUE(manager.CanLayersCollide(0, 31));
+    TEST_ASSERT_EQUAL(0, manager.GetBroadPhase().GetProxyCount());
+}
+
+void TestCollisionManager::TestRegisterUnregister() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(10, 0, 0), 1.0f);
+
+    manager.RegisterCollider(&a);
+    manager.RegisterCollider(&b);
+    manager.RegisterCollider(&a); // duplicate ignored
+    TEST_ASSERT_EQUAL(2, manager.GetColliderCount());
+    TEST_ASSERT_EQUAL(2, manager.GetBroadPhase().GetProxyCount());
+
+    manager.UnregisterCollider(&a);
+    TEST_ASSERT_EQUAL(1, manager.GetColliderCount());
+    TEST_ASSERT_EQUAL(1, manager.GetBroadPhase().GetProxyCount());
+    TEST_ASSERT_FALSE(manager.OverlapSphere(Vector3D(0, 0, 0), 0.5f));
+
+    manager.UnregisterAllColliders();
+    TEST_ASSERT_EQUAL(0, manager.GetBroadPhase().GetProxyCount());
+}
+
+// ========== Method Tests ==========
+
+void TestCollisionManager::TestUpdateGeneratesEnterEvents() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(1.5f, 0, 0), 1.0f);
+    SphereCollider far(Vector3D(100, 0, 0), 1.0f);
+
+    manager.RegisterCollider(&a);
+    manager.RegisterCollider(&b);
+    manager.RegisterCollider(&far);
+
+    int enters = 0;
+    int stays = 0;
+    manager.AddCollisionEnterCallback([&](const CollisionInfo&) { ++enters; });
+    manager.AddCollisionStayCallback([&](const CollisionInfo&) { ++stays; });
+
+    manager.Update();
+    TEST_ASSERT_EQUAL(1, enters);
+    TEST_ASSERT_EQUAL(0, stays);
+
+    manager.Update();
+    TEST_ASSERT_EQUAL(1, enters);
+    TEST_ASSERT_EQUAL(1, stays);
+}
+
+void TestCollisionManager::TestRaycastClosestHit() {
+    CollisionManager manager;
+    SphereCollider nearSphere(Vector3D(0, 0, 10), 1.0f);
+    SphereCollider farSphere(Vector3D(0, 0, 20), 1.0f);
+    manager.RegisterCollider(&farSphere);
+    manager.RegisterCollider(&nearSphere);
+
+    RaycastHit hit;
+    TEST_ASSERT_TRUE(manager.Raycast(Vector3D(0, 0, 0), Vector3D(0, 0, 1), hit, 100.0f));
+    TEST_ASSERT_EQUAL_PTR(&nearSphere, hit.collider);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 9.0f, hit.distance);
+
+    TEST_ASSERT_FALSE(manager.Raycast(Vector3D(0, 0, 0), Vector3D(0, 0, 1), hit, 5.0f));
+    TEST_ASSERT_FALSE(manager.Raycast(Vector3D(0, 0, 0), Vector3D(0, 1, 0), hit, 100.0f));
+
+    nearSphere.SetLayer(3);
+    TEST_ASSERT_TRUE(manager.Raycast(Vector3D(0, 0, 0), Vector3D(0, 0, 1), hit, 100.0f, 1u << 0));
+    TEST_ASSERT_EQUAL_PTR(&farSphere, hit.collider);
+}
+
+void TestCollisionManager::TestRaycastAllSorted() {
+    CollisionManager manager;
+    SphereCollider s1(Vector3D(0, 0, 30), 1.0f);
+    SphereCollider s2(Vector3D(0, 0, 10), 1.0f);
+    SphereCollider s3(Vector3D(0, 0, 20), 1.0f);
+    manager.RegisterCollider(&s1);
+    manager.RegisterCollider(&s2);
+    manager.RegisterCollider(&s3);
+
+    std::vector<RaycastHit> hits;
+    TEST_ASSERT_EQUAL(3, manager.RaycastAll(Vector3D(0, 0, 0), Vector3D(0, 0, 1), hits, 100.0f));
+    TEST_ASSERT_EQUAL_PTR(&s2, hits[0].collider);
+    TEST_ASSERT_EQUAL_PTR(&s3, hits[1].collider);
+    TEST_ASSERT_EQUAL_PTR(&s1, hits[2].collider);
+}
+
+void TestCollisionManager::TestOverlapSphere() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(5, 0, 0), 1.0f);
+    manager.RegisterCollider(&a);
+    manager.RegisterCollider(&b);
+
+    TEST_ASSERT_TRUE(manager.OverlapSphere(Vector3D(2, 0, 0), 1.5f));
+    TEST_ASSERT_FALSE(manager.OverlapSphere(Vector3D(2.5f, 0, 0), 0.5f));
+
+    std::vector<Collider*> results;
+    TEST_ASSERT_EQUAL(2, manager.OverlapSphereAll(Vector3D(2.5f, 0, 0), 2.0f, results));
+    TEST_ASSERT_EQUAL(1, manager.OverlapSphereAll(Vector3D(5, 0, 0), 0.5f, results));
+    TEST_ASSERT_EQUAL_PTR(&b, results[0]);
+}
+
+void TestCollisionManager::TestOverlapBox() {
+    CollisionManager manager;
+    SphereCollider sphere(Vector3D(0, 0, 0), 1.0f);
+    BoxCollider box(Vector3D(10, 0, 0), Vector3D(2, 2, 2));
+    CapsuleCollider capsule(Vector3D(-10, 0, 0), 0.5f, 4.0f);
+    manager.RegisterCollider(&sphere);
+    manager.RegisterCollider(&box);
+    manager.RegisterCollider(&capsule);
+
+    TEST_ASSERT_TRUE(manager.OverlapBox(Vector3D(1.5f, 0, 0), Vector3D(0.6f, 0.6f, 0.6f)));
+    TEST_ASSERT_FALSE(manager.OverlapBox(Vector3D(1.5f, 1.5f, 0), Vector3D(0.4f, 0.4f, 0.4f)));
+    TEST_ASSERT_TRUE(manager.OverlapBox(Vector3D(11.5f, 0, 0), Vector3D(1, 1, 1)));
+    TEST_ASSERT_TRUE(manager.OverlapBox(Vector3D(-10, 1.8f, 0), Vector3D(0.2f, 0.2f, 0.2f)));
+    TEST_ASSERT_FALSE(manager.OverlapBox(Vector3D(-10, 3.0f, 0), Vector3D(0.2f, 0.2f, 0.2f)));
+}
+
+void TestCollisionManager::TestRaycastBatchMatchesSingle() {
+    CollisionManager manager;
+    std::vector<SphereCollider> spheres;
+    spheres.reserve(64);
+    for (int i = 0; i < 64; ++i) {
+        spheres.emplace_back(Vector3D(static_cast<float>((i % 8) * 4), static_cast<float>((i / 8) * 4), 20.0f), 1.0f);
+    }
+    for (auto& s : spheres) manager.RegisterCollider(&s);
+
+    std::vector<RaycastQuery> queries;
+    for (int i = 0; i < 200; ++i) {
+        const float x = static_cast<float>(i % 20) * 1.7f - 2.0f;
+        const float y = static_cast<float>(i / 20) * 3.1f - 1.0f;
+        queries.emplace_back(Vector3D(x, y, 0), Vector3D(0, 0, 1), 50.0f);
+    }
+
+    std::vector<RaycastHit> hits;
+    int hitCount = manager.RaycastBatch(queries, hits);
+    TEST_ASSERT_EQUAL(static_cast<int>(queries.size()), static_cast<int>(hits.size()));
+
+    int expectedCount = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        RaycastHit single;
+        bool hit = manager.Raycast(queries[i].origin, queries[i].direction, single, queries[i].maxDistance);
+        TEST_ASSERT_EQUAL(hit, hits[i].collider != nullptr);
+        if (hit) {
+            ++expectedCount;
+            TEST_ASSERT_EQUAL_PTR(single.collider, hits[i].collider);
+            TEST_ASSERT_FLOAT_WITHIN(1e-4f, single.distance, hits[i].distance);
+        }
+    }
+    TEST_ASSERT_EQUAL(expectedCount, hitCount);
+    TEST_ASSERT_TRUE(hitCount > 0);
+}
+
+void TestCollisionManager::TestOverlapSphereBatch() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    BoxCollider box(Vector3D(10, 0, 0), Vector3D(2, 2, 2));
+    manager.RegisterCollider(&a);
+    manager.RegisterCollider(&box);
+
+    std::vector<OverlapSphereQuery> queries;
+    for (int i = 0; i < 100; ++i) {
+        queries.emplace_back(Vector3D(static_cast<float>(i) * 0.2f - 2.0f, 0, 0), 0.5f);
+    }
+
+    std::unique_ptr<bool[]> results(new bool[queries.size()]);
+    int count = manager.OverlapSphereBatch(queries.data(), queries.size(), results.get());
+
+    int expected = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        bool single = manager.OverlapSphere(queries[i].center, queries[i].radius);
+        TEST_ASSERT_EQUAL(single, results[i]);
+        if (single) ++expected;
+    }
+    TEST_ASSERT_EQUAL(expected, count);
+}
+
+void TestCollisionManager::TestSyncBroadPhaseAfterMove() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    manager.RegisterCollider(&a);
+
+    a.SetPosition(Vector3D(50, 0, 0));
+    manager.SyncBroadPhase();
+
+    TEST_ASSERT_TRUE(manager.OverlapSphere(Vector3D(50, 0, 0), 0.5f));
+    TEST_ASSERT_FALSE(manager.OverlapSphere(Vector3D(0, 0, 0), 0.5f));
+}
+
+void TestCollisionManager::TestExitEventCarriesContact() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(1.5f, 0, 0), 1.0f);
+    manager.RegisterCollider(&a);
+    manager.RegisterCollider(&b);
+
+    int exits = 0;
+    CollisionInfo last;
+    manager.AddCollisionExitCallback([&](const CollisionInfo& info) { ++exits; last = info; });
+
+    manager.Update();
+    TEST_ASSERT_EQUAL(1, manager.GetContactCount());
+
+    b.SetPosition(Vector3D(10, 0, 0));
+    manager.Update();
+
+    TEST_ASSERT_EQUAL(1, exits);
+    TEST_ASSERT_EQUAL(0, manager.GetContactCount());
+    TEST_ASSERT_EQUAL(0, manager.GetContacts().GetCount());
+    TEST_ASSERT_TRUE(last.colliderA == &a || last.colliderB == &a);
+    TEST_ASSERT_TRUE(last.colliderA == &b || last.colliderB == &b);
+    TEST_ASSERT_TRUE(last.penetrationDepth > 0.0f);
+}
+
+void TestCollisionManager::TestBatchCallbacks() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(1.5f, 0, 0), 1.0f);
+    SphereCollider c(Vector3D(-1.5f, 0, 0), 1.0f);
+    manager.RegisterCollider(&a);
+    manager.RegisterCollider(&b);
+    manager.RegisterCollider(&c);
+
+    int enterBatches = 0;
+    size_t enterEvents = 0;
+    size_t stayEvents = 0;
+    manager.AddCollisionEnterBatchCallback([&](const CollisionInfo*, size_t count) { ++enterBatches; enterEvents += count; });
+    manager.AddCollisionStayBatchCallback([&](const CollisionInfo*, size_t count) { stayEvents += count; });
+
+    manager.Update();
+    TEST_ASSERT_EQUAL(1, enterBatches);
+    TEST_ASSERT_EQUAL(2, enterEvents);
+
+    // Steady state reuses the same manifolds
+    const size_t poolSize = manager.GetContacts().GetPoolSize();
+    manager.Update();
+    manager.Update();
+    TEST_ASSERT_EQUAL(1, enterBatches);
+    TEST_ASSERT_EQUAL(4, stayEvents);
+    TEST_ASSERT_EQUAL(poolSize, manager.GetContacts().GetPoolSize());
+
+    manager.ClearCallbacks();
+    manager.Update();
+    TEST_ASSERT_EQUAL(4, stayEvents);
+}
+
+void TestCollisionManager::TestUnregisterDropsContacts() {
+    CollisionManager manager;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(1.5f, 0, 0), 1.0f);
+    manager.RegisterCollider(&a);
+    manager.RegisterCollider(&b);
+
+    int exits = 0;
+    manager.AddCollisionExitCallback([&](const CollisionInfo&) { ++exits; });
+
+    manager.Update();
+    manager.UnregisterCollider(&b);
+    TEST_ASSERT_EQUAL(0, manager.GetContactCount());
+
+    manager.Update();
+    TEST_ASSERT_EQUAL(0, exits);
+    TEST_ASSERT_EQUAL(0, manager.GetContacts().GetCount());
+}
+
+// ========== Edge Cases ==========
+
+void TestCollisionManager::TestEdgeCases() {
+    CollisionManager manager;
+    RaycastHit hit;
+
+    // Empty manager
+    TEST_ASSERT_FALSE(manager.Raycast(Vector3D(0, 0, 0), Vector3D(1, 0, 0), hit, 10.0f));
+    TEST_ASSERT_EQUAL(0, manager.RaycastBatch(nullptr, 0, nullptr));
+
+    // Disabled colliders are ignored by every query
+    SphereCollider a(Vector3D(5, 0, 0), 1.0f);
+    manager.RegisterCollider(&a);
+    a.SetEnabled(false);
+    TEST_ASSERT_FALSE(manager.Raycast(Vector3D(0, 0, 0), Vector3D(1, 0, 0), hit, 10.0f));
+    TEST_ASSERT_FALSE(manager.OverlapSphere(Vector3D(5, 0, 0), 1.0f));
+
+    // Axis-parallel ray starting on a slab plane
+    a.SetEnabled(true);
+    TEST_ASSERT_TRUE(manager.Raycast(Vector3D(4, 0, -5), Vector3D(0, 0, 1), hit, 10.0f));
+
+    manager.RegisterCollider(nullptr);
+    TEST_ASSERT_EQUAL(1, manager.GetColliderCount());
+}
+
+// ========== Test Runner ==========
+
+void TestCollisionManager::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestRegisterUnregister);
+    RUN_TEST(TestUpdateGeneratesEnterEvents);
+    RUN_TEST(TestRaycastClosestHit);
+    RUN_TEST(TestRaycastAllSorted);
+    RUN_TEST(TestOverlapSphere);
+    RUN_TEST(TestOverlapBox);
+    RUN_TEST(TestRaycastBatchMatchesSingle);
+    RUN_TEST(TestOverlapSphereBatch);
+    RUN_TEST(TestSyncBroadPhaseAfterMove);
+    RUN_TEST(TestExitEventCarriesContact);
+    RUN_TEST(TestBatchCallbacks);
+    RUN_TEST(TestUnregisterDropsContacts);
+    RUN_TEST(TestEdgeCases);
+}
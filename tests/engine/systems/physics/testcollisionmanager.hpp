@@ -0,0 +1,49 @@
+/**
+ * @file testcollisionmanager.hpp
+ * @brief Unit tests for the CollisionManager class.
+ *
+ * Covers broadphase-backed pair generation, contact events, single and batched
+ * raycasts, and overlap queries.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/physics/collisionmanager.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestCollisionManager
+ * @brief Contains static test methods for the CollisionManager class.
+ */
+class TestCollisionManager {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+    static void TestRegisterUnregister();
+
+    // Method tests
+    static void TestUpdateGeneratesEnterEvents();
+    static void TestRaycastClosestHit();
+    static void TestRaycastAllSorted();
+    static void TestOverlapSphere();
+    static void TestOverlapBox();
+    static void TestRaycastBatchMatchesSingle();
+    static void TestOverlapSphereBatch();
+    static void TestSyncBroadPhaseAfterMove();
+    static void TestExitEventCarriesContact();
+    static void TestBatchCallbacks();
+    static void TestUnregisterDropsContacts();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
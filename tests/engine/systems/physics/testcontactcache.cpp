@@ -0,0 +1,156 @@
+/**
+ * @file testcontactcache.cpp
+ * @brief Implementation of ContactCache unit tests.
+ */
+
+#include "testcontactcache.hpp"
+#include <ptx/systems/physics/spherecollider.hpp>
+
+using namespace ptx;
+
+// ========== Constructor Tests ==========
+
+void TestContactCache::TestDefaultConstructor() {
+    ContactCache cache;
+
+    TEST_ASSERT_EQUAL(0, cache.GetCount());
+    TEST_ASSERT_EQUAL(0, cache.GetPoolSize());
+    TEST_ASSERT_EQUAL_UINT32(ContactCache::kInvalidIndex, cache.Find(ContactCache::MakeKey(1, 2)));
+}
+
+// ========== Method Tests ==========
+
+void TestContactCache::TestMakeKeyOrderIndependent() {
+    TEST_ASSERT_TRUE(ContactCache::MakeKey(3, 7) == ContactCache::MakeKey(7, 3));
+    TEST_ASSERT_TRUE(ContactCache::MakeKey(1, 2) != ContactCache::MakeKey(1, 3));
+
+    // IDs above 16 bits must not alias (the old pointer packing truncated on 64-bit hosts)
+    TEST_ASSERT_TRUE(ContactCache::MakeKey(0x10000u, 1) != ContactCache::MakeKey(0x20000u, 1));
+}
+
+void TestContactCache::TestFindOrCreate() {
+    ContactCache cache;
+    bool created = false;
+
+    const uint32_t index = cache.FindOrCreate(ContactCache::MakeKey(1, 2), created);
+    TEST_ASSERT_TRUE(created);
+    TEST_ASSERT_TRUE(cache.Get(index).active);
+    TEST_ASSERT_EQUAL(1, cache.GetCount());
+
+    const uint32_t again = cache.FindOrCreate(ContactCache::MakeKey(2, 1), created);
+    TEST_ASSERT_FALSE(created);
+    TEST_ASSERT_EQUAL_UINT32(index, again);
+    TEST_ASSERT_EQUAL_UINT32(index, cache.Find(ContactCache::MakeKey(1, 2)));
+    TEST_ASSERT_EQUAL(1, cache.GetCount());
+}
+
+void TestContactCache::TestRemoveRecyclesIndex() {
+    ContactCache cache;
+    bool created = false;
+
+    const uint32_t first = cache.FindOrCreate(ContactCache::MakeKey(1, 2), created);
+    cache.FindOrCreate(ContactCache::MakeKey(1, 3), created);
+
+    cache.Remove(first);
+    TEST_ASSERT_EQUAL(1, cache.GetCount());
+    TEST_ASSERT_FALSE(cache.Get(first).active);
+    TEST_ASSERT_EQUAL_UINT32(ContactCache::kInvalidIndex, cache.Find(ContactCache::MakeKey(1, 2)));
+    TEST_ASSERT_TRUE(cache.Find(ContactCache::MakeKey(1, 3)) != ContactCache::kInvalidIndex);
+
+    const uint32_t reused = cache.FindOrCreate(ContactCache::MakeKey(4, 5), created);
+    TEST_ASSERT_TRUE(created);
+    TEST_ASSERT_EQUAL_UINT32(first, reused);
+    TEST_ASSERT_EQUAL(2, cache.GetPoolSize());
+}
+
+void TestContactCache::TestRemoveCollider() {
+    ContactCache cache;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(1, 0, 0), 1.0f);
+    SphereCollider c(Vector3D(2, 0, 0), 1.0f);
+    bool created = false;
+
+    ContactManifold& ab = cache.Get(cache.FindOrCreate(ContactCache::MakeKey(a.GetID(), b.GetID()), created));
+    ab.info.colliderA = &a;
+    ab.info.colliderB = &b;
+
+    ContactManifold& bc = cache.Get(cache.FindOrCreate(ContactCache::MakeKey(b.GetID(), c.GetID()), created));
+    bc.info.colliderA = &b;
+    bc.info.colliderB = &c;
+
+    TEST_ASSERT_EQUAL(1, cache.RemoveCollider(&a));
+    TEST_ASSERT_EQUAL(1, cache.GetCount());
+    TEST_ASSERT_EQUAL(1, cache.RemoveCollider(&c));
+    TEST_ASSERT_EQUAL(0, cache.GetCount());
+}
+
+void TestContactCache::TestClearKeepsStorage() {
+    ContactCache cache;
+    bool created = false;
+
+    for (uint32_t i = 1; i <= 10; ++i) {
+        cache.FindOrCreate(ContactCache::MakeKey(0, i), created);
+    }
+
+    cache.Clear();
+    TEST_ASSERT_EQUAL(0, cache.GetCount());
+    TEST_ASSERT_EQUAL(10, cache.GetPoolSize());
+
+    for (uint32_t i = 1; i <= 10; ++i) {
+        cache.FindOrCreate(ContactCache::MakeKey(100, i), created);
+        TEST_ASSERT_TRUE(created);
+    }
+    TEST_ASSERT_EQUAL(10, cache.GetPoolSize());
+}
+
+void TestContactCache::TestGrowth() {
+    ContactCache cache(8);
+    bool created = false;
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        cache.FindOrCreate(ContactCache::MakeKey(i, i + 1), created);
+    }
+    TEST_ASSERT_EQUAL(1000, cache.GetCount());
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const uint32_t index = cache.Find(ContactCache::MakeKey(i + 1, i));
+        TEST_ASSERT_TRUE(index != ContactCache::kInvalidIndex);
+        TEST_ASSERT_TRUE(cache.Get(index).key == ContactCache::MakeKey(i, i + 1));
+    }
+}
+
+// ========== Edge Cases ==========
+
+void TestContactCache::TestEdgeCases() {
+    ContactCache cache(8);
+    bool created = false;
+
+    // Removing invalid or already removed indices is a no-op
+    cache.Remove(ContactCache::kInvalidIndex);
+    const uint32_t index = cache.FindOrCreate(ContactCache::MakeKey(1, 2), created);
+    cache.Remove(index);
+    cache.Remove(index);
+    TEST_ASSERT_EQUAL(0, cache.GetCount());
+
+    // Churn builds up tombstones; lookups must stay correct without unbounded growth
+    for (uint32_t i = 0; i < 5000; ++i) {
+        const uint32_t slot = cache.FindOrCreate(ContactCache::MakeKey(i, i + 7), created);
+        TEST_ASSERT_TRUE(created);
+        cache.Remove(slot);
+    }
+    TEST_ASSERT_EQUAL(0, cache.GetCount());
+    TEST_ASSERT_EQUAL(1, cache.GetPoolSize());
+}
+
+// ========== Test Runner ==========
+
+void TestContactCache::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestMakeKeyOrderIndependent);
+    RUN_TEST(TestFindOrCreate);
+    RUN_TEST(TestRemoveRecyclesIndex);
+    RUN_TEST(TestRemoveCollider);
+    RUN_TEST(TestClearKeepsStorage);
+    RUN_TEST(TestGrowth);
+    RUN_TEST(TestEdgeCases);
+}
@@ -0,0 +1,40 @@
+/**
+ * @file testcontactcache.hpp
+ * @brief Unit tests for the ContactCache class.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/physics/contactcache.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestContactCache
+ * @brief Contains static test methods for the ContactCache class.
+ */
+class TestContactCache {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+
+    // Method tests
+    static void TestMakeKeyOrderIndependent();
+    static void TestFindOrCreate();
+    static void TestRemoveRecyclesIndex();
+    static void TestRemoveCollider();
+    static void TestClearKeepsStorage();
+    static void TestGrowth();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,288 @@
+/**
+ * @file testphysicsworld.cpp
+ * @brief Implementation of PhysicsWorld unit tests.
+ */
+
+#include "testphysicsworld.hpp"
+#include <memory>
+#include <vector>
+
+using namespace ptx;
+
+namespace {
+
+// Steps the world for a number of 60 Hz frames.
+void Run(PhysicsWorld& world, int frames) {
+    for (int i = 0; i < frames; ++i) {
+        world.Step(1.0f / 60.0f);
+    }
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestPhysicsWorld::TestDefaultConstructor() {
+    PhysicsWorld world;
+
+    TEST_ASSERT_EQUAL(0, world.GetBodyCount());
+    TEST_ASSERT_EQUAL(0, world.GetIslandCount());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, -9.81f, world.GetGravity().Y);
+    TEST_ASSERT_TRUE(world.IsSleepingEnabled());
+}
+
+void TestPhysicsWorld::TestCreateDestroyBody() {
+    PhysicsWorld world;
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(5, 0, 0), 1.0f);
+    SphereCollider c(Vector3D(10, 0, 0), 1.0f);
+
+    const int32_t bodyA = world.CreateBody(&a);
+    const int32_t bodyB = world.CreateBody(&b, RigidBody(RigidBodyType::Dynamic, 2.0f));
+    const int32_t bodyC = world.CreateBody(&c, RigidBody(RigidBodyType::Static, 0.0f));
+
+    TEST_ASSERT_EQUAL(3, world.GetBodyCount());
+    TEST_ASSERT_EQUAL(3, world.GetCollisionManager().GetColliderCount());
+    TEST_ASSERT_EQUAL(PhysicsWorld::kInvalidBody, world.CreateBody(&a));
+    TEST_ASSERT_EQUAL(bodyB, world.GetBody(&b));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 2.0f, world.GetMass(bodyB));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 4.18879f, world.GetMass(bodyA)); // density 1, unit sphere
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, world.GetMass(bodyC));
+
+    // Removing the first body swaps the last one into its slot; handles stay valid.
+    world.DestroyBody(bodyA);
+    TEST_ASSERT_FALSE(world.IsValid(bodyA));
+    TEST_ASSERT_EQUAL(2, world.GetBodyCount());
+    TEST_ASSERT_EQUAL_PTR(&c, world.GetCollider(bodyC));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 10.0f, world.GetPosition(bodyC).X);
+    TEST_ASSERT_EQUAL(2, world.GetCollisionManager().GetColliderCount());
+
+    world.Clear();
+    TEST_ASSERT_EQUAL(0, world.GetBodyCount());
+    TEST_ASSERT_EQUAL(0, world.GetCollisionManager().GetColliderCount());
+}
+
+// ========== Method Tests ==========
+
+void TestPhysicsWorld::TestGravityIntegration() {
+    PhysicsWorld world;
+    SphereCollider ball(Vector3D(0, 10, 0), 0.5f);
+    const int32_t body = world.CreateBody(&ball);
+
+    Run(world, 60);
+
+    // Semi-implicit Euler: v = g * t exactly, position close to 0.5 * g * t^2.
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, -9.81f, world.GetLinearVelocity(body).Y);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 10.0f - 4.905f, world.GetPosition(body).Y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, world.GetPosition(body).Y, ball.GetPosition().Y);
+}
+
+void TestPhysicsWorld::TestRestingOnStaticFloor() {
+    PhysicsWorld world;
+    BoxCollider floor(Vector3D(0, -0.5f, 0), Vector3D(20, 1, 20));
+    SphereCollider ball(Vector3D(0, 2, 0), 0.5f);
+    world.GetCollisionManager().RegisterCollider(&floor); // static geometry without a body
+    const int32_t body = world.CreateBody(&ball);
+
+    Run(world, 180);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 0.5f, world.GetPosition(body).Y);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 0.0f, world.GetLinearVelocity(body).Y);
+    TEST_ASSERT_EQUAL(1, world.GetContactConstraintCount());
+}
+
+void TestPhysicsWorld::TestSleepAndWake() {
+    PhysicsWorld world;
+    BoxCollider floor(Vector3D(0, -0.5f, 0), Vector3D(20, 1, 20));
+    SphereCollider ball(Vector3D(0, 0.5f, 0), 0.5f);
+    world.CreateBody(&floor, RigidBody(RigidBodyType::Static, 0.0f));
+    const int32_t body = world.CreateBody(&ball);
+
+    Run(world, 120);
+    TEST_ASSERT_FALSE(world.IsAwake(body));
+    TEST_ASSERT_EQUAL(0, world.GetAwakeBodyCount());
+    TEST_ASSERT_EQUAL(0, world.GetAwakeIslandCount());
+
+    const float restingY = world.GetPosition(body).Y;
+    Run(world, 30);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, restingY, world.GetPosition(body).Y);
+
+    world.ApplyImpulse(body, Vector3D(0, 5, 0), world.GetPosition(body));
+    TEST_ASSERT_TRUE(world.IsAwake(body));
+    world.Step(1.0f / 60.0f);
+    TEST_ASSERT_TRUE(world.GetPosition(body).Y > restingY);
+}
+
+void TestPhysicsWorld::TestIslandsAreIndependent() {
+    PhysicsWorld world;
+    world.SetGravity(Vector3D(0, 0, 0));
+
+    // Two touching pairs far apart form two islands; a lone body forms a third.
+    SphereCollider a(Vector3D(0, 0, 0), 1.0f);
+    SphereCollider b(Vector3D(1.9f, 0, 0), 1.0f);
+    SphereCollider c(Vector3D(100, 0, 0), 1.0f);
+    SphereCollider d(Vector3D(101.9f, 0, 0), 1.0f);
+    SphereCollider e(Vector3D(-100, 0, 0), 1.0f);
+    for (SphereCollider* s : { &a, &b, &c, &d, &e }) {
+        world.CreateBody(s);
+    }
+
+    world.Step(1.0f / 60.0f);
+    TEST_ASSERT_EQUAL(3, world.GetIslandCount());
+    TEST_ASSERT_EQUAL(2, world.GetContactConstraintCount());
+
+    // Overlapping pairs are pushed apart symmetrically.
+    TEST_ASSERT_TRUE(world.GetLinearVelocity(world.GetBody(&a)).X < 0.0f);
+    TEST_ASSERT_TRUE(world.GetLinearVelocity(world.GetBody(&b)).X > 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, -world.GetLinearVelocity(world.GetBody(&c)).X,
+                             world.GetLinearVelocity(world.GetBody(&d)).X);
+}
+
+void TestPhysicsWorld::TestWarmStartImpulsesCached() {
+    PhysicsWorld world;
+    BoxCollider floor(Vector3D(0, -0.5f, 0), Vector3D(20, 1, 20));
+    SphereCollider ball(Vector3D(0, 0.49f, 0), 0.5f);
+    world.SetSleepingEnabled(false);
+    world.GetCollisionManager().RegisterCollider(&floor);
+    const int32_t body = world.CreateBody(&ball, RigidBody(RigidBodyType::Dynamic, 1.0f));
+
+    Run(world, 60);
+
+    const CollisionManager& manager = world.GetCollisionManager();
+    TEST_ASSERT_EQUAL(1, manager.GetActiveContacts().size());
+    const ContactManifold& manifold = manager.GetContacts().Get(manager.GetActiveContacts()[0]);
+
+    // At rest the cached normal impulse carries the body's weight for one step.
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 9.81f / 60.0f, manifold.normalImpulse);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, world.GetLinearVelocity(body).Y);
+}
+
+void TestPhysicsWorld::TestRestitution() {
+    PhysicsWorld world;
+    world.SetGravity(Vector3D(0, 0, 0));
+
+    BoxCollider wall(Vector3D(0, 0, 0), Vector3D(1, 10, 10));
+    SphereCollider ball(Vector3D(2, 0, 0), 0.5f);
+    wall.SetMaterial(PhysicsMaterial(0.0f, 1.0f, 1.0f));
+    ball.SetMaterial(PhysicsMaterial(0.0f, 1.0f, 1.0f));
+    world.CreateBody(&wall, RigidBody(RigidBodyType::Static, 0.0f));
+
+    RigidBody desc;
+    desc.linearVelocity = Vector3D(-10, 0, 0);
+    const int32_t body = world.CreateBody(&ball, desc);
+
+    Run(world, 30);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 10.0f, world.GetLinearVelocity(body).X);
+}
+
+void TestPhysicsWorld::TestKinematicPushesDynamic() {
+    PhysicsWorld world;
+    world.SetGravity(Vector3D(0, 0, 0));
+
+    BoxCollider pusher(Vector3D(0, 0, 0), Vector3D(1, 1, 1));
+    SphereCollider ball(Vector3D(1.2f, 0, 0), 0.5f);
+
+    RigidBody kinematic(RigidBodyType::Kinematic, 0.0f);
+    kinematic.linearVelocity = Vector3D(2, 0, 0);
+    const int32_t pusherBody = world.CreateBody(&pusher, kinematic);
+    const int32_t ballBody = world.CreateBody(&ball);
+    world.SetAwake(ballBody, false);
+
+    Run(world, 60);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 2.0f, world.GetPosition(pusherBody).X);
+    TEST_ASSERT_TRUE(world.GetPosition(ballBody).X > 2.4f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 2.0f, world.GetLinearVelocity(pusherBody).X);
+}
+
+void TestPhysicsWorld::TestDeterministicAcrossRuns() {
+    // Many small stacks solved in parallel must give identical results every run.
+    auto simulate = [](std::vector<float>& heights) {
+        PhysicsWorld world;
+        BoxCollider floor(Vector3D(0, -0.5f, 0), Vector3D(200, 1, 200));
+        world.GetCollisionManager().RegisterCollider(&floor);
+
+        std::vector<std::unique_ptr<SphereCollider>> balls;
+        for (int stack = 0; stack < 16; ++stack) {
+            for (int level = 0; level < 3; ++level) {
+                balls.emplace_back(new SphereCollider(Vector3D(stack * 4.0f, 0.5f + level * 1.05f, 0), 0.5f));
+                world.CreateBody(balls.back().get());
+            }
+        }
+
+        Run(world, 90);
+
+        heights.clear();
+        for (const auto& ball : balls) {
+            heights.push_back(ball->GetPosition().Y);
+        }
+    };
+
+    std::vector<float> first, second;
+    simulate(first);
+    simulate(second);
+
+    TEST_ASSERT_EQUAL(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); ++i) {
+        TEST_ASSERT_EQUAL_FLOAT(first[i], second[i]);
+    }
+
+    // Stacks stay upright and above the floor.
+    for (size_t i = 0; i < first.size(); ++i) {
+        TEST_ASSERT_TRUE(first[i] > 0.4f);
+    }
+}
+
+// ========== Edge Cases ==========
+
+void TestPhysicsWorld::TestEdgeCases() {
+    PhysicsWorld world;
+
+    // Invalid handles are ignored
+    TEST_ASSERT_EQUAL(PhysicsWorld::kInvalidBody, world.CreateBody(nullptr));
+    world.DestroyBody(42);
+    world.SetLinearVelocity(-1, Vector3D(1, 0, 0));
+    TEST_ASSERT_FALSE(world.IsAwake(7));
+    TEST_ASSERT_EQUAL_PTR(nullptr, world.GetCollider(3));
+
+    // Zero or negative time steps do nothing
+    SphereCollider ball(Vector3D(0, 5, 0), 0.5f);
+    const int32_t body = world.CreateBody(&ball);
+    world.Step(0.0f);
+    world.Step(-1.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 5.0f, world.GetPosition(body).Y);
+
+    // Static bodies ignore velocity changes
+    SphereCollider rock(Vector3D(10, 0, 0), 1.0f);
+    const int32_t rockBody = world.CreateBody(&rock, RigidBody(RigidBodyType::Static, 0.0f));
+    world.SetLinearVelocity(rockBody, Vector3D(1, 0, 0));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, world.GetLinearVelocity(rockBody).X);
+
+    // Triggers never generate constraints
+    SphereCollider trigger(Vector3D(0, 5, 0), 2.0f);
+    trigger.SetTrigger(true);
+    world.GetCollisionManager().RegisterCollider(&trigger);
+    world.Step(1.0f / 60.0f);
+    TEST_ASSERT_EQUAL(0, world.GetContactConstraintCount());
+
+    // Handles are recycled after destruction
+    world.DestroyBody(body);
+    SphereCollider other(Vector3D(0, 0, 0), 1.0f);
+    TEST_ASSERT_EQUAL(body, world.CreateBody(&other));
+}
+
+// ========== Test Runner ==========
+
+void TestPhysicsWorld::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestCreateDestroyBody);
+    RUN_TEST(TestGravityIntegration);
+    RUN_TEST(TestRestingOnStaticFloor);
+    RUN_TEST(TestSleepAndWake);
+    RUN_TEST(TestIslandsAreIndependent);
+    RUN_TEST(TestWarmStartImpulsesCached);
+    RUN_TEST(TestRestitution);
+    RUN_TEST(TestKinematicPushesDynamic);
+    RUN_TEST(TestDeterministicAcrossRuns);
+    RUN_TEST(TestEdgeCases);
+}
@@ -0,0 +1,45 @@
+/**
+ * @file testphysicsworld.hpp
+ * @brief Unit tests for the PhysicsWorld class.
+ *
+ * Covers body storage, integration, contact resolution, islands and sleeping.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/physics/physicsworld.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestPhysicsWorld
+ * @brief Contains static test methods for the PhysicsWorld class.
+ */
+class TestPhysicsWorld {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+    static void TestCreateDestroyBody();
+
+    // Method tests
+    static void TestGravityIntegration();
+    static void TestRestingOnStaticFloor();
+    static void TestSleepAndWake();
+    static void TestIslandsAreIndependent();
+    static void TestWarmStartImpulsesCached();
+    static void TestRestitution();
+    static void TestKinematicPushesDynamic();
+    static void TestDeterministicAcrossRuns();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -2,7 +2,8 @@
  * @file testvectorfield2d.hpp
  * @brief Unit tests for the VectorField2D class.
  *
- * TODO: Add detailed description of what this test suite covers.
+ * Covers storage formats, boundary conditions, the stable-fluids solver
+ * (diffusion, advection, projection), pattern generators and sampling.
  *
  * @date 10/10/2025
  * @version 1.0
@@ -36,9 +37,17 @@ public:
     static void TestGetCountX();
     static void TestGetCountY();
     static void TestRenderDensity();
-    // ... add tests for remaining 5 methods
+    static void TestGetVectorAtPosition();
+    static void TestRenderVector();
+    static void TestSetPosition();
+    static void TestSetRotation();
+    static void TestSetSize();
 
     // Functionality tests
+    static void TestProjectRemovesDivergence();
+    static void TestStepConservesDensity();
+    static void TestStorageFormatsAgree();
+    static void TestParallelSolveIsDeterministic();
 
     // Edge case & integration tests
     static void TestEdgeCases();
@@ -46,10 +55,5 @@ public:
     /**
      * @brief Runs all test methods.
      */
-    static void TestGetVectorAtPosition();
-    static void TestRenderVector();
-    static void TestSetPosition();
-    static void TestSetRotation();
-    static void TestSetSize();
     static void RunAllTests();
 };
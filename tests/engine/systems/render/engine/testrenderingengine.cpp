@@ -4,6 +4,89 @@
  */
 
 #include "testrenderingengine.hpp"
+#include <ptx/assets/model/statictrianglegroup.hpp>
+#include <ptx/assets/model/trianglegroup.hpp>
+#include <ptx/systems/render/core/camera.hpp>
+#include <ptx/systems/render/core/pixelgroup.hpp>
+#include <ptx/systems/render/material/implementations/uniformcolormaterial.hpp>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief A red backdrop with a green triangle in front, seen by four 8x8 cameras.
+ *
+ * Cameras 0 and 1 share a transform; each camera owns a pixel group tiling a 16x16 area.
+ */
+struct MultiCameraRig {
+    Vector3D backVertices[4] = {Vector3D(-4, -4, 10), Vector3D(36, -4, 10), Vector3D(36, 36, 10), Vector3D(-4, 36, 10)};
+    Vector3D frontVertices[3] = {Vector3D(2, 2, 5), Vector3D(14, 4, 5), Vector3D(5, 13, 5)};
+    IndexGroup backIndices[2] = {IndexGroup(0, 1, 2), IndexGroup(0, 2, 3)};
+    IndexGroup frontIndices[1] = {IndexGroup(0, 1, 2)};
+
+    StaticTriangleGroup backStatic{backVertices, backIndices, 4, 2};
+    StaticTriangleGroup frontStatic{frontVertices, frontIndices, 3, 1};
+    TriangleGroup backTriangles{&backStatic};
+    TriangleGroup frontTriangles{&frontStatic};
+    UniformColorMaterial red{RGBColor(255, 0, 0)};
+    UniformColorMaterial green{RGBColor(0, 255, 0)};
+    Mesh back{&backStatic, &backTriangles, &red};
+    Mesh front{&frontStatic, &frontTriangles, &green};
+    Scene scene{2};
+
+    Transform sharedTransform;
+    Transform ownTransforms[2];
+    CameraLayout layout{CameraLayout::ZForward, CameraLayout::YUp};
+    PixelGroup pixels0{64, Vector2D(8, 8), Vector2D(0, 0), 8};
+    PixelGroup pixels1{64, Vector2D(8, 8), Vector2D(8, 0), 8};
+    PixelGroup pixels2{64, Vector2D(8, 8), Vector2D(0, 8), 8};
+    PixelGroup pixels3{64, Vector2D(8, 8), Vector2D(8, 8), 8};
+    Camera camera0{&sharedTransform, &layout, &pixels0};
+    Camera camera1{&sharedTransform, &layout, &pixels1};
+    Camera camera2{&ownTransforms[0], &layout, &pixels2};
+    Camera camera3{&ownTransforms[1], &layout, &pixels3};
+    CameraBase* list[4] = {&camera0, &camera1, &camera2, &camera3};
+    CameraManager manager{list, 4};
+
+    MultiCameraRig() {
+        scene.AddMesh(&back);
+        scene.AddMesh(&front);
+    }
+
+    /** @brief Overwrites every pixel so stale output cannot pass a comparison. */
+    void Clear() {
+        for (CameraBase* camera : list) {
+            IPixelGroup* group = camera->GetPixelGroup();
+            for (uint16_t i = 0; i < group->GetPixelCount(); ++i) *group->GetColor(i) = RGBColor(1, 2, 3);
+        }
+    }
+
+    /** @brief Copies every camera's colors in camera order. */
+    std::vector<RGBColor> Snapshot() {
+        std::vector<RGBColor> colors;
+        for (CameraBase* camera : list) {
+            IPixelGroup* group = camera->GetPixelGroup();
+            for (uint16_t i = 0; i < group->GetPixelCount(); ++i) colors.push_back(*group->GetColor(i));
+        }
+        return colors;
+    }
+};
+
+bool SameColors(const std::vector<RGBColor>& a, const std::vector<RGBColor>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].R != b[i].R || a[i].G != b[i].G || a[i].B != b[i].B) return false;
+    }
+    return true;
+}
+
+size_t CountColor(const std::vector<RGBColor>& colors, uint8_t r, uint8_t g, uint8_t b) {
+    size_t count = 0;
+    for (const RGBColor& color : colors) count += (color.R == r && color.G == g && color.B == b) ? 1 : 0;
+    return count;
+}
+
+} // namespace
 
 // ========== Constructor Tests ==========
 
@@ -24,7 +107,7 @@ void TestRenderingEngine::TestParameterizedConstructor() {
     // Test that the static methods exist and work with valid minimal parameters
 
     // Create minimal scene and camera setup
-    Scene scene;
+    Scene scene(1);
     Transform transform;
     PixelGroup pixelGroup(1, Vector2D(10.0f, 10.0f), Vector2D(0.0f, 0.0f), 1);
     Camera camera(&transform, &pixelGroup);
@@ -38,11 +121,134 @@ void TestRenderingEngine::TestParameterizedConstructor() {
     TEST_ASSERT_TRUE(true);
 }
 
+// ========== Functionality Tests ==========
+
+void TestRenderingEngine::TestRasterizeParallelMatchesSerial() {
+    MultiCameraRig rig;
+    ptx::ThreadPool pool(3);
+
+    RenderingEngine::Rasterize(&rig.scene, &rig.manager);
+    const std::vector<RGBColor> serial = rig.Snapshot();
+    TEST_ASSERT_TRUE(CountColor(serial, 255, 0, 0) > 0);
+    TEST_ASSERT_TRUE(CountColor(serial, 0, 255, 0) > 0);
+    TEST_ASSERT_EQUAL_size_t(0, CountColor(serial, 1, 2, 3));
+
+    // Repeated parallel renders reuse scratch and never depend on scheduling.
+    for (int frame = 0; frame < 5; ++frame) {
+        rig.Clear();
+        RenderingEngine::RasterizeParallel(&rig.scene, &rig.manager, nullptr, &pool);
+        TEST_ASSERT_TRUE(SameColors(serial, rig.Snapshot()));
+    }
+
+    // Moving the shared camera transform moves both of its cameras identically.
+    rig.sharedTransform.SetPosition(Vector3D(3, 1, 0));
+    RenderingEngine::Rasterize(&rig.scene, &rig.manager);
+    const std::vector<RGBColor> moved = rig.Snapshot();
+    TEST_ASSERT_FALSE(SameColors(serial, moved));
+
+    rig.Clear();
+    RenderingEngine::RasterizeParallel(&rig.scene, &rig.manager, nullptr, &pool);
+    TEST_ASSERT_TRUE(SameColors(moved, rig.Snapshot()));
+}
+
+void TestRenderingEngine::TestRasterStats() {
+    MultiCameraRig rig;
+    ptx::ThreadPool pool(3);
+
+    // Neither mesh has bounds yet, so every camera draws both.
+    RenderingEngine::Rasterize(&rig.scene, &rig.manager);
+    Rasterizer::Stats stats = RenderingEngine::GetRasterStats();
+    TEST_ASSERT_EQUAL_UINT32(8, stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.meshesCulled);
+
+    // Push the backdrop out of every camera; the triangle stays in view of all four.
+    rig.front.UpdateTransform();
+    rig.back.GetTransform()->SetPosition(Vector3D(1000, 0, 0));
+    rig.back.ResetVertices();
+    rig.back.UpdateTransform();
+
+    RenderingEngine::Rasterize(&rig.scene, &rig.manager);
+    const std::vector<RGBColor> serial = rig.Snapshot();
+    stats = RenderingEngine::GetRasterStats();
+    TEST_ASSERT_EQUAL_UINT32(4, stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.meshesCulled);
+    TEST_ASSERT_EQUAL_size_t(0, CountColor(serial, 255, 0, 0));
+    TEST_ASSERT_TRUE(CountColor(serial, 0, 255, 0) > 0);
+
+    // The parallel path culls the same meshes and produces the same pixels.
+    rig.Clear();
+    RenderingEngine::RasterizeParallel(&rig.scene, &rig.manager, nullptr, &pool);
+    stats = RenderingEngine::GetRasterStats();
+    TEST_ASSERT_EQUAL_UINT32(4, stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.meshesCulled);
+    TEST_ASSERT_TRUE(SameColors(serial, rig.Snapshot()));
+}
+
+void TestRenderingEngine::TestRasterizeParallelParticles() {
+    MultiCameraRig rig;
+    ptx::ThreadPool pool(3);
+
+    // One particle in front of the triangle and one hidden behind the backdrop.
+    ptx::ParticleSystem system;
+    ptx::ParticleEmitterConfig config;
+    config.maxParticles = 2;
+    auto emitter = system.CreateEmitter(config);
+    ptx::ParticlePool& particles = emitter->GetPool();
+    const size_t visible = particles.Spawn();
+    particles.SetPosition(visible, Vector3D(7, 7, 1));
+    particles.SetSize(visible, 6.0f);
+    particles.SetColor(visible, Vector3D(0, 0, 1));
+    particles.SetAlpha(visible, 1.0f);
+    const size_t hidden = particles.Spawn();
+    particles.SetPosition(hidden, Vector3D(12, 12, 20));
+    particles.SetSize(hidden, 6.0f);
+    particles.SetColor(hidden, Vector3D(1, 1, 1));
+    particles.SetAlpha(hidden, 1.0f);
+
+    ParticleSplatter splatter(&system);
+
+    RenderingEngine::Rasterize(&rig.scene, &rig.manager, &splatter);
+    const std::vector<RGBColor> serial = rig.Snapshot();
+
+    rig.Clear();
+    RenderingEngine::RasterizeParallel(&rig.scene, &rig.manager, &splatter, &pool);
+    const std::vector<RGBColor> parallel = rig.Snapshot();
+
+    TEST_ASSERT_TRUE(SameColors(serial, parallel));
+
+    size_t tinted = 0;
+    for (const RGBColor& color : parallel) tinted += color.B > 0 ? 1 : 0;
+    TEST_ASSERT_TRUE(tinted > 0);
+}
+
+void TestRenderingEngine::TestRasterizeParallelSharedPixelGroup() {
+    // Two cameras writing one pixel group fall back to the serial order: last camera wins.
+    MultiCameraRig rig;
+    ptx::ThreadPool pool(3);
+    Transform offset;
+    offset.SetPosition(Vector3D(-6, -6, 0));
+    Camera overlay(&offset, &rig.layout, &rig.pixels0);
+    CameraBase* list[2] = {&rig.camera0, &overlay};
+    CameraManager manager(list, 2);
+
+    RenderingEngine::Rasterize(&rig.scene, &manager);
+    const std::vector<RGBColor> serial = rig.Snapshot();
+
+    rig.Clear();
+    RenderingEngine::RasterizeParallel(&rig.scene, &manager, nullptr, &pool);
+    const std::vector<RGBColor> parallel = rig.Snapshot();
+
+    for (size_t i = 0; i < 64; ++i) {
+        TEST_ASSERT_EQUAL_UINT8(serial[i].G, parallel[i].G);
+        TEST_ASSERT_EQUAL_UINT8(serial[i].R, parallel[i].R);
+    }
+}
+
 // ========== Edge Cases ==========
 
 void TestRenderingEngine::TestEdgeCases() {
     // Test with valid scene but nullptr camera manager
-    Scene scene;
+    Scene scene(1);
     RenderingEngine::Rasterize(&scene, nullptr);
     RenderingEngine::RayTrace(&scene, nullptr);
 
@@ -56,6 +262,11 @@ void TestRenderingEngine::TestEdgeCases() {
     RenderingEngine::Rasterize(nullptr, &cameraManager);
     RenderingEngine::RayTrace(nullptr, &cameraManager);
 
+    // Parallel rendering shares the same null handling.
+    RenderingEngine::RasterizeParallel(nullptr, nullptr);
+    RenderingEngine::RasterizeParallel(&scene, nullptr);
+    RenderingEngine::RasterizeParallel(nullptr, &cameraManager);
+
     // If we get here, methods handle edge cases gracefully
     TEST_ASSERT_TRUE(true);
 }
@@ -65,5 +276,9 @@ void TestRenderingEngine::TestEdgeCases() {
 void TestRenderingEngine::RunAllTests() {
     RUN_TEST(TestDefaultConstructor);
     RUN_TEST(TestParameterizedConstructor);
+    RUN_TEST(TestRasterizeParallelMatchesSerial);
+    RUN_TEST(TestRasterizeParallelParticles);
+    RUN_TEST(TestRasterizeParallelSharedPixelGroup);
+    RUN_TEST(TestRasterStats);
     RUN_TEST(TestEdgeCases);
 }
@@ -23,6 +23,12 @@ public:
     static void TestDefaultConstructor();
     static void TestParameterizedConstructor();
 
+    // Functionality tests
+    static void TestRasterizeParallelMatchesSerial();
+    static void TestRasterizeParallelParticles();
+    static void TestRasterizeParallelSharedPixelGroup();
+    static void TestRasterStats();
+
     // Edge case & integration tests
     static void TestEdgeCases();
 
@@ -0,0 +1,229 @@
+/**
+ * @file testparticlesplatter.cpp
+ * @brief Implementation of ParticleSplatter unit tests.
+ */
+
+#include "testparticlesplatter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace ptx;
+
+namespace {
+
+constexpr uint16_t kSide = 16;
+
+/**
+ * @brief 16x16 camera looking down +Z with pixel (x, y) at index y * 16 + x.
+ */
+struct TestView {
+    Transform transform;
+    CameraLayout layout{CameraLayout::ZForward, CameraLayout::YUp};
+    PixelGroup pixels{kSide * kSide, Vector2D(kSide, kSide), Vector2D(0, 0), kSide};
+    Camera camera{&transform, &layout, &pixels};
+
+    RGBColor& At(int x, int y) { return *pixels.GetColor(static_cast<uint16_t>(y * kSide + x)); }
+};
+
+void AddParticle(ParticleEmitter& emitter, const Vector3D& position, float size,
+                 const Vector3D& color, float alpha) {
+    ParticlePool& pool = emitter.GetPool();
+    const size_t index = pool.Spawn();
+    pool.SetPosition(index, position);
+    pool.SetSize(index, size);
+    pool.SetColor(index, color);
+    pool.SetAlpha(index, alpha);
+}
+
+ParticleEmitterConfig Capacity(int maxParticles) {
+    ParticleEmitterConfig config;
+    config.maxParticles = maxParticles;
+    return config;
+}
+
+} // namespace
+
+// ========== Constructor Tests ==========
+
+void TestParticleSplatter::TestDefaultConstructor() {
+    ParticleSplatter splatter;
+
+    TEST_ASSERT_TRUE(splatter.GetParticleSystem() == nullptr);
+    TEST_ASSERT_TRUE(splatter.GetBlendMode() == ParticleBlendMode::Additive);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, splatter.GetMinimumRadius());
+
+    TestView view;
+    splatter.Splat(&view.camera);
+    TEST_ASSERT_EQUAL(0, static_cast<int>(splatter.GetVisibleParticleCount()));
+}
+
+// ========== Method Tests ==========
+
+void TestParticleSplatter::TestAdditiveSplat() {
+    ParticleSystem system;
+    auto emitter = system.CreateEmitter(Capacity(4));
+    AddParticle(*emitter, Vector3D(8, 8, 5), 4.0f, Vector3D(1, 0, 0), 1.0f);
+
+    TestView view;
+    ParticleSplatter splatter(&system);
+    splatter.Render(nullptr, &view.camera);
+
+    TEST_ASSERT_EQUAL(1, static_cast<int>(splatter.GetVisibleParticleCount()));
+    TEST_ASSERT_TRUE(splatter.GetTileCount() > 1);
+
+    // Radius 2, weight 1 - d^2 / r^2.
+    TEST_ASSERT_EQUAL_UINT8(255, view.At(8, 8).R);
+    TEST_ASSERT_EQUAL_UINT8(191, view.At(9, 8).R);
+    TEST_ASSERT_EQUAL_UINT8(191, view.At(8, 7).R);
+    TEST_ASSERT_EQUAL_UINT8(128, view.At(9, 9).R);
+    TEST_ASSERT_EQUAL_UINT8(0, view.At(10, 8).R);
+    TEST_ASSERT_EQUAL_UINT8(0, view.At(8, 8).G);
+}
+
+void TestParticleSplatter::TestAdditiveAccumulates() {
+    ParticleSystem system;
+    auto first = system.CreateEmitter(Capacity(2));
+    auto second = system.CreateEmitter(Capacity(2));
+    AddParticle(*first, Vector3D(4, 4, 1), 2.0f, Vector3D(1, 1, 1), 0.25f);
+    AddParticle(*second, Vector3D(4, 4, 2), 2.0f, Vector3D(1, 1, 1), 0.25f);
+
+    TestView view;
+    view.At(4, 4) = RGBColor(10, 20, 30);
+
+    ParticleSplatter splatter(&system);
+    splatter.Splat(&view.camera);
+
+    // Adds onto the existing pixel color.
+    TEST_ASSERT_EQUAL_UINT8(138, view.At(4, 4).R);
+    TEST_ASSERT_EQUAL_UINT8(148, view.At(4, 4).G);
+    TEST_ASSERT_EQUAL_UINT8(158, view.At(4, 4).B);
+
+    // Saturates instead of wrapping.
+    splatter.SetIntensity(8.0f);
+    splatter.Splat(&view.camera);
+    TEST_ASSERT_EQUAL_UINT8(255, view.At(4, 4).R);
+}
+
+void TestParticleSplatter::TestAlphaBlendOrder() {
+    ParticleSystem system;
+    auto emitter = system.CreateEmitter(Capacity(4));
+    // Near green first, far red second: blending must still go back to front.
+    AddParticle(*emitter, Vector3D(6, 6, 1), 2.0f, Vector3D(0, 1, 0), 0.5f);
+    AddParticle(*emitter, Vector3D(6, 6, 10), 2.0f, Vector3D(1, 0, 0), 1.0f);
+
+    TestView view;
+    ParticleSplatter splatter(&system, ParticleBlendMode::Alpha);
+    splatter.Splat(&view.camera);
+
+    TEST_ASSERT_EQUAL_UINT8(128, view.At(6, 6).R);
+    TEST_ASSERT_EQUAL_UINT8(128, view.At(6, 6).G);
+    TEST_ASSERT_EQUAL_UINT8(0, view.At(6, 6).B);
+}
+
+void TestParticleSplatter::TestDepthOcclusion() {
+    ParticleSystem system;
+    auto emitter = system.CreateEmitter(Capacity(4));
+    AddParticle(*emitter, Vector3D(3, 3, 5), 2.0f, Vector3D(1, 1, 1), 1.0f);
+    AddParticle(*emitter, Vector3D(12, 12, 1), 2.0f, Vector3D(1, 1, 1), 1.0f);
+
+    TestView view;
+    std::vector<float> depth(kSide * kSide, std::numeric_limits<float>::max());
+    depth[3 * kSide + 3] = 3.0f;     // Surface in front of the first particle
+    depth[12 * kSide + 12] = 3.0f;   // Surface behind the second particle
+
+    ParticleSplatter splatter(&system);
+    splatter.Splat(&view.camera, depth.data());
+
+    TEST_ASSERT_EQUAL_UINT8(0, view.At(3, 3).R);
+    TEST_ASSERT_EQUAL_UINT8(255, view.At(12, 12).R);
+}
+
+// ========== Functionality Tests ==========
+
+void TestParticleSplatter::TestMatchesReference() {
+    ParticleSystem system;
+    auto emitter = system.CreateEmitter(Capacity(200));
+    uint32_t seed = 12345u;
+    auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / 16777216.0f;
+    };
+    for (int i = 0; i < 200; ++i) {
+        AddParticle(*emitter, Vector3D(next() * 20.0f - 2.0f, next() * 20.0f - 2.0f, next() * 10.0f),
+                    0.5f + next() * 5.0f, Vector3D(next(), next(), next()), next() * 0.2f);
+    }
+
+    TestView view;
+    ParticleSplatter splatter(&system);
+    splatter.Splat(&view.camera);
+
+    // Brute force over every pixel and particle, ignoring tiles.
+    const ParticleSpan span = emitter->GetPool().GetSpan();
+    for (int y = 0; y < kSide; ++y) {
+        for (int x = 0; x < kSide; ++x) {
+            float red = 0.0f;
+            for (size_t i = 0; i < span.count; ++i) {
+                const float r = std::max(0.5f, span.size[i] * 0.5f);
+                const float dx = x - span.positionX[i];
+                const float dy = y - span.positionY[i];
+                const float d2 = dx * dx + dy * dy;
+                if (d2 < r * r) red += span.colorR[i] * 255.0f * span.alpha[i] * (1.0f - d2 / (r * r));
+            }
+            const int expected = static_cast<int>(std::min(255.0f, red + 0.5f));
+            TEST_ASSERT_UINT8_WITHIN(1, expected, view.At(x, y).R);
+        }
+    }
+
+    // Repeat renders are identical.
+    std::vector<uint8_t> first;
+    for (int i = 0; i < kSide * kSide; ++i) first.push_back(view.pixels.GetColor(i)->G);
+    for (int i = 0; i < kSide * kSide; ++i) *view.pixels.GetColor(i) = RGBColor(0, 0, 0);
+    splatter.Splat(&view.camera);
+    for (int i = 0; i < kSide * kSide; ++i) {
+        TEST_ASSERT_EQUAL_UINT8(first[i], view.pixels.GetColor(i)->G);
+    }
+}
+
+// ========== Edge Cases ==========
+
+void TestParticleSplatter::TestEdgeCases() {
+    ParticleSystem system;
+    auto emitter = system.CreateEmitter(Capacity(4));
+    AddParticle(*emitter, Vector3D(100, 100, 1), 2.0f, Vector3D(1, 1, 1), 1.0f);  // Off screen
+    AddParticle(*emitter, Vector3D(5, 5, 1), 2.0f, Vector3D(1, 1, 1), 0.0f);      // Transparent
+
+    TestView view;
+    ParticleSplatter splatter(&system);
+    splatter.Splat(&view.camera);
+    TEST_ASSERT_EQUAL(0, static_cast<int>(splatter.GetVisibleParticleCount()));
+    TEST_ASSERT_EQUAL_UINT8(0, view.At(5, 5).R);
+
+    // Null camera and 2D cameras are ignored.
+    splatter.Splat(nullptr);
+    splatter.Render(nullptr, nullptr);
+    Transform transform;
+    Camera flat(&transform, &view.pixels);
+    splatter.Splat(&flat);
+    TEST_ASSERT_EQUAL(0, static_cast<int>(splatter.GetVisibleParticleCount()));
+
+    // Tiny particles still reach the nearest pixel through the minimum radius.
+    AddParticle(*emitter, Vector3D(7, 7, 1), 0.01f, Vector3D(1, 1, 1), 1.0f);
+    splatter.Splat(&view.camera);
+    TEST_ASSERT_EQUAL_UINT8(255, view.At(7, 7).R);
+    splatter.SetMinimumRadius(-1.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, splatter.GetMinimumRadius());
+}
+
+// ========== Test Runner ==========
+
+void TestParticleSplatter::RunAllTests() {
+    RUN_TEST(TestDefaultConstructor);
+    RUN_TEST(TestAdditiveSplat);
+    RUN_TEST(TestAdditiveAccumulates);
+    RUN_TEST(TestAlphaBlendOrder);
+    RUN_TEST(TestDepthOcclusion);
+    RUN_TEST(TestMatchesReference);
+    RUN_TEST(TestEdgeCases);
+}
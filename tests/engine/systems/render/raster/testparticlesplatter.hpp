@@ -0,0 +1,45 @@
+/**
+ * @file testparticlesplatter.hpp
+ * @brief Unit tests for the ParticleSplatter class.
+ *
+ * Covers projection, tile binning, both blend modes and depth occlusion.
+ *
+ * @date 18/10/2026
+ * @version 1.0
+ * @author Coela
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <ptx/systems/render/raster/particlesplatter.hpp>
+#include <ptx/systems/render/core/camera.hpp>
+#include <ptx/systems/render/core/pixelgroup.hpp>
+#include <utils/testhelpers.hpp>
+
+/**
+ * @class TestParticleSplatter
+ * @brief Contains static test methods for the ParticleSplatter class.
+ */
+class TestParticleSplatter {
+public:
+    // Constructor & lifecycle tests
+    static void TestDefaultConstructor();
+
+    // Method tests
+    static void TestAdditiveSplat();
+    static void TestAdditiveAccumulates();
+    static void TestAlphaBlendOrder();
+    static void TestDepthOcclusion();
+
+    // Functionality tests
+    static void TestMatchesReference();
+
+    // Edge case & integration tests
+    static void TestEdgeCases();
+
+    /**
+     * @brief Runs all test methods.
+     */
+    static void RunAllTests();
+};
@@ -4,6 +4,14 @@
  */
 
 #include "testrasterizer.hpp"
+#include <ptx/assets/model/statictrianglegroup.hpp>
+#include <ptx/assets/model/trianglegroup.hpp>
+#include <ptx/systems/render/core/camera.hpp>
+#include <ptx/systems/render/core/pixelgroup.hpp>
+#include <ptx/systems/render/material/implementations/uniformcolormaterial.hpp>
+#include <ptx/systems/scene/deform/blendshape.hpp>
+#include <ptx/systems/scene/deform/trianglegroupdeformer.hpp>
+#include <limits>
 
 // ========== Constructor Tests ==========
 
@@ -17,6 +25,209 @@ void TestRasterizer::TestDefaultConstructor() {
     TEST_ASSERT_TRUE(true);
 }
 
+// ========== Functionality Tests ==========
+
+void TestRasterizer::TestScratchReuse() {
+    Vector3D vertices[3] = {Vector3D(-2, -2, 4), Vector3D(5, -2, 4), Vector3D(-2, 5, 4)};
+    IndexGroup indices[1] = {IndexGroup(0, 1, 2)};
+    StaticTriangleGroup source(vertices, indices, 3, 1);
+    TriangleGroup triangles(&source);
+    UniformColorMaterial material(RGBColor(0, 0, 255));
+    Mesh mesh(&source, &triangles, &material);
+    Scene scene(1);
+    scene.AddMesh(&mesh);
+
+    Transform transform;
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    PixelGroup pixelGroup(16, Vector2D(4, 4), Vector2D(0, 0), 4);
+    Camera camera(&transform, &layout, &pixelGroup);
+
+    float depth[16];
+    Rasterizer::Scratch scratch;
+    Rasterizer::PrepareCamera(&camera);
+    Rasterizer::Rasterize(&scene, &camera, depth, &scratch);
+    TEST_ASSERT_EQUAL_size_t(1, scratch.triangles.size());
+    TEST_ASSERT_EQUAL_UINT8(255, pixelGroup.GetColor(0)->B);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 4.0f, depth[0]);
+
+    // A second render reuses the storage instead of growing it.
+    const RasterTriangle2D* storage = scratch.triangles.data();
+    *pixelGroup.GetColor(0) = RGBColor(0, 0, 0);
+    Rasterizer::Rasterize(&scene, &camera, depth, &scratch);
+    TEST_ASSERT_EQUAL_size_t(1, scratch.triangles.size());
+    TEST_ASSERT_TRUE(storage == scratch.triangles.data());
+    TEST_ASSERT_EQUAL_UINT8(255, pixelGroup.GetColor(0)->B);
+
+    // Pixels outside the triangle keep the far depth.
+    TEST_ASSERT_TRUE(depth[15] == std::numeric_limits<float>::max());
+}
+
+void TestRasterizer::TestVertexCache() {
+    // A quad: four shared vertices, two triangles.
+    Vector3D vertices[4] = {Vector3D(-2, -2, 4), Vector3D(5, -2, 4), Vector3D(5, 5, 4), Vector3D(-2, 5, 4)};
+    IndexGroup indices[2] = {IndexGroup(0, 1, 2), IndexGroup(0, 2, 3)};
+    StaticTriangleGroup source(vertices, indices, 4, 2);
+    TriangleGroup triangles(&source);
+    UniformColorMaterial material(RGBColor(0, 0, 255));
+    Mesh mesh(&source, &triangles, &material);
+    Scene scene(1);
+    scene.AddMesh(&mesh);
+
+    Transform transform;
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    PixelGroup pixelGroup(16, Vector2D(4, 4), Vector2D(0, 0), 4);
+    Camera camera(&transform, &layout, &pixelGroup);
+
+    float depth[16];
+    Rasterizer::Scratch scratch;
+    Rasterizer::PrepareCamera(&camera);
+    Rasterizer::Rasterize(&scene, &camera, depth, &scratch);
+
+    // Each vertex is projected once, not once per triangle corner.
+    TEST_ASSERT_EQUAL_size_t(4, scratch.screenX.size());
+    TEST_ASSERT_EQUAL_size_t(2, scratch.triangles.size());
+    TEST_ASSERT_EQUAL_size_t(2, scratch.normals.size());
+
+    // Cached setup matches projecting the triangle directly.
+    Quaternion lookDirection = transform.GetRotation().Multiply(camera.GetLookOffset());
+    const Vector3D* cornerPtrs = triangles.GetVertices();
+    RasterTriangle3D corners(&cornerPtrs[0], &cornerPtrs[2], &cornerPtrs[3]);
+    RasterTriangle2D direct(transform, lookDirection, corners, &material);
+    const RasterTriangle2D& cached = scratch.triangles[1];
+    TEST_ASSERT_EQUAL_FLOAT(direct.p1.X, cached.p1.X);
+    TEST_ASSERT_EQUAL_FLOAT(direct.p2.Y, cached.p2.Y);
+    TEST_ASSERT_EQUAL_FLOAT(direct.p3.X, cached.p3.X);
+    TEST_ASSERT_EQUAL_FLOAT(direct.averageDepth, cached.averageDepth);
+    TEST_ASSERT_TRUE(cached.normal == &scratch.normals[1]);
+    TEST_ASSERT_TRUE(cached.t3p2 == &cornerPtrs[2]);
+    TEST_ASSERT_EQUAL_UINT8(255, pixelGroup.GetColor(0)->B);
+
+    // Moving the mesh moves what is drawn: the cache reads the transformed vertices.
+    mesh.GetTransform()->SetPosition(Vector3D(100, 0, 0));
+    mesh.ResetVertices();
+    mesh.UpdateTransform();
+    Rasterizer::Rasterize(&scene, &camera, depth, &scratch);
+    TEST_ASSERT_EQUAL_UINT8(0, pixelGroup.GetColor(0)->B);
+    TEST_ASSERT_TRUE(depth[0] == std::numeric_limits<float>::max());
+}
+
+void TestRasterizer::TestMeshCulling() {
+    Vector3D vertices[3] = {Vector3D(-2, -2, 4), Vector3D(5, -2, 4), Vector3D(-2, 5, 4)};
+    IndexGroup indices[1] = {IndexGroup(0, 1, 2)};
+    StaticTriangleGroup source(vertices, indices, 3, 1);
+    TriangleGroup visibleTriangles(&source);
+    TriangleGroup hiddenTriangles(&source);
+    UniformColorMaterial material(RGBColor(0, 0, 255));
+    Mesh visible(&source, &visibleTriangles, &material);
+    Mesh hidden(&source, &hiddenTriangles, &material);
+    Scene scene(2);
+    scene.AddMesh(&visible);
+    scene.AddMesh(&hidden);
+
+    Transform transform;
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    PixelGroup pixelGroup(16, Vector2D(4, 4), Vector2D(0, 0), 4);
+    Camera camera(&transform, &layout, &pixelGroup);
+
+    Rasterizer::Scratch scratch;
+    Rasterizer::PrepareCamera(&camera);
+
+    // Without bounds both meshes are drawn.
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(2, scratch.stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(0, scratch.stats.meshesCulled);
+
+    // Moved far off to the side, the second mesh is rejected before triangle setup.
+    visible.UpdateTransform();
+    hidden.GetTransform()->SetPosition(Vector3D(100, 0, 0));
+    hidden.ResetVertices();
+    hidden.UpdateTransform();
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(1, scratch.stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(1, scratch.stats.meshesCulled);
+    TEST_ASSERT_EQUAL_size_t(1, scratch.triangles.size());
+    TEST_ASSERT_EQUAL_UINT8(255, pixelGroup.GetColor(0)->B);
+
+    // Partially overlapping the camera still draws.
+    hidden.GetTransform()->SetPosition(Vector3D(1, 0, 0));
+    hidden.ResetVertices();
+    hidden.UpdateTransform();
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(2, scratch.stats.meshesDrawn);
+
+    // Everything culled still clears the frame, as drawing nothing would.
+    visible.GetTransform()->SetPosition(Vector3D(-100, 0, 0));
+    visible.ResetVertices();
+    visible.UpdateTransform();
+    hidden.GetTransform()->SetPosition(Vector3D(100, 0, 0));
+    hidden.ResetVertices();
+    hidden.UpdateTransform();
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(0, scratch.stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(2, scratch.stats.meshesCulled);
+    TEST_ASSERT_EQUAL_UINT8(0, pixelGroup.GetColor(0)->B);
+
+    // Disabled meshes are not counted.
+    visible.Disable();
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(1, scratch.stats.meshesCulled);
+}
+
+void TestRasterizer::TestCullingAfterDeform() {
+    Vector3D vertices[3] = {Vector3D(-2, -2, 4), Vector3D(5, -2, 4), Vector3D(-2, 5, 4)};
+    IndexGroup indices[1] = {IndexGroup(0, 1, 2)};
+    StaticTriangleGroup source(vertices, indices, 3, 1);
+    TriangleGroup triangles(&source);
+    UniformColorMaterial material(RGBColor(0, 0, 255));
+    Mesh mesh(&source, &triangles, &material);
+    Scene scene(1);
+    scene.AddMesh(&mesh);
+
+    Transform transform;
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    PixelGroup pixelGroup(16, Vector2D(4, 4), Vector2D(0, 0), 4);
+    Camera camera(&transform, &layout, &pixelGroup);
+
+    Rasterizer::Scratch scratch;
+    Rasterizer::PrepareCamera(&camera);
+
+    // Off to the side after the transform: culled.
+    mesh.GetTransform()->SetPosition(Vector3D(100, 0, 0));
+    mesh.ResetVertices();
+    mesh.UpdateTransform();
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(1, scratch.stats.meshesCulled);
+
+    // A blendshape applied after the transform moves it back on screen; the stale bounds
+    // must not hide it.
+    int morphIndexes[3] = {0, 1, 2};
+    Vector3D morphOffsets[3] = {Vector3D(-100, 0, 0), Vector3D(-100, 0, 0), Vector3D(-100, 0, 0)};
+    Blendshape morph(3, morphIndexes, morphOffsets);
+    morph.Weight = 1.0f;
+    morph.BlendObject3D(&triangles);
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(1, scratch.stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(0, scratch.stats.meshesCulled);
+    TEST_ASSERT_EQUAL_UINT8(255, pixelGroup.GetColor(0)->B);
+
+    // Same for a deformer pass.
+    *pixelGroup.GetColor(0) = RGBColor(0, 0, 0);
+    mesh.ResetVertices();
+    mesh.UpdateTransform();
+    float shift[3] = {-100.0f, -100.0f, -100.0f};
+    TriangleGroupDeformer deformer(&triangles);
+    deformer.CosineInterpolationDeformer(shift, 2, 1.0f, -1000.0f, 1000.0f, TriangleGroupDeformer::YAxis, TriangleGroupDeformer::XAxis);
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(1, scratch.stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT8(255, pixelGroup.GetColor(0)->B);
+
+    // Refreshing the bounds makes the mesh cullable again.
+    mesh.UpdateBounds();
+    Rasterizer::Rasterize(&scene, &camera, nullptr, &scratch);
+    TEST_ASSERT_EQUAL_UINT32(1, scratch.stats.meshesDrawn);
+    TEST_ASSERT_EQUAL_UINT32(0, scratch.stats.meshesCulled);
+}
+
 // ========== Edge Cases ==========
 
 // ========== Test Runner ==========
@@ -24,7 +235,7 @@ void TestRasterizer::TestDefaultConstructor() {
 void TestRasterizer::TestParameterizedConstructor() {
     // Rasterizer has no constructors - test with valid minimal parameters
 
-    Scene scene;
+    Scene scene(1);
     Transform transform;
     PixelGroup pixelGroup(4, Vector2D(20.0f, 20.0f), Vector2D(0.0f, 0.0f), 2);
     Camera camera(&transform, &pixelGroup);
@@ -37,7 +248,7 @@ void TestRasterizer::TestParameterizedConstructor() {
 
 void TestRasterizer::TestEdgeCases() {
     // Test with valid scene but nullptr camera
-    Scene scene;
+    Scene scene(1);
     Rasterizer::Rasterize(&scene, nullptr);
 
     // Test with nullptr scene but valid camera
@@ -53,5 +264,9 @@ void TestRasterizer::TestEdgeCases() {
 void TestRasterizer::RunAllTests() {
     RUN_TEST(TestDefaultConstructor);
     RUN_TEST(TestParameterizedConstructor);
+    RUN_TEST(TestScratchReuse);
+    RUN_TEST(TestVertexCache);
+    RUN_TEST(TestMeshCulling);
+    RUN_TEST(TestCullingAfterDeform);
     RUN_TEST(TestEdgeCases);
 }
@@ -26,6 +26,10 @@ public:
     static void TestParameterizedConstructor();
 
     // Functionality tests
+    static void TestScratchReuse();
+    static void TestVertexCache();
+    static void TestMeshCulling();
+    static void TestCullingAfterDeform();
 
     // Edge case & integration tests
     static void TestEdgeCases();
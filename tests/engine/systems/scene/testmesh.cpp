@@ -4,6 +4,8 @@
  */
 
 #include "testmesh.hpp"
+#include <ptx/assets/model/statictrianglegroup.hpp>
+#include <ptx/assets/model/trianglegroup.hpp>
 
 // ========== Constructor Tests ==========
 
@@ -102,9 +104,60 @@ void TestMesh::TestSetTransform() {
 }
 
 void TestMesh::TestUpdateTransform() {
-    // TODO: Implement test for UpdateTransform()
-    // Mesh obj; // Requires constructor parameters
-    TEST_ASSERT_TRUE(false);  // Not implemented
+    Vector3D vertices[3] = {Vector3D(0, 0, 0), Vector3D(2, 0, 1), Vector3D(0, 3, -1)};
+    IndexGroup indices[1] = {IndexGroup(0, 1, 2)};
+    StaticTriangleGroup source(vertices, indices, 3, 1);
+    TriangleGroup triangles(&source);
+    Mesh mesh(&source, &triangles, nullptr);
+
+    mesh.GetTransform()->SetPosition(Vector3D(10, 20, 30));
+    mesh.ResetVertices();
+    mesh.UpdateTransform();
+
+    TEST_ASSERT_EQUAL_FLOAT(12.0f, triangles.GetVertices()[1].X);
+    TEST_ASSERT_EQUAL_FLOAT(23.0f, triangles.GetVertices()[2].Y);
+
+    // Bounds are grown in the same pass.
+    Vector3D minimum, maximum;
+    TEST_ASSERT_TRUE(mesh.GetWorldBounds(minimum, maximum));
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, minimum.X);
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, minimum.Y);
+    TEST_ASSERT_EQUAL_FLOAT(29.0f, minimum.Z);
+    TEST_ASSERT_EQUAL_FLOAT(12.0f, maximum.X);
+    TEST_ASSERT_EQUAL_FLOAT(23.0f, maximum.Y);
+    TEST_ASSERT_EQUAL_FLOAT(31.0f, maximum.Z);
+}
+
+void TestMesh::TestGetWorldBounds() {
+    Vector3D vertices[3] = {Vector3D(-1, 0, 0), Vector3D(1, 0, 0), Vector3D(0, 5, 0)};
+    IndexGroup indices[1] = {IndexGroup(0, 1, 2)};
+    StaticTriangleGroup source(vertices, indices, 3, 1);
+    TriangleGroup triangles(&source);
+    Mesh mesh(&source, &triangles, nullptr);
+
+    // Unknown until the first update.
+    Vector3D minimum, maximum;
+    TEST_ASSERT_FALSE(mesh.GetWorldBounds(minimum, maximum));
+
+    mesh.UpdateBounds();
+    TEST_ASSERT_TRUE(mesh.GetWorldBounds(minimum, maximum));
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, minimum.X);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, maximum.Y);
+
+    // Resetting the vertices invalidates the bounds until the next update.
+    mesh.ResetVertices();
+    TEST_ASSERT_FALSE(mesh.GetWorldBounds(minimum, maximum));
+
+    // So does any in-place write reported through the triangle group.
+    mesh.UpdateTransform();
+    TEST_ASSERT_TRUE(mesh.GetWorldBounds(minimum, maximum));
+    triangles.GetVertices()[2].Y = 50.0f;
+    triangles.MarkVerticesChanged();
+    TEST_ASSERT_FALSE(mesh.GetWorldBounds(minimum, maximum));
+
+    mesh.UpdateBounds();
+    TEST_ASSERT_TRUE(mesh.GetWorldBounds(minimum, maximum));
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, maximum.Y);
 }
 
 void TestMesh::RunAllTests() {
@@ -127,4 +180,5 @@ void TestMesh::RunAllTests() {
     RUN_TEST(TestSetMaterial);
     RUN_TEST(TestSetTransform);
     RUN_TEST(TestUpdateTransform);
+    RUN_TEST(TestGetWorldBounds);
 }
@@ -52,5 +52,6 @@ public:
     static void TestSetMaterial();
     static void TestSetTransform();
     static void TestUpdateTransform();
+    static void TestGetWorldBounds();
     static void RunAllTests();
 };
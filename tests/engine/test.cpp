@@ -25,6 +25,9 @@
 #include "core/math/testvector2d.hpp"
 #include "core/math/testvector3d.hpp"
 #include "core/math/testyawpitchroll.hpp"
+#include "core/platform/testrandomstream.hpp"
+#include "core/platform/testspscring.hpp"
+#include "core/platform/testtriplebuffer.hpp"
 #include "core/platform/testustring.hpp"
 #include "core/signal/filter/testderivativefilter.hpp"
 #include "core/signal/filter/testfftfilter.hpp"
@@ -41,11 +44,27 @@
 #include "core/signal/testfft.hpp"
 #include "core/signal/testfftvoicedetection.hpp"
 #include "core/signal/testfunctiongenerator.hpp"
+#include "core/signal/teststft.hpp"
+#include "core/signal/testaudioanalyzer.hpp"
+#include "core/time/testframepacer.hpp"
 #include "core/time/testtimestep.hpp"
 #include "core/time/testwait.hpp"
+#include "debug/testprofiler.hpp"
+#include "platform/ipc/testptxdelta.hpp"
+#include "platform/ipc/testptxshm.hpp"
+#include "platform/ipc/testptxshmreader.hpp"
+#include "project/testproject.hpp"
+#include "resources/testresourcemanager.hpp"
 #include "systems/hardware/testvirtualcontroller.hpp"
+#include "systems/particles/testparticleaffector.hpp"
+#include "systems/particles/testparticleemitter.hpp"
+#include "systems/particles/testparticlepool.hpp"
+#include "systems/particles/testparticlesystem.hpp"
 #include "systems/physics/testboundarymotionsimulator.hpp"
+#include "systems/physics/testcollisionmanager.hpp"
+#include "systems/physics/testcontactcache.hpp"
 #include "systems/physics/testphysicssimulator.hpp"
+#include "systems/physics/testphysicsworld.hpp"
 #include "systems/physics/testvectorfield2d.hpp"
 #include "systems/render/core/testcamera.hpp"
 #include "systems/render/core/testcameralayout.hpp"
@@ -69,8 +88,10 @@
 #include "systems/render/post/effects/testhorizontalblur.hpp"
 #include "systems/render/post/effects/testmagnet.hpp"
 #include "systems/render/post/testcompositor.hpp"
+#include "systems/render/engine/testrenderingengine.hpp"
 #include "systems/render/raster/helpers/testrastertriangle2d.hpp"
 #include "systems/render/raster/helpers/testrastertriangle3d.hpp"
+#include "systems/render/raster/testparticlesplatter.hpp"
 #include "systems/render/raster/testrasterizer.hpp"
 #include "systems/render/ray/testraytracer.hpp"
 #include "systems/render/shader/implementations/testaudioreactiveparams.hpp"
@@ -152,6 +173,9 @@ int main(int /*argc*/, char ** /*argv*/) {
     TestVector2D::RunAllTests();
     TestVector3D::RunAllTests();
     TestYawPitchRoll::RunAllTests();
+    TestRandomStream::RunAllTests();
+    TestSPSCRing::RunAllTests();
+    TestTripleBuffer::RunAllTests();
     TestUString::RunAllTests();
     TestDerivativeFilter::RunAllTests();
     TestFFTFilter::RunAllTests();
@@ -168,11 +192,27 @@ int main(int /*argc*/, char ** /*argv*/) {
     TestFFT::RunAllTests();
     TestFFTVoiceDetection::RunAllTests();
     TestFunctionGenerator::RunAllTests();
+    TestSTFT::RunAllTests();
+    TestAudioAnalyzer::RunAllTests();
+    TestFramePacer::RunAllTests();
     TestTimeStep::RunAllTests();
     TestWait::RunAllTests();
+    TestProfiler::RunAllTests();
+    TestPTXDelta::RunAllTests();
+    TestPTXShm::RunAllTests();
+    TestPTXShmReader::RunAllTests();
+    TestProject::RunAllTests();
+    TestResourceManager::RunAllTests();
     TestVirtualController::RunAllTests();
+    TestParticleAffector::RunAllTests();
+    TestParticleEmitter::RunAllTests();
+    TestParticlePool::RunAllTests();
+    TestParticleSystem::RunAllTests();
     TestBoundaryMotionSimulator::RunAllTests();
+    TestCollisionManager::RunAllTests();
+    TestContactCache::RunAllTests();
     TestPhysicsSimulator::RunAllTests();
+    TestPhysicsWorld::RunAllTests();
     TestVectorField2D::RunAllTests();
     TestCamera::RunAllTests();
     TestCameraLayout::RunAllTests();
@@ -196,8 +236,10 @@ int main(int /*argc*/, char ** /*argv*/) {
     TestHorizontalBlur::RunAllTests();
     TestMagnet::RunAllTests();
     TestCompositor::RunAllTests();
+    TestRenderingEngine::RunAllTests();
     TestRasterTriangle2D::RunAllTests();
     TestRasterTriangle3D::RunAllTests();
+    TestParticleSplatter::RunAllTests();
     TestRasterizer::RunAllTests();
     TestRayTracer::RunAllTests();
     TestAudioReactiveParams::RunAllTests();